@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -311,11 +311,20 @@ private:
  * The postfix *_bf16 is for the memory layout needed for the
  * fast-mode kernels, in which the weights are passed in bfloat16
  * format.
+ *
+ * * SPARSE_2_4 is a hint that the weights follow a 2:4 structured
+ *   sparsity pattern (at most two non-zero values in every group of
+ *   four consecutive input channels). The weights are passed in the
+ *   same layout as for UNSPECIFIED; the library compresses them into
+ *   the kept values plus, for each value, a byte holding its offset
+ *   inside the group when the weights are prepared, and falls back to
+ *   dense computation if the pattern does not hold.
  */
 enum class WeightFormat
 {
     UNSPECIFIED    = 0x1,
     ANY            = 0x2,
+    SPARSE_2_4     = 0x4,
     OHWI           = 0x100100,
     OHWIo2         = 0x100200,
     OHWIo4         = 0x100400,
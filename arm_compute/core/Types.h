@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1661,9 +1661,13 @@ inline int block_by(const WeightFormat wf)
 {
     return (static_cast<int>(wf) >> 20) & 0xF;
 }
+inline bool is_sparse_format(const WeightFormat &wf)
+{
+    return wf == WeightFormat::SPARSE_2_4;
+}
 inline bool is_fixed_format(const WeightFormat &wf)
 {
-    return wf != WeightFormat::UNSPECIFIED && wf != WeightFormat::ANY;
+    return wf != WeightFormat::UNSPECIFIED && wf != WeightFormat::ANY && !is_sparse_format(wf);
 }
 inline bool is_fixed_format_fast_math(const WeightFormat &wf)
 {
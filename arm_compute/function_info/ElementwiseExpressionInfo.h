@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEEXPRESSIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEEXPRESSIONINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+/** Operations available in an @ref ElementwiseExpressionInfo */
+enum class ElementwiseExpressionOp
+{
+    Input,       /**< Element of one of the expression inputs */
+    Add,         /**< (x + y) */
+    Sub,         /**< (x - y) */
+    Mul,         /**< (x * y) */
+    Div,         /**< (x / y) */
+    Min,         /**< Min(x, y) */
+    Max,         /**< Max(x, y) */
+    SquaredDiff, /**< (x - y)^2 */
+    Prelu,       /**< y*x if x < 0, x otherwise */
+    Unary,       /**< One of the @ref ElementWiseUnary operations applied to x */
+    Activation   /**< Activation function applied to x */
+};
+
+/** Single operation of an @ref ElementwiseExpressionInfo */
+struct ElementwiseExpressionNode
+{
+    /** Operation computed by the node */
+    ElementwiseExpressionOp op{ElementwiseExpressionOp::Input};
+    /** Input index for @ref ElementwiseExpressionOp::Input, index of the first operand node otherwise */
+    unsigned int lhs{0};
+    /** Index of the second operand node of binary operations */
+    unsigned int rhs{0};
+    /** Operation of @ref ElementwiseExpressionOp::Unary nodes */
+    ElementWiseUnary unary_op{ElementWiseUnary::EXP};
+    /** Activation of @ref ElementwiseExpressionOp::Activation nodes */
+    ActivationLayerInfo act_info{};
+};
+
+/** Class for holding a small DAG of elementwise operations evaluated in a single pass over memory
+ *
+ * Nodes are appended in topological order: every operand refers to a node created earlier, so the list can be
+ * evaluated front to back. The last node created is the result of the expression.
+ *
+ * For example, ((a + b) * c) followed by a RELU is built as:
+ * @code
+ * ElementwiseExpressionInfo expr;
+ * const unsigned int a   = expr.input(0);
+ * const unsigned int b   = expr.input(1);
+ * const unsigned int c   = expr.input(2);
+ * const unsigned int sum = expr.binary(ElementwiseExpressionOp::Add, a, b);
+ * const unsigned int mul = expr.binary(ElementwiseExpressionOp::Mul, sum, c);
+ * expr.activation(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU), mul);
+ * @endcode
+ */
+class ElementwiseExpressionInfo
+{
+public:
+    /** Maximum number of nodes of an expression, including the inputs */
+    static constexpr unsigned int max_num_nodes = 16;
+    /** Maximum number of tensors read by an expression */
+    static constexpr unsigned int max_num_inputs = 8;
+
+    /** Default constructor */
+    ElementwiseExpressionInfo() = default;
+    /** Append a node reading one of the expression inputs
+     *
+     * @param[in] idx Index of the input tensor. The same input can be read by several nodes.
+     *
+     * @return the index of the new node
+     */
+    unsigned int input(unsigned int idx)
+    {
+        ARM_COMPUTE_ERROR_ON(idx >= max_num_inputs);
+        ElementwiseExpressionNode node{};
+        node.op     = ElementwiseExpressionOp::Input;
+        node.lhs    = idx;
+        _num_inputs = std::max(_num_inputs, idx + 1);
+        return append(node);
+    }
+    /** Append a binary operation node
+     *
+     * @param[in] op  Binary operation. Must not be @ref ElementwiseExpressionOp::Input, Unary or Activation.
+     * @param[in] lhs Index of the node holding the first operand.
+     * @param[in] rhs Index of the node holding the second operand.
+     *
+     * @return the index of the new node
+     */
+    unsigned int binary(ElementwiseExpressionOp op, unsigned int lhs, unsigned int rhs)
+    {
+        ARM_COMPUTE_ERROR_ON(op == ElementwiseExpressionOp::Input || op == ElementwiseExpressionOp::Unary ||
+                             op == ElementwiseExpressionOp::Activation);
+        ARM_COMPUTE_ERROR_ON(lhs >= _nodes.size() || rhs >= _nodes.size());
+        ElementwiseExpressionNode node{};
+        node.op  = op;
+        node.lhs = lhs;
+        node.rhs = rhs;
+        return append(node);
+    }
+    /** Append a unary operation node
+     *
+     * @param[in] op  Unary operation. Supported: RSQRT/EXP/NEG/LOG/ABS/SIN.
+     * @param[in] src Index of the node holding the operand.
+     *
+     * @return the index of the new node
+     */
+    unsigned int unary(ElementWiseUnary op, unsigned int src)
+    {
+        ARM_COMPUTE_ERROR_ON(src >= _nodes.size());
+        ElementwiseExpressionNode node{};
+        node.op       = ElementwiseExpressionOp::Unary;
+        node.lhs      = src;
+        node.unary_op = op;
+        return append(node);
+    }
+    /** Append an activation node
+     *
+     * @param[in] act_info Activation layer information.
+     * @param[in] src      Index of the node holding the operand.
+     *
+     * @return the index of the new node
+     */
+    unsigned int activation(const ActivationLayerInfo &act_info, unsigned int src)
+    {
+        ARM_COMPUTE_ERROR_ON(src >= _nodes.size());
+        ElementwiseExpressionNode node{};
+        node.op       = ElementwiseExpressionOp::Activation;
+        node.lhs      = src;
+        node.act_info = act_info;
+        return append(node);
+    }
+    /* Get the nodes in evaluation order. The last one is the result of the expression */
+    const std::vector<ElementwiseExpressionNode> &nodes() const
+    {
+        return _nodes;
+    }
+    /* Get the number of input tensors read by the expression */
+    unsigned int num_inputs() const
+    {
+        return _num_inputs;
+    }
+
+private:
+    unsigned int append(const ElementwiseExpressionNode &node)
+    {
+        _nodes.push_back(node);
+        return static_cast<unsigned int>(_nodes.size() - 1);
+    }
+
+    std::vector<ElementwiseExpressionNode> _nodes{};
+    unsigned int                           _num_inputs{0};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEEXPRESSIONINFO_H
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_EMBEDDINGBAGINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_EMBEDDINGBAGINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Pooling applied to the rows gathered for a bag */
+enum class EmbeddingBagMode
+{
+    Sum, /**< Sum of the rows of the bag */
+    Mean /**< Sum of the rows of the bag divided by the number of indices in the bag */
+};
+
+/** Embedding bag operator information */
+struct EmbeddingBagInfo
+{
+    /** Constructor
+     *
+     * @param[in] m (Optional) Pooling applied to every bag. Defaults to @ref EmbeddingBagMode::Sum.
+     */
+    EmbeddingBagInfo(EmbeddingBagMode m = EmbeddingBagMode::Sum) : mode(m)
+    {
+    }
+    EmbeddingBagMode mode{EmbeddingBagMode::Sum}; /**< Pooling applied to every bag */
+};
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_EMBEDDINGBAGINFO_H
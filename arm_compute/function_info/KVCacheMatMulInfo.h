@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_KVCACHEMATMULINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_KVCACHEMATMULINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Which half of an attention key/value cache a @ref KVCacheMatMulInfo refers to */
+enum class KVCacheOperand
+{
+    Key,  /**< dst[t] = scale * dot(lhs, key[t]) for every cached token t */
+    Value /**< dst = sum over cached tokens t of lhs[t] * value[t] */
+};
+
+/** Class for holding information related to a matrix multiplication against an appendable key/value cache
+ */
+class KVCacheMatMulInfo
+{
+public:
+    /** Default constructor */
+    KVCacheMatMulInfo() = default;
+    /** Constructor
+     *
+     * @param[in] operand    Whether the cache holds keys or values.
+     * @param[in] head_dim   Length of each cached row.
+     * @param[in] max_length Maximum number of rows the cache can hold.
+     * @param[in] scale      (Optional) Scale applied to the result. Only used for @ref KVCacheOperand::Key.
+     */
+    KVCacheMatMulInfo(KVCacheOperand operand, unsigned int head_dim, unsigned int max_length, float scale = 1.f)
+        : _operand(operand), _head_dim(head_dim), _max_length(max_length), _scale(scale)
+    {
+    }
+    /* Get the cache operand */
+    KVCacheOperand operand() const
+    {
+        return _operand;
+    }
+    /* Get the length of each cached row */
+    unsigned int head_dim() const
+    {
+        return _head_dim;
+    }
+    /* Get the maximum number of cached rows */
+    unsigned int max_length() const
+    {
+        return _max_length;
+    }
+    /* Get the output scale */
+    float scale() const
+    {
+        return _scale;
+    }
+
+private:
+    KVCacheOperand _operand{KVCacheOperand::Key};
+    unsigned int   _head_dim{0};
+    unsigned int   _max_length{0};
+    float          _scale{1.f};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_KVCACHEMATMULINFO_H
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_LAYERNORMALIZATIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_LAYERNORMALIZATIONINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Normalization computed by a layer normalization operator */
+enum class LayerNormalizationType
+{
+    LayerNorm, /**< (x - mean(x)) / sqrt(var(x) + epsilon) */
+    RMSNorm    /**< x / sqrt(mean(x^2) + epsilon) */
+};
+
+/** Layer normalization operator information */
+struct LayerNormalizationInfo
+{
+    /** Constructor
+     *
+     * @param[in] t   (Optional) Normalization to compute. Defaults to @ref LayerNormalizationType::LayerNorm.
+     * @param[in] eps (Optional) Small value added to the variance to avoid division by zero. Defaults to 1e-5.
+     */
+    LayerNormalizationInfo(LayerNormalizationType t = LayerNormalizationType::LayerNorm, float eps = 1e-5f)
+        : type(t), epsilon(eps)
+    {
+    }
+    LayerNormalizationType type{LayerNormalizationType::LayerNorm}; /**< Normalization to compute */
+    float                  epsilon{1e-5f};                          /**< Small value added to the variance */
+};
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_LAYERNORMALIZATIONINFO_H
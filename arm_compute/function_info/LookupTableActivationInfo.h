@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_LOOKUPTABLEACTIVATIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_LOOKUPTABLEACTIVATIONINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <functional>
+#include <utility>
+
+namespace arm_compute
+{
+/** Lookup table activation information
+ *
+ * Holds an arbitrary scalar function, for example GELU with the tanh approximation, SiLU, Mish or a custom function.
+ * The function is evaluated in single precision once for every value representable in the data type of the tensors
+ * when the operator is configured, and only read from the resulting table when the operator runs.
+ */
+class LookupTableActivationInfo
+{
+public:
+    /** Scalar function applied to every element */
+    using Function = std::function<float(float)>;
+
+    /** Default constructor: no function is set */
+    LookupTableActivationInfo() = default;
+    /** Constructor
+     *
+     * @param[in] func Scalar function applied to every element. It must not depend on any state that changes after the
+     *                 operator is configured.
+     */
+    LookupTableActivationInfo(Function func) : _function(std::move(func))
+    {
+    }
+    /** Get the scalar function applied to every element */
+    const Function &function() const
+    {
+        return _function;
+    }
+    /** Check if a function is set */
+    bool enabled() const
+    {
+        return static_cast<bool>(_function);
+    }
+
+private:
+    Function _function{};
+};
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_LOOKUPTABLEACTIVATIONINFO_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,14 +33,18 @@
 
 namespace arm_compute
 {
-/** Scatter Function */
+/** Scatter Function
+ *
+ * Updates sharing the same index are reduced into the output in the order they appear in the updates tensor.
+ */
 enum class ScatterFunction
 {
     Update = 0,
     Add    = 1,
     Sub    = 2,
     Max    = 3,
-    Min    = 4
+    Min    = 4,
+    Mul    = 5 /**< Only supported on CPU */
 };
 /** Scatter operator information */
 struct ScatterInfo
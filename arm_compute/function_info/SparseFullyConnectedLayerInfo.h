@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_SPARSEFULLYCONNECTEDLAYERINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_SPARSEFULLYCONNECTEDLAYERINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+namespace arm_compute
+{
+/** Shape of the blocks a sparse weights matrix is compressed into, as (output channels)x(input channels) */
+enum class SparseBlockShape
+{
+    Block1x4, /**< 1 output channel by 4 consecutive input channels */
+    Block4x4, /**< 4 output channels by 4 consecutive input channels */
+    Block8x1  /**< 8 output channels by 1 input channel */
+};
+
+/** Sparse fully connected layer info */
+struct SparseFullyConnectedLayerInfo
+{
+    /* Fused-activation parameters */
+    ActivationLayerInfo activation_info{}; /**<  Fused activation to apply after the matrix multiplication. */
+    /* Information about weights */
+    bool transpose_weights{true}; /**<  True if the weights are [input channels, output channels] as in @ref FullyConnectedLayerInfo, false if already transposed. */
+    SparseBlockShape block_shape{SparseBlockShape::Block1x4}; /**<  Shape of the blocks the weights are compressed into. */
+    /* Other parameters */
+    float max_density{0.3f}; /**<  Run dense when the fraction of blocks holding a non-zero exceeds this value. */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_SPARSEFULLYCONNECTEDLAYERINFO_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,7 @@ public:
     void visit(DepthwiseConvolutionLayerNode &n) override;
     void visit(FusedConvolutionBatchNormalizationNode &n) override;
     void visit(FusedDepthwiseConvolutionBatchNormalizationNode &n) override;
+    void visit(FusedDepthwiseSeparableConvolutionNode &n) override;
     void visit(OutputNode &n) override;
 
     void default_visit(INode &n) override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,11 @@ public:
      * @param[in] n Node to visit.
      */
     virtual void visit(FusedDepthwiseConvolutionBatchNormalizationNode &n) = 0;
+    /** Visit FusedDepthwiseSeparableConvolutionNode.
+     *
+     * @param[in] n Node to visit.
+     */
+    virtual void visit(FusedDepthwiseSeparableConvolutionNode &n) = 0;
     /** Visit InputNode.
      *
      * @param[in] n Node to visit.
@@ -210,6 +215,7 @@ public:
     virtual void visit(FullyConnectedLayerNode &n) override;
     virtual void visit(FusedConvolutionBatchNormalizationNode &n) override;
     virtual void visit(FusedDepthwiseConvolutionBatchNormalizationNode &n) override;
+    virtual void visit(FusedDepthwiseSeparableConvolutionNode &n) override;
     virtual void visit(InputNode &n) override;
     virtual void visit(NormalizationLayerNode &n) override;
     virtual void visit(OutputNode &n) override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,6 +100,8 @@ struct GraphConfig
     int         num_threads{
         -1}; /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
+    std::string   conv_method_tuner_file{
+        "acl_conv_method_tuner.csv"}; /**< File to load/store the convolution methods selected by the CPU tuner from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
 };
@@ -175,6 +177,8 @@ enum class NodeType
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedDepthwiseSeparableConvolutionLayer,
+    FusedElementwiseExpressionLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
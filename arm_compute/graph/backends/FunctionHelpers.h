@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "arm_compute/core/ITensorInfo.h"
 #include "arm_compute/graph/backends/FusedConvolutionBatchNormalizationFunction.h"
 #include "arm_compute/graph/backends/FusedDepthwiseConvolutionBatchNormalizationFunction.h"
+#include "arm_compute/graph/backends/FusedDepthwiseSeparableConvolutionFunction.h"
 #include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/Nodes.h"
@@ -303,6 +304,70 @@ create_fused_depthwise_convolution_batch_normalization_layer(FusedDepthwiseConvo
     return func;
 }
 
+/** Create a backend fused depthwise separable convolution layer function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused depthwise separable convolution layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction>
+create_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 13 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input       = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *dwc_weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *dwc_biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *pwc_weights = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *pwc_biases  = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *dwc_mean    = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *dwc_var     = get_backing_tensor<TargetInfo>(node.input(6));
+    typename TargetInfo::TensorType *dwc_beta    = get_backing_tensor<TargetInfo>(node.input(7));
+    typename TargetInfo::TensorType *dwc_gamma   = get_backing_tensor<TargetInfo>(node.input(8));
+    typename TargetInfo::TensorType *pwc_mean    = get_backing_tensor<TargetInfo>(node.input(9));
+    typename TargetInfo::TensorType *pwc_var     = get_backing_tensor<TargetInfo>(node.input(10));
+    typename TargetInfo::TensorType *pwc_beta    = get_backing_tensor<TargetInfo>(node.input(11));
+    typename TargetInfo::TensorType *pwc_gamma   = get_backing_tensor<TargetInfo>(node.input(12));
+
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info        = node.convolution_info();
+    const unsigned int        depth_multiplier = node.depth_multiplier();
+    const ActivationLayerInfo dwc_act          = node.depthwise_activation();
+    const ActivationLayerInfo fused_act        = node.fused_activation();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = FusedDepthwiseSeparableConvolutionFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+        std::string("FusedDepthwiseSeparableConvolutionLayer"), mm, input, dwc_weights, dwc_biases, pwc_weights,
+        pwc_biases, output, dwc_mean, dwc_var, dwc_beta, dwc_gamma, node.dwc_epsilon(), pwc_mean, pwc_var, pwc_beta,
+        pwc_gamma, node.pwc_epsilon(), conv_info, depth_multiplier, dwc_act, fused_act);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape()
+                               << " Depthwise weights shape: " << dwc_weights->info()->tensor_shape()
+                               << " Pointwise weights shape: " << pwc_weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Depth multiplier: " << depth_multiplier
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+    return func;
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
@@ -423,14 +488,18 @@ std::unique_ptr<arm_compute::IFunction> create_concatenate_layer(ConcatenateLaye
  *
  * @tparam ConvolutionLayerFunctions Backend convolution functions
  * @tparam TargetInfo                Target-specific information
+ * @tparam GenericArgs               Types of the additional constructor arguments of the generic convolution function
  *
- * @param[in] node Node to create the backend function for
- * @param[in] ctx  Graph context
+ * @param[in] node         Node to create the backend function for
+ * @param[in] ctx          Graph context
+ * @param[in] generic_args Additional constructor arguments of the generic convolution function, used when the node
+ *                         leaves the convolution method to the backend
  *
  * @return Backend convolution layer function
  */
-template <typename ConvolutionLayerFunctions, typename TargetInfo>
-std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node, GraphContext &ctx)
+template <typename ConvolutionLayerFunctions, typename TargetInfo, typename... GenericArgs>
+std::unique_ptr<IFunction>
+create_convolution_layer(ConvolutionLayerNode &node, GraphContext &ctx, GenericArgs... generic_args)
 {
     validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
 
@@ -481,10 +550,11 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     }
     else
     {
-        std::tie(func, func_name) =
-            create_named_memory_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
-                std::string("GenericConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(),
-                Size2D(1U, 1U), fused_act, fast_math, num_groups);
+        auto f = std::make_unique<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(mm, generic_args...);
+        f->configure(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math,
+                     num_groups);
+        func      = std::move(f);
+        func_name = "GenericConvolutionLayer";
     }
 
     // Log info
@@ -830,6 +900,42 @@ std::unique_ptr<IFunction> create_eltwise_layer(EltwiseLayerNode &node)
     return func;
 }
 
+/** Create a backend fused elementwise expression layer function
+ *
+ * @tparam ElementwiseExpressionFunction Backend elementwise expression function
+ * @tparam TargetInfo                    Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused elementwise expression layer function
+ */
+template <typename ElementwiseExpressionFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_elementwise_expression_layer(FusedElementwiseExpressionNode &node)
+{
+    validate_node<TargetInfo>(node, node.expression().num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    std::vector<typename TargetInfo::SrcTensorType *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor<TargetInfo>(node.input(i)));
+    }
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    // Create and configure function
+    auto func = std::make_unique<ElementwiseExpressionFunction>();
+    func->configure(inputs, output, node.expression());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: "
+                                               << output->info()->data_type() << " Shape: "
+                                               << output->info()->tensor_shape() << " Num Inputs: " << inputs.size()
+                                               << " Num Operations: " << node.expression().nodes().size() << std::endl);
+
+    return func;
+}
+
 /** Create a backend unary element-wise operation layer function
  *
  * @tparam UnaryEltwiseFunctions Backend unary element-wise function
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDDEPTHWISESEPARABLECONVOLUTIONFUNCTION_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDDEPTHWISESEPARABLECONVOLUTIONFUNCTION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to first fold the optional batch normalizations into the depthwise and pointwise weights and then
+ * run the fused depthwise separable convolution with the modified weights */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedDepthwiseSeparableConvolutionFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    FusedDepthwiseSeparableConvolutionFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _separable_conv_layer(memory_manager),
+          _dwc_batch_norm_layer(),
+          _pwc_batch_norm_layer(),
+          _dwc_fused_bias(),
+          _pwc_fused_bias(),
+          _fuse_dwc(false),
+          _fuse_pwc(false),
+          _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                              while every optional dimension from 4 and above represent a batch of inputs.
+     *                              Data types supported: F16/F32.
+     * @param[in]  dwc_weights      Depthwise weights tensor. These are 3D tensors with shape [IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  dwc_bias         Depthwise biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  pwc_weights      Pointwise weights tensor. These are 4D tensors with shape [IFM, 1, 1, OFM]. Data type supported: Same as @p input.
+     * @param[in]  pwc_bias         Pointwise biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                              Data types supported: Same as @p input.
+     * @param[in]  dwc_mean         Mean values of the batch normalization folded into the depthwise weights. Nullptr if there is none.
+     * @param[in]  dwc_var          Variance values of the batch normalization folded into the depthwise weights.
+     * @param[in]  dwc_beta         Beta values of the batch normalization folded into the depthwise weights. Can be nullptr.
+     * @param[in]  dwc_gamma        Gamma values of the batch normalization folded into the depthwise weights. Can be nullptr.
+     * @param[in]  dwc_epsilon      Epsilon of the batch normalization folded into the depthwise weights.
+     * @param[in]  pwc_mean         Mean values of the batch normalization folded into the pointwise weights. Nullptr if there is none.
+     * @param[in]  pwc_var          Variance values of the batch normalization folded into the pointwise weights.
+     * @param[in]  pwc_beta         Beta values of the batch normalization folded into the pointwise weights. Can be nullptr.
+     * @param[in]  pwc_gamma        Gamma values of the batch normalization folded into the pointwise weights. Can be nullptr.
+     * @param[in]  pwc_epsilon      Epsilon of the batch normalization folded into the pointwise weights.
+     * @param[in]  conv_info        Padding and stride information of the depthwise convolution.
+     * @param[in]  depth_multiplier Multiplier to apply to the input's depth in order to retrieve the depthwise output's depth.
+     * @param[in]  dwc_act          Activation applied between the depthwise and the pointwise convolution.
+     * @param[in]  fused_act        Activation layer information in case of a fused activation.
+     */
+    void configure(TensorType                *input,
+                   TensorType                *dwc_weights,
+                   TensorType                *dwc_bias,
+                   TensorType                *pwc_weights,
+                   TensorType                *pwc_bias,
+                   TensorType                *output,
+                   const TensorType          *dwc_mean,
+                   const TensorType          *dwc_var,
+                   const TensorType          *dwc_beta,
+                   const TensorType          *dwc_gamma,
+                   float                      dwc_epsilon,
+                   const TensorType          *pwc_mean,
+                   const TensorType          *pwc_var,
+                   const TensorType          *pwc_beta,
+                   const TensorType          *pwc_gamma,
+                   float                      pwc_epsilon,
+                   const PadStrideInfo       &conv_info,
+                   unsigned int               depth_multiplier,
+                   ActivationLayerInfo const &dwc_act,
+                   ActivationLayerInfo const &fused_act)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        _fuse_dwc = (dwc_mean != nullptr);
+        _fuse_pwc = (pwc_mean != nullptr);
+
+        // Batch normalization might end up with a bias != 0, so a bias is created for the layers that have none
+        TensorType *dwc_bias_to_use = dwc_bias;
+        if (_fuse_dwc)
+        {
+            dwc_bias_to_use = (dwc_bias != nullptr) ? dwc_bias : &_dwc_fused_bias;
+            _dwc_batch_norm_layer.configure(dwc_weights, dwc_mean, dwc_var, nullptr,
+                                            dwc_bias != nullptr ? nullptr : &_dwc_fused_bias, dwc_bias, dwc_beta,
+                                            dwc_gamma, dwc_epsilon, FuseBatchNormalizationType::DEPTHWISECONVOLUTION);
+        }
+
+        TensorType *pwc_bias_to_use = pwc_bias;
+        if (_fuse_pwc)
+        {
+            pwc_bias_to_use = (pwc_bias != nullptr) ? pwc_bias : &_pwc_fused_bias;
+            _pwc_batch_norm_layer.configure(pwc_weights, pwc_mean, pwc_var, nullptr,
+                                            pwc_bias != nullptr ? nullptr : &_pwc_fused_bias, pwc_bias, pwc_beta,
+                                            pwc_gamma, pwc_epsilon, FuseBatchNormalizationType::CONVOLUTION);
+        }
+
+        _separable_conv_layer.configure(input, dwc_weights, dwc_bias_to_use, pwc_weights, pwc_bias_to_use, output,
+                                        conv_info, depth_multiplier, dwc_act, fused_act);
+
+        if (_fuse_dwc && dwc_bias == nullptr)
+        {
+            _dwc_fused_bias.allocator()->allocate();
+        }
+        if (_fuse_pwc && pwc_bias == nullptr)
+        {
+            _pwc_fused_bias.allocator()->allocate();
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        _separable_conv_layer.run();
+    }
+
+    void prepare()
+    {
+        if (!_is_prepared)
+        {
+            if (_fuse_dwc)
+            {
+                _dwc_batch_norm_layer.run();
+            }
+            if (_fuse_pwc)
+            {
+                _pwc_batch_norm_layer.run();
+            }
+            _separable_conv_layer.prepare();
+            _is_prepared = true;
+        }
+    }
+
+private:
+    typename FusedLayerTypes::DepthwiseSeparableConvolutionLayer _separable_conv_layer;
+    typename FusedLayerTypes::FuseBatchNormalization             _dwc_batch_norm_layer;
+    typename FusedLayerTypes::FuseBatchNormalization             _pwc_batch_norm_layer;
+    TensorConcreteType                                           _dwc_fused_bias;
+    TensorConcreteType                                           _pwc_fused_bias;
+    bool                                                         _fuse_dwc;
+    bool                                                         _fuse_pwc;
+    bool                                                         _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDDEPTHWISESEPARABLECONVOLUTIONFUNCTION_H
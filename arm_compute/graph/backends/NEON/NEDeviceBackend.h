@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 
 namespace arm_compute
 {
@@ -42,6 +43,13 @@ class NEDeviceBackend final : public IDeviceBackend
 {
 public:
     NEDeviceBackend();
+    /** Destructor */
+    ~NEDeviceBackend();
+    /** Switch on/off convolution method tuning
+     *
+     * @param[in] enable_tuning Measure the convolution methods of new configurations if true
+     */
+    void set_convolution_method_tuning(bool enable_tuning);
 
     // Inherited overridden methods
     void                           initialize_backend() override;
@@ -59,7 +67,9 @@ public:
     void                                          sync() override;
 
 private:
-    Allocator _allocator; /**< Backend allocator */
+    Allocator                _allocator;              /**< Backend allocator */
+    NEConvolutionMethodTuner _conv_method_tuner;      /**< Convolution method tuner */
+    std::string              _conv_method_tuner_file; /**< Filename to load/store the convolution methods from */
 };
 } // namespace backends
 } // namespace graph
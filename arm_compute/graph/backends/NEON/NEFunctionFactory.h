@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,9 @@
 
 namespace arm_compute
 {
+// Forward declarations
+class NEConvolutionMethodTuner;
+
 namespace graph
 {
 // Forward declarations
@@ -48,12 +51,14 @@ class NEFunctionFactory final
 public:
     /** Create a backend execution function depending on the node type
      *
-     * @param[in] node Node to create the backend function for
-     * @param[in] ctx  Context to use
+     * @param[in] node              Node to create the backend function for
+     * @param[in] ctx               Context to use
+     * @param[in] conv_method_tuner (Optional) Tuner selecting the method of the convolutions left to the backend heuristics
      *
      * @return Backend function
      */
-    static std::unique_ptr<arm_compute::IFunction> create(INode *node, GraphContext &ctx);
+    static std::unique_ptr<arm_compute::IFunction>
+    create(INode *node, GraphContext &ctx, NEConvolutionMethodTuner *conv_method_tuner = nullptr);
 };
 } // namespace backends
 } // namespace graph
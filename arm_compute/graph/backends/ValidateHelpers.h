@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -234,6 +234,37 @@ Status validate_depthwise_convolution_layer(DepthwiseConvolutionLayerNode &node)
 
     return status;
 }
+
+/** Validates a fused depthwise separable convolution layer node
+ *
+ * @tparam FusedFunction Fused depthwise separable convolution layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename FusedFunction>
+Status validate_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedDepthwiseSeparableConvolutionLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 13);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input       = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *dwc_weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *dwc_biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *pwc_weights = get_backing_tensor_info(node.input(3));
+    arm_compute::ITensorInfo *pwc_biases  = get_backing_tensor_info(node.input(4));
+    arm_compute::ITensorInfo *output      = get_backing_tensor_info(node.output(0));
+
+    // Validate function
+    return FusedFunction::validate(input, dwc_weights, dwc_biases, pwc_weights, pwc_biases, output,
+                                   node.convolution_info(), node.depth_multiplier(), node.depthwise_activation(),
+                                   node.fused_activation());
+}
+
 /** Validates a depth to space layer node
  *
  * @tparam DequantizationLayer Dequantize layer type
@@ -737,6 +768,36 @@ Status validate_eltwise_Layer(EltwiseLayerNode &node)
     }
     return Status{};
 }
+
+/** Validates a fused elementwise expression layer node
+ *
+ * @tparam ElementwiseExpressionFunction Elementwise expression function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename ElementwiseExpressionFunction>
+Status validate_fused_elementwise_expression_layer(FusedElementwiseExpressionNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedElementwiseExpressionLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != node.expression().num_inputs());
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    std::vector<const arm_compute::ITensorInfo *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor_info(node.input(i)));
+        ARM_COMPUTE_RETURN_ERROR_ON(inputs.back() == nullptr);
+    }
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(output == nullptr);
+
+    // Validate function
+    return ElementwiseExpressionFunction::validate(inputs, output, node.expression());
+}
 /** Validates a unary element-wise layer node
  *
  * @param[in] node Node to validate
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Depthwise Convolution and 1x1 Convolution node
+ *
+ * Inputs are, in order: input, depthwise weights, depthwise biases, pointwise weights and pointwise biases, followed
+ * by the optional mean, variance, beta and gamma of a batch normalization folded into the depthwise weights and of
+ * one folded into the pointwise weights.
+ */
+class FusedDepthwiseSeparableConvolutionNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info                 Depthwise convolution layer attributes.
+     * @param[in] depth_multiplier     Multiplier to apply to the input's depth in order to retrieve the depthwise output's depth.
+     * @param[in] depthwise_activation (Optional) Activation applied between the two convolutions. Disabled if not specified
+     * @param[in] fused_activation     (Optional) Fused activation layer. Disabled if not specified
+     * @param[in] dwc_epsilon          (Optional) Epsilon of the batch normalization folded into the depthwise weights.
+     * @param[in] pwc_epsilon          (Optional) Epsilon of the batch normalization folded into the pointwise weights.
+     */
+    FusedDepthwiseSeparableConvolutionNode(PadStrideInfo       info,
+                                           unsigned int        depth_multiplier,
+                                           ActivationLayerInfo depthwise_activation = ActivationLayerInfo(),
+                                           ActivationLayerInfo fused_activation     = ActivationLayerInfo(),
+                                           float               dwc_epsilon          = 0.f,
+                                           float               pwc_epsilon          = 0.f);
+
+    /** Depthwise convolution metadata accessor
+     *
+     * @return Depthwise convolution information
+     */
+    PadStrideInfo convolution_info() const;
+
+    /** Depth multiplier accessor
+     *
+     * @return Depth multiplier
+     */
+    unsigned int depth_multiplier() const;
+
+    /** Depthwise batch normalization epsilon accessor
+     *
+     * @return Epsilon of the batch normalization folded into the depthwise weights
+     */
+    float dwc_epsilon() const;
+
+    /** Pointwise batch normalization epsilon accessor
+     *
+     * @return Epsilon of the batch normalization folded into the pointwise weights
+     */
+    float pwc_epsilon() const;
+
+    /** Returns the activation applied between the depthwise and the pointwise convolution
+     *
+     * @return Depthwise activation
+     */
+    ActivationLayerInfo depthwise_activation() const;
+
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+
+    /** Computes the output descriptor
+     *
+     * @param[in] input_descriptor       Input descriptor
+     * @param[in] dwc_weights_descriptor Depthwise weights descriptor
+     * @param[in] pwc_weights_descriptor Pointwise weights descriptor
+     * @param[in] info                   Depthwise convolution operation attributes
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &dwc_weights_descriptor,
+                                                      const TensorDescriptor &pwc_weights_descriptor,
+                                                      const PadStrideInfo    &info);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedDepthwiseSeparableConvolutionLayer;
+
+private:
+    PadStrideInfo       _info;
+    unsigned int        _depth_multiplier;
+    ActivationLayerInfo _depthwise_activation;
+    ActivationLayerInfo _fused_activation;
+    float               _dwc_epsilon;
+    float               _pwc_epsilon;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,8 @@ class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
+class FusedDepthwiseSeparableConvolutionNode;
+class FusedElementwiseExpressionNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class L2NormalizeLayerNode;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,6 +61,7 @@ public:
     void visit(EltwiseLayerNode &n) override;
     void visit(FusedConvolutionBatchNormalizationNode &n) override;
     void visit(FusedDepthwiseConvolutionBatchNormalizationNode &n) override;
+    void visit(FusedDepthwiseSeparableConvolutionNode &n) override;
     void visit(NormalizationLayerNode &n) override;
     void visit(PoolingLayerNode &n) override;
     void default_visit(INode &n) override;
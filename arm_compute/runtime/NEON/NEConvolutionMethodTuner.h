@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_NECONVOLUTIONMETHODTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_NECONVOLUTIONMETHODTUNER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Empirical selection of the convolution method used by @ref NEConvolutionLayer
+ *
+ * Instead of relying on the static heuristics of @ref NEConvolutionLayer::get_convolution_method, the tuner configures
+ * every method supporting a given convolution, times a few runs of each of them on dummy data after a warm-up run and
+ * keeps the one with the lowest median time. Decisions are cached in a table keyed by the tensor shapes, data types,
+ * convolution parameters, CPU model and number of threads, which can be saved to and loaded from a file so the
+ * measurements only happen once per device.
+ */
+class NEConvolutionMethodTuner final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_configs Measure the convolution methods for configurations which are not present in the table ?
+     */
+    NEConvolutionMethodTuner(bool tune_new_configs = true);
+
+    /** Setter for tune_new_configs option
+     *
+     * @param[in] tune_new_configs Measure the convolution methods for configurations which are not present in the table ?
+     */
+    void set_tune_new_configs(bool tune_new_configs);
+
+    /** Tune configurations that are not in the convolution methods table
+     *
+     * @return True if tuning of new configurations is enabled.
+     */
+    bool tune_new_configs() const;
+
+    /** Manually add the convolution method to use for a configuration
+     *
+     * @param[in] config_id Unique identifier of the configuration
+     * @param[in] method    Convolution method to use for the given configuration
+     */
+    void add_convolution_method(const std::string &config_id, ConvolutionMethod method);
+
+    /** Give read access to the convolution methods table
+     *
+     * @return The convolution methods table as unordered_map container
+     */
+    const std::unordered_map<std::string, ConvolutionMethod> &convolution_methods_table() const;
+
+    /** Find the convolution method to use for the given configuration
+     *
+     * The method is looked up in the table first. Unknown configurations are measured when tuning of new configurations
+     * is enabled and fall back to @ref NEConvolutionLayer::get_convolution_method otherwise.
+     *
+     * @note Measuring allocates the tensors and workspace of each candidate method and runs them on the scheduler.
+     *
+     * @param[in] input            Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] weights          Weights tensor info. Data type supported: Same as @p input, also could be QSYMM8_PER_CHANNEL or QASYMM8_SIGNED if input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] biases           Biases tensor info. Can be nullptr.
+     * @param[in] output           Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info     Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel.
+     * @param[in] dilation         Dilation, in elements, across x and y.
+     * @param[in] act_info         Activation layer information in case of a fused activation.
+     * @param[in] enable_fast_math Enable fast math computation.
+     *
+     * @return The convolution method to use
+     */
+    ConvolutionMethod get_convolution_method(const ITensorInfo         *input,
+                                             const ITensorInfo         *weights,
+                                             const ITensorInfo         *biases,
+                                             const ITensorInfo         *output,
+                                             const PadStrideInfo       &conv_info,
+                                             const WeightsInfo         &weights_info,
+                                             const Size2D              &dilation,
+                                             const ActivationLayerInfo &act_info,
+                                             bool                       enable_fast_math);
+
+    /** Build the identifier of a configuration in the convolution methods table
+     *
+     * Similar to @ref NEConvolutionMethodTuner::get_convolution_method
+     *
+     * @return The configuration identifier
+     */
+    static std::string config_id(const ITensorInfo         *input,
+                                 const ITensorInfo         *weights,
+                                 const ITensorInfo         *biases,
+                                 const ITensorInfo         *output,
+                                 const PadStrideInfo       &conv_info,
+                                 const WeightsInfo         &weights_info,
+                                 const Size2D              &dilation,
+                                 const ActivationLayerInfo &act_info,
+                                 bool                       enable_fast_math);
+
+    /** Load the convolution methods table from file
+     *
+     * @param[in] filename Load the convolution methods table from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+
+    /** Save the content of the convolution methods table to file
+     *
+     * @param[in] filename Save the convolution methods table to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+private:
+    std::unordered_map<std::string, ConvolutionMethod> _methods_table;
+    bool                                               _tune_new_configs;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_NECONVOLUTIONMETHODTUNER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,10 +38,9 @@ class ITensor;
 /** Function to calculate the index of the minimum or maximum values in a
  *  tensor based on an axis.
  *
- *  This function calls the following kernels:
+ *  This function calls the following functions:
  *
- * -# NEReductionOperationKernel
- * -# NEFillBorderKernel
+ * -# @ref NEReductionOperation
  *
  * @note The default data type for an uninitialized output tensor is
  *       signed 32-bit integer (S32). It is the user's responsibility to check
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@ namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+class NEConvolutionMethodTuner;
 
 /** Basic function to simulate a convolution layer. This function calls one of the following functions:
  * -# cpu::CpuGemmConv2d     (executed only in case GEMM is required for the operation)
@@ -71,13 +72,21 @@ class ITensor;
  * DirectConv    | 9x9              |
  * GEMM          | Any size         |
  *
+ * When a @ref NEConvolutionMethodTuner is given, the method is instead picked by the tuner, which measures every
+ * applicable method the first time it meets a configuration.
  *
  */
 class NEConvolutionLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager (Optional) Memory manager.
+     * @param[in] tuner          (Optional) Tuner used to select the convolution method. If nullptr, the method is
+     *                           selected by @ref NEConvolutionLayer::get_convolution_method
+     */
+    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr,
+                       NEConvolutionMethodTuner       *tuner          = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEConvolutionLayer(const NEConvolutionLayer &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -123,7 +132,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported
+     *                              for NHWC tensors, with all the groups run by GEMM_CONV2D in a single workload
      */
     void configure(ITensor                   *input,
                    const ITensor             *weights,
@@ -136,6 +146,10 @@ public:
                    bool                       enable_fast_math = false,
                    unsigned int               num_groups       = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionLayer
+     *
+     * The configuration is checked against the method picked by @ref NEConvolutionLayer::get_convolution_method. A
+     * function configured with a @ref NEConvolutionMethodTuner validates the method picked by the tuner instead, which
+     * is always one of the methods supporting the configuration.
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
@@ -155,7 +169,8 @@ public:
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
-     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported
+     *                             for NHWC tensors, with all the groups run by GEMM_CONV2D in a single workload
      *
      * @return a status
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,11 @@ namespace arm_compute
  * -# @ref NEConvolutionLayer
  * -# @ref NEReverse
  *
+ * Strided deconvolutions in NHWC skip the upsampling instead: the input is multiplied by the whole kernel in a single
+ * GEMM and the partial results are summed into the output, so the zero-filled upsampled tensor is never built. This
+ * covers F16/F32 and QASYMM8/QASYMM8_SIGNED with per-tensor quantized weights, which are accumulated in S32 and
+ * requantized once summed.
+ *
  */
 class NEDeconvolutionLayer : public IFunction
 {
@@ -88,7 +93,7 @@ public:
     /** Default move assignment operator */
     NEDeconvolutionLayer &operator=(NEDeconvolutionLayer &&) = default;
     /** Default destructor */
-    ~NEDeconvolutionLayer() = default;
+    ~NEDeconvolutionLayer();
 
     /** Set the input, weights, biases and output tensors.
      *
@@ -156,6 +161,8 @@ public:
     void prepare() override;
 
 private:
+    struct GemmDeconv;
+
     MemoryGroup        _memory_group;
     NEConvolutionLayer _conv_f;
     CPPUpsample        _upsample_f;
@@ -168,6 +175,8 @@ private:
     PadStrideInfo      _info;
     bool               _is_prepared;
     bool               _do_upsampling;
+
+    std::unique_ptr<GemmDeconv> _gemm_deconv;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDECONVOLUTIONLAYER_H
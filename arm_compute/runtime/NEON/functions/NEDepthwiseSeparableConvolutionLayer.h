@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CoreTypes.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute a depthwise convolution followed by a 1x1 convolution. This function calls the following
+ * kernels/functions:
+ *
+ * Supports only NHWC data layout
+ *
+ * -# cpu::kernels::CpuDepthwiseConv2dAssemblyWrapperKernel
+ * -# cpu::CpuGemmAssemblyDispatch
+ *
+ * The depthwise output is computed a band of rows at a time and consumed by the 1x1 convolution while it is still in
+ * cache, so the intermediate tensor is never written to memory.
+ */
+class NEDepthwiseSeparableConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEDepthwiseSeparableConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Default move constructor */
+    NEDepthwiseSeparableConvolutionLayer(NEDepthwiseSeparableConvolutionLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer &operator=(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Default move assignment operator */
+    NEDepthwiseSeparableConvolutionLayer &operator=(NEDepthwiseSeparableConvolutionLayer &&) = default;
+    /** Destructor */
+    ~NEDepthwiseSeparableConvolutionLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |src3           |src4           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                              while every optional dimension from 4 and above represent a batch of inputs.
+     *                              Data types supported: F16/F32.
+     * @param[in]  dwc_weights      Depthwise weights tensor. These are 3D tensors with shape [IFM * depth_multiplier, kernel_x, kernel_y].
+     *                              Data type supported: Same as @p input.
+     * @param[in]  dwc_biases       Depthwise biases tensor. A 1D tensor with shape [IFM * depth_multiplier]. Can be nullptr.
+     *                              Data type supported: Same as @p input.
+     * @param[in]  pwc_weights      Pointwise weights tensor. These are 4D tensors with shape [IFM * depth_multiplier, 1, 1, OFM].
+     *                              Data type supported: Same as @p input.
+     * @param[in]  pwc_biases       Pointwise biases tensor. A 1D tensor with shape [OFM]. Can be nullptr.
+     *                              Data type supported: Same as @p input.
+     * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [OFM, width, height],
+     *                              while the rest represent batch of outputs. Data types supported: Same as @p input.
+     * @param[in]  conv_info        Padding and stride information of the depthwise convolution.
+     * @param[in]  depth_multiplier (Optional) Multiplier to apply to the input's depth of the depthwise convolution.
+     * @param[in]  dwc_act_info     (Optional) Activation applied between the depthwise and the pointwise convolution.
+     * @param[in]  pwc_act_info     (Optional) Activation applied to the output of the pointwise convolution.
+     */
+    void configure(ITensor                   *input,
+                   const ITensor             *dwc_weights,
+                   const ITensor             *dwc_biases,
+                   const ITensor             *pwc_weights,
+                   const ITensor             *pwc_biases,
+                   ITensor                   *output,
+                   const PadStrideInfo       &conv_info,
+                   unsigned int               depth_multiplier = 1,
+                   const ActivationLayerInfo &dwc_act_info     = ActivationLayerInfo(),
+                   const ActivationLayerInfo &pwc_act_info     = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseSeparableConvolutionLayer
+     *
+     * Similar to @ref NEDepthwiseSeparableConvolutionLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *input,
+                           const ITensorInfo         *dwc_weights,
+                           const ITensorInfo         *dwc_biases,
+                           const ITensorInfo         *pwc_weights,
+                           const ITensorInfo         *pwc_biases,
+                           const ITensorInfo         *output,
+                           const PadStrideInfo       &conv_info,
+                           unsigned int               depth_multiplier = 1,
+                           const ActivationLayerInfo &dwc_act_info     = ActivationLayerInfo(),
+                           const ActivationLayerInfo &pwc_act_info     = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
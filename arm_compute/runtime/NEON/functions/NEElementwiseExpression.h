@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEEXPRESSION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEEXPRESSION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to evaluate a chain of elementwise operations in a single pass over memory
+ *
+ * Running e.g. @ref NEArithmeticAddition, @ref NEPixelWiseMultiplication and @ref NEActivationLayer one after the
+ * other reads and writes a full tensor for every operation. This function evaluates the whole
+ * @ref ElementwiseExpressionInfo for a few vectors at a time instead, so only the inputs are read and only the final
+ * result is written.
+ *
+ * This function calls the following operators:
+ *
+ * -# cpu::CpuElementwiseExpression
+ */
+class NEElementwiseExpression : public IFunction
+{
+public:
+    /** Constructor */
+    NEElementwiseExpression();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseExpression(const NEElementwiseExpression &) = delete;
+    /** Default move constructor */
+    NEElementwiseExpression(NEElementwiseExpression &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseExpression &operator=(const NEElementwiseExpression &) = delete;
+    /** Default move assignment operator */
+    NEElementwiseExpression &operator=(NEElementwiseExpression &&);
+    /** Destructor */
+    ~NEElementwiseExpression();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |srcs           |dst            |
+     * |:--------------|:--------------|
+     * |F16            |F16            |
+     * |F32            |F32            |
+     *
+     * F16 inputs are evaluated in FP32 and rounded once when the result is stored.
+     *
+     * @param[in]  srcs Input tensors, where srcs[i] is read by the @ref ElementwiseExpressionInfo::input() nodes of
+     *                  index i. Data types supported: F16/F32. Each input is broadcast against the output.
+     * @param[out] dst  Output tensor holding the result of the last node of @p info.
+     *                  Data type supported: same as @p srcs.
+     * @param[in]  info Expression to evaluate. At most @ref ElementwiseExpressionInfo::max_num_nodes nodes reading at
+     *                  most @ref ElementwiseExpressionInfo::max_num_inputs inputs are supported.
+     */
+    void configure(const std::vector<const ITensor *> &srcs, ITensor *dst, const ElementwiseExpressionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEElementwiseExpression
+     *
+     * Similar to @ref NEElementwiseExpression::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &srcs,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseExpressionInfo        &info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEEXPRESSION_H
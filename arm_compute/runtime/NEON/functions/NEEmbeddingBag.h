@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to gather rows of an embedding table and pool them per bag with a sum or a mean
+ *
+ * The gathered rows are accumulated directly into the pooled result, so unlike @ref NEGather followed by
+ * @ref NEReductionOperation no intermediate tensor of gathered rows is written. The bags are distributed across the
+ * threads and the rows are prefetched ahead of their use.
+ *
+ * This function calls the following kernels:
+ * -# cpu::kernels::CpuEmbeddingBagKernel
+ */
+class NEEmbeddingBag : public IFunction
+{
+public:
+    /** Constructor */
+    NEEmbeddingBag();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingBag(const NEEmbeddingBag &) = delete;
+    /** Default move constructor */
+    NEEmbeddingBag(NEEmbeddingBag &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingBag &operator=(const NEEmbeddingBag &) = delete;
+    /** Default move assignment operator */
+    NEEmbeddingBag &operator=(NEEmbeddingBag &&);
+    /** Destructor */
+    ~NEEmbeddingBag();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |table  |indices |offsets |scales |output |
+     * |:------|:-------|:-------|:------|:------|
+     * |F32    |S32     |S32     |F32    |F32    |
+     * |F16    |S32     |S32     |F32    |F16    |
+     * |S8     |S32     |S32     |F32    |F32    |
+     *
+     * Bag b pools the rows indices[offsets[b]] to indices[offsets[b + 1] - 1]; the last bag ends with the last index.
+     * A bag whose offset is not lower than the next one is empty and its output row is zero.
+     *
+     * @param[in]  table   2D embedding table, one row along X per embedding. Data types supported: F16/F32/S8.
+     * @param[in]  indices 1D tensor of the rows to gather. Indices outside the table contribute zeros.
+     *                     Data types supported: S32.
+     * @param[in]  offsets 1D tensor of the first index of every bag. Data types supported: S32.
+     * @param[out] output  2D destination tensor, one row per bag.
+     *                     Data types supported: F32 for S8 tables, same as @p table otherwise.
+     * @param[in]  info    (Optional) Pooling applied to every bag. Defaults to a sum.
+     * @param[in]  scales  (Optional) 1D tensor of per-row scales, one per row of @p table, applied to the rows before
+     *                     pooling. Can be nullptr, except for S8 tables. Data types supported: F32.
+     */
+    void configure(const ITensor          *table,
+                   const ITensor          *indices,
+                   const ITensor          *offsets,
+                   ITensor                *output,
+                   const EmbeddingBagInfo &info   = EmbeddingBagInfo(),
+                   const ITensor          *scales = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEEmbeddingBag
+     *
+     * Similar to @ref NEEmbeddingBag::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo      *table,
+                           const ITensorInfo      *indices,
+                           const ITensorInfo      *offsets,
+                           const ITensorInfo      *output,
+                           const EmbeddingBagInfo &info   = EmbeddingBagInfo(),
+                           const ITensorInfo      *scales = nullptr);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,12 +42,14 @@ class ITensor;
 class NEFFTDigitReverseKernel;
 class NEFFTRadixStageKernel;
 class NEFFTScaleKernel;
+class NESlice;
 
 /** Basic function to execute one dimensional FFT. This function calls the following kernels:
  *
  * -# NEFFTDigitReverseKernel Performs digit reverse
  * -# NEFFTRadixStageKernel   A list of FFT kernels depending on the radix decomposition
  * -# NEFFTScaleKernel        Performs output scaling in case of in inverse FFT
+ * -# @ref NESlice            Keeps the non-redundant half of the spectrum of a real input along axis 0
  */
 class NEFFT1D : public IFunction
 {
@@ -77,6 +79,9 @@ public:
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor.  Data types and data layouts supported: Same as @p input.
      *                    Number of channels supported: 1 (real tensor) or 2 (complex tensor).If @p input is real, @p output must be complex.
+     *                    Along axis 0, the complex side of a transform between a real signal of length N and its
+     *                    spectrum can hold N / 2 + 1 elements only, the rest of the spectrum being its conjugate mirror.
+     *                    This halves the size of the spectrum and the work of any later pass on it.
      * @param[in]  config FFT related configuration
      */
     void configure(const ITensor *input, ITensor *output, const FFT1DInfo &config);
@@ -98,11 +103,13 @@ protected:
     std::unique_ptr<NEFFTDigitReverseKernel>            _digit_reverse_kernel;
     std::vector<std::unique_ptr<NEFFTRadixStageKernel>> _fft_kernels;
     std::unique_ptr<NEFFTScaleKernel>                   _scale_kernel;
+    std::unique_ptr<NESlice>                            _crop_func;
     Tensor                                              _digit_reversed_input;
     Tensor                                              _digit_reverse_indices;
     unsigned int                                        _num_ffts;
     unsigned int                                        _axis;
     bool                                                _run_scale;
+    bool                                                _run_crop;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFFT1D_H
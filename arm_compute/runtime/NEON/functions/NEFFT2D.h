@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,9 @@ public:
      *
      * @param[in]  input  Source tensor. Data types supported: F32.
      * @param[out] output Destination tensor. Data types and data layouts supported: Same as @p input.
+     *                    A real-to-complex transform can store the N / 2 + 1 non-redundant elements of the spectrum
+     *                    along axis 0 only, if axis 0 is the first pass. The matching complex-to-real transform then
+     *                    takes that half spectrum and must run axis 0 as the second pass. See @ref NEFFT1D.
      * @param[in]  config FFT related configuration
      */
     void configure(const ITensor *input, ITensor *output, const FFT2DInfo &config);
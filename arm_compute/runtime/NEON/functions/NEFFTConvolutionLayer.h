@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,10 +50,15 @@ class ITensor;
  *
  *  -# @ref NEPermute                        Permute input if NHWC(only NCHW is supported).
  *  -# @ref NEPadLayer                       Pad input.
- *  -# @ref NEFFT2D                          Forward transform to the frequency domain.
+ *  -# @ref NEFFT2D                          Forward real-to-complex transform to the half spectrum.
  *  -# @ref NEComplexPixelWiseMultiplication Complex element-wise product of input and the weights.
  *  -# @ref NEReductionOperation             Reduction across channels.
- *  -# @ref NEFFT2D                          Inverse transform back to the time domain.
+ *  -# @ref NEFFT2D                          Inverse complex-to-real transform back to the time domain.
+ *
+ * The transforms are sized to the smallest length made of the supported radices that avoids wrap-around in the
+ * extracted region. Only the non-redundant half of each spectrum along the width is kept, which halves the cost of
+ * the products, the reduction and the transforms run after the first pass. The transformed weights are computed
+ * once, in prepare().
  *  -# @ref NEStridedSlice                   Extract valid output.
  *  -# @ref NEArithmeticAddition             Add bias.
  *  -# @ref NEActivationLayer                Perform activation.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -128,7 +128,9 @@ public:
      *                          - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
      *                          Data type supported: Same as @p input.
      * @param[in]  fc_info      (Optional) Fully connected layer additional info
-     * @param[in]  weights_info (Optional) Stores neccessary compute information when weights are already reshaped
+     * @param[in]  weights_info (Optional) Stores neccessary compute information when weights are already reshaped.
+     *                          A weight format of WeightFormat::SPARSE_2_4 selects the 2:4 structured sparse F32 kernels
+     *                          when they support the problem, and the dense kernels otherwise.
      */
     void configure(const ITensor          *input,
                    const ITensor          *weights,
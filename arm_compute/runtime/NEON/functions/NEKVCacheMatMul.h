@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEKVCACHEMATMUL_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEKVCACHEMATMUL_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to run a decode step matrix multiplication against an appendable key/value cache
+ *
+ * Autoregressive decoding multiplies a single row per attention head with a cache that grows by one row every step.
+ * This function owns a pre-packed copy of the cache sized for @ref KVCacheMatMulInfo::max_length() rows: new rows
+ * are packed incrementally with @ref append() and @ref run() only reads the rows appended so far, so the active length
+ * can change between runs without reconfiguring.
+ *
+ * This function calls the following operators:
+ *
+ * -# cpu::CpuKVCacheMatMul
+ */
+class NEKVCacheMatMul : public IFunction
+{
+public:
+    /** Constructor */
+    NEKVCacheMatMul();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEKVCacheMatMul(const NEKVCacheMatMul &) = delete;
+    /** Default move constructor */
+    NEKVCacheMatMul(NEKVCacheMatMul &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEKVCacheMatMul &operator=(const NEKVCacheMatMul &) = delete;
+    /** Default move assignment operator */
+    NEKVCacheMatMul &operator=(NEKVCacheMatMul &&);
+    /** Destructor */
+    ~NEKVCacheMatMul();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |lhs            |dst            |
+     * |:--------------|:--------------|
+     * |F16            |F16            |
+     * |F32            |F32            |
+     *
+     * @param[in]  lhs  For @ref KVCacheOperand::Key, the query of shape [head_dim, 1, batches].
+     *                  For @ref KVCacheOperand::Value, the attention weights of shape [max_length, 1, batches] of
+     *                  which only the first @ref length() entries are read. Data types supported: F16/F32.
+     * @param[out] dst  For @ref KVCacheOperand::Key, the scaled scores of shape [max_length, 1, batches] where the
+     *                  entries past @ref length() are set to -infinity, so that a softmax over the whole row ignores them.
+     *                  For @ref KVCacheOperand::Value, the output of shape [head_dim, 1, batches].
+     *                  Data type supported: same as @p lhs.
+     * @param[in]  info Cache information.
+     */
+    void configure(const ITensor *lhs, ITensor *dst, const KVCacheMatMulInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEKVCacheMatMul
+     *
+     * Similar to @ref NEKVCacheMatMul::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs, const ITensorInfo *dst, const KVCacheMatMulInfo &info);
+    /** Pack new rows at the end of the cache
+     *
+     * @param[in] rows Rows of shape [head_dim, num_rows, batches]. Data type supported: same as the configured lhs.
+     *                 The cache must have room for @p num_rows more rows.
+     */
+    void append(const ITensor *rows);
+    /** Discard all the cached rows, e.g. to start a new sequence */
+    void reset();
+    /** Number of rows currently held in the cache
+     *
+     * @return the active length
+     */
+    unsigned int length() const;
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEKVCACHEMATMUL_H
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORMALIZATION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORMALIZATION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to run a LayerNorm or a RMSNorm along X, with an optional affine transform and residual addition
+ *
+ * A transformer block "x + residual -> norm -> gamma/beta -> quantize" runs as a single pass over the rows instead of
+ * one pass per operation. The rows are distributed across the threads.
+ *
+ * This function calls the following kernels:
+ * -# cpu::kernels::CpuLayerNormalizationKernel
+ */
+class NELayerNormalization : public IFunction
+{
+public:
+    /** Constructor */
+    NELayerNormalization();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELayerNormalization(const NELayerNormalization &) = delete;
+    /** Default move constructor */
+    NELayerNormalization(NELayerNormalization &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELayerNormalization &operator=(const NELayerNormalization &) = delete;
+    /** Default move assignment operator */
+    NELayerNormalization &operator=(NELayerNormalization &&);
+    /** Destructor */
+    ~NELayerNormalization();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src      |dst                              |
+     * |:--------|:--------------------------------|
+     * |F32      |F32, QASYMM8, QASYMM8_SIGNED     |
+     * |F16      |F16, QASYMM8, QASYMM8_SIGNED     |
+     * |BFLOAT16 |BFLOAT16, QASYMM8, QASYMM8_SIGNED|
+     *
+     * @note If @p output is not initialised it gets the data type of @p input. Initialise it as QASYMM8 or
+     *       QASYMM8_SIGNED, with its quantization info, to quantize the normalized values.
+     *
+     * @param[in]  input           Source tensor. The normalization is computed along X.
+     *                             Data types supported: F16/F32/BFLOAT16.
+     * @param[in]  gamma           1D tensor of scales, one per element along X. Can be nullptr.
+     *                             Data types supported: same as @p input.
+     * @param[in]  beta            1D tensor of offsets, one per element along X. Can be nullptr.
+     *                             Data types supported: same as @p input.
+     * @param[out] output          Destination tensor. Same shape as @p input. It can be the same as @p input.
+     *                             Data types supported: same as @p input or QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  info            (Optional) Normalization type and epsilon. Defaults to a LayerNorm.
+     * @param[in]  residual        (Optional) Tensor added to @p input before the normalization. Can be nullptr.
+     *                             Same shape and data type as @p input.
+     * @param[out] residual_output (Optional) Destination tensor for @p input + @p residual, i.e. the residual of the
+     *                             next block. Can be nullptr. Requires @p residual.
+     *                             Same shape and data type as @p input.
+     */
+    void configure(const ITensor                *input,
+                   const ITensor                *gamma,
+                   const ITensor                *beta,
+                   ITensor                      *output,
+                   const LayerNormalizationInfo &info            = LayerNormalizationInfo(),
+                   const ITensor                *residual        = nullptr,
+                   ITensor                      *residual_output = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELayerNormalization
+     *
+     * Similar to @ref NELayerNormalization::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *input,
+                           const ITensorInfo            *gamma,
+                           const ITensorInfo            *beta,
+                           const ITensorInfo            *output,
+                           const LayerNormalizationInfo &info            = LayerNormalizationInfo(),
+                           const ITensorInfo            *residual        = nullptr,
+                           const ITensorInfo            *residual_output = nullptr);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORMALIZATION_H
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELOOKUPTABLEACTIVATION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELOOKUPTABLEACTIVATION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/LookupTableActivationInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to apply an arbitrary scalar function to every element through a lookup table
+ *
+ * Unlike @ref NEActivationLayer, which only provides a fixed set of activation functions, this function accepts any
+ * scalar function, for example GELU with the tanh approximation, SiLU or Mish. The function is evaluated once for
+ * every value representable in the data type when the function is configured: 256 values for 8-bit quantized tensors
+ * and 65536 values for F16 tensors. Running the function then costs a table lookup per element, however expensive
+ * the scalar function is.
+ *
+ * @note Only supported on aarch64.
+ *
+ * This function calls the following operators:
+ * -# cpu::CpuLookupTableActivation
+ */
+class NELookupTableActivation : public IFunction
+{
+public:
+    /** Constructor */
+    NELookupTableActivation();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELookupTableActivation(const NELookupTableActivation &) = delete;
+    /** Default move constructor */
+    NELookupTableActivation(NELookupTableActivation &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELookupTableActivation &operator=(const NELookupTableActivation &) = delete;
+    /** Default move assignment operator */
+    NELookupTableActivation &operator=(NELookupTableActivation &&);
+    /** Destructor */
+    ~NELookupTableActivation();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |QASYMM8        |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |
+     * |F16            |F16            |
+     *
+     * @note If the output tensor is a nullptr or is equal to the input, the function is applied in-place
+     *
+     * @param[in, out] input  Source tensor. In case of @p output tensor = nullptr, this tensor will store the result.
+     *                        Data types supported: QASYMM8/QASYMM8_SIGNED/F16.
+     * @param[out]     output Destination tensor. Data types supported: same as @p input.
+     *                        For quantized tensors, the results are requantized with the static quantization
+     *                        information of @p output.
+     * @param[in]      info   Function to apply to every element.
+     */
+    void configure(ITensor *input, ITensor *output, const LookupTableActivationInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELookupTableActivation
+     *
+     * Similar to @ref NELookupTableActivation::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const LookupTableActivationInfo &info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELOOKUPTABLEACTIVATION_H
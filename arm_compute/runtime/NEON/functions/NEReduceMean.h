@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,14 +30,20 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
-#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
-#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
 
 namespace arm_compute
 {
-/** Basic function to perform reduce operation */
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to perform reduce operation
+ *
+ * All the axes are reduced by a single cpu::CpuReduction pass, which also drops the reduced dimensions when
+ * @p keep_dims is false.
+ */
 class NEReduceMean : public IFunction
 {
 public:
@@ -47,10 +53,10 @@ public:
     NEReduceMean(const NEReduceMean &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEReduceMean &operator=(const NEReduceMean &) = delete;
-    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
-    NEReduceMean(NEReduceMean &&) = delete;
-    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
-    NEReduceMean &operator=(NEReduceMean &&) = delete;
+    /** Default move constructor */
+    NEReduceMean(NEReduceMean &&);
+    /** Default move assignment operator */
+    NEReduceMean &operator=(NEReduceMean &&);
     /** Default destructor */
     ~NEReduceMean();
     /** Configure kernel
@@ -91,12 +97,8 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                       _memory_group;
-    std::vector<NEReductionOperation> _reduction_kernels;
-    std::vector<Tensor>               _reduced_outs;
-    NEReshapeLayer                    _reshape;
-    int                               _reduction_ops;
-    bool                              _keep_dims;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEREDUCEMEAN_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,21 +28,20 @@
  * @publicapi
  */
 
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
-#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/IMemoryManager.h"
 
 #include <memory>
 
 namespace arm_compute
 {
 class ITensor;
-class NEReductionOperationKernel;
+class ITensorInfo;
 
-/** Basic function to simulate a reduction operation. This function calls the following kernels:
+/** Basic function to simulate a reduction operation. This function calls the following operators:
  *
- * -# @ref NEReshapeLayer
- * -# NEReductionOperationKernel
+ * -# cpu::CpuReduction
  *
  */
 class NEReductionOperation : public IFunction
@@ -53,11 +52,11 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEReductionOperation(const NEReductionOperation &) = delete;
     /** Default move constructor */
-    NEReductionOperation(NEReductionOperation &&) = default;
+    NEReductionOperation(NEReductionOperation &&);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEReductionOperation &operator=(const NEReductionOperation &) = delete;
     /** Default move assignment operator */
-    NEReductionOperation &operator=(NEReductionOperation &&) = default;
+    NEReductionOperation &operator=(NEReductionOperation &&);
     /** Default destructor */
     ~NEReductionOperation();
     /** Set the input and output tensors.
@@ -74,9 +73,9 @@ public:
      * |F32            |F32            |
      * |S32            |S32            |
      *
-     * @param[in, out] input     Source tensor. Data type supported: QASYMM8_SIGNED/QASYMM8/F16/F32/S32. (Written to only for border_size != 0)
+     * @param[in, out] input     Source tensor. Data type supported: QASYMM8_SIGNED/QASYMM8/F16/F32/S32.
      * @param[out]     output    Destination tensor. Data types and data layouts supported: same as @p input.
-     * @param[in]      axis      Dimension along which to reduce. Supported reduction axis : 0
+     * @param[in]      axis      Dimension along which to reduce. Supported reduction axis : 0-3
      * @param[in]      op        Reduction operation to perform.
      * @param[in]      keep_dims (Optional) Whether to keep the reduced dimension after the operation. Defaults to true.
      */
@@ -86,7 +85,7 @@ public:
      *
      * @param[in] input     Source tensor info. Data type supported: QASYMM8_SIGNED/QASYMM8/F16/F32/S32.
      * @param[in] output    Destination tensor info. Data types and data layouts supported: same as @p input.
-     * @param[in] axis      Dimension along which to reduce. Supported reduction axis : 0
+     * @param[in] axis      Dimension along which to reduce. Supported reduction axis : 0-3
      * @param[in] op        Reduction operation to perform.
      * @param[in] keep_dims (Optional) Whether to keep the reduced dimension after the operation. Defaults to true.
      *
@@ -102,13 +101,8 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                                 _memory_group;
-    std::unique_ptr<NEReductionOperationKernel> _reduction_kernel;
-    NEReshapeLayer                              _reshape;
-    Tensor                                      _output_internal;
-    size_t                                      _window_split;
-    int                                         _reduction_axis;
-    bool                                        _is_reshape_required;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEREDUCTIONOPERATION_H
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESOFTMAXTOPK_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESOFTMAXTOPK_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute the softmax probabilities of the k most likely elements of every row
+ *
+ * This is equivalent to a @ref NESoftmaxLayer along X followed by a top-k selection, but the full softmax is never
+ * written to memory: each row is read once, which suits sampling from vocabulary sized rows.
+ *
+ * This function calls the following kernels:
+ * -# cpu::kernels::CpuSoftmaxTopKKernel
+ */
+class NESoftmaxTopK : public IFunction
+{
+public:
+    /** Constructor */
+    NESoftmaxTopK();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESoftmaxTopK(const NESoftmaxTopK &) = delete;
+    /** Default move constructor */
+    NESoftmaxTopK(NESoftmaxTopK &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESoftmaxTopK &operator=(const NESoftmaxTopK &) = delete;
+    /** Default move assignment operator */
+    NESoftmaxTopK &operator=(NESoftmaxTopK &&);
+    /** Destructor */
+    ~NESoftmaxTopK();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src      |values   |indices  |
+     * |:--------|:--------|:--------|
+     * |F16      |F16      |U32      |
+     * |F32      |F32      |U32      |
+     *
+     * @param[in]  input   Source tensor. Softmax is computed along X. Data types supported: F16/F32.
+     * @param[out] values  Destination tensor for the k largest probabilities of every row, in descending order.
+     *                     Same shape as @p input with the X dimension set to @p k.
+     *                     Data types supported: same as @p input.
+     * @param[out] indices Destination tensor for the positions along X of @p values. Same shape as @p values.
+     *                     Data types supported: U32.
+     * @param[in]  k       Number of elements to select. Must be in the range [1, input's X dimension].
+     * @param[in]  beta    (Optional) A scaling factor for the exponent, i.e. the inverse of the sampling temperature.
+     */
+    void configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k, float beta = 1.0f);
+    /** Static function to check if given info will lead to a valid configuration of @ref NESoftmaxTopK
+     *
+     * Similar to @ref NESoftmaxTopK::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *values,
+                           const ITensorInfo *indices,
+                           unsigned int       k,
+                           float              beta = 1.0f);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESOFTMAXTOPK_H
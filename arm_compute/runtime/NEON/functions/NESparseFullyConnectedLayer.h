@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESPARSEFULLYCONNECTEDLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESPARSEFULLYCONNECTEDLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute a fully connected layer with block-sparse weights
+ *
+ * On the first run the constant weights are scanned for blocks of @ref SparseFullyConnectedLayerInfo::block_shape
+ * holding at least one non-zero value. If the fraction of such blocks does not exceed
+ * @ref SparseFullyConnectedLayerInfo::max_density, the weights are compressed in a block compressed sparse row
+ * format and only the stored blocks are multiplied. Otherwise the function behaves as @ref NEFullyConnectedLayer.
+ *
+ * This function calls the following operators:
+ *
+ * -# cpu::CpuSparseFullyConnected
+ */
+class NESparseFullyConnectedLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NESparseFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseFullyConnectedLayer(const NESparseFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains pointers) */
+    NESparseFullyConnectedLayer(NESparseFullyConnectedLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseFullyConnectedLayer &operator=(const NESparseFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains pointers) */
+    NESparseFullyConnectedLayer &operator=(NESparseFullyConnectedLayer &&) = delete;
+    /** Default destructor */
+    ~NESparseFullyConnectedLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     * - NCHW
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  input   Source tensor of shape [K, M]. Data type supported: F32.
+     * @param[in]  weights Constant weights tensor. [K, N] if @ref SparseFullyConnectedLayerInfo::transpose_weights is
+     *                     set, [N, K] otherwise. N must be a multiple of the block height and K of the block width.
+     *                     Data type supported: same as @p input.
+     * @param[in]  biases  Bias tensor of shape [N]. Can be nullptr. Data type supported: same as @p input.
+     * @param[out] output  Destination tensor of shape [N, M]. Data type supported: same as @p input.
+     * @param[in]  info    (Optional) Sparse fully connected layer information.
+     *                     Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU activations can be fused.
+     */
+    void configure(const ITensor                       *input,
+                   const ITensor                       *weights,
+                   const ITensor                       *biases,
+                   ITensor                             *output,
+                   const SparseFullyConnectedLayerInfo &info = SparseFullyConnectedLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseFullyConnectedLayer
+     *
+     * Similar to @ref NESparseFullyConnectedLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *input,
+                           const ITensorInfo                   *weights,
+                           const ITensorInfo                   *biases,
+                           const ITensorInfo                   *output,
+                           const SparseFullyConnectedLayerInfo &info = SparseFullyConnectedLayerInfo());
+    /** Whether the weights were too dense to be compressed
+     *
+     * @note Only meaningful once the function has been prepared.
+     *
+     * @return true if the dense fully connected path is used
+     */
+    bool uses_dense_fallback() const;
+
+    //Inherited methods override
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESPARSEFULLYCONNECTEDLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,11 @@ namespace arm_compute
 {
 namespace
 {
+bool is_half_spectrum(const ITensorInfo *input, const ITensorInfo *output, unsigned int axis)
+{
+    return axis == 0 && input->dimension(0) != output->dimension(0);
+}
+
 Status validate_arguments(const ITensorInfo               *input,
                           const ITensorInfo               *output,
                           const ITensorInfo               *idx,
@@ -48,7 +53,6 @@ Status validate_arguments(const ITensorInfo               *input,
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(idx, 1, DataType::U32);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
-    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
     ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(input, idx);
 
     // Checks performed when output is configured
@@ -56,11 +60,23 @@ Status validate_arguments(const ITensorInfo               *input,
     {
         ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(output);
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->tensor_shape()[config.axis] != idx->tensor_shape().x());
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        if (is_half_spectrum(input, output, config.axis))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() != 2);
+            ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != (output->dimension(0) / 2) + 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(
+                detail::have_different_dimensions(input->tensor_shape(), output->tensor_shape(), 1));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        }
     }
     else
     {
+        ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
         const auto output_info = TensorInfo(input->tensor_shape(), 2, input->data_type());
         ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(&output_info);
     }
@@ -77,7 +93,7 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo
 
     auto_init_if_empty(*output, input->clone()->set_num_channels(2));
 
-    Window win = calculate_max_window(*input, Steps());
+    Window win = calculate_max_window(*output, Steps());
 
     return std::make_pair(Status{}, win);
 }
@@ -164,7 +180,8 @@ Status NEFFTDigitReverseKernel::validate(const ITensorInfo               *input,
 template <bool is_input_complex, bool is_conj>
 void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
 {
-    const size_t N = _input->info()->dimension(0);
+    const size_t N    = _output->info()->dimension(0);
+    const size_t N_in = _input->info()->dimension(0);
 
     // Copy the look-up buffer to a local array
     std::vector<unsigned int> buffer_idx(N);
@@ -184,7 +201,23 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
         slice,
         [&](const Coordinates &)
         {
-            if (is_input_complex)
+            if (is_input_complex && N_in != N)
+            {
+                // Load the half spectrum
+                memcpy(buffer_row_in.data(), reinterpret_cast<float *>(in.ptr()), 2 * N_in * sizeof(float));
+
+                // Shuffle, mirroring the upper half from the conjugate of the lower one
+                for (size_t x = 0; x < 2 * N; x += 2)
+                {
+                    const size_t idx       = buffer_idx[x / 2];
+                    const bool   is_mirror = idx >= N_in;
+                    const size_t src_idx   = is_mirror ? N - idx : idx;
+                    const float  imag      = buffer_row_in[2 * src_idx + 1];
+                    buffer_row_out[x]      = buffer_row_in[2 * src_idx];
+                    buffer_row_out[x + 1]  = (is_conj != is_mirror) ? -imag : imag;
+                }
+            }
+            else if (is_input_complex)
             {
                 // Load
                 memcpy(buffer_row_in.data(), reinterpret_cast<float *>(in.ptr()), 2 * N * sizeof(float));
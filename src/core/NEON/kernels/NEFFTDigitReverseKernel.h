@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,10 @@ public:
     /** Default destructor */
     ~NEFFTDigitReverseKernel() = default;
     /** Set the input and output tensors.
+     *
+     * A complex @p input of N / 2 + 1 elements along axis 0 is read as the non-redundant half of the spectrum of a
+     * real signal: the missing elements are rebuilt from the Hermitian symmetry X[N - k] = conj(X[k]).
+     * In that case @p output must be initialized with the full length N.
      *
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
@@ -25,6 +25,7 @@
 #include "arm_gemm/gemm_common.hpp"
 #include "gemm_hybrid.hpp"
 #include "gemm_hybrid_indirect.hpp"
+#include "gemm_hybrid_sparse.hpp"
 #include "gemm_implementation.hpp"
 #include "gemm_interleaved.hpp"
 #include "gemv_batched.hpp"
@@ -34,6 +35,7 @@
 #include "kernels/a64_hybrid_fp32_mla_4x24.hpp"
 #include "kernels/a64_hybrid_fp32_mla_6x16.hpp"
 #include "kernels/a64_hybrid_fp32_mla_8x4.hpp"
+#include "kernels/a64_hybrid_fp32_sparse24_mla_4x16.hpp"
 #include "kernels/a64_sgemm_8x12.hpp"
 #include "kernels/a64_sgemm_8x6.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_6x4.hpp"
@@ -106,6 +108,15 @@ namespace arm_gemm {
 
 static const GemmImplementation<float, float, float> gemm_fp32_methods[] =
 {
+#ifdef __aarch64__
+// Only used on request: the weights are expected to follow a 2:4 sparsity pattern.
+{
+    "a64_hybrid_fp32_sparse24_mla_4x16",
+    [](const GemmArgs &args) { return args._cfg && args._cfg->weight_format == WeightFormat::SPARSE_2_4 && !args._indirect_input && args._Ksections == 1 && !args._accumulate; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmHybridSparse<cls_a64_hybrid_fp32_sparse24_mla_4x16, float, float>(args); }
+},
+#endif // __aarch64__
 {
     "gemv_batched",
     [](const GemmArgs &args) { return args._Msize==1 && args._nbatches>1 && !args._indirect_input; },
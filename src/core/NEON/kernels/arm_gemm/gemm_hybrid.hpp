@@ -206,6 +206,9 @@ public:
                                (m_end - m_start), (nmax - n0));
                 }
 
+                if (last_pass) {
+                    this->apply_epilogue(g_arrays, m_start, m_end, n0, nmax, batch, multi);
+                }
             } while (p.next_dim1());
         }
 
@@ -276,6 +279,16 @@ public:
         return total_cycles;
     }
 
+    bool set_epilogue(const IGemmEpilogue *epilogue) override {
+        // Epilogues operate on float output values.
+        if (!std::is_same<Tr, float>::value) {
+            return false;
+        }
+
+        this->_epilogue = epilogue;
+        return true;
+    }
+
     GemmConfig get_config() override {
         GemmConfig c;
 
@@ -36,6 +36,7 @@
 #include "arm_gemm/ndrange.hpp"
 #include "performance_parameters.hpp"
 #include "arm_common/internal/utils.hpp"
+#include "splitk.hpp"
 
 #ifdef CYCLE_PROFILING
 #include "arm_common/profiler.hpp"
@@ -278,6 +279,13 @@ class GemmHybridIndirect : public GemmCommon<To, Tw, Tr> {
     unsigned int _n_block;
     const unsigned int _Mround;
 
+    /* Split-K: number of K slices and the size of each (a whole number of K blocks). */
+    const unsigned int _k_splits;
+    const unsigned int _k_split_size;
+
+    std::atomic<unsigned int> *_splitk_counters = nullptr;
+    Tr *_splitk_partials = nullptr;
+
     /* Pretransposed buffer. */
     const Troi *_B_transposed=nullptr;
 
@@ -341,6 +349,46 @@ class GemmHybridIndirect : public GemmCommon<To, Tw, Tr> {
         return ktotal;
     }
 
+    // Split K if the output doesn't have enough blocks to occupy all the threads.  Slices are made of whole K
+    // blocks, so this needs K blocking to be possible at all.  This is only done when there is no output stage (the
+    // partial results need to be summed before requantizing), and not for fixed format kernels as they can be run
+    // through the stateless interface without a working space.  Partial results are stored in the output type, so
+    // reduced precision outputs are only split in fast mode.
+    static unsigned int compute_k_splits(const GemmArgs &args, unsigned int k_block, unsigned int n_block) {
+        if (!std::is_same<OutputStage, Nothing>::value || FixedFormat || args._accumulate) {
+            return 1;
+        }
+
+        if (!std::is_same<Tr, float>::value && !args._fast_mode) {
+            return 1;
+        }
+
+        const unsigned int k_blocks = iceildiv(get_ktotal(args), k_block);
+        const unsigned int units    = iceildiv(args._Msize, strategy::out_height()) * args._nbatches * iceildiv(args._Nsize, n_block) * args._nmulti;
+
+        // Cost in MACs.  The reduction is a scalar loop which costs roughly as much per element as a few vector MACs;
+        // a rough ratio is good enough as splitting only pays off when K is much larger than the output.
+        constexpr float reduce_macs_per_element = 8.0f;
+
+        const float tile_size   = static_cast<float>(strategy::out_height()) * std::min(n_block, args._Nsize);
+        const float block_cost  = tile_size * k_block;
+        const float reduce_cost = tile_size * reduce_macs_per_element;
+
+        return splitk_compute_splits(units, args._maxthreads, k_blocks, block_cost, reduce_cost);
+    }
+
+    static unsigned int compute_k_split_size(const GemmArgs &args, unsigned int k_block, unsigned int k_splits) {
+        return iceildiv(iceildiv(get_ktotal(args), k_block), k_splits) * k_block;
+    }
+
+    unsigned int get_splitk_tiles() const {
+        return _window_range.total_size() / _k_splits;
+    }
+
+    size_t get_partials_size() const {
+        return static_cast<size_t>(_k_splits) * _args._nmulti * _args._nbatches * _args._Msize * _args._Nsize * sizeof(Tr);
+    }
+
     // New N blocking strategy: if it's narrow, or much taller than it is wide, do the full width.  Otherwise do a
     // single block.
     static unsigned int compute_n_block(const GemmArgs &args, const OutputStage os = {}) {
@@ -398,8 +446,10 @@ public:
                 _rounded_Ksize(roundup(args._Ksize, strategy::k_unroll())),
                 _k_block(compute_k_block(args)), _n_block(compute_n_block(args, os)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
+                _k_splits(compute_k_splits(args, _k_block, _n_block)),
+                _k_split_size(compute_k_split_size(args, _k_block, _k_splits)),
                 _window_range(iceildiv(args._Msize, strategy::out_height()), args._nbatches,
-                              iceildiv(args._Nsize, _n_block), args._nmulti)
+                              iceildiv(args._Nsize, _n_block), args._nmulti * _k_splits)
     {
         // We take a copy of the arguments (not a pointer or reference), but there is no lifetime requirement on the
         // GemmConfig.  Clear out the pointer to avoid accidents.
@@ -412,8 +462,10 @@ public:
                 _rounded_Ksize(roundup(args._Ksize, strategy::k_unroll())),
                 _k_block(compute_k_block(args)), _n_block(compute_n_block(args)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
+                _k_splits(compute_k_splits(args, _k_block, _n_block)),
+                _k_split_size(compute_k_split_size(args, _k_block, _k_splits)),
                 _window_range(iceildiv(args._Msize, strategy::out_height()), args._nbatches,
-                              iceildiv(args._Nsize, _n_block), args._nmulti)
+                              iceildiv(args._Nsize, _n_block), args._nmulti * _k_splits)
     {
         // We take a copy of the arguments (not a pointer or reference), but there is no lifetime requirement on the
         // GemmConfig.  Clear out the pointer to avoid accidents.
@@ -460,15 +512,19 @@ public:
         assert(FixedFormat || _B_transposed);
         static_assert(std::is_same<To, Tloi>::value, "gemm_native: Operand types must be the same.");
 
-        /* For now, each work item implies all the K for a given output
-         * pixel (so we don't need to synchronize access to the output
-         * array).  So separate the loop over K blocks here.  */
+        /* Each work item implies all the K for a given output pixel, or all
+         * the K in one slice in split-K mode (in which case the slices are
+         * combined through the working space).  So separate the loop over K
+         * blocks here.  */
         for (unsigned int k0=0; k0<_Ktotal; k0+=_k_block) {
             unsigned int kmax   = std::min(k0 + _k_block, _Ktotal);
             unsigned int kern_k = roundup(kmax-k0, strategy::k_unroll());
 
-            const bool first_pass = (k0 == 0);
-            const bool last_pass = (kmax == _Ktotal);
+            /* Which K slice this block belongs to, and whether it starts or finishes the slice. */
+            const unsigned int k_split = k0 / _k_split_size;
+            const bool first_pass = (k0 == k_split * _k_split_size);
+            const bool last_pass = (kmax == std::min((k_split + 1) * _k_split_size, _Ktotal));
+            const bool split_k = (_k_splits > 1);
 
             unsigned int first_section = (k0 / _rounded_Ksize);
             unsigned int first_offset  = (k0 % _rounded_Ksize);
@@ -506,8 +562,12 @@ public:
                 const unsigned int batch   = p.dim(1);
                 const unsigned int n0      = p.dim(2) * _n_block;
                 const unsigned int nmax    = std::min(n0 + _n_block, _args._Nsize);
-                const unsigned int multi   = p.dim(3);
+                const unsigned int multi   = p.dim(3) % _args._nmulti;
 
+                // In split-K mode, only do the blocks belonging to this work item's slice.
+                if ((p.dim(3) / _args._nmulti) != k_split) {
+                    continue;
+                }
 
                 // We need to select the appropriate part of the column bias
                 // for quantized cases, but not manipulate a nullptr in
@@ -527,7 +587,12 @@ public:
                                (n0 * kern_k);
                 }
 
-                IndirectOutputArg<Tr> out_arg(g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (batch * g_arrays._C_batch_stride) + (m_start * g_arrays._ldc) + n0, g_arrays._ldc);
+                // Partial results for each slice go to the working space, with no bias or activation.
+                IndirectOutputArg<Tr> out_arg = split_k ?
+                    IndirectOutputArg<Tr>(_splitk_partials + (((k_split * _args._nmulti + multi) * _args._nbatches + batch) * _args._Msize + m_start) * _args._Nsize + n0, _args._Nsize) :
+                    IndirectOutputArg<Tr>(g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (batch * g_arrays._C_batch_stride) + (m_start * g_arrays._ldc) + n0, g_arrays._ldc);
+                const Tr * const bias_ptr = (g_arrays._bias && first_pass && !split_k) ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n0 : nullptr;
+                const Activation act = (last_pass && !split_k) ? _args._act : Activation();
 
 #ifdef CYCLE_PROFILING
                 auto p = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)(m_end - m_start) * kern_k * roundup(nmax-n0, strategy::out_width()));
@@ -540,8 +605,7 @@ public:
                                  strat, sections, string_lengths.data(),
                                  IndirectInputArg<To>(_indirect_buf + (multi * _args._nbatches * _args._Ksections) + (batch * _args._Ksections) + first_section, m_start, first_offset),
                                  (m_end - m_start), (nmax - n0), kern_k, b_panel, g_arrays._ldb, out_arg,
-                                 (g_arrays._bias && first_pass) ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n0 : nullptr,
-                                 last_pass ? _args._act : Activation(),
+                                 bias_ptr, act,
                                  !first_pass || _args._accumulate,
                                  // Quantization parameters
                                  _os, offset_col_bias, n0);
@@ -573,8 +637,7 @@ public:
                                  strat, sections, string_lengths.data(),
                                  IndirectInputArg<To>(in_row_strings.data(), 0, first_offset),
                                  (m_end - m_start), (nmax - n0), kern_k, b_panel, g_arrays._ldb, out_arg,
-                                 (g_arrays._bias && first_pass) ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n0 : nullptr,
-                                 last_pass ? _args._act : Activation(),
+                                 bias_ptr, act,
                                  !first_pass || _args._accumulate,
                                  // Quantization parameters
                                  _os, offset_col_bias, n0);
@@ -589,12 +652,35 @@ public:
                                  strat, 1, &len,
                                  IndirectInputArg<To>(g_arrays._Aptr + (multi * g_arrays._A_multi_stride) + (batch * g_arrays._A_batch_stride) + m_start * g_arrays._lda + k0, g_arrays._lda),
                                  (m_end - m_start), (nmax - n0), kern_k, b_panel, g_arrays._ldb, out_arg,
-                                 (g_arrays._bias && first_pass) ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n0 : nullptr,
-                                 last_pass ? _args._act : Activation(),
+                                 bias_ptr, act,
                                  !first_pass || _args._accumulate,
                                  // Quantization parameters
                                  _os, offset_col_bias, n0);
                 }
+
+                if (last_pass && !split_k) {
+                    this->apply_epilogue(g_arrays, m_start, m_end, n0, nmax, batch, multi);
+                }
+
+                if (split_k && last_pass) {
+                    // Whoever finishes the last slice of a block of rows produces the final output for it.
+                    for (unsigned int m=m_start; m<m_end; m+=strategy::out_height()) {
+                        const unsigned int m_block = m / strategy::out_height();
+                        const unsigned int tile = ((multi * _window_range.get_size(2) + (n0 / _n_block)) * _args._nbatches + batch) * _window_range.get_size(0) + m_block;
+
+                        if (splitk_arrive(_splitk_counters[tile], _k_splits)) {
+                            const unsigned int rows = std::min(m + strategy::out_height(), _args._Msize) - m;
+
+                            splitk_reduce(g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (batch * g_arrays._C_batch_stride) + (m * g_arrays._ldc) + n0, g_arrays._ldc,
+                                          _splitk_partials + ((multi * _args._nbatches + batch) * _args._Msize + m) * _args._Nsize + n0,
+                                          get_partials_size() / (_k_splits * sizeof(Tr)), _args._Nsize, _k_splits,
+                                          g_arrays._bias ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n0 : nullptr,
+                                          _args._act, rows, nmax - n0);
+
+                            this->apply_epilogue(g_arrays, m, m + rows, n0, nmax, batch, multi);
+                        }
+                    }
+                }
             } while (process_all_rows ? p.next_dim1() : p.next_dim0());
         }
     }
@@ -611,6 +697,23 @@ public:
         execute_common(work_range, thread_locator, threadid, this->_gemm_arrays);
     }
 
+    // Interface implementation - working space (only needed for split-K)
+    size_t get_working_size() const override {
+        if (_k_splits > 1) {
+            return splitk_counters_size(get_splitk_tiles()) + get_partials_size();
+        }
+
+        return 0;
+    }
+
+    void set_working_space(void *buffer) override {
+        if (_k_splits > 1) {
+            // This is called before every run, so the counters always start from zero.
+            _splitk_counters = splitk_reset_counters(buffer, get_splitk_tiles());
+            _splitk_partials = reinterpret_cast<Tr *>(reinterpret_cast<uintptr_t>(buffer) + splitk_counters_size(get_splitk_tiles()));
+        }
+    }
+
     // Interface implementation - pretransposed
     bool B_is_pretransposed() const override {
         return (FixedFormat == false);
@@ -856,6 +959,16 @@ public:
         return c;
     }
 
+    bool set_epilogue(const IGemmEpilogue *epilogue) override {
+        // Epilogues operate on float output values.
+        if (!std::is_same<OutputStage, Nothing>::value || !std::is_same<Tr, float>::value) {
+            return false;
+        }
+
+        this->_epilogue = epilogue;
+        return true;
+    }
+
     void update_quantization_parameters(const Requantize32 &re) override {
         if (std::is_same<OutputStage, Requantize32>::value) {
             Requantize32 *qp = reinterpret_cast<Requantize32 *>(&_os);
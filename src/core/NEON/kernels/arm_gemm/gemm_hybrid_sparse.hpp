@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+#include "arm_gemm/arm_gemm.hpp"
+#include "arm_gemm/ndrange.hpp"
+#include "arm_common/internal/utils.hpp"
+
+#ifdef CYCLE_PROFILING
+#include "arm_common/profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+/* Hybrid GEMM for weights following a 2:4 structured sparsity pattern.
+ *
+ * At pretranspose time B is compressed into panels of out_width()
+ * columns: for each group of group_size() K values and each column only
+ * the (at most) sparse_slots() non-zero values are kept, together with
+ * their position inside the group.  The kernel gathers the matching
+ * activations, halving both the MACs and the weight bandwidth.
+ *
+ * Whether B actually follows the pattern is only known once the data is
+ * seen, so if any group holds too many non-zeros the same layout is
+ * filled with every value of the group instead and the kernel runs
+ * dense.  The slot count is recorded at the start of the buffer so that
+ * set_pretransposed_B_data() can recover it.
+ */
+template<typename strategy, typename To, typename Tr>
+class GemmHybridSparse : public GemmCommon<To, To, Tr> {
+    typedef typename strategy::rhs_operand_type Troi;
+
+    static_assert(std::is_same<To, typename strategy::lhs_operand_type>::value, "gemm_hybrid_sparse: LHS operand types must be the same.");
+    static_assert(std::is_same<To, Troi>::value, "gemm_hybrid_sparse: RHS operand types must be the same.");
+    static_assert(std::is_same<Tr, typename strategy::result_type>::value, "gemm_hybrid_sparse: Result type must be the same.");
+
+    /* Space reserved ahead of the panels for the slot count (keeps the panels 16-byte aligned). */
+    static constexpr size_t _header_size = 16;
+
+    /* const properties set by constructor */
+    const CPUInfo * const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const Activation _act;
+
+    /* Blocking info */
+    const unsigned int _n_block;
+
+    /* Compressed buffer and the number of slots stored per group (sparse_slots() or group_size()). */
+    const uint8_t *_B_compressed=nullptr;
+    unsigned int _slots=0;
+
+    const NDRange<4> _window_range;
+
+    static unsigned int compute_n_block(const GemmArgs &args) {
+        if (args._cfg && args._cfg->outer_block_size) {
+            unsigned int n_block = args._cfg->outer_block_size;
+
+            // Needs to be (at least a single) multiple of the kernel output width.
+            n_block /= strategy::out_width();
+            n_block = std::max(n_block, 1u) * strategy::out_width();
+
+            return n_block;
+        }
+
+        if (args._Nsize <= 64 || (args._Msize / args._Nsize) > 155) {
+            return roundup(args._Nsize, strategy::out_width());
+        }
+
+        return strategy::out_width() * 4;
+    }
+
+    unsigned int n_panels() const {
+        return iceildiv(_Nsize, strategy::out_width());
+    }
+
+    size_t panel_size(unsigned int slots) const {
+        return static_cast<size_t>(iceildiv(_Ksize, strategy::group_size())) * slots * strategy::out_width() * (sizeof(Troi) + sizeof(uint8_t));
+    }
+
+public:
+    GemmHybridSparse(GemmHybridSparse &) = delete;
+    GemmHybridSparse & operator= (GemmHybridSparse &) = delete;
+
+    /* Constructor */
+    GemmHybridSparse(const GemmArgs &args)
+              : _ci(args._ci), _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
+                _nbatches(args._nbatches), _nmulti(args._nmulti),
+                _act(args._act),
+                _n_block(compute_n_block(args)),
+                _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, iceildiv(_Nsize, _n_block), _nmulti) { }
+
+    // Interface implementation - Compulsory functions
+    ndrange_t get_window_size() const override {
+        return { _window_range.total_size() };
+    }
+
+    // This kernel can always be dynamically scheduled.
+    bool supports_dynamic_scheduling() const override {
+        return true;
+    }
+
+    // Execute
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        strategy strat(_ci);
+
+        /* Make sure we've been set up correctly. */
+        assert(_B_compressed);
+
+        const auto   &g_arrays    = this->_gemm_arrays;
+        const size_t  panel_bytes = panel_size(_slots);
+
+        auto p = _window_range.iterator(work_range.get_position(0), work_range.get_position_end(0));
+
+        if (p.done()) {
+            return;
+        }
+
+        do {
+            const unsigned int m_start = p.dim(0) * strategy::out_height();
+            const unsigned int m_end   = std::min(p.dim0_max() * strategy::out_height(), _Msize);
+            const unsigned int batch   = p.dim(1);
+            const unsigned int n0      = p.dim(2) * _n_block;
+            const unsigned int nmax    = std::min(n0 + _n_block, _Nsize);
+            const unsigned int multi   = p.dim(3);
+
+#ifdef CYCLE_PROFILING
+            auto prof_scope = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)(m_end - m_start) * iceildiv(_Ksize, strategy::group_size()) * _slots * roundup(nmax-n0, strategy::out_width()));
+#endif
+
+            for (unsigned int x0=n0; x0<nmax; x0+=strategy::out_width()) {
+                const unsigned int xmax = std::min(x0 + strategy::out_width(), nmax);
+
+                const uint8_t *b_panel = _B_compressed + (static_cast<size_t>(multi) * n_panels() + (x0 / strategy::out_width())) * panel_bytes;
+
+                strat.kernel(g_arrays._Aptr + (multi * g_arrays._A_multi_stride) + (batch * g_arrays._A_batch_stride) + (m_start * g_arrays._lda), g_arrays._lda,
+                             b_panel, _slots,
+                             g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (batch * g_arrays._C_batch_stride) + (m_start * g_arrays._ldc) + x0, g_arrays._ldc,
+                             (m_end - m_start), (xmax - x0), _Ksize,
+                             g_arrays._bias ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + x0 : nullptr,
+                             _act);
+            }
+
+            this->apply_epilogue(g_arrays, m_start, m_end, n0, nmax, batch, multi);
+        } while (p.next_dim1());
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        return (_B_compressed==nullptr);
+    }
+
+    bool B_pretranspose_supports_transpose() const override {
+        return true;
+    }
+
+    // The buffer is sized for the dense fallback, as the sparsity of B is not known yet.
+    size_t get_B_pretransposed_array_size() const override {
+        return _header_size + static_cast<size_t>(_nmulti) * n_panels() * panel_size(strategy::group_size());
+    }
+
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed) override {
+        const unsigned int group_size = strategy::group_size();
+        const unsigned int width      = strategy::out_width();
+
+        auto b_at = [&](unsigned int multi, unsigned int k, unsigned int n) -> Troi {
+            const To *b = B + (multi * B_multi_stride);
+            return transposed ? b[n * ldb + k] : b[k * ldb + n];
+        };
+
+        // Check the pattern holds for every group before choosing the layout.
+        bool is_sparse = true;
+        for (unsigned int multi=0; multi<_nmulti && is_sparse; multi++) {
+            for (unsigned int k0=0; k0<_Ksize && is_sparse; k0+=group_size) {
+                const unsigned int kmax = std::min(k0 + group_size, _Ksize);
+
+                for (unsigned int n=0; n<_Nsize; n++) {
+                    unsigned int nonzeros = 0;
+                    for (unsigned int k=k0; k<kmax; k++) {
+                        nonzeros += (b_at(multi, k, n) != static_cast<Troi>(0)) ? 1 : 0;
+                    }
+                    if (nonzeros > strategy::sparse_slots()) {
+                        is_sparse = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        const unsigned int slots = is_sparse ? strategy::sparse_slots() : group_size;
+
+        uint8_t *buffer = reinterpret_cast<uint8_t *>(in_buffer);
+        *reinterpret_cast<uint32_t *>(buffer) = slots;
+
+        uint8_t *out = buffer + _header_size;
+
+        for (unsigned int multi=0; multi<_nmulti; multi++) {
+            for (unsigned int x0=0; x0<_Nsize; x0+=width) {
+                for (unsigned int k0=0; k0<_Ksize; k0+=group_size) {
+                    const unsigned int kmax = std::min(k0 + group_size, _Ksize);
+
+                    Troi    *values  = reinterpret_cast<Troi *>(out);
+                    uint8_t *offsets = out + slots * width * sizeof(Troi);
+
+                    for (unsigned int x=0; x<width; x++) {
+                        const unsigned int n = x0 + x;
+
+                        unsigned int used = 0;
+                        if (n < _Nsize) {
+                            for (unsigned int k=k0; k<kmax; k++) {
+                                const Troi v = b_at(multi, k, n);
+
+                                // The dense layout keeps every position, zeros included.
+                                if (slots == group_size || v != static_cast<Troi>(0)) {
+                                    values[used * width + x]  = v;
+                                    offsets[used * width + x] = static_cast<uint8_t>((k - k0) * sizeof(Troi));
+                                    used++;
+                                }
+                            }
+                        }
+
+                        // Pad unused slots (and columns past N) with zero weights.
+                        for (; used<slots; used++) {
+                            values[used * width + x]  = static_cast<Troi>(0);
+                            offsets[used * width + x] = 0;
+                        }
+                    }
+
+                    out += slots * width * (sizeof(Troi) + sizeof(uint8_t));
+                }
+            }
+        }
+
+        _B_compressed = buffer + _header_size;
+        _slots        = slots;
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override {
+        const uint8_t *buffer = reinterpret_cast<const uint8_t *>(in_buffer);
+
+        _slots        = *reinterpret_cast<const uint32_t *>(buffer);
+        _B_compressed = buffer + _header_size;
+    }
+
+    bool set_epilogue(const IGemmEpilogue *epilogue) override {
+        // Epilogues operate on float output values.
+        if (!std::is_same<Tr, float>::value) {
+            return false;
+        }
+
+        this->_epilogue = epilogue;
+        return true;
+    }
+
+    GemmConfig get_config() override {
+        GemmConfig c;
+
+        c.outer_block_size = _n_block;
+        c.filter = get_type_name<strategy>();
+        c.weight_format = WeightFormat::SPARSE_2_4;
+
+        return c;
+    }
+};
+
+} // namespace arm_gemm
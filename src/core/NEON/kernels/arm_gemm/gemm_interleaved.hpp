@@ -981,6 +981,10 @@ public:
                             // Accumulation buffer
                             get_accumulation_buffer(accumulation_buffer, start_row, start_x, batch, multi));
 
+                        if (last_pass) {
+                            this->apply_epilogue(g_arrays, start_row, end_row, start_x, end_x, batch, multi);
+                        }
+
                         /* Increment to the next block */
                         start_row += strategy::out_height();
                         if (start_row >= _Msize) {
@@ -1132,6 +1136,10 @@ public:
                             // Accumulation buffer
                             get_accumulation_buffer(accumulation_buffer, y, current.x0(), batch, current.multi()) );
 
+                        if (last_pass) {
+                            this->apply_epilogue(g_arrays, y, ymax, current.x0(), current.xmax(), batch, current.multi());
+                        }
+
                         a_ptr += (strategy::out_height() * a_panel_stride);
                     }
                 }
@@ -1338,6 +1346,16 @@ public:
         }
     }
 
+    bool set_epilogue(const IGemmEpilogue *epilogue) override {
+        // Epilogues operate on float output values.
+        if (!std::is_same<OutputStage, Nothing>::value || !std::is_same<Tr, float>::value) {
+            return false;
+        }
+
+        this->_epilogue = epilogue;
+        return true;
+    }
+
     void set_indirect_parameters(size_t string_len, const Tlo * const * const *ptr) override {
         assert(string_len == _Ksize);
         _indirect_buf = ptr;
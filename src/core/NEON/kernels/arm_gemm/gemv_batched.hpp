@@ -33,7 +33,21 @@ namespace arm_gemm {
 template<typename To, typename Tr>
 class GemvBatched : public GemmCommon<To, To, Tr> {
 private:
+    /* The subgemm sees batches as rows, so map each of its rows back to
+     * the batch it came from before handing it to the caller's epilogue. */
+    class BatchEpilogue : public IGemmEpilogue {
+    public:
+        const IGemmEpilogue *_epilogue = nullptr;
+
+        void apply(void *C, size_t ldc, unsigned int m0, unsigned int rows, unsigned int n0, unsigned int cols, unsigned int, unsigned int multi) const override {
+            for (unsigned int row=0; row<rows; row++) {
+                _epilogue->apply(reinterpret_cast<Tr *>(C) + (row * ldc), ldc, 0, 1, n0, cols, m0 + row, multi);
+            }
+        }
+    };
+
     UniqueGemmCommon<To, To, Tr> _subgemm = nullptr;
+    BatchEpilogue                _batch_epilogue = {};
 
 public:
     GemvBatched(const GemmArgs &args) {
@@ -96,6 +110,12 @@ public:
         _subgemm->set_pretransposed_B_data(buffer);
     }
 
+    bool set_epilogue(const IGemmEpilogue *epilogue) override {
+        _batch_epilogue._epilogue = epilogue;
+
+        return _subgemm->set_epilogue(epilogue != nullptr ? &_batch_epilogue : nullptr);
+    }
+
     GemmConfig get_config() override {
         GemmConfig c = _subgemm->get_config();
 
@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "arm_gemm/arm_gemm.hpp"
+#include "splitk.hpp"
 
 #ifdef CYCLE_PROFILING
 #include "arm_common/profiler.hpp"
@@ -93,6 +94,13 @@ class GemvPretransposed : public GemmCommon<Tlo, Tro, Tr> {
     unsigned int k_block=0;
     unsigned int n_block=0;
 
+    /* Split-K: number of K slices and the (k_unroll aligned) size of each. */
+    unsigned int _k_splits=1;
+    unsigned int _k_split_size=0;
+
+    std::atomic<unsigned int> *_splitk_counters = nullptr;
+    Tr *_splitk_partials = nullptr;
+
     const Troi *_B_pretransposed = nullptr;
 
     OutputStage _os;
@@ -109,6 +117,46 @@ class GemvPretransposed : public GemmCommon<Tlo, Tro, Tr> {
         }
     }
 
+    // Number of out_width blocks in each multi.
+    unsigned int get_window_per_multi() const {
+        return iceildiv(_args._Nsize, strategy::out_width());
+    }
+
+    // Split K if there are not enough column blocks to occupy all the threads.  This is only done when there is no
+    // output stage (the partial results need to be summed before requantizing) and the user didn't ask for a specific
+    // blocking.  Partial results are stored in the output type, so reduced precision outputs are only split in fast
+    // mode.
+    void compute_k_splits() {
+        if (!std::is_same<OutputStage, Nothing>::value || _args._accumulate || k_block != _args._Ksize) {
+            return;
+        }
+
+        if (!std::is_same<Tr, float>::value && !_args._fast_mode) {
+            return;
+        }
+
+        // GEMV is bound by streaming B, so cost everything in elements read.  Slices have a minimum size to keep the
+        // overhead of the extra kernel calls small.
+        constexpr unsigned int min_slice = 256;
+
+        const unsigned int k_round  = roundup(_args._Ksize, strategy::k_unroll());
+        const unsigned int k_blocks = k_round / min_slice;
+
+        const float block_cost  = static_cast<float>(min_slice) * strategy::out_width();
+        const float reduce_cost = static_cast<float>(strategy::out_width());
+
+        const unsigned int splits = splitk_compute_splits(get_window_per_multi() * _args._nmulti, _args._maxthreads, k_blocks, block_cost, reduce_cost);
+
+        if (splits > 1) {
+            _k_split_size = roundup(iceildiv(k_round, splits), strategy::k_unroll());
+            _k_splits     = iceildiv(k_round, _k_split_size);
+        }
+    }
+
+    size_t get_partials_size() const {
+        return static_cast<size_t>(_k_splits) * _args._nmulti * _args._Nsize * sizeof(Tr);
+    }
+
 public:
     GemvPretransposed(GemvPretransposed &) = delete;
     GemvPretransposed & operator= (GemvPretransposed &) = delete;
@@ -129,11 +177,13 @@ public:
         } else {
             n_block = args._Nsize;
         }
+
+        compute_k_splits();
     }
 
-    // Window is number of out_width blocks, times number of multis.
+    // Window is number of out_width blocks, times number of multis, times number of K slices.
     ndrange_t get_window_size() const override {
-        return { iceildiv(_args._Nsize, strategy::out_width()) * _args._nmulti };
+        return { get_window_per_multi() * _args._nmulti * _k_splits };
     }
 
     // Actually execute the GEMV.
@@ -148,44 +198,109 @@ public:
         const auto start = work_range.get_position(0);
         const auto end   = work_range.get_position_end(0);
 
-        /* Break the window values down into multis of interest... */
-        const unsigned int window_per_multi = iceildiv(_args._Nsize, strategy::out_width());
-        const unsigned int multi_0    = start / window_per_multi;
-        const unsigned int multi_end  = end   / window_per_multi;
+        static_assert(std::is_same<Tr, Tri>::value, "GemvPretransposed: Result types must be the same.");
 
-        /* ... and figure out where we start and end in the first and last multi. */
-        const unsigned int n_0   = (start - (multi_0 * window_per_multi)) * strategy::out_width();
-        const unsigned int n_max = (end - (multi_end * window_per_multi)) * strategy::out_width();
+        /* K slices are outermost in the window. */
+        const unsigned int window_per_multi = get_window_per_multi();
+        const unsigned int window_per_split = window_per_multi * _args._nmulti;
 
-        static_assert(std::is_same<Tr, Tri>::value, "GemvPretransposed: Result types must be the same.");
+        for (unsigned int split=start / window_per_split; split<_k_splits && (split * window_per_split) < end; split++) {
+            const unsigned int split_start = std::max<unsigned int>(start, split * window_per_split) - (split * window_per_split);
+            const unsigned int split_end   = std::min<unsigned int>(end, (split + 1) * window_per_split) - (split * window_per_split);
+
+            /* Break the window values down into multis of interest... */
+            const unsigned int multi_0    = split_start / window_per_multi;
+            const unsigned int multi_end  = split_end   / window_per_multi;
+
+            /* ... and figure out where we start and end in the first and last multi. */
+            const unsigned int n_0   = (split_start - (multi_0 * window_per_multi)) * strategy::out_width();
+            const unsigned int n_max = (split_end - (multi_end * window_per_multi)) * strategy::out_width();
 
-        for (unsigned int multi=multi_0; multi<=multi_end; multi++) {
-            const unsigned int n_start = (multi==multi_0) ? n_0 : 0;
-            const unsigned int n_end = (multi==multi_end) ? n_max : _args._Nsize;
+            /* ... and which part of K this slice covers. */
+            const unsigned int k_start = (_k_splits > 1) ? split * _k_split_size : 0;
+            const unsigned int k_end   = (_k_splits > 1) ? std::min(k_start + _k_split_size, _args._Ksize) : _args._Ksize;
 
-            if (n_end <= n_start)
-                continue;
+            for (unsigned int multi=multi_0; multi<=multi_end && multi<_args._nmulti; multi++) {
+                const unsigned int n_start = (multi==multi_0) ? n_0 : 0;
+                const unsigned int n_end = (multi==multi_end) ? std::min(n_max, _args._Nsize) : _args._Nsize;
 
-            for (unsigned int k0=0; k0<_args._Ksize; k0+=k_block) {
-                unsigned int kmax = std::min(k0 + k_block, _args._Ksize);
+                if (n_end <= n_start)
+                    continue;
 
-                for (unsigned int n=n_start; n<n_end; n+=n_block) {
-                    unsigned int nmax = std::min(n + n_block, n_end);
+                for (unsigned int k0=k_start; k0<k_end; k0+=k_block) {
+                    unsigned int kmax = std::min(k0 + k_block, k_end);
+
+                    for (unsigned int n=n_start; n<n_end; n+=n_block) {
+                        unsigned int nmax = std::min(n + n_block, n_end);
 #ifdef CYCLE_PROFILING
-                    auto p = prof.ScopedProfiler(PROFILE_KERNEL, (kmax-k0) * (nmax-n));
+                        auto p = prof.ScopedProfiler(PROFILE_KERNEL, (kmax-k0) * (nmax-n));
 #endif
-                    run_gemv_kernel<OutputStage>::run(strat, g_arrays._Aptr + (multi * g_arrays._A_multi_stride) + k0,
-                                 _B_pretransposed + (multi * _buffer_per_multi) + (n * roundup(_args._Ksize, strategy::k_unroll())) + (k0 * strategy::out_width()),
-                                 g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + n,
-                                 (nmax - n), (kmax-k0),
-                                 g_arrays._bias ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n : nullptr,
-                                 _args._act, (k0 != 0) || _args._accumulate,
-                                 _os, col_bias, n + (_args._Nsize * multi));
+                        const Troi *b_ptr = _B_pretransposed + (multi * _buffer_per_multi) + (n * roundup(_args._Ksize, strategy::k_unroll())) + (k0 * strategy::out_width());
+
+                        if (_k_splits > 1) {
+                            // Partial result for this slice: no bias or activation until all slices are summed.
+                            run_gemv_kernel<OutputStage>::run(strat, g_arrays._Aptr + (multi * g_arrays._A_multi_stride) + k0,
+                                         b_ptr,
+                                         _splitk_partials + ((split * _args._nmulti + multi) * _args._Nsize) + n,
+                                         (nmax - n), (kmax-k0),
+                                         static_cast<const Tr *>(nullptr), Activation(), false,
+                                         _os, col_bias, n + (_args._Nsize * multi));
+                        } else {
+                            run_gemv_kernel<OutputStage>::run(strat, g_arrays._Aptr + (multi * g_arrays._A_multi_stride) + k0,
+                                         b_ptr,
+                                         g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + n,
+                                         (nmax - n), (kmax-k0),
+                                         g_arrays._bias ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n : nullptr,
+                                         _args._act, (k0 != 0) || _args._accumulate,
+                                         _os, col_bias, n + (_args._Nsize * multi));
+                        }
+                    }
+                }
+
+                if (_k_splits == 1) {
+                    this->apply_epilogue(g_arrays, 0, 1, n_start, n_end, 0, multi);
+                }
+
+                if (_k_splits > 1) {
+                    // Whoever finishes the last slice of a block produces the final output for it.
+                    for (unsigned int n=n_start; n<n_end; n+=strategy::out_width()) {
+                        const unsigned int block = (multi * window_per_multi) + (n / strategy::out_width());
+
+                        if (splitk_arrive(_splitk_counters[block], _k_splits)) {
+                            const unsigned int nmax = std::min(n + strategy::out_width(), _args._Nsize);
+
+                            splitk_reduce(g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + n, 0,
+                                          _splitk_partials + (multi * _args._Nsize) + n, static_cast<size_t>(_args._nmulti) * _args._Nsize, 0, _k_splits,
+                                          g_arrays._bias ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n : nullptr,
+                                          _args._act, 1, nmax - n);
+
+                            this->apply_epilogue(g_arrays, 0, 1, n, nmax, 0, multi);
+                        }
+                    }
                 }
             }
         }
     }
 
+    /* Working space - only needed for split-K */
+    size_t get_working_size() const override {
+        if (_k_splits > 1) {
+            return splitk_counters_size(get_window_per_multi() * _args._nmulti) + get_partials_size();
+        }
+
+        return 0;
+    }
+
+    void set_working_space(void *buffer) override {
+        if (_k_splits > 1) {
+            const unsigned int blocks = get_window_per_multi() * _args._nmulti;
+
+            // This is called before every run, so the counters always start from zero.
+            _splitk_counters = splitk_reset_counters(buffer, blocks);
+            _splitk_partials = reinterpret_cast<Tr *>(reinterpret_cast<uintptr_t>(buffer) + splitk_counters_size(blocks));
+        }
+    }
+
     /* Pretransposed interface implementation */
     bool B_is_pretransposed() const override {
         return true;
@@ -214,6 +329,16 @@ public:
         }
     }
 
+    bool set_epilogue(const IGemmEpilogue *epilogue) override {
+        // Epilogues operate on float output values.
+        if (!std::is_same<OutputStage, Nothing>::value || !std::is_same<Tr, float>::value) {
+            return false;
+        }
+
+        this->_epilogue = epilogue;
+        return true;
+    }
+
     void set_quantized_bias(const int32_t *bias, size_t bias_multi_stride) override {
         if (std::is_same<OutputStage, Requantize32>::value) {
             Requantize32 *qp = reinterpret_cast<Requantize32 *>(&_os);
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define ARGLIST  \
+    const float *, size_t, \
+    const uint8_t *, unsigned int, \
+    float *, size_t, \
+    size_t, size_t, size_t, \
+    const float *, Activation
+
+namespace arm_gemm
+{
+// Actual kernel implementations
+void a64_hybrid_fp32_sparse24_mla_4x16( ARGLIST );
+
+/* Hybrid kernel operating on 2:4 structured sparse weights.
+ *
+ * The weights are compressed by GemmHybridSparse into panels of
+ * out_width() columns.  For every group of group_size() consecutive K
+ * values a panel holds, per column, sparse_slots() values followed by
+ * the same number of byte offsets locating the matching activation
+ * inside the group (its position scaled by sizeof(float)).  The
+ * kernel gathers the activations with table lookups so only the stored
+ * values are multiplied.  With group_size() slots the same layout
+ * carries dense weights.
+ */
+class cls_a64_hybrid_fp32_sparse24_mla_4x16
+{
+public:
+    typedef float lhs_operand_type;
+    typedef float rhs_operand_type;
+    typedef float result_type;
+
+    typedef void (*kern_type)( ARGLIST );
+
+    /* Kernel blocking parameters */
+    static constexpr unsigned int out_height()
+    {
+        return 4;
+    }
+
+    static constexpr unsigned int out_width()
+    {
+        return 16;
+    }
+
+    static constexpr unsigned int group_size()
+    {
+        return 4;
+    }
+
+    static constexpr unsigned int sparse_slots()
+    {
+        return 2;
+    }
+
+    kern_type kernel=a64_hybrid_fp32_sparse24_mla_4x16;
+    cls_a64_hybrid_fp32_sparse24_mla_4x16(const CPUInfo *)
+    {
+    }
+};
+
+} // namespace arm_gemm
+
+#undef ARGLIST
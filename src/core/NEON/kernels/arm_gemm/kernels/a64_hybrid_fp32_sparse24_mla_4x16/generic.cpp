@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifdef __aarch64__
+
+#include "arm_gemm/arm_gemm.hpp"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace arm_gemm {
+
+void a64_hybrid_fp32_sparse24_mla_4x16(
+    const float *A, size_t lda, const uint8_t *B_panel, unsigned int slots,
+    float *C, size_t ldc, size_t M, size_t N, size_t K,
+    const float *bias, Activation act
+)
+{
+    float minval = -std::numeric_limits<float>::infinity();
+    float maxval = std::numeric_limits<float>::infinity();
+
+    switch(act.type) {
+        default:
+        case Activation::Type::None:
+            break;
+        case Activation::Type::BoundedReLU:
+            maxval = static_cast<float>(act.param1);
+            /* fall through */
+        case Activation::Type::ReLU:
+            minval = 0.0f;
+            break;
+    }
+
+    const float32x4_t vmin = vdupq_n_f32(minval);
+    const float32x4_t vmax = vdupq_n_f32(maxval);
+
+    // Byte shuffles replicating the offset stored for column (4 * q + j) into the four bytes of lane j, and the byte
+    // position of each lane within its float.
+    static const uint8_t bcast_tbl[4][16] = {
+        { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 },
+        { 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7 },
+        { 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11 },
+        { 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 },
+    };
+    static const uint8_t lane_tbl[16] = { 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+
+    const uint8x16_t bcast[4] = { vld1q_u8(bcast_tbl[0]), vld1q_u8(bcast_tbl[1]), vld1q_u8(bcast_tbl[2]), vld1q_u8(bcast_tbl[3]) };
+    const uint8x16_t lane_bytes = vld1q_u8(lane_tbl);
+
+    const size_t full_groups = K / 4;
+    const size_t groups      = (K + 3) / 4;
+    const size_t group_bytes = slots * 16 * (sizeof(float) + sizeof(uint8_t));
+
+    // Columns past N are zero in the panel, but the bias pointer only covers N entries.
+    float bias_buf[16] = { 0 };
+    if (bias != nullptr) {
+        std::memcpy(bias_buf, bias, N * sizeof(float));
+    }
+
+    for (size_t m0 = 0; m0 < M; m0 += 4) {
+        const size_t rows = std::min<size_t>(M - m0, 4);
+
+        // Missing rows re-read the last valid row, their results are discarded.
+        const float *a_rows[4];
+        for (size_t r = 0; r < 4; r++) {
+            a_rows[r] = A + (m0 + std::min(r, rows - 1)) * lda;
+        }
+
+        float32x4_t acc[4][4];
+        for (unsigned int q = 0; q < 4; q++) {
+            const float32x4_t b = vld1q_f32(bias_buf + q * 4);
+            for (unsigned int r = 0; r < 4; r++) {
+                acc[r][q] = b;
+            }
+        }
+
+        const uint8_t *g_ptr = B_panel;
+        for (size_t g = 0; g < groups; g++, g_ptr += group_bytes) {
+            uint8x16_t a[4];
+            if (g < full_groups) {
+                for (unsigned int r = 0; r < 4; r++) {
+                    a[r] = vreinterpretq_u8_f32(vld1q_f32(a_rows[r] + g * 4));
+                }
+            } else {
+                // K tail: zero the activations beyond K so the padded weights contribute nothing.
+                for (unsigned int r = 0; r < 4; r++) {
+                    float tail[4] = { 0 };
+                    std::memcpy(tail, a_rows[r] + g * 4, (K - g * 4) * sizeof(float));
+                    a[r] = vreinterpretq_u8_f32(vld1q_f32(tail));
+                }
+            }
+
+            const float   *values  = reinterpret_cast<const float *>(g_ptr);
+            const uint8_t *offsets = g_ptr + slots * 16 * sizeof(float);
+
+            for (unsigned int s = 0; s < slots; s++) {
+                const uint8x16_t offs = vld1q_u8(offsets + s * 16);
+
+                for (unsigned int q = 0; q < 4; q++) {
+                    const uint8x16_t  sel = vaddq_u8(vqtbl1q_u8(offs, bcast[q]), lane_bytes);
+                    const float32x4_t w   = vld1q_f32(values + s * 16 + q * 4);
+
+                    for (unsigned int r = 0; r < 4; r++) {
+                        acc[r][q] = vfmaq_f32(acc[r][q], w, vreinterpretq_f32_u8(vqtbl1q_u8(a[r], sel)));
+                    }
+                }
+            }
+        }
+
+        for (size_t r = 0; r < rows; r++) {
+            float *c_row = C + (m0 + r) * ldc;
+
+            if (N == 16) {
+                for (unsigned int q = 0; q < 4; q++) {
+                    vst1q_f32(c_row + q * 4, vminq_f32(vmaxq_f32(acc[r][q], vmin), vmax));
+                }
+            } else {
+                float out_buf[16];
+                for (unsigned int q = 0; q < 4; q++) {
+                    vst1q_f32(out_buf + q * 4, vminq_f32(vmaxq_f32(acc[r][q], vmin), vmax));
+                }
+                std::memcpy(c_row, out_buf, N * sizeof(float));
+            }
+        }
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#include "arm_gemm/arm_gemm.hpp"
+#include "bias_adder.hpp"
+#include "arm_common/internal/utils.hpp"
+
+// Split-K support.
+//
+// When the output is too small to give every thread some work, K can be divided into "slices" which are computed
+// independently.  Each slice writes a partial result for its part of the output into the working space, and a
+// counter per output tile records how many slices have finished.  Whichever thread finishes the last slice of a tile
+// sums the partials and applies bias and activation, so there is no barrier between the two phases.  The partials
+// are always summed in slice order, so the result doesn't depend on how the work was scheduled.
+
+namespace arm_gemm {
+
+// Choose the number of K slices using a simple cost model of the critical path.
+//
+// "units" is the number of independent output tiles (i.e. the window size without splitting), and "k_blocks" the
+// number of indivisible steps along K.  "block_cost" is the cost of one step of one tile, and "reduce_cost" the cost
+// of reading back one set of partials for one tile, in the same (arbitrary) units.
+inline unsigned int splitk_compute_splits(unsigned int units, unsigned int maxthreads, unsigned int k_blocks, float block_cost, float reduce_cost) {
+    if (units == 0 || units >= maxthreads || k_blocks < 2) {
+        return 1;
+    }
+
+    const unsigned int max_splits = std::min(iceildiv(maxthreads, units), k_blocks);
+
+    unsigned int best_splits = 1;
+    float        best_cost   = static_cast<float>(k_blocks) * block_cost;
+
+    for (unsigned int splits=2; splits<=max_splits; splits++) {
+        // Work is handed out in whole tiles, so count how many rounds the busiest thread does...
+        const unsigned int rounds = iceildiv(units * splits, maxthreads);
+        // ... plus the final reduction, which is done by one thread per tile.
+        const float cost = static_cast<float>(rounds * iceildiv(k_blocks, splits)) * block_cost + static_cast<float>(splits) * reduce_cost;
+
+        if (cost < best_cost) {
+            best_cost   = cost;
+            best_splits = splits;
+        }
+    }
+
+    // Slices are made of whole steps, so make sure none of them ends up empty.
+    return iceildiv(k_blocks, iceildiv(k_blocks, best_splits));
+}
+
+// Working space layout: one counter per output tile (padded to a cache line) followed by the partial results.
+inline size_t splitk_counters_size(unsigned int tiles) {
+    return roundup<size_t>(tiles * sizeof(std::atomic<unsigned int>), 64);
+}
+
+inline std::atomic<unsigned int> *splitk_reset_counters(void *working_space, unsigned int tiles) {
+    auto *counters = reinterpret_cast<std::atomic<unsigned int> *>(working_space);
+
+    for (unsigned int i=0; i<tiles; i++) {
+        new (counters + i) std::atomic<unsigned int>(0);
+    }
+
+    return counters;
+}
+
+// Called once a slice of a tile is complete; returns true for the thread that completed the final slice.  The
+// acquire/release ordering makes the other slices' partials visible to that thread.
+inline bool splitk_arrive(std::atomic<unsigned int> &counter, unsigned int splits) {
+    return counter.fetch_add(1, std::memory_order_acq_rel) == (splits - 1);
+}
+
+// Sum the partials for a block of output in slice order, then apply the bias and activation.
+template<typename T>
+void splitk_reduce(T *out, unsigned int ldc, const T *partials, size_t split_stride, unsigned int ldp, unsigned int splits,
+                   const T *bias, Activation act, unsigned int rows, unsigned int cols) {
+    for (unsigned int row=0; row<rows; row++) {
+        for (unsigned int col=0; col<cols; col++) {
+            const T *p = partials + row * ldp + col;
+            T        v = p[0];
+
+            for (unsigned int split=1; split<splits; split++) {
+                v += p[split * split_stride];
+            }
+
+            out[row * ldc + col] = v;
+        }
+    }
+
+    if (bias) {
+        activator<true>(out, ldc, bias, act, rows, cols);
+    } else {
+        activator<false>(out, ldc, static_cast<const T *>(nullptr), act, rows, cols);
+    }
+}
+
+} // namespace arm_gemm
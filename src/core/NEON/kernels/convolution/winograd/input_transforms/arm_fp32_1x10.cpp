@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+void arm_fp32_1x10(
+  const unsigned int n_channels,
+  const float *const input_base,
+  size_t,  // We don't need to stride over rows
+  const size_t input_col_stride,
+  float *outptr,
+  const size_t matrix_stride
+)
+{
+  constexpr int inner_tile_cols = 10;
+
+  // Get pointers into the input tile
+  const float *x_ptrs[inner_tile_cols];
+  for (int j = 0; j < inner_tile_cols; j++)
+  {
+    x_ptrs[j] = input_base + j*input_col_stride;
+  }
+
+  // Vectors used/computed in this kernel.
+  float x[inner_tile_cols];
+  float U[inner_tile_cols];
+
+  // Perform the Winograd input transformation for each channel in the input
+  // tensor.
+  int channels_remaining = n_channels;
+  for (; channels_remaining >= 4; channels_remaining -= 4)
+  {
+    float32x4_t x[inner_tile_cols], U[inner_tile_cols];
+
+    // Load x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x[j] = vld1q_f32(x_ptrs[j]);
+      x_ptrs[j] += 4;
+    }
+
+    // Compute U = x . X
+    U[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[0], 36.0f), x[2], -205.0f), x[4], 273.0f), x[6], -120.0f), x[8], 16.0f);
+    U[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], 36.0f), x[2], -36.0f), x[3], -169.0f), x[4], 169.0f), x[5], 104.0f), x[6], -104.0f), x[7], -16.0f), x[8], 16.0f);
+    U[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -36.0f), x[2], -36.0f), x[3], 169.0f), x[4], 169.0f), x[5], -104.0f), x[6], -104.0f), x[7], 16.0f), x[8], 16.0f);
+    U[3] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], 18.0f), x[2], -9.0f), x[3], -98.0f), x[4], 49.0f), x[5], 112.0f), x[6], -56.0f), x[7], -32.0f), x[8], 16.0f);
+    U[4] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -18.0f), x[2], -9.0f), x[3], 98.0f), x[4], 49.0f), x[5], -112.0f), x[6], -56.0f), x[7], 32.0f), x[8], 16.0f);
+    U[5] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], 36.0f), x[2], -72.0f), x[3], -61.0f), x[4], 122.0f), x[5], 29.0f), x[6], -58.0f), x[7], -4.0f), x[8], 8.0f);
+    U[6] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -36.0f), x[2], -72.0f), x[3], 61.0f), x[4], 122.0f), x[5], -29.0f), x[6], -58.0f), x[7], 4.0f), x[8], 8.0f);
+    U[7] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], 12.0f), x[2], -8.0f), x[3], -63.0f), x[4], 42.0f), x[5], 63.0f), x[6], -42.0f), x[7], -12.0f), x[8], 8.0f);
+    U[8] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -12.0f), x[2], -8.0f), x[3], 63.0f), x[4], 42.0f), x[5], -63.0f), x[6], -42.0f), x[7], 12.0f), x[8], 8.0f);
+    U[9] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], 36.0f), x[3], -205.0f), x[5], 273.0f), x[7], -120.0f), x[9], 16.0f);
+
+    // Store the transformed vector
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      vst1q_f32(outptr + j*matrix_stride, U[j]);
+    }
+    outptr += 4;
+  }
+  for (; channels_remaining >= 2; channels_remaining -= 2)
+  {
+    float32x2_t x[inner_tile_cols], U[inner_tile_cols];
+
+    // Load x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x[j] = vld1_f32(x_ptrs[j]);
+      x_ptrs[j] += 2;
+    }
+
+    // Compute U = x . X
+    U[0] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[0], 36.0f), x[2], -205.0f), x[4], 273.0f), x[6], -120.0f), x[8], 16.0f);
+    U[1] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], 36.0f), x[2], -36.0f), x[3], -169.0f), x[4], 169.0f), x[5], 104.0f), x[6], -104.0f), x[7], -16.0f), x[8], 16.0f);
+    U[2] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], -36.0f), x[2], -36.0f), x[3], 169.0f), x[4], 169.0f), x[5], -104.0f), x[6], -104.0f), x[7], 16.0f), x[8], 16.0f);
+    U[3] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], 18.0f), x[2], -9.0f), x[3], -98.0f), x[4], 49.0f), x[5], 112.0f), x[6], -56.0f), x[7], -32.0f), x[8], 16.0f);
+    U[4] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], -18.0f), x[2], -9.0f), x[3], 98.0f), x[4], 49.0f), x[5], -112.0f), x[6], -56.0f), x[7], 32.0f), x[8], 16.0f);
+    U[5] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], 36.0f), x[2], -72.0f), x[3], -61.0f), x[4], 122.0f), x[5], 29.0f), x[6], -58.0f), x[7], -4.0f), x[8], 8.0f);
+    U[6] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], -36.0f), x[2], -72.0f), x[3], 61.0f), x[4], 122.0f), x[5], -29.0f), x[6], -58.0f), x[7], 4.0f), x[8], 8.0f);
+    U[7] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], 12.0f), x[2], -8.0f), x[3], -63.0f), x[4], 42.0f), x[5], 63.0f), x[6], -42.0f), x[7], -12.0f), x[8], 8.0f);
+    U[8] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], -12.0f), x[2], -8.0f), x[3], 63.0f), x[4], 42.0f), x[5], -63.0f), x[6], -42.0f), x[7], 12.0f), x[8], 8.0f);
+    U[9] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmul_n_f32(x[1], 36.0f), x[3], -205.0f), x[5], 273.0f), x[7], -120.0f), x[9], 16.0f);
+
+    // Store the transformed vector
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      vst1_f32(outptr + j*matrix_stride, U[j]);
+    }
+    outptr += 2;
+  }
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Load x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x[j] = *(x_ptrs[j]++);
+    }
+
+    // Compute U = x . X
+    U[0] = 36*x[0] + -205*x[2] + 273*x[4] + -120*x[6] + 16*x[8];
+    U[1] = 36*x[1] + -36*x[2] + -169*x[3] + 169*x[4] + 104*x[5] + -104*x[6] + -16*x[7] + 16*x[8];
+    U[2] = -36*x[1] + -36*x[2] + 169*x[3] + 169*x[4] + -104*x[5] + -104*x[6] + 16*x[7] + 16*x[8];
+    U[3] = 18*x[1] + -9*x[2] + -98*x[3] + 49*x[4] + 112*x[5] + -56*x[6] + -32*x[7] + 16*x[8];
+    U[4] = -18*x[1] + -9*x[2] + 98*x[3] + 49*x[4] + -112*x[5] + -56*x[6] + 32*x[7] + 16*x[8];
+    U[5] = 36*x[1] + -72*x[2] + -61*x[3] + 122*x[4] + 29*x[5] + -58*x[6] + -4*x[7] + 8*x[8];
+    U[6] = -36*x[1] + -72*x[2] + 61*x[3] + 122*x[4] + -29*x[5] + -58*x[6] + 4*x[7] + 8*x[8];
+    U[7] = 12*x[1] + -8*x[2] + -63*x[3] + 42*x[4] + 63*x[5] + -42*x[6] + -12*x[7] + 8*x[8];
+    U[8] = -12*x[1] + -8*x[2] + 63*x[3] + 42*x[4] + -63*x[5] + -42*x[6] + 12*x[7] + 8*x[8];
+    U[9] = 36*x[1] + -205*x[3] + 273*x[5] + -120*x[7] + 16*x[9];
+
+    // Store the transformed vector
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      *(outptr + j*matrix_stride) = U[j];
+    }
+    outptr++;
+  }
+}
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <arm_neon.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+void arm_fp32_8x8(
+  unsigned int n_channels,
+  const float* const input_base,
+  const size_t input_row_stride,
+  const size_t input_col_stride,
+  float* outptr,
+  const size_t matrix_stride
+)
+{
+  constexpr int inner_tile_rows = 8;
+  constexpr int inner_tile_cols = 8;
+
+  // Get pointers into the input tile
+  const float *x_ptrs[inner_tile_rows][inner_tile_cols];
+  for (int i = 0; i < inner_tile_rows; i++)
+  {
+    // Get a pointer into the row
+    const float* const row_ptr = input_base + i*input_row_stride;
+
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x_ptrs[i][j] = row_ptr + j*input_col_stride;
+    }
+  }
+
+  // Perform the Winograd input transformation for each channel in the input
+  // tensor.
+  int channels_remaining = n_channels;
+  for (; channels_remaining >= 4; channels_remaining -= 4)
+  {
+    // Matrices used/computed in this kernel. XT . x is computed one column
+    // at a time to keep the number of live registers down.
+    float32x4_t x[inner_tile_rows], XTx[inner_tile_rows][inner_tile_cols], U[inner_tile_cols];
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      for (int i = 0; i < inner_tile_rows; i++)
+      {
+        x[i] = vld1q_f32(x_ptrs[i][j]);
+        x_ptrs[i][j] += 4;
+      }
+
+      // XTx[0][j] = -4*x[0] + 21*x[2] + -21*x[4] + 4*x[6];
+      XTx[0][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[0], -4.0f), x[2], 21.0f), x[4], -21.0f), x[6], 4.0f);
+
+      // XTx[1][j] = -4*x[1] + 4*x[2] + 17*x[3] + -17*x[4] + -4*x[5] + 4*x[6];
+      XTx[1][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -4.0f), x[2], 4.0f), x[3], 17.0f), x[4], -17.0f), x[5], -4.0f), x[6], 4.0f);
+
+      // XTx[2][j] = 4*x[1] + 4*x[2] + -17*x[3] + -17*x[4] + 4*x[5] + 4*x[6];
+      XTx[2][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], 4.0f), x[2], 4.0f), x[3], -17.0f), x[4], -17.0f), x[5], 4.0f), x[6], 4.0f);
+
+      // XTx[3][j] = -2*x[1] + 1*x[2] + 10*x[3] + -5*x[4] + -8*x[5] + 4*x[6];
+      XTx[3][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[2], x[1], -2.0f), x[3], 10.0f), x[4], -5.0f), x[5], -8.0f), x[6], 4.0f);
+
+      // XTx[4][j] = 2*x[1] + 1*x[2] + -10*x[3] + -5*x[4] + 8*x[5] + 4*x[6];
+      XTx[4][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[2], x[1], 2.0f), x[3], -10.0f), x[4], -5.0f), x[5], 8.0f), x[6], 4.0f);
+
+      // XTx[5][j] = -4*x[1] + 8*x[2] + 5*x[3] + -10*x[4] + -1*x[5] + 2*x[6];
+      XTx[5][j] = vmlaq_n_f32(vsubq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -4.0f), x[2], 8.0f), x[3], 5.0f), x[4], -10.0f), x[5]), x[6], 2.0f);
+
+      // XTx[6][j] = 4*x[1] + 8*x[2] + -5*x[3] + -10*x[4] + 1*x[5] + 2*x[6];
+      XTx[6][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[5], x[1], 4.0f), x[2], 8.0f), x[3], -5.0f), x[4], -10.0f), x[6], 2.0f);
+
+      // XTx[7][j] = -4*x[1] + 21*x[3] + -21*x[5] + 4*x[7];
+      XTx[7][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x[1], -4.0f), x[3], 21.0f), x[5], -21.0f), x[7], 4.0f);
+    }
+
+    // Compute U = XT . x . X and store the transformed matrix
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      U[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(XTx[i][0], -4.0f), XTx[i][2], 21.0f), XTx[i][4], -21.0f), XTx[i][6], 4.0f);
+      U[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(XTx[i][1], -4.0f), XTx[i][2], 4.0f), XTx[i][3], 17.0f), XTx[i][4], -17.0f), XTx[i][5], -4.0f), XTx[i][6], 4.0f);
+      U[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(XTx[i][1], 4.0f), XTx[i][2], 4.0f), XTx[i][3], -17.0f), XTx[i][4], -17.0f), XTx[i][5], 4.0f), XTx[i][6], 4.0f);
+      U[3] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][2], XTx[i][1], -2.0f), XTx[i][3], 10.0f), XTx[i][4], -5.0f), XTx[i][5], -8.0f), XTx[i][6], 4.0f);
+      U[4] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][2], XTx[i][1], 2.0f), XTx[i][3], -10.0f), XTx[i][4], -5.0f), XTx[i][5], 8.0f), XTx[i][6], 4.0f);
+      U[5] = vmlaq_n_f32(vsubq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(XTx[i][1], -4.0f), XTx[i][2], 8.0f), XTx[i][3], 5.0f), XTx[i][4], -10.0f), XTx[i][5]), XTx[i][6], 2.0f);
+      U[6] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][5], XTx[i][1], 4.0f), XTx[i][2], 8.0f), XTx[i][3], -5.0f), XTx[i][4], -10.0f), XTx[i][6], 2.0f);
+      U[7] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(XTx[i][1], -4.0f), XTx[i][3], 21.0f), XTx[i][5], -21.0f), XTx[i][7], 4.0f);
+
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        vst1q_f32(outptr + (i*inner_tile_cols + j)*matrix_stride, U[j]);
+      }
+    }
+    outptr += 4;
+  }
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Matrices used/computed in this kernel
+    float x[inner_tile_rows], XTx[inner_tile_rows][inner_tile_cols], U[inner_tile_cols];
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      for (int i = 0; i < inner_tile_rows; i++)
+      {
+        x[i] = *(x_ptrs[i][j]++);
+      }
+
+      XTx[0][j] = -4*x[0] + 21*x[2] + -21*x[4] + 4*x[6];
+      XTx[1][j] = -4*x[1] + 4*x[2] + 17*x[3] + -17*x[4] + -4*x[5] + 4*x[6];
+      XTx[2][j] = 4*x[1] + 4*x[2] + -17*x[3] + -17*x[4] + 4*x[5] + 4*x[6];
+      XTx[3][j] = -2*x[1] + 1*x[2] + 10*x[3] + -5*x[4] + -8*x[5] + 4*x[6];
+      XTx[4][j] = 2*x[1] + 1*x[2] + -10*x[3] + -5*x[4] + 8*x[5] + 4*x[6];
+      XTx[5][j] = -4*x[1] + 8*x[2] + 5*x[3] + -10*x[4] + -1*x[5] + 2*x[6];
+      XTx[6][j] = 4*x[1] + 8*x[2] + -5*x[3] + -10*x[4] + 1*x[5] + 2*x[6];
+      XTx[7][j] = -4*x[1] + 21*x[3] + -21*x[5] + 4*x[7];
+    }
+
+    // Compute U = XT . x . X and store the transformed matrix
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      U[0] = -4*XTx[i][0] + 21*XTx[i][2] + -21*XTx[i][4] + 4*XTx[i][6];
+      U[1] = -4*XTx[i][1] + 4*XTx[i][2] + 17*XTx[i][3] + -17*XTx[i][4] + -4*XTx[i][5] + 4*XTx[i][6];
+      U[2] = 4*XTx[i][1] + 4*XTx[i][2] + -17*XTx[i][3] + -17*XTx[i][4] + 4*XTx[i][5] + 4*XTx[i][6];
+      U[3] = -2*XTx[i][1] + 1*XTx[i][2] + 10*XTx[i][3] + -5*XTx[i][4] + -8*XTx[i][5] + 4*XTx[i][6];
+      U[4] = 2*XTx[i][1] + 1*XTx[i][2] + -10*XTx[i][3] + -5*XTx[i][4] + 8*XTx[i][5] + 4*XTx[i][6];
+      U[5] = -4*XTx[i][1] + 8*XTx[i][2] + 5*XTx[i][3] + -10*XTx[i][4] + -1*XTx[i][5] + 2*XTx[i][6];
+      U[6] = 4*XTx[i][1] + 8*XTx[i][2] + -5*XTx[i][3] + -10*XTx[i][4] + 1*XTx[i][5] + 2*XTx[i][6];
+      U[7] = -4*XTx[i][1] + 21*XTx[i][3] + -21*XTx[i][5] + 4*XTx[i][7];
+
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        *(outptr + (i*inner_tile_cols + j)*matrix_stride) = U[j];
+      }
+    }
+    outptr++;
+  }
+}
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE)
+
+#include <arm_sve.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+void sve_fp32_8x8(
+  const unsigned int n_channels,
+  const float *input_base,
+  const size_t input_row_stride,
+  const size_t input_col_stride,
+  float *outptr,
+  const size_t matrix_stride
+)
+{
+  constexpr unsigned int inner_tile_rows = 8, inner_tile_cols = 8;
+
+  for (unsigned int c = 0; c < n_channels; c += svcntw())
+  {
+    const svbool_t pg = svwhilelt_b32(c, n_channels);
+
+    // Compute XT . x one column at a time, staging the result in the output
+    // matrices.
+    for (unsigned int j = 0; j < inner_tile_cols; j++)
+    {
+      const float *const col_ptr = input_base + j*input_col_stride + c;
+      const svfloat32_t x0 = svld1_f32(pg, col_ptr + 0*input_row_stride);
+      const svfloat32_t x1 = svld1_f32(pg, col_ptr + 1*input_row_stride);
+      const svfloat32_t x2 = svld1_f32(pg, col_ptr + 2*input_row_stride);
+      const svfloat32_t x3 = svld1_f32(pg, col_ptr + 3*input_row_stride);
+      const svfloat32_t x4 = svld1_f32(pg, col_ptr + 4*input_row_stride);
+      const svfloat32_t x5 = svld1_f32(pg, col_ptr + 5*input_row_stride);
+      const svfloat32_t x6 = svld1_f32(pg, col_ptr + 6*input_row_stride);
+      const svfloat32_t x7 = svld1_f32(pg, col_ptr + 7*input_row_stride);
+
+      float *const XTx_ptr = outptr + j*matrix_stride + c;
+      svst1_f32(pg, XTx_ptr + 0*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, x0, -4.0f), x2, 21.0f), x4, -21.0f), x6, 4.0f));
+      svst1_f32(pg, XTx_ptr + 8*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, x1, -4.0f), x2, 4.0f), x3, 17.0f), x4, -17.0f), x5, -4.0f), x6, 4.0f));
+      svst1_f32(pg, XTx_ptr + 16*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, x1, 4.0f), x2, 4.0f), x3, -17.0f), x4, -17.0f), x5, 4.0f), x6, 4.0f));
+      svst1_f32(pg, XTx_ptr + 24*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, x2, x1, -2.0f), x3, 10.0f), x4, -5.0f), x5, -8.0f), x6, 4.0f));
+      svst1_f32(pg, XTx_ptr + 32*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, x2, x1, 2.0f), x3, -10.0f), x4, -5.0f), x5, 8.0f), x6, 4.0f));
+      svst1_f32(pg, XTx_ptr + 40*matrix_stride, svmla_n_f32_x(pg, svsub_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, x1, -4.0f), x2, 8.0f), x3, 5.0f), x4, -10.0f), x5), x6, 2.0f));
+      svst1_f32(pg, XTx_ptr + 48*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, x5, x1, 4.0f), x2, 8.0f), x3, -5.0f), x4, -10.0f), x6, 2.0f));
+      svst1_f32(pg, XTx_ptr + 56*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, x1, -4.0f), x3, 21.0f), x5, -21.0f), x7, 4.0f));
+    }
+
+    // Compute U = XT . x . X one row at a time, overwriting the staged values.
+    for (unsigned int i = 0; i < inner_tile_rows; i++)
+    {
+      float *const row_ptr = outptr + i*inner_tile_cols*matrix_stride + c;
+      const svfloat32_t XTx0 = svld1_f32(pg, row_ptr + 0*matrix_stride);
+      const svfloat32_t XTx1 = svld1_f32(pg, row_ptr + 1*matrix_stride);
+      const svfloat32_t XTx2 = svld1_f32(pg, row_ptr + 2*matrix_stride);
+      const svfloat32_t XTx3 = svld1_f32(pg, row_ptr + 3*matrix_stride);
+      const svfloat32_t XTx4 = svld1_f32(pg, row_ptr + 4*matrix_stride);
+      const svfloat32_t XTx5 = svld1_f32(pg, row_ptr + 5*matrix_stride);
+      const svfloat32_t XTx6 = svld1_f32(pg, row_ptr + 6*matrix_stride);
+      const svfloat32_t XTx7 = svld1_f32(pg, row_ptr + 7*matrix_stride);
+
+      svst1_f32(pg, row_ptr + 0*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, XTx0, -4.0f), XTx2, 21.0f), XTx4, -21.0f), XTx6, 4.0f));
+      svst1_f32(pg, row_ptr + 1*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, XTx1, -4.0f), XTx2, 4.0f), XTx3, 17.0f), XTx4, -17.0f), XTx5, -4.0f), XTx6, 4.0f));
+      svst1_f32(pg, row_ptr + 2*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, XTx1, 4.0f), XTx2, 4.0f), XTx3, -17.0f), XTx4, -17.0f), XTx5, 4.0f), XTx6, 4.0f));
+      svst1_f32(pg, row_ptr + 3*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, XTx2, XTx1, -2.0f), XTx3, 10.0f), XTx4, -5.0f), XTx5, -8.0f), XTx6, 4.0f));
+      svst1_f32(pg, row_ptr + 4*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, XTx2, XTx1, 2.0f), XTx3, -10.0f), XTx4, -5.0f), XTx5, 8.0f), XTx6, 4.0f));
+      svst1_f32(pg, row_ptr + 5*matrix_stride, svmla_n_f32_x(pg, svsub_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, XTx1, -4.0f), XTx2, 8.0f), XTx3, 5.0f), XTx4, -10.0f), XTx5), XTx6, 2.0f));
+      svst1_f32(pg, row_ptr + 6*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, XTx5, XTx1, 4.0f), XTx2, 8.0f), XTx3, -5.0f), XTx4, -10.0f), XTx6, 2.0f));
+      svst1_f32(pg, row_ptr + 7*matrix_stride, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmul_n_f32_x(pg, XTx1, -4.0f), XTx3, 21.0f), XTx5, -21.0f), XTx7, 4.0f));
+    }
+  }
+}
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,12 +38,15 @@ namespace input_transform {
 void sme_fp32_mla_6x6(unsigned int, const float *, size_t, size_t, float *, size_t);
 #endif  // defined(ARM_COMPUTE_ENABLE_SME)
 void sve_fp32_6x6(unsigned int, const float *, size_t, size_t, float *, size_t);
+void sve_fp32_8x8(unsigned int, const float *, size_t, size_t, float *, size_t);
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 void a64_fp32_6x6(unsigned int, const float *, size_t, size_t, float *, size_t);
 #else  // defined(__aarch64__)
 void arm_fp32_6x6(unsigned int, const float *, size_t, size_t, float *, size_t);
 #endif  // defined(__aarch64__)
+void arm_fp32_8x8(unsigned int, const float *, size_t, size_t, float *, size_t);
 void arm_fp32_4x4(unsigned int, const float *, size_t, size_t, float *, size_t);
+void arm_fp32_1x10(const unsigned int, const float *const, size_t, const size_t, float *, const size_t);
 void arm_fp32_1x8(const unsigned int, const float *const, size_t, const size_t, float *, const size_t);
 
 #define IMPL(HEIGHT, WIDTH, FUNC, DRIVER) new Transform ## DRIVER <float, float>(#FUNC, HEIGHT, WIDTH, FUNC)
@@ -55,14 +58,18 @@ static const TransformImplementation<float> transforms_fp32[] = {
   { IMPL(6, 6, sme_fp32_mla_6x6, Unpadded), MethodConstraints::RequiresSME },
 #endif  // defined(ARM_COMPUTE_ENABLE_SME)
   { IMPL(6, 6, sve_fp32_6x6, Unpadded), MethodConstraints::RequiresSVE },
+  { IMPL(8, 8, sve_fp32_8x8, Unpadded), MethodConstraints::RequiresSVE },
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
   { IMPL(6, 6, a64_fp32_6x6, Unpadded) },
 #else  // defined(__aarch64__)
   { IMPL(6, 6, arm_fp32_6x6, Unpadded) },
 #endif  // defined(__aarch64__)
+  { IMPL(8, 8, arm_fp32_8x8, Unpadded) },
   { IMPL(4, 4, arm_fp32_4x4, Unpadded) },
   { IMPL(1, 8, arm_fp32_1x8, Unpadded) },
   { new TransformUnpadded<float, float>("arm_fp32_1x8", 8, 1, TransformUnpadded<float, float>::get_transposed_kernel(arm_fp32_1x8)) },
+  { IMPL(1, 10, arm_fp32_1x10, Unpadded) },
+  { new TransformUnpadded<float, float>("arm_fp32_1x10", 10, 1, TransformUnpadded<float, float>::get_transposed_kernel(arm_fp32_1x10)) },
   { nullptr },
 };
 
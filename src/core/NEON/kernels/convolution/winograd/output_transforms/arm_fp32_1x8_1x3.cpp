@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+void arm_fp32_1x8_1x3(
+  unsigned int n_channels,
+  const float* inptr,
+  const size_t matrix_stride,
+  const float* bptr,
+  float *outptr,
+  size_t,  // No need to stride across rows
+  const size_t output_col_stride,
+  const float output_min,
+  const float output_max
+)
+{
+  constexpr unsigned int inner_tile_cols = 10, output_tile_cols = 8;
+
+  // For each channel of the output
+  for (; n_channels >= 4; n_channels -= 4)
+  {
+    // Matrices used and computed during this transform
+    float32x4_t F[inner_tile_cols], f[output_tile_cols], b = vdupq_n_f32(0.0f);
+
+    // Read a 1x10 tile in the Winograd domain
+    for (auto j = 0u; j < inner_tile_cols; j++)
+    {
+      F[j] = vld1q_f32(inptr + j*matrix_stride);
+    }
+    inptr += 4;
+
+    f[0] = vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(F[0], F[1]), F[2]), F[3]), F[4]), F[5]), F[6]), F[7]), F[8]);
+    f[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -2.0f), F[4], 2.0f), F[5], -0.5f), F[6], 0.5f), F[7], -1.5f), F[8], 1.5f);
+    f[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(F[1], F[2]), F[3], 4.0f), F[4], 4.0f), F[5], 0.25f), F[6], 0.25f), F[7], 2.25f), F[8], 2.25f);
+    f[3] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -8.0f), F[4], 8.0f), F[5], -0.125f), F[6], 0.125f), F[7], -3.375f), F[8], 3.375f);
+    f[4] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(F[1], F[2]), F[3], 16.0f), F[4], 16.0f), F[5], 0.0625f), F[6], 0.0625f), F[7], 5.0625f), F[8], 5.0625f);
+    f[5] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -32.0f), F[4], 32.0f), F[5], -0.03125f), F[6], 0.03125f), F[7], -7.59375f), F[8], 7.59375f);
+    f[6] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(F[1], F[2]), F[3], 64.0f), F[4], 64.0f), F[5], 0.015625f), F[6], 0.015625f), F[7], 11.390625f), F[8], 11.390625f);
+    f[7] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -128.0f), F[4], 128.0f), F[5], -0.0078125f), F[6], 0.0078125f), F[7], -17.0859375f), F[8], 17.0859375f), F[9]);
+
+    // Write out the output tile
+    if (bptr != 0)
+    {
+      b = vld1q_f32(bptr);
+      bptr += 4;
+    }
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      const auto y = vminq_f32(vmaxq_f32(f[j] + b, vdupq_n_f32(output_min)),
+                               vdupq_n_f32(output_max));
+      vst1q_f32(outptr + j*output_col_stride, y);
+    }
+    outptr += 4;
+  }
+  for (; n_channels >= 2; n_channels -= 2)
+  {
+    // Matrices used and computed during this transform
+    float32x2_t F[inner_tile_cols], f[output_tile_cols], b = vdup_n_f32(0.0f);
+
+    // Read a 1x10 tile in the Winograd domain
+    for (auto j = 0u; j < inner_tile_cols; j++)
+    {
+      F[j] = vld1_f32(inptr + j*matrix_stride);
+    }
+    inptr += 2;
+
+    f[0] = vadd_f32(vadd_f32(vadd_f32(vadd_f32(vadd_f32(vadd_f32(vadd_f32(vadd_f32(F[0], F[1]), F[2]), F[3]), F[4]), F[5]), F[6]), F[7]), F[8]);
+    f[1] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vsub_f32(F[2], F[1]), F[3], -2.0f), F[4], 2.0f), F[5], -0.5f), F[6], 0.5f), F[7], -1.5f), F[8], 1.5f);
+    f[2] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vadd_f32(F[1], F[2]), F[3], 4.0f), F[4], 4.0f), F[5], 0.25f), F[6], 0.25f), F[7], 2.25f), F[8], 2.25f);
+    f[3] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vsub_f32(F[2], F[1]), F[3], -8.0f), F[4], 8.0f), F[5], -0.125f), F[6], 0.125f), F[7], -3.375f), F[8], 3.375f);
+    f[4] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vadd_f32(F[1], F[2]), F[3], 16.0f), F[4], 16.0f), F[5], 0.0625f), F[6], 0.0625f), F[7], 5.0625f), F[8], 5.0625f);
+    f[5] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vsub_f32(F[2], F[1]), F[3], -32.0f), F[4], 32.0f), F[5], -0.03125f), F[6], 0.03125f), F[7], -7.59375f), F[8], 7.59375f);
+    f[6] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vadd_f32(F[1], F[2]), F[3], 64.0f), F[4], 64.0f), F[5], 0.015625f), F[6], 0.015625f), F[7], 11.390625f), F[8], 11.390625f);
+    f[7] = vadd_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vsub_f32(F[2], F[1]), F[3], -128.0f), F[4], 128.0f), F[5], -0.0078125f), F[6], 0.0078125f), F[7], -17.0859375f), F[8], 17.0859375f), F[9]);
+
+    // Write out the output tile
+    if (bptr != 0)
+    {
+      b = vld1_f32(bptr);
+      bptr += 2;
+    }
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      const auto y = vmin_f32(vmax_f32(f[j] + b, vdup_n_f32(output_min)),
+                              vdup_n_f32(output_max));
+      vst1_f32(outptr + j*output_col_stride, y);
+    }
+    outptr += 2;
+  }
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed during this transform
+    float F[inner_tile_cols], f[output_tile_cols], b = 0.0f;
+
+    // Read a 1x10 tile in the Winograd domain
+    for (auto j = 0u; j < inner_tile_cols; j++)
+    {
+      F[j] = *(inptr + j*matrix_stride);
+    }
+    inptr++;
+
+    f[0] = 1*F[0] + 1*F[1] + 1*F[2] + 1*F[3] + 1*F[4] + 1*F[5] + 1*F[6] + 1*F[7] + 1*F[8];
+    f[1] = -1*F[1] + 1*F[2] + -2*F[3] + 2*F[4] + -0.5f*F[5] + 0.5f*F[6] + -1.5f*F[7] + 1.5f*F[8];
+    f[2] = 1*F[1] + 1*F[2] + 4*F[3] + 4*F[4] + 0.25f*F[5] + 0.25f*F[6] + 2.25f*F[7] + 2.25f*F[8];
+    f[3] = -1*F[1] + 1*F[2] + -8*F[3] + 8*F[4] + -0.125f*F[5] + 0.125f*F[6] + -3.375f*F[7] + 3.375f*F[8];
+    f[4] = 1*F[1] + 1*F[2] + 16*F[3] + 16*F[4] + 0.0625f*F[5] + 0.0625f*F[6] + 5.0625f*F[7] + 5.0625f*F[8];
+    f[5] = -1*F[1] + 1*F[2] + -32*F[3] + 32*F[4] + -0.03125f*F[5] + 0.03125f*F[6] + -7.59375f*F[7] + 7.59375f*F[8];
+    f[6] = 1*F[1] + 1*F[2] + 64*F[3] + 64*F[4] + 0.015625f*F[5] + 0.015625f*F[6] + 11.390625f*F[7] + 11.390625f*F[8];
+    f[7] = -1*F[1] + 1*F[2] + -128*F[3] + 128*F[4] + -0.0078125f*F[5] + 0.0078125f*F[6] + -17.0859375f*F[7] + 17.0859375f*F[8] + 1*F[9];
+
+    // Write out the output tile
+    if (bptr != 0)
+    {
+      b = *(bptr++);
+    }
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      *(outptr + j*output_col_stride) = std::max(std::min(f[j] + b, output_max), output_min);
+    }
+    outptr++;
+  }
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
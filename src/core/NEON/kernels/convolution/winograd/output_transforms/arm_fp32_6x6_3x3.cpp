@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+void arm_fp32_6x6_3x3(
+  unsigned int n_channels,
+  const float* inptr,
+  const size_t matrix_stride,
+  const float* bptr,
+  float *outptr,
+  const size_t output_row_stride,
+  const size_t output_col_stride,
+  const float output_min,
+  const float output_max
+)
+{
+  constexpr auto inner_tile_rows = 8u, inner_tile_cols = 8u;
+  constexpr auto output_tile_rows = 6u, output_tile_cols = 6u;
+
+  // For each channel of the output
+  for (; n_channels >= 4; n_channels -= 4)
+  {
+    // Matrices used and computed during this transform. The rows of the
+    // Winograd-domain tile are read one at a time to keep register use down.
+    float32x4_t F[inner_tile_cols], FZ[inner_tile_rows][output_tile_cols], f[output_tile_rows][output_tile_cols], b;
+
+    // Compute the matrix F Z
+    for (auto i = 0u; i < inner_tile_rows; i++)
+    {
+      for (auto j = 0u; j < inner_tile_cols; j++)
+      {
+        F[j] = vld1q_f32(inptr + (i*inner_tile_cols + j)*matrix_stride);
+      }
+
+      // FZ[i][0] = 1*F[0] + 1*F[1] + 1*F[2] + 1*F[3] + 1*F[4] + 1*F[5] + 1*F[6];
+      FZ[i][0] = vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(F[0], F[1]), F[2]), F[3]), F[4]), F[5]), F[6]);
+
+      // FZ[i][1] = -1*F[1] + 1*F[2] + -2*F[3] + 2*F[4] + -0.5f*F[5] + 0.5f*F[6];
+      FZ[i][1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -2.0f), F[4], 2.0f), F[5], -0.5f), F[6], 0.5f);
+
+      // FZ[i][2] = 1*F[1] + 1*F[2] + 4*F[3] + 4*F[4] + 0.25f*F[5] + 0.25f*F[6];
+      FZ[i][2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(F[1], F[2]), F[3], 4.0f), F[4], 4.0f), F[5], 0.25f), F[6], 0.25f);
+
+      // FZ[i][3] = -1*F[1] + 1*F[2] + -8*F[3] + 8*F[4] + -0.125f*F[5] + 0.125f*F[6];
+      FZ[i][3] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -8.0f), F[4], 8.0f), F[5], -0.125f), F[6], 0.125f);
+
+      // FZ[i][4] = 1*F[1] + 1*F[2] + 16*F[3] + 16*F[4] + 0.0625f*F[5] + 0.0625f*F[6];
+      FZ[i][4] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(F[1], F[2]), F[3], 16.0f), F[4], 16.0f), F[5], 0.0625f), F[6], 0.0625f);
+
+      // FZ[i][5] = -1*F[1] + 1*F[2] + -32*F[3] + 32*F[4] + -0.03125f*F[5] + 0.03125f*F[6] + 1*F[7];
+      FZ[i][5] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(F[2], F[1]), F[3], -32.0f), F[4], 32.0f), F[5], -0.03125f), F[6], 0.03125f), F[7]);
+    }
+    inptr += 4;
+
+    // Compute the output tile f = ZT F Z
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      f[0][j] = vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vaddq_f32(FZ[0][j], FZ[1][j]), FZ[2][j]), FZ[3][j]), FZ[4][j]), FZ[5][j]), FZ[6][j]);
+      f[1][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(FZ[2][j], FZ[1][j]), FZ[3][j], -2.0f), FZ[4][j], 2.0f), FZ[5][j], -0.5f), FZ[6][j], 0.5f);
+      f[2][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(FZ[1][j], FZ[2][j]), FZ[3][j], 4.0f), FZ[4][j], 4.0f), FZ[5][j], 0.25f), FZ[6][j], 0.25f);
+      f[3][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(FZ[2][j], FZ[1][j]), FZ[3][j], -8.0f), FZ[4][j], 8.0f), FZ[5][j], -0.125f), FZ[6][j], 0.125f);
+      f[4][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(FZ[1][j], FZ[2][j]), FZ[3][j], 16.0f), FZ[4][j], 16.0f), FZ[5][j], 0.0625f), FZ[6][j], 0.0625f);
+      f[5][j] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vsubq_f32(FZ[2][j], FZ[1][j]), FZ[3][j], -32.0f), FZ[4][j], 32.0f), FZ[5][j], -0.03125f), FZ[6][j], 0.03125f), FZ[7][j]);
+    }
+
+    // Write out the output tile
+    if (bptr != nullptr)
+    {
+      b = vld1q_f32(bptr);
+      bptr += 4;
+    }
+    else
+    {
+      b = vdupq_n_f32(0.0f);
+    }
+    for (auto i = 0u; i < output_tile_rows; i++)
+    {
+      for (auto j = 0u; j < output_tile_cols; j++)
+      {
+        const auto y =
+            vmaxq_f32(vminq_f32(vaddq_f32(f[i][j], b), vdupq_n_f32(output_max)),
+                     vdupq_n_f32(output_min));
+        vst1q_f32(outptr + i*output_row_stride + j*output_col_stride, y);
+      }
+    }
+    outptr += 4;
+  }
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed during this transform
+    float F[inner_tile_cols], FZ[inner_tile_rows][output_tile_cols], f[output_tile_rows][output_tile_cols], b;
+
+    // Compute the matrix F Z
+    for (auto i = 0u; i < inner_tile_rows; i++)
+    {
+      for (auto j = 0u; j < inner_tile_cols; j++)
+      {
+        F[j] = *(inptr + (i*inner_tile_cols + j)*matrix_stride);
+      }
+
+      FZ[i][0] = 1*F[0] + 1*F[1] + 1*F[2] + 1*F[3] + 1*F[4] + 1*F[5] + 1*F[6];
+      FZ[i][1] = -1*F[1] + 1*F[2] + -2*F[3] + 2*F[4] + -0.5f*F[5] + 0.5f*F[6];
+      FZ[i][2] = 1*F[1] + 1*F[2] + 4*F[3] + 4*F[4] + 0.25f*F[5] + 0.25f*F[6];
+      FZ[i][3] = -1*F[1] + 1*F[2] + -8*F[3] + 8*F[4] + -0.125f*F[5] + 0.125f*F[6];
+      FZ[i][4] = 1*F[1] + 1*F[2] + 16*F[3] + 16*F[4] + 0.0625f*F[5] + 0.0625f*F[6];
+      FZ[i][5] = -1*F[1] + 1*F[2] + -32*F[3] + 32*F[4] + -0.03125f*F[5] + 0.03125f*F[6] + 1*F[7];
+    }
+    inptr++;
+
+    // Compute the output tile f = ZT F Z
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      f[0][j] = 1*FZ[0][j] + 1*FZ[1][j] + 1*FZ[2][j] + 1*FZ[3][j] + 1*FZ[4][j] + 1*FZ[5][j] + 1*FZ[6][j];
+      f[1][j] = -1*FZ[1][j] + 1*FZ[2][j] + -2*FZ[3][j] + 2*FZ[4][j] + -0.5f*FZ[5][j] + 0.5f*FZ[6][j];
+      f[2][j] = 1*FZ[1][j] + 1*FZ[2][j] + 4*FZ[3][j] + 4*FZ[4][j] + 0.25f*FZ[5][j] + 0.25f*FZ[6][j];
+      f[3][j] = -1*FZ[1][j] + 1*FZ[2][j] + -8*FZ[3][j] + 8*FZ[4][j] + -0.125f*FZ[5][j] + 0.125f*FZ[6][j];
+      f[4][j] = 1*FZ[1][j] + 1*FZ[2][j] + 16*FZ[3][j] + 16*FZ[4][j] + 0.0625f*FZ[5][j] + 0.0625f*FZ[6][j];
+      f[5][j] = -1*FZ[1][j] + 1*FZ[2][j] + -32*FZ[3][j] + 32*FZ[4][j] + -0.03125f*FZ[5][j] + 0.03125f*FZ[6][j] + 1*FZ[7][j];
+    }
+
+    // Write out the output tile
+    if (bptr != nullptr)
+    {
+      b = *(bptr++);
+    }
+    else
+    {
+      b = 0.0f;
+    }
+    for (auto i = 0u; i < output_tile_rows; i++)
+    {
+      for (auto j = 0u; j < output_tile_cols; j++)
+      {
+        const auto y = std::max(std::min(f[i][j] + b, output_max), output_min);
+        *(outptr + i*output_row_stride + j*output_col_stride) = y;
+      }
+    }
+    outptr++;
+  }
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
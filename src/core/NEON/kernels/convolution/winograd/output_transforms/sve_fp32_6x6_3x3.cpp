@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE)
+
+#include <arm_sve.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+namespace
+{
+
+/* Compute element `col` of F Z for one row of the Winograd-domain tile; `F`
+ * points to the first matrix of the row.
+ */
+template <unsigned int col>
+inline svfloat32_t compute_FZ(svbool_t pg, const float *F, size_t matrix_stride);
+
+template <>
+inline svfloat32_t compute_FZ<0>(const svbool_t pg, const float *const F, const size_t matrix_stride)
+{
+  const svfloat32_t F0 = svld1_f32(pg, F + 0*matrix_stride);
+  const svfloat32_t F1 = svld1_f32(pg, F + 1*matrix_stride);
+  const svfloat32_t F2 = svld1_f32(pg, F + 2*matrix_stride);
+  const svfloat32_t F3 = svld1_f32(pg, F + 3*matrix_stride);
+  const svfloat32_t F4 = svld1_f32(pg, F + 4*matrix_stride);
+  const svfloat32_t F5 = svld1_f32(pg, F + 5*matrix_stride);
+  const svfloat32_t F6 = svld1_f32(pg, F + 6*matrix_stride);
+  return svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, F0, F1), F2), F3), F4), F5), F6);
+}
+
+template <>
+inline svfloat32_t compute_FZ<1>(const svbool_t pg, const float *const F, const size_t matrix_stride)
+{
+  const svfloat32_t F1 = svld1_f32(pg, F + 1*matrix_stride);
+  const svfloat32_t F2 = svld1_f32(pg, F + 2*matrix_stride);
+  const svfloat32_t F3 = svld1_f32(pg, F + 3*matrix_stride);
+  const svfloat32_t F4 = svld1_f32(pg, F + 4*matrix_stride);
+  const svfloat32_t F5 = svld1_f32(pg, F + 5*matrix_stride);
+  const svfloat32_t F6 = svld1_f32(pg, F + 6*matrix_stride);
+  return svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svsub_f32_x(pg, F2, F1), F3, -2.0f), F4, 2.0f), F5, -0.5f), F6, 0.5f);
+}
+
+template <>
+inline svfloat32_t compute_FZ<2>(const svbool_t pg, const float *const F, const size_t matrix_stride)
+{
+  const svfloat32_t F1 = svld1_f32(pg, F + 1*matrix_stride);
+  const svfloat32_t F2 = svld1_f32(pg, F + 2*matrix_stride);
+  const svfloat32_t F3 = svld1_f32(pg, F + 3*matrix_stride);
+  const svfloat32_t F4 = svld1_f32(pg, F + 4*matrix_stride);
+  const svfloat32_t F5 = svld1_f32(pg, F + 5*matrix_stride);
+  const svfloat32_t F6 = svld1_f32(pg, F + 6*matrix_stride);
+  return svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svadd_f32_x(pg, F1, F2), F3, 4.0f), F4, 4.0f), F5, 0.25f), F6, 0.25f);
+}
+
+template <>
+inline svfloat32_t compute_FZ<3>(const svbool_t pg, const float *const F, const size_t matrix_stride)
+{
+  const svfloat32_t F1 = svld1_f32(pg, F + 1*matrix_stride);
+  const svfloat32_t F2 = svld1_f32(pg, F + 2*matrix_stride);
+  const svfloat32_t F3 = svld1_f32(pg, F + 3*matrix_stride);
+  const svfloat32_t F4 = svld1_f32(pg, F + 4*matrix_stride);
+  const svfloat32_t F5 = svld1_f32(pg, F + 5*matrix_stride);
+  const svfloat32_t F6 = svld1_f32(pg, F + 6*matrix_stride);
+  return svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svsub_f32_x(pg, F2, F1), F3, -8.0f), F4, 8.0f), F5, -0.125f), F6, 0.125f);
+}
+
+template <>
+inline svfloat32_t compute_FZ<4>(const svbool_t pg, const float *const F, const size_t matrix_stride)
+{
+  const svfloat32_t F1 = svld1_f32(pg, F + 1*matrix_stride);
+  const svfloat32_t F2 = svld1_f32(pg, F + 2*matrix_stride);
+  const svfloat32_t F3 = svld1_f32(pg, F + 3*matrix_stride);
+  const svfloat32_t F4 = svld1_f32(pg, F + 4*matrix_stride);
+  const svfloat32_t F5 = svld1_f32(pg, F + 5*matrix_stride);
+  const svfloat32_t F6 = svld1_f32(pg, F + 6*matrix_stride);
+  return svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svadd_f32_x(pg, F1, F2), F3, 16.0f), F4, 16.0f), F5, 0.0625f), F6, 0.0625f);
+}
+
+template <>
+inline svfloat32_t compute_FZ<5>(const svbool_t pg, const float *const F, const size_t matrix_stride)
+{
+  const svfloat32_t F1 = svld1_f32(pg, F + 1*matrix_stride);
+  const svfloat32_t F2 = svld1_f32(pg, F + 2*matrix_stride);
+  const svfloat32_t F3 = svld1_f32(pg, F + 3*matrix_stride);
+  const svfloat32_t F4 = svld1_f32(pg, F + 4*matrix_stride);
+  const svfloat32_t F5 = svld1_f32(pg, F + 5*matrix_stride);
+  const svfloat32_t F6 = svld1_f32(pg, F + 6*matrix_stride);
+  const svfloat32_t F7 = svld1_f32(pg, F + 7*matrix_stride);
+  return svadd_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svsub_f32_x(pg, F2, F1), F3, -32.0f), F4, 32.0f), F5, -0.03125f), F6, 0.03125f), F7);
+}
+
+/* Compute column `col` of the output tile f = ZT F Z, add the bias and clamp.
+ *
+ * Working a column at a time keeps every intermediate in registers at the cost
+ * of re-reading some of the Winograd-domain tile.
+ */
+template <unsigned int col>
+inline void transform_column(const svbool_t pg, const float *const F, const size_t matrix_stride, float *const f,
+                             const size_t output_row_stride, const size_t output_col_stride, const svfloat32_t b,
+                             const svfloat32_t output_min, const svfloat32_t output_max)
+{
+  const svfloat32_t FZ0 = compute_FZ<col>(pg, F + 0*matrix_stride, matrix_stride);
+  const svfloat32_t FZ1 = compute_FZ<col>(pg, F + 8*matrix_stride, matrix_stride);
+  const svfloat32_t FZ2 = compute_FZ<col>(pg, F + 16*matrix_stride, matrix_stride);
+  const svfloat32_t FZ3 = compute_FZ<col>(pg, F + 24*matrix_stride, matrix_stride);
+  const svfloat32_t FZ4 = compute_FZ<col>(pg, F + 32*matrix_stride, matrix_stride);
+  const svfloat32_t FZ5 = compute_FZ<col>(pg, F + 40*matrix_stride, matrix_stride);
+  const svfloat32_t FZ6 = compute_FZ<col>(pg, F + 48*matrix_stride, matrix_stride);
+  const svfloat32_t FZ7 = compute_FZ<col>(pg, F + 56*matrix_stride, matrix_stride);
+
+  float *const outptr = f + col*output_col_stride;
+  const svfloat32_t f0 = svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, svadd_f32_x(pg, FZ0, FZ1), FZ2), FZ3), FZ4), FZ5), FZ6);
+  const svfloat32_t f1 = svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svsub_f32_x(pg, FZ2, FZ1), FZ3, -2.0f), FZ4, 2.0f), FZ5, -0.5f), FZ6, 0.5f);
+  const svfloat32_t f2 = svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svadd_f32_x(pg, FZ1, FZ2), FZ3, 4.0f), FZ4, 4.0f), FZ5, 0.25f), FZ6, 0.25f);
+  const svfloat32_t f3 = svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svsub_f32_x(pg, FZ2, FZ1), FZ3, -8.0f), FZ4, 8.0f), FZ5, -0.125f), FZ6, 0.125f);
+  const svfloat32_t f4 = svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svadd_f32_x(pg, FZ1, FZ2), FZ3, 16.0f), FZ4, 16.0f), FZ5, 0.0625f), FZ6, 0.0625f);
+  const svfloat32_t f5 = svadd_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svmla_n_f32_x(pg, svsub_f32_x(pg, FZ2, FZ1), FZ3, -32.0f), FZ4, 32.0f), FZ5, -0.03125f), FZ6, 0.03125f), FZ7);
+
+  svst1_f32(pg, outptr + 0*output_row_stride, svmax_f32_x(pg, svmin_f32_x(pg, svadd_f32_x(pg, f0, b), output_max), output_min));
+  svst1_f32(pg, outptr + 1*output_row_stride, svmax_f32_x(pg, svmin_f32_x(pg, svadd_f32_x(pg, f1, b), output_max), output_min));
+  svst1_f32(pg, outptr + 2*output_row_stride, svmax_f32_x(pg, svmin_f32_x(pg, svadd_f32_x(pg, f2, b), output_max), output_min));
+  svst1_f32(pg, outptr + 3*output_row_stride, svmax_f32_x(pg, svmin_f32_x(pg, svadd_f32_x(pg, f3, b), output_max), output_min));
+  svst1_f32(pg, outptr + 4*output_row_stride, svmax_f32_x(pg, svmin_f32_x(pg, svadd_f32_x(pg, f4, b), output_max), output_min));
+  svst1_f32(pg, outptr + 5*output_row_stride, svmax_f32_x(pg, svmin_f32_x(pg, svadd_f32_x(pg, f5, b), output_max), output_min));
+}
+
+}  // namespace
+
+void sve_fp32_6x6_3x3(
+  const unsigned int n_channels,
+  const float *inptr,
+  const size_t matrix_stride,
+  const float *bptr,
+  float *outptr,
+  const size_t output_row_stride,
+  const size_t output_col_stride,
+  const float output_min,
+  const float output_max
+)
+{
+  const svfloat32_t vmin = svdup_n_f32(output_min);
+  const svfloat32_t vmax = svdup_n_f32(output_max);
+
+  for (unsigned int c = 0; c < n_channels; c += svcntw())
+  {
+    const svbool_t pg = svwhilelt_b32(c, n_channels);
+    const svfloat32_t b = (bptr != nullptr) ? svld1_f32(pg, bptr + c) : svdup_n_f32(0.0f);
+
+    transform_column<0>(pg, inptr + c, matrix_stride, outptr + c, output_row_stride, output_col_stride, b, vmin, vmax);
+    transform_column<1>(pg, inptr + c, matrix_stride, outptr + c, output_row_stride, output_col_stride, b, vmin, vmax);
+    transform_column<2>(pg, inptr + c, matrix_stride, outptr + c, output_row_stride, output_col_stride, b, vmin, vmax);
+    transform_column<3>(pg, inptr + c, matrix_stride, outptr + c, output_row_stride, output_col_stride, b, vmin, vmax);
+    transform_column<4>(pg, inptr + c, matrix_stride, outptr + c, output_row_stride, output_col_stride, b, vmin, vmax);
+    transform_column<5>(pg, inptr + c, matrix_stride, outptr + c, output_row_stride, output_col_stride, b, vmin, vmax);
+  }
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,10 +33,15 @@ namespace output_transform {
 #if defined(ARM_COMPUTE_ENABLE_SME)
 void sme_fp32_mopa_4x4_3x3(unsigned int, const float *, size_t, const float *, float *, size_t, size_t, float, float);
 #endif  // defined(ARM_COMPUTE_ENABLE_SME)
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+void sve_fp32_6x6_3x3(unsigned int, const float *, size_t, const float *, float *, size_t, size_t, float, float);
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #endif  // defined(__aarch64__)
+void arm_fp32_6x6_3x3(unsigned int, const float *, size_t, const float *, float *, size_t, size_t, float, float);
 void arm_fp32_4x4_3x3(unsigned int, const float *, size_t, const float *, float *, size_t, size_t, float, float);
 void arm_fp32_2x2_3x3(unsigned int, const float *, size_t, const float *, float *, size_t, size_t, float, float);
 void arm_fp32_2x2_5x5(unsigned int, const float *, size_t, const float *, float *, size_t, size_t, float, float);
+void arm_fp32_1x8_1x3(unsigned int, const float *, const size_t, const float *, float *, size_t, const size_t, const float, const float);
 void arm_fp32_1x6_1x3(unsigned int, const float *, const size_t, const float *, float *, size_t, const size_t, const float, const float);
 void arm_fp32_1x4_1x5(unsigned int, const float *, const size_t, const float *, float *, size_t, const size_t, const float, const float);
 void arm_fp32_1x2_1x7(unsigned int, const float *, const size_t, const float *, float *, size_t, const size_t, const float, const float);
@@ -52,10 +57,16 @@ static const TransformImplementation<float> transforms_fp32[] = {
 #if defined(ARM_COMPUTE_ENABLE_SME)
   { IMPL(4, 4, 3, 3, sme_fp32_mopa_4x4_3x3, Unpadded), MethodConstraints::RequiresSME },
 #endif  // defined(ARM_COMPUTE_ENABLE_SME)
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+  { IMPL(6, 6, 3, 3, sve_fp32_6x6_3x3, Unpadded), MethodConstraints::RequiresSVE | MethodConstraints::LargerShape | MethodConstraints::FastMode },
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #endif  // defined(__aarch64__)
+  { IMPL(6, 6, 3, 3, arm_fp32_6x6_3x3, Unpadded), MethodConstraints::LargerShape | MethodConstraints::FastMode },
   { IMPL(4, 4, 3, 3, arm_fp32_4x4_3x3, Unpadded), MethodConstraints::LargerShape },
   { IMPL(2, 2, 3, 3, arm_fp32_2x2_3x3, Unpadded) },
   { IMPL(2, 2, 5, 5, arm_fp32_2x2_5x5, Unpadded) },
+  { IMPL(1, 8, 1, 3, arm_fp32_1x8_1x3, Unpadded), MethodConstraints::FastMode },
+  { IMPL_T(8, 1, 3, 1, arm_fp32_1x8_1x3, Unpadded), MethodConstraints::FastMode },
   { IMPL(1, 6, 1, 3, arm_fp32_1x6_1x3, Unpadded) },
   { IMPL_T(6, 1, 3, 1, arm_fp32_1x6_1x3, Unpadded) },
   { IMPL(1, 4, 1, 5, arm_fp32_1x4_1x5, Unpadded) },
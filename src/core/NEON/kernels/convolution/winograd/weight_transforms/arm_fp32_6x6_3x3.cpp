@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace weight_transform {
+
+void arm_fp32_6x6_3x3(
+  unsigned int n_channels,
+  const float *inptr, const size_t ld_weight_row, const size_t ld_weight_col,
+  float *outptr, const size_t matrix_stride
+)
+{
+  for (; n_channels >= 4; n_channels -= 4)
+  {
+    // Matrices used and computed in this kernel
+    float32x4_t w[3][3], Ww[8][3], V[8][8];
+
+    // Read weights
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        w[i][j] = vld1q_f32(inptr + i*ld_weight_row + j*ld_weight_col);
+      }
+    }
+
+    // Compute the matrix W w
+    for (int j = 0; j < 3; j++)
+    {
+      Ww[0][j] = vmulq_n_f32(w[0][j], -0.25f);
+      Ww[1][j] = vmulq_n_f32(vsubq_f32(vsubq_f32(w[1][j], w[0][j]), w[2][j]), 1.0f / 18.0f);
+      Ww[2][j] = vmulq_n_f32(vaddq_f32(vaddq_f32(w[0][j], w[1][j]), w[2][j]), -1.0f / 18.0f);
+      Ww[3][j] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(w[0][j], w[1][j], -2.0f), w[2][j], 4.0f), 1.0f / 360.0f);
+      Ww[4][j] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(w[0][j], w[1][j], 2.0f), w[2][j], 4.0f), 1.0f / 360.0f);
+      Ww[5][j] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(w[0][j], 16.0f), w[1][j], -8.0f), w[2][j], 4.0f), 1.0f / 45.0f);
+      Ww[6][j] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(w[0][j], 16.0f), w[1][j], 8.0f), w[2][j], 4.0f), 1.0f / 45.0f);
+      Ww[7][j] = vmulq_n_f32(w[2][j], 0.25f);
+    }
+
+    // Compute V = W w WT
+    for (int i = 0; i < 8; i++)
+    {
+      V[i][0] = vmulq_n_f32(Ww[i][0], -0.25f);
+      V[i][1] = vmulq_n_f32(vsubq_f32(vsubq_f32(Ww[i][1], Ww[i][0]), Ww[i][2]), 1.0f / 18.0f);
+      V[i][2] = vmulq_n_f32(vaddq_f32(vaddq_f32(Ww[i][0], Ww[i][1]), Ww[i][2]), -1.0f / 18.0f);
+      V[i][3] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(Ww[i][0], Ww[i][1], -2.0f), Ww[i][2], 4.0f), 1.0f / 360.0f);
+      V[i][4] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(Ww[i][0], Ww[i][1], 2.0f), Ww[i][2], 4.0f), 1.0f / 360.0f);
+      V[i][5] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(Ww[i][0], 16.0f), Ww[i][1], -8.0f), Ww[i][2], 4.0f), 1.0f / 45.0f);
+      V[i][6] = vmulq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(Ww[i][0], 16.0f), Ww[i][1], 8.0f), Ww[i][2], 4.0f), 1.0f / 45.0f);
+      V[i][7] = vmulq_n_f32(Ww[i][2], 0.25f);
+    }
+
+    // Store the transformed weights
+    for (int i = 0, m = 0; i < 8; i++)
+    {
+      for (int j = 0; j < 8; j++, m++)
+      {
+        vst1q_f32(outptr + m*matrix_stride, V[i][j]);
+      }
+    }
+
+    inptr += 4;
+    outptr += 4;
+  }
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed in this kernel
+    float w[3][3], Ww[8][3], V[8][8];
+
+    // Read weights
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        w[i][j] = *(inptr + i*ld_weight_row + j*ld_weight_col);
+      }
+    }
+
+    // Compute the matrix W w
+    for (int j = 0; j < 3; j++)
+    {
+      Ww[0][j] = (1*w[0][j]) / -4.0f;
+      Ww[1][j] = (-1*w[0][j] + 1*w[1][j] + -1*w[2][j]) / 18.0f;
+      Ww[2][j] = (1*w[0][j] + 1*w[1][j] + 1*w[2][j]) / -18.0f;
+      Ww[3][j] = (1*w[0][j] + -2*w[1][j] + 4*w[2][j]) / 360.0f;
+      Ww[4][j] = (1*w[0][j] + 2*w[1][j] + 4*w[2][j]) / 360.0f;
+      Ww[5][j] = (16*w[0][j] + -8*w[1][j] + 4*w[2][j]) / 45.0f;
+      Ww[6][j] = (16*w[0][j] + 8*w[1][j] + 4*w[2][j]) / 45.0f;
+      Ww[7][j] = (1*w[2][j]) / 4.0f;
+    }
+
+    // Compute V = W w WT
+    for (int i = 0; i < 8; i++)
+    {
+      V[i][0] = (1*Ww[i][0]) / -4.0f;
+      V[i][1] = (-1*Ww[i][0] + 1*Ww[i][1] + -1*Ww[i][2]) / 18.0f;
+      V[i][2] = (1*Ww[i][0] + 1*Ww[i][1] + 1*Ww[i][2]) / -18.0f;
+      V[i][3] = (1*Ww[i][0] + -2*Ww[i][1] + 4*Ww[i][2]) / 360.0f;
+      V[i][4] = (1*Ww[i][0] + 2*Ww[i][1] + 4*Ww[i][2]) / 360.0f;
+      V[i][5] = (16*Ww[i][0] + -8*Ww[i][1] + 4*Ww[i][2]) / 45.0f;
+      V[i][6] = (16*Ww[i][0] + 8*Ww[i][1] + 4*Ww[i][2]) / 45.0f;
+      V[i][7] = (1*Ww[i][2]) / 4.0f;
+    }
+
+    // Store the transformed weights
+    for (int i = 0, m = 0; i < 8; i++)
+    {
+      for (int j = 0; j < 8; j++, m++)
+      {
+        *(outptr + m*matrix_stride) = V[i][j];
+      }
+    }
+
+    inptr++;
+    outptr++;
+  }
+}
+
+}  // namespace weight_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,9 +33,11 @@ namespace weight_transform {
 #if defined(ARM_COMPUTE_ENABLE_SVE)
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #endif  // defined(__aarch64__)
+void arm_fp32_6x6_3x3(unsigned int, const float *, size_t, size_t, float *, size_t);
 void arm_fp32_4x4_3x3(unsigned int, const float *, size_t, size_t, float *, size_t);
 void arm_fp32_2x2_3x3(unsigned int, const float *, size_t, size_t, float *, size_t);
 void arm_fp32_2x2_5x5(unsigned int, const float *, size_t, size_t, float *, size_t);
+void cpp_fp32_1x8_1x3(unsigned int, const float *, size_t, size_t, float *, size_t);
 void cpp_fp32_1x6_1x3(unsigned int, const float *, size_t, size_t, float *, size_t);
 void cpp_fp32_1x4_1x5(unsigned int, const float *, size_t, size_t, float *, size_t);
 void cpp_fp32_1x2_1x7(unsigned int, const float *, size_t, size_t, float *, size_t);
@@ -51,9 +53,12 @@ static const TransformImplementation<float> transforms_fp32[] = {
 #if defined(ARM_COMPUTE_ENABLE_SVE)
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #endif  // defined(__aarch64__)
+  { IMPL(3, 3, 8, 8, arm_fp32_6x6_3x3) },
   { IMPL(3, 3, 6, 6, arm_fp32_4x4_3x3) },
   { IMPL(3, 3, 4, 4, arm_fp32_2x2_3x3) },
   { IMPL(5, 5, 6, 6, arm_fp32_2x2_5x5) },
+  { IMPL(1, 3, 1, 10, cpp_fp32_1x8_1x3) },
+  { IMPL_T(3, 1, 10, 1, cpp_fp32_1x8_1x3) },
   { IMPL(1, 3, 1, 8, cpp_fp32_1x6_1x3) },
   { IMPL_T(3, 1, 8, 1, cpp_fp32_1x6_1x3) },
   { IMPL(1, 5, 1, 8, cpp_fp32_1x4_1x5) },
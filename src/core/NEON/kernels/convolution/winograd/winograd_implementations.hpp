@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "winograd.hpp"
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -39,6 +40,7 @@ enum class MethodConstraints
   RequiresSME  = 0x4,
   RequiresSME2 = 0x8,
   LargerShape  = 0x10, // Input tensor shape is larger than the output transform tile shape.
+  FastMode     = 0x20, // Less accurate than the default tiles, only used in fast mode.
 };
 
 constexpr inline bool operator!(const MethodConstraints &c)
@@ -150,6 +152,83 @@ constexpr T iroundup(T num, T den)
 
 }
 
+/* Estimate the cost of a convolution computed with the given output transform,
+ * in units of Winograd-domain multiply-accumulates.
+ *
+ * Larger output tiles need fewer multiplies per output point, but spend more
+ * on the transforms, waste more of the GEMM on partial tiles at the edges of
+ * small feature maps and have more transformed weights to stream. The estimate
+ * adds up:
+ *  - the batched GEMMs, with the number of tiles rounded up to a GEMM block;
+ *  - the input and output transforms, which are applied separably;
+ *  - the traffic for transformed weights and Winograd-domain buffers which do
+ *    not fit in the L2 cache.
+ */
+template <typename TWinogradIn, typename TWinogradOut>
+inline double estimate_cost(
+  const CPUInfo *ci, const ConvolutionArgs &conv_args, const output_transform::ITransform *transform
+)
+{
+  // Cost of a transform operation and of a byte moved beyond the L2 cache,
+  // relative to a multiply-accumulate in the GEMM.
+  constexpr double transform_op_cost = 2.0;
+  constexpr double memory_byte_cost = 2.0;
+  constexpr unsigned int gemm_block_rows = 8;
+
+  const unsigned int in_rows = transform->get_input_rows();
+  const unsigned int in_cols = transform->get_input_cols();
+  const unsigned int out_rows = transform->get_output_rows();
+  const unsigned int out_cols = transform->get_output_cols();
+
+  const double n_matrices = in_rows * in_cols;
+  const unsigned int n_tiles_per_batch = iceildiv(conv_args.output_shape.rows, out_rows) *
+                                         iceildiv(conv_args.output_shape.cols, out_cols);
+  const double n_tiles = static_cast<double>(conv_args.n_batches) * n_tiles_per_batch;
+  const double n_input_channels = conv_args.n_input_channels;
+  const double n_output_channels = conv_args.n_output_channels;
+
+  const double gemm_macs = static_cast<double>(conv_args.n_batches) * iroundup(n_tiles_per_batch, gemm_block_rows) *
+                           n_matrices * n_input_channels * n_output_channels;
+  const double input_ops = n_tiles * n_input_channels * n_matrices * (in_rows + in_cols);
+  const double output_ops = n_tiles * n_output_channels * in_rows * out_cols * (in_cols + out_rows);
+
+  // The transformed weights are read once per batch; the Winograd-domain input
+  // and output are each written once and read back once.
+  const double l2_bytes = ci->get_L2_cache_size();
+  const double weight_bytes = n_matrices * n_input_channels * n_output_channels * sizeof(TWinogradIn);
+  const double buffer_bytes = n_tiles * n_matrices *
+                              (n_input_channels * sizeof(TWinogradIn) + n_output_channels * sizeof(TWinogradOut));
+  const double spilled_bytes = conv_args.n_batches * std::max(0.0, weight_bytes - l2_bytes) +
+                               2.0 * std::max(0.0, buffer_bytes - l2_bytes);
+
+  return gemm_macs + transform_op_cost * (input_ops + output_ops) + memory_byte_cost * spilled_bytes;
+}
+
+template <typename TWinogradOut, typename TOut>
+inline MethodConstraints get_output_transform_constraints(const output_transform::ITransform *transform)
+{
+  for (auto impl = output_transform::implementation_list<TWinogradOut, TOut>();
+       impl->transform.get() != nullptr; impl++)
+  {
+    if (impl->transform.get() == transform)
+    {
+      return impl->constraints;
+    }
+  }
+
+  return MethodConstraints::None;
+}
+
+/* Output transforms which need SME are used whenever they can be, ahead of
+ * the cost model: its estimate does not account for the matrix engine.
+ */
+template <typename TWinogradOut, typename TOut>
+inline bool is_preferred_output_transform(const output_transform::ITransform *transform)
+{
+  return !!(get_output_transform_constraints<TWinogradOut, TOut>(transform) &
+            (MethodConstraints::RequiresSME | MethodConstraints::RequiresSME2));
+}
+
 template <typename TWeight, typename TWinogradIn>
 inline std::vector<const weight_transform::ITransform *> get_weight_transforms(
   const CPUInfo *ci, const ConvolutionArgs &conv_args, const WinogradConfig *cfg
@@ -245,23 +324,36 @@ bool get_implementation(
 )
 {
   // Get vectors of valid weight, input and output transforms; then select the
-  // combination which produces the biggest output tile.
+  // combination which the cost model expects to be cheapest.
   const auto weight_transforms = get_weight_transforms<TWeight, TWinogradIn>(ci, conv_args, cfg);
   const auto input_transforms = get_input_transforms<TIn, TWinogradIn>(ci, conv_args, cfg);
   const auto output_transforms = get_output_transforms<TWinogradOut, TOut>(ci, conv_args, cfg);
 
   // Now attempt to select a complete set of Winograd transformations which can
-  // solve the problem. Work backwards from the output transform to find
-  // matching input implementations.
+  // solve the problem. Work backwards from each output transform to find
+  // matching weight and input implementations; where several complete sets
+  // have the same cost, the one listed first is preferred.
   bool success = false;
+  double best_cost = 0.0;
   for (auto output_transform = output_transforms.cbegin();
-       !success && output_transform != output_transforms.cend();
+       output_transform != output_transforms.cend();
        output_transform++)
   {
+    // The larger tiles trade accuracy for speed, so only consider them when
+    // the caller allows it.
+    if (!fast_mode &&
+        !!(get_output_transform_constraints<TWinogradOut, TOut>(*output_transform) & MethodConstraints::FastMode))
+    {
+      continue;
+    }
+
+    const weight_transform::ITransform *selected_weight_transform = nullptr;
+    const input_transform::ITransform *selected_input_transform = nullptr;
+
     // Look for matching weight transforms, if we find one then we look for
     // matching input transforms.
     for (auto weight_transform = weight_transforms.cbegin();
-         !success && weight_transform != weight_transforms.cend();
+         selected_input_transform == nullptr && weight_transform != weight_transforms.cend();
          weight_transform++)
     {
       // If this weight transform is compatible, then look for a matching input
@@ -270,22 +362,42 @@ bool get_implementation(
           (*output_transform)->get_input_cols() == (*weight_transform)->get_transformed_tile_cols())
       {
         for (auto input_transform = input_transforms.cbegin();
-             !success && input_transform != input_transforms.cend();
+             selected_input_transform == nullptr && input_transform != input_transforms.cend();
              input_transform++)
         {
-          // If the input transform is suitable, then set the configuration and
-          // indicate success.
           if ((*input_transform)->get_input_rows() == (*output_transform)->get_input_rows() &&
               (*input_transform)->get_input_cols() == (*output_transform)->get_input_cols())
           {
-            dest.output_transform = *output_transform;
-            dest.input_transform = *input_transform;
-            dest.weight_transform = *weight_transform;
-            success = true;
+            selected_weight_transform = *weight_transform;
+            selected_input_transform = *input_transform;
           }
         }
       }
     }
+
+    // If this output transform can be used then keep it if it is preferred or
+    // cheaper than anything seen so far.
+    if (selected_input_transform != nullptr)
+    {
+      if (is_preferred_output_transform<TWinogradOut, TOut>(*output_transform))
+      {
+        dest.output_transform = *output_transform;
+        dest.input_transform = selected_input_transform;
+        dest.weight_transform = selected_weight_transform;
+        success = true;
+        break;
+      }
+
+      const double cost = estimate_cost<TWinogradIn, TWinogradOut>(ci, conv_args, *output_transform);
+      if (!success || cost < best_cost)
+      {
+        dest.output_transform = *output_transform;
+        dest.input_transform = selected_input_transform;
+        dest.weight_transform = selected_weight_transform;
+        best_cost = cost;
+        success = true;
+      }
+    }
   }
 
   if (!success)
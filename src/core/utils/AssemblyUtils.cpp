@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -79,6 +79,9 @@ arm_gemm::WeightFormat map_to_arm_gemm_weight_format(const arm_compute::WeightFo
         case arm_compute::WeightFormat::ANY:
             gemm_weight_fromat = arm_gemm::WeightFormat::ANY;
             break;
+        case arm_compute::WeightFormat::SPARSE_2_4:
+            gemm_weight_fromat = arm_gemm::WeightFormat::SPARSE_2_4;
+            break;
         case arm_compute::WeightFormat::OHWI:
             gemm_weight_fromat = arm_gemm::WeightFormat::OHWI;
             break;
@@ -199,6 +202,9 @@ arm_compute::WeightFormat map_to_arm_compute_weight_format(const arm_gemm::Weigh
         case arm_gemm::WeightFormat::ANY:
             acl_weight_fromat = arm_compute::WeightFormat::ANY;
             break;
+        case arm_gemm::WeightFormat::SPARSE_2_4:
+            acl_weight_fromat = arm_compute::WeightFormat::SPARSE_2_4;
+            break;
         case arm_gemm::WeightFormat::OHWI:
             acl_weight_fromat = arm_compute::WeightFormat::OHWI;
             break;
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDeconvolutionCol2ImKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/deconv_col2im/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuDeconvolutionCol2ImKernel::DeconvCol2ImKernel> available_kernels = {
+    {"neon_fp32_deconv_col2im", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_deconv_col2im)},
+    {"neon_fp16_deconv_col2im",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_deconv_col2im)},
+    {"neon_s32_deconv_col2im", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_s32_deconv_col2im)}};
+
+Status validate_arguments(const ITensorInfo   *src,
+                          const ITensorInfo   *bias,
+                          const ITensorInfo   *dst,
+                          const Size2D        &input_dims,
+                          const Size2D        &kernel_dims,
+                          const PadStrideInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.stride().first == 0 || info.stride().second == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_dims.area() == 0 || kernel_dims.area() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != dst->dimension(0) * kernel_dims.area(),
+                                    "Source width must be OFM * kernel_w * kernel_h");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) != input_dims.area() * dst->dimension(3),
+                                    "Source height must be W * H * N");
+
+    const auto out_dims = deconvolution_output_dimensions(input_dims.width, input_dims.height, kernel_dims.width,
+                                                          kernel_dims.height, info);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != out_dims.first || dst->dimension(2) != out_dims.second);
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != dst->dimension(0));
+    }
+
+    const auto *uk = CpuDeconvolutionCol2ImKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuDeconvolutionCol2ImKernel::configure(const ITensorInfo   *src,
+                                             const ITensorInfo   *bias,
+                                             ITensorInfo         *dst,
+                                             const Size2D        &input_dims,
+                                             const Size2D        &kernel_dims,
+                                             const PadStrideInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDeconvolutionCol2ImKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, bias, dst, input_dims, kernel_dims, info));
+    ARM_COMPUTE_UNUSED(bias);
+
+    const auto uk = CpuDeconvolutionCol2ImKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method  = uk->ukernel;
+    _name        = std::string("CpuDeconvolutionCol2ImKernel").append("/").append(uk->name);
+    _input_dims  = input_dims;
+    _kernel_dims = kernel_dims;
+    _info        = info;
+
+    // The channels of an output pixel are accumulated together, so X is a single step
+    Window win = calculate_max_window(*dst, Steps(dst->dimension(0)));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDeconvolutionCol2ImKernel::validate(const ITensorInfo   *src,
+                                              const ITensorInfo   *bias,
+                                              const ITensorInfo   *dst,
+                                              const Size2D        &input_dims,
+                                              const Size2D        &kernel_dims,
+                                              const PadStrideInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, bias, dst, input_dims, kernel_dims, info));
+    return Status{};
+}
+
+void CpuDeconvolutionCol2ImKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDeconvolutionCol2ImKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *bias = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst  = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, bias, dst, _input_dims, _kernel_dims, _info, window);
+}
+
+const char *CpuDeconvolutionCol2ImKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuDeconvolutionCol2ImKernel::DeconvCol2ImKernel> &
+CpuDeconvolutionCol2ImKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
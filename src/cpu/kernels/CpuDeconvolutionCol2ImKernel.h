@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUDECONVOLUTIONCOL2IMKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUDECONVOLUTIONCOL2IMKERNEL_H
+
+#include "arm_compute/core/CoreTypes.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Size2D.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to scatter the GEMM output of a transposed convolution into the NHWC destination
+ *
+ * The source is the product of the input, viewed as [IFM, W * H * N], with the weights reshaped to
+ * [OFM * kernel_w * kernel_h, IFM]. Each output pixel gathers the rows of the input pixels it overlaps and adds the
+ * bias, so the zero-stuffed input of the upsample + convolution formulation is never built.
+ */
+class CpuDeconvolutionCol2ImKernel : public ICpuKernel<CpuDeconvolutionCol2ImKernel>
+{
+private:
+    using DeconvCol2ImKernelPtr = std::add_pointer<void(const ITensor *,
+                                                        const ITensor *,
+                                                        ITensor *,
+                                                        const Size2D &,
+                                                        const Size2D &,
+                                                        const PadStrideInfo &,
+                                                        const Window &)>::type;
+
+public:
+    struct DeconvCol2ImKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        DeconvCol2ImKernelPtr        ukernel;
+    };
+
+    CpuDeconvolutionCol2ImKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDeconvolutionCol2ImKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src         Source tensor info of shape [OFM * kernel_w * kernel_h, W * H * N]. Data types
+     *                         supported: F16/F32/S32.
+     * @param[in]  bias        (Optional) Bias tensor info of shape [OFM]. Can be nullptr. Data type supported: same as
+     *                         @p src.
+     * @param[out] dst         Destination tensor info of shape [OFM, out_w, out_h, N]. Data layout supported: NHWC.
+     *                         Data type supported: same as @p src.
+     * @param[in]  input_dims  Width and height of the deconvolution input.
+     * @param[in]  kernel_dims Width and height of the deconvolution kernel.
+     * @param[in]  info        Strides and paddings of the deconvolution.
+     */
+    void configure(const ITensorInfo   *src,
+                   const ITensorInfo   *bias,
+                   ITensorInfo         *dst,
+                   const Size2D        &input_dims,
+                   const Size2D        &kernel_dims,
+                   const PadStrideInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDeconvolutionCol2ImKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo   *src,
+                           const ITensorInfo   *bias,
+                           const ITensorInfo   *dst,
+                           const Size2D        &input_dims,
+                           const Size2D        &kernel_dims,
+                           const PadStrideInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<DeconvCol2ImKernel> &get_available_kernels();
+
+private:
+    DeconvCol2ImKernelPtr _run_method{nullptr};
+    Size2D                _input_dims{};
+    Size2D                _kernel_dims{};
+    PadStrideInfo         _info{};
+    std::string           _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUDECONVOLUTIONCOL2IMKERNEL_H
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuElementwiseExpressionKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/elementwise_expression/list.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuElementwiseExpressionKernel::ElementwiseExpressionKernel> available_kernels = {
+    {"neon_fp16_elementwise_expression",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_elementwise_expression)},
+    {"neon_fp32_elementwise_expression", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_elementwise_expression)}};
+
+bool is_unary_supported(ElementWiseUnary op)
+{
+    switch (op)
+    {
+        case ElementWiseUnary::RSQRT:
+        case ElementWiseUnary::EXP:
+        case ElementWiseUnary::NEG:
+        case ElementWiseUnary::LOG:
+        case ElementWiseUnary::ABS:
+        case ElementWiseUnary::SIN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Status validate_expression(const ElementwiseExpressionInfo &info)
+{
+    const std::vector<ElementwiseExpressionNode> &nodes = info.nodes();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(nodes.empty(), "Empty expression");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(nodes.size() > ElementwiseExpressionInfo::max_num_nodes,
+                                    "Too many nodes in the expression");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_inputs() > ElementwiseExpressionInfo::max_num_inputs,
+                                    "Too many inputs in the expression");
+
+    for (size_t n = 0; n < nodes.size(); ++n)
+    {
+        const ElementwiseExpressionNode &node = nodes[n];
+        switch (node.op)
+        {
+            case ElementwiseExpressionOp::Input:
+                ARM_COMPUTE_RETURN_ERROR_ON(node.lhs >= info.num_inputs());
+                break;
+            case ElementwiseExpressionOp::Unary:
+                ARM_COMPUTE_RETURN_ERROR_ON(node.lhs >= n);
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_unary_supported(node.unary_op), "Unsupported unary operation");
+                break;
+            case ElementwiseExpressionOp::Activation:
+                ARM_COMPUTE_RETURN_ERROR_ON(node.lhs >= n);
+#ifndef __aarch64__
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.act_info.activation() ==
+                                                    ActivationLayerInfo::ActivationFunction::GELU,
+                                                "GELU is only supported on aarch64");
+#endif /* __aarch64__ */
+                break;
+            default:
+                // Operands must be computed before the node itself
+                ARM_COMPUTE_RETURN_ERROR_ON(node.lhs >= n || node.rhs >= n);
+                break;
+        }
+    }
+    return Status{};
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &srcs,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_expression(info));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.empty(), "The expression must read at least one input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.size() != info.num_inputs(),
+                                    "The number of inputs does not match the expression");
+
+    const ITensorInfo *src0 = srcs[0];
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src0);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src0, 1, DataType::F16, DataType::F32);
+
+    TensorShape out_shape = src0->tensor_shape();
+    for (const ITensorInfo *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, src);
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_shape.total_size() == 0, "Inputs are not broadcast compatible");
+
+    const auto uk = CpuElementwiseExpressionKernel::get_implementation(
+        DataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(detail::have_different_dimensions(out_shape, dst->tensor_shape(), 0),
+                                        "Wrong shape for output");
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuElementwiseExpressionKernel::configure(const std::vector<const ITensorInfo *> &srcs,
+                                               ITensorInfo                            *dst,
+                                               const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuElementwiseExpressionKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(srcs, dst, info));
+
+    TensorShape out_shape = srcs[0]->tensor_shape();
+    for (const ITensorInfo *src : srcs)
+    {
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+    }
+    auto_init_if_empty(*dst, out_shape, 1, srcs[0]->data_type());
+
+    const auto uk = CpuElementwiseExpressionKernel::get_implementation(
+        DataTypeISASelectorData{srcs[0]->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuElementwiseExpressionKernel").append("/").append(uk->name);
+    _info       = info;
+
+    ICpuKernel::configure(calculate_max_window(out_shape));
+}
+
+Status CpuElementwiseExpressionKernel::validate(const std::vector<const ITensorInfo *> &srcs,
+                                                const ITensorInfo                      *dst,
+                                                const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(srcs, dst, info));
+    return Status{};
+}
+
+void CpuElementwiseExpressionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuElementwiseExpressionKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    std::array<const ITensor *, ElementwiseExpressionInfo::max_num_inputs> srcs{};
+    for (unsigned int i = 0; i < _info.num_inputs(); ++i)
+    {
+        srcs[i] = tensors.get_const_tensor(TensorType::ACL_SRC_VEC + i);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(srcs[i]);
+    }
+    ITensor *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(srcs.data(), dst, _info, window);
+}
+
+const char *CpuElementwiseExpressionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuElementwiseExpressionKernel::ElementwiseExpressionKernel> &
+CpuElementwiseExpressionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
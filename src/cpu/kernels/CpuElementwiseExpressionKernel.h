@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUELEMENTWISEEXPRESSIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUELEMENTWISEEXPRESSIONKERNEL_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to evaluate a DAG of elementwise operations in a single pass over memory
+ *
+ * The expression is evaluated tile by tile along the X dimension: every node of @ref ElementwiseExpressionInfo runs a
+ * vector loop over a tile small enough for all the intermediate results to stay in the L1 cache, so only the inputs
+ * are read and only the final result is written to memory.
+ *
+ * The inputs are passed in the tensor pack as ACL_SRC_VEC + i.
+ */
+class CpuElementwiseExpressionKernel : public ICpuKernel<CpuElementwiseExpressionKernel>
+{
+private:
+    using ElementwiseExpressionKernelPtr = std::add_pointer<void(
+        const ITensor *const *, ITensor *, const ElementwiseExpressionInfo &, const Window &)>::type;
+
+public:
+    struct ElementwiseExpressionKernel
+    {
+        const char                    *name;
+        const DataTypeISASelectorPtr   is_selected;
+        ElementwiseExpressionKernelPtr ukernel;
+    };
+
+    CpuElementwiseExpressionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuElementwiseExpressionKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  srcs Source tensor infos, one per input index of @p info. Data types supported: F16/F32.
+     *                  Each input must be broadcast compatible with the output.
+     * @param[out] dst  Destination tensor info. Data type supported: same as @p srcs.
+     *                  If empty, it is initialised with the broadcast shape of @p srcs.
+     * @param[in]  info Expression to evaluate.
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs,
+                   ITensorInfo                            *dst,
+                   const ElementwiseExpressionInfo        &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuElementwiseExpressionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &srcs,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseExpressionInfo        &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<ElementwiseExpressionKernel> &get_available_kernels();
+
+private:
+    ElementwiseExpressionKernelPtr _run_method{nullptr};
+    ElementwiseExpressionInfo      _info{};
+    std::string                    _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUELEMENTWISEEXPRESSIONKERNEL_H
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuEmbeddingBagKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/embedding_bag/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuEmbeddingBagKernel::EmbeddingBagKernel> available_kernels = {
+    {"neon_fp32_embedding_bag", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(neon_fp32_embedding_bag)},
+    {"neon_fp16_embedding_bag",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(neon_fp16_embedding_bag)},
+    {"neon_s8_embedding_bag", [](const DataTypeISASelectorData &data) { return data.dt == DataType::S8; },
+     REGISTER_INTEGER_NEON(neon_s8_embedding_bag)},
+};
+
+DataType dst_data_type(DataType table_data_type)
+{
+    return table_data_type == DataType::S8 ? DataType::F32 : table_data_type;
+}
+
+Status validate_arguments(const ITensorInfo &table,
+                          const ITensorInfo &indices,
+                          const ITensorInfo &offsets,
+                          const ITensorInfo *scales,
+                          const ITensorInfo &dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&table);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&table, 1, DataType::F16, DataType::F32, DataType::S8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&indices, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&offsets, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(&table, &indices, &offsets);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(table.num_dimensions() > 2, "The table must be 2D");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(indices.num_dimensions() > 1 || offsets.num_dimensions() > 1,
+                                    "indices and offsets must be 1D");
+
+    if (scales != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(scales->num_dimensions() > 1 || scales->dimension(0) != table.dimension(1),
+                                        "scales must be 1D with one value per row of the table");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(table.data_type() == DataType::S8, "S8 tables require per-row scales");
+    }
+
+    if (dst.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&dst, 1, dst_data_type(table.data_type()));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst.tensor_shape(),
+                                                           TensorShape(table.dimension(0), offsets.dimension(0)));
+    }
+
+    const auto *uk = CpuEmbeddingBagKernel::get_implementation(
+        DataTypeISASelectorData{table.data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuEmbeddingBagKernel::EmbeddingBagKernel> &CpuEmbeddingBagKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+void CpuEmbeddingBagKernel::configure(const ITensorInfo      *table,
+                                      const ITensorInfo      *indices,
+                                      const ITensorInfo      *offsets,
+                                      const ITensorInfo      *scales,
+                                      ITensorInfo            *dst,
+                                      const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuEmbeddingBagKernel::configure");
+    ARM_COMPUTE_UNUSED(indices, scales);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table, indices, offsets, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*table, *indices, *offsets, scales, *dst));
+
+    auto_init_if_empty(*dst, TensorShape(table->dimension(0), offsets->dimension(0)), 1,
+                       dst_data_type(table->data_type()));
+
+    const auto *uk = CpuEmbeddingBagKernel::get_implementation(
+        DataTypeISASelectorData{table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuEmbeddingBagKernel").append("/").append(uk->name);
+
+    // One window step per bag: the ukernel pools whole rows
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuEmbeddingBagKernel>::configure(win);
+}
+
+Status CpuEmbeddingBagKernel::validate(const ITensorInfo      *table,
+                                       const ITensorInfo      *indices,
+                                       const ITensorInfo      *offsets,
+                                       const ITensorInfo      *scales,
+                                       const ITensorInfo      *dst,
+                                       const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuEmbeddingBagKernel::validate");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(table, indices, offsets, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*table, *indices, *offsets, scales, *dst));
+    return Status{};
+}
+
+void CpuEmbeddingBagKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuEmbeddingBagKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuEmbeddingBagKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto table   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto indices = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto offsets = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const auto scales  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(table, indices, offsets, scales, dst, _info, window);
+}
+
+const char *CpuEmbeddingBagKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
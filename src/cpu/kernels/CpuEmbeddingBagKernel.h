@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUEMBEDDINGBAGKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUEMBEDDINGBAGKERNEL_H
+
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel gathering rows of an embedding table and pooling them per bag
+ *
+ * Every bag is a range of the indices, starting at its offset and ending at the offset of the next bag. The rows of a
+ * bag are summed in FP32, optionally scaled one by one by a per-row scale, then divided by the size of the bag in
+ * @ref EmbeddingBagMode::Mean. Rows are prefetched ahead of their use since consecutive indices usually point to
+ * distant rows of a large table.
+ *
+ * The tensors are passed in the tensor pack as:
+ * - ACL_SRC_0: table
+ * - ACL_SRC_1: indices
+ * - ACL_SRC_2: offsets
+ * - ACL_SRC_3: per-row scales (optional)
+ * - ACL_DST: destination
+ */
+class CpuEmbeddingBagKernel : public ICpuKernel<CpuEmbeddingBagKernel>
+{
+private:
+    using EmbeddingBagKernelPtr = std::add_pointer<void(const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        ITensor *,
+                                                        const EmbeddingBagInfo &,
+                                                        const Window &)>::type;
+
+public:
+    CpuEmbeddingBagKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuEmbeddingBagKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  table   2D tensor info of the embedding table, one row along X per embedding.
+     *                     Data types supported: F16/F32/S8.
+     * @param[in]  indices 1D tensor info of the rows to gather. Data types supported: S32.
+     *                     Indices outside the table contribute zeros.
+     * @param[in]  offsets 1D tensor info of the first index of every bag. Data types supported: S32.
+     * @param[in]  scales  (Optional) 1D tensor info of per-row scales, one per row of @p table. Can be nullptr,
+     *                     except for S8 tables. Data types supported: F32.
+     * @param[out] dst     2D destination tensor info, one row per bag.
+     *                     Data types supported: F32 for S8 tables, same as @p table otherwise.
+     * @param[in]  info    Pooling applied to every bag.
+     */
+    void configure(const ITensorInfo      *table,
+                   const ITensorInfo      *indices,
+                   const ITensorInfo      *offsets,
+                   const ITensorInfo      *scales,
+                   ITensorInfo            *dst,
+                   const EmbeddingBagInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuEmbeddingBagKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo      *table,
+                           const ITensorInfo      *indices,
+                           const ITensorInfo      *offsets,
+                           const ITensorInfo      *scales,
+                           const ITensorInfo      *dst,
+                           const EmbeddingBagInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct EmbeddingBagKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        EmbeddingBagKernelPtr        ukernel;
+    };
+
+    static const std::vector<EmbeddingBagKernel> &get_available_kernels();
+
+private:
+    EmbeddingBagInfo      _info{};
+    EmbeddingBagKernelPtr _run_method{nullptr};
+    std::string           _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUEMBEDDINGBAGKERNEL_H
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuKVCacheAppendKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/kvcache_matmul/list.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+// Appending only moves data around, so the rows are copied as raw storage of the right width.
+template <typename T>
+void append_rows(
+    const ITensor *rows, ITensor *cache, const KVCacheMatMulInfo &info, unsigned int position, const Window &window)
+{
+    const unsigned int head_dim     = info.head_dim();
+    const size_t       block_stride = static_cast<size_t>(head_dim) * kvcache_key_block;
+    const size_t       ld           = ceil_to_multiple(head_dim, kvcache_value_block);
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src_it(rows, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto        *src  = reinterpret_cast<const T *>(src_it.ptr());
+            auto              *dst  = reinterpret_cast<T *>(cache->ptr_to_element(Coordinates(0, id.z())));
+            const unsigned int slot = position + id.y();
+
+            if (info.operand() == KVCacheOperand::Key)
+            {
+                T *block = dst + (slot / kvcache_key_block) * block_stride + (slot % kvcache_key_block);
+                for (unsigned int d = 0; d < head_dim; ++d)
+                {
+                    block[d * kvcache_key_block] = src[d];
+                }
+            }
+            else
+            {
+                std::copy_n(src, head_dim, dst + slot * ld);
+            }
+        },
+        src_it);
+}
+} // namespace
+
+void CpuKVCacheAppendKernel::configure(const ITensorInfo *cache, const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheAppendKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(cache);
+
+    _info = info;
+
+    // The largest append covers the whole cache
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, info.max_length(), 1));
+    win.set(Window::DimZ, Window::Dimension(0, cache->dimension(1), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuKVCacheAppendKernel::validate(const ITensorInfo       *rows,
+                                        const ITensorInfo       *cache,
+                                        const KVCacheMatMulInfo &info,
+                                        unsigned int             position)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(rows, cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rows, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(rows, cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rows->num_dimensions() > 3, "Only up to 3 dimensions are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rows->dimension(0) != info.head_dim(), "Row length must match head_dim");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rows->dimension(2) != cache->dimension(1), "Number of batches mismatch");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(position + rows->dimension(1) > info.max_length(), "Cache capacity exceeded");
+
+    const TensorInfo packed_info = packed_cache_info(rows->data_type(), info, rows->dimension(2));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cache, &packed_info);
+
+    return Status{};
+}
+
+TensorInfo
+CpuKVCacheAppendKernel::packed_cache_info(DataType data_type, const KVCacheMatMulInfo &info, unsigned int batches)
+{
+    size_t per_batch = 0;
+    if (info.operand() == KVCacheOperand::Key)
+    {
+        per_batch = ceil_to_multiple(info.max_length(), kvcache_key_block) * static_cast<size_t>(info.head_dim());
+    }
+    else
+    {
+        per_batch = static_cast<size_t>(info.max_length()) * ceil_to_multiple(info.head_dim(), kvcache_value_block);
+    }
+    return TensorInfo(TensorShape(per_batch, batches), 1, data_type);
+}
+
+void CpuKVCacheAppendKernel::set_position(unsigned int position)
+{
+    ARM_COMPUTE_ERROR_ON(position > _info.max_length());
+    _position = position;
+}
+
+void CpuKVCacheAppendKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheAppendKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const ITensor *rows  = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *cache = tensors.get_tensor(TensorType::ACL_DST);
+
+    switch (rows->info()->element_size())
+    {
+        case 2:
+            append_rows<uint16_t>(rows, cache, _info, _position, window);
+            break;
+        case 4:
+            append_rows<uint32_t>(rows, cache, _info, _position, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+    }
+}
+
+const char *CpuKVCacheAppendKernel::name() const
+{
+    return "CpuKVCacheAppendKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUKVCACHEAPPENDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUKVCACHEAPPENDKERNEL_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to append rows to a packed key/value cache
+ *
+ * Keys are packed in blocks of 8 tokens laid out as [head_dim][8], so that @ref CpuKVCacheMatMulKernel can compute
+ * the scores of a block with broadcast multiply-accumulates. Values are stored row by row with the row length padded
+ * to a multiple of 16 elements.
+ */
+class CpuKVCacheAppendKernel : public ICpuKernel<CpuKVCacheAppendKernel>
+{
+public:
+    CpuKVCacheAppendKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuKVCacheAppendKernel);
+    /** Initialise the kernel
+     *
+     * @param[in] cache Packed cache tensor info as returned by @ref packed_cache_info(). Data types supported: F16/F32.
+     * @param[in] info  Cache information.
+     */
+    void configure(const ITensorInfo *cache, const KVCacheMatMulInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * @param[in] rows     Rows to append of shape [head_dim, num_rows, batches]. Data types supported: F16/F32.
+     * @param[in] cache    Packed cache tensor info. Data type supported: same as @p rows.
+     * @param[in] info     Cache information.
+     * @param[in] position Index of the first appended row in the cache.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo       *rows,
+                           const ITensorInfo       *cache,
+                           const KVCacheMatMulInfo &info,
+                           unsigned int             position);
+    /** Compute the info of the packed cache
+     *
+     * @param[in] data_type Data type of the cached rows.
+     * @param[in] info      Cache information.
+     * @param[in] batches   Number of independent caches, e.g. batches times attention heads.
+     *
+     * @return the packed cache tensor info
+     */
+    static TensorInfo packed_cache_info(DataType data_type, const KVCacheMatMulInfo &info, unsigned int batches);
+    /** Set the cache index the next appended rows are written to
+     *
+     * @param[in] position Index of the first appended row.
+     */
+    void set_position(unsigned int position);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    KVCacheMatMulInfo _info{};
+    unsigned int      _position{0};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUKVCACHEAPPENDKERNEL_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuKVCacheMatMulKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/CpuKVCacheAppendKernel.h"
+#include "src/cpu/kernels/kvcache_matmul/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuKVCacheMatMulKernel::KVCacheMatMulKernel> available_kernels = {
+    {"neon_fp16_kvcache_matmul",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_kvcache_matmul)},
+    {"neon_fp32_kvcache_matmul", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_kvcache_matmul)}};
+
+TensorShape compute_dst_shape(const KVCacheMatMulInfo &info, unsigned int batches)
+{
+    const unsigned int width = (info.operand() == KVCacheOperand::Key) ? info.max_length() : info.head_dim();
+    return TensorShape(width, 1U, batches);
+}
+
+Status validate_arguments(const ITensorInfo       *lhs,
+                          const ITensorInfo       *cache,
+                          const ITensorInfo       *dst,
+                          const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(lhs);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.head_dim() == 0 || info.max_length() == 0, "Empty cache dimensions");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->num_dimensions() > 3, "Only up to 3 dimensions are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(1) != 1, "Only a single lhs row per batch is supported");
+
+    const unsigned int lhs_width = (info.operand() == KVCacheOperand::Key) ? info.head_dim() : info.max_length();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(0) != lhs_width,
+                                    "lhs width must match head_dim (Key) or max_length (Value)");
+
+    const unsigned int batches     = lhs->dimension(2);
+    const TensorInfo   packed_info = CpuKVCacheAppendKernel::packed_cache_info(lhs->data_type(), info, batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cache, &packed_info);
+
+    const auto uk = CpuKVCacheMatMulKernel::get_implementation(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_dst_shape(info, batches));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuKVCacheMatMulKernel::configure(const ITensorInfo       *lhs,
+                                       const ITensorInfo       *cache,
+                                       ITensorInfo             *dst,
+                                       const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheMatMulKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, cache, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(lhs, cache, dst, info));
+    ARM_COMPUTE_UNUSED(cache);
+
+    auto_init_if_empty(*dst, lhs->clone()->set_tensor_shape(compute_dst_shape(info, lhs->dimension(2))));
+
+    const auto uk =
+        CpuKVCacheMatMulKernel::get_implementation(DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuKVCacheMatMulKernel").append("/").append(uk->name);
+    _info       = info;
+
+    const unsigned int step = (info.operand() == KVCacheOperand::Key) ? kvcache_key_block : kvcache_value_block;
+    ICpuKernel::configure(calculate_max_window(*dst, Steps(step)));
+}
+
+Status CpuKVCacheMatMulKernel::validate(const ITensorInfo       *lhs,
+                                        const ITensorInfo       *cache,
+                                        const ITensorInfo       *dst,
+                                        const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, cache, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(lhs, cache, dst, info));
+    return Status{};
+}
+
+void CpuKVCacheMatMulKernel::set_length(unsigned int length)
+{
+    ARM_COMPUTE_ERROR_ON(length > _info.max_length());
+    _length = length;
+}
+
+Window CpuKVCacheMatMulKernel::active_window() const
+{
+    Window win = ICpuKernel::window();
+    if (_info.operand() == KVCacheOperand::Key)
+    {
+        // Only the blocks holding cached keys need computing, the rest of the row is masked by the last block
+        win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(_length, kvcache_key_block), kvcache_key_block));
+    }
+    return win;
+}
+
+void CpuKVCacheMatMulKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheMatMulKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *cache = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(lhs, cache, dst, _info, _length, window);
+}
+
+const char *CpuKVCacheMatMulKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuKVCacheMatMulKernel::KVCacheMatMulKernel> &CpuKVCacheMatMulKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUKVCACHEMATMULKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUKVCACHEMATMULKERNEL_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a single row per batch with the active part of a packed key/value cache
+ *
+ * The cache is expected in the packed layout produced by @ref CpuKVCacheAppendKernel.
+ */
+class CpuKVCacheMatMulKernel : public ICpuKernel<CpuKVCacheMatMulKernel>
+{
+private:
+    using KVCacheMatMulKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, ITensor *, const KVCacheMatMulInfo &, unsigned int, const Window &)>::type;
+
+public:
+    struct KVCacheMatMulKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        KVCacheMatMulKernelPtr       ukernel;
+    };
+
+    CpuKVCacheMatMulKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuKVCacheMatMulKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  lhs   Left-hand side tensor info. For @ref KVCacheOperand::Key, a query of shape [head_dim, 1, batches].
+     *                   For @ref KVCacheOperand::Value, weights of shape [max_length, 1, batches].
+     *                   Data types supported: F16/F32.
+     * @param[in]  cache Packed cache tensor info as returned by @ref CpuKVCacheAppendKernel::packed_cache_info(). Data type supported: same as @p lhs.
+     * @param[out] dst   Destination tensor info. For @ref KVCacheOperand::Key, [max_length, 1, batches].
+     *                   For @ref KVCacheOperand::Value, [head_dim, 1, batches]. Data type supported: same as @p lhs.
+     * @param[in]  info  Cache information.
+     */
+    void configure(const ITensorInfo *lhs, const ITensorInfo *cache, ITensorInfo *dst, const KVCacheMatMulInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuKVCacheMatMulKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo       *lhs,
+                           const ITensorInfo       *cache,
+                           const ITensorInfo       *dst,
+                           const KVCacheMatMulInfo &info);
+    /** Set the number of cached rows to use on the next run
+     *
+     * @param[in] length Number of active rows. Must not exceed @ref KVCacheMatMulInfo::max_length().
+     */
+    void set_length(unsigned int length);
+    /** Window covering only the active part of the cache for the current length
+     *
+     * @return the window to be scheduled
+     */
+    Window active_window() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<KVCacheMatMulKernel> &get_available_kernels();
+
+private:
+    KVCacheMatMulKernelPtr _run_method{nullptr};
+    KVCacheMatMulInfo      _info{};
+    unsigned int           _length{0};
+    std::string            _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUKVCACHEMATMULKERNEL_H
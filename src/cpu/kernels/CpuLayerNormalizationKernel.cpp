@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLayerNormalizationKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/layernorm/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLayerNormalizationKernel::LayerNormalizationKernel> available_kernels = {
+    {"neon_fp32_layer_normalization", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(neon_fp32_layer_normalization)},
+    {"neon_fp16_layer_normalization",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(neon_fp16_layer_normalization)},
+    {"neon_bf16_layer_normalization",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16; },
+     REGISTER_BF16_NEON(neon_bf16_layer_normalization)},
+};
+
+Status validate_arguments(const ITensorInfo            &src,
+                          const ITensorInfo            *residual,
+                          const ITensorInfo            *gamma,
+                          const ITensorInfo            *beta,
+                          const ITensorInfo            &dst,
+                          const ITensorInfo            *sum,
+                          const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&src, 1, DataType::F16, DataType::F32, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.epsilon < 0.f, "epsilon must not be negative");
+
+    if (residual != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&src, residual);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&src, residual);
+    }
+    for (const ITensorInfo *param : {gamma, beta})
+    {
+        if (param != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&src, param);
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(param->num_dimensions() != 1 || param->dimension(0) != src.dimension(0),
+                                            "gamma and beta must be 1D with the size of src's X dimension");
+        }
+    }
+    if (sum != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(residual == nullptr, "The sum output requires a residual input");
+        if (sum->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&src, sum);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&src, sum);
+        }
+    }
+    if (dst.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&src, &dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst.data_type() != src.data_type() && dst.data_type() != DataType::QASYMM8 &&
+                                            dst.data_type() != DataType::QASYMM8_SIGNED,
+                                        "dst must have the data type of src or be QASYMM8/QASYMM8_SIGNED");
+    }
+
+    const auto *uk = CpuLayerNormalizationKernel::get_implementation(
+        DataTypeISASelectorData{src.data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuLayerNormalizationKernel::LayerNormalizationKernel> &
+CpuLayerNormalizationKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+void CpuLayerNormalizationKernel::configure(const ITensorInfo            *src,
+                                            const ITensorInfo            *residual,
+                                            const ITensorInfo            *gamma,
+                                            const ITensorInfo            *beta,
+                                            ITensorInfo                  *dst,
+                                            ITensorInfo                  *sum,
+                                            const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuLayerNormalizationKernel::configure");
+    ARM_COMPUTE_UNUSED(residual, gamma, beta);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*src, residual, gamma, beta, *dst, sum, info));
+
+    auto_init_if_empty(*dst, *src);
+    if (sum != nullptr)
+    {
+        auto_init_if_empty(*sum, *src);
+    }
+
+    const auto *uk = CpuLayerNormalizationKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLayerNormalizationKernel").append("/").append(uk->name);
+
+    // One window step per row: the ukernel walks the whole row
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuLayerNormalizationKernel>::configure(win);
+}
+
+Status CpuLayerNormalizationKernel::validate(const ITensorInfo            *src,
+                                             const ITensorInfo            *residual,
+                                             const ITensorInfo            *gamma,
+                                             const ITensorInfo            *beta,
+                                             const ITensorInfo            *dst,
+                                             const ITensorInfo            *sum,
+                                             const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuLayerNormalizationKernel::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*src, residual, gamma, beta, *dst, sum, info));
+    return Status{};
+}
+
+void CpuLayerNormalizationKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLayerNormalizationKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuLayerNormalizationKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src      = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto residual = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto gamma    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const auto beta     = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    auto       dst      = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto       sum      = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src, residual, gamma, beta, dst, sum, _info, window);
+}
+
+const char *CpuLayerNormalizationKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
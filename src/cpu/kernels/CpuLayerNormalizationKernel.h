@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULAYERNORMALIZATIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULAYERNORMALIZATIONKERNEL_H
+
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel normalizing every row along X with LayerNorm or RMSNorm
+ *
+ * The residual addition, the scale and shift and the conversion to a quantized output are all applied while the row is
+ * in cache, so a transformer block "x + residual -> norm -> gamma/beta" reads each input row twice and writes the
+ * normalized row, plus the sum of the residual addition if requested, once.
+ *
+ * The tensors are passed in the tensor pack as:
+ * - ACL_SRC_0: source
+ * - ACL_SRC_1: residual (optional)
+ * - ACL_SRC_2: gamma (optional)
+ * - ACL_SRC_3: beta (optional)
+ * - ACL_DST_0: destination
+ * - ACL_DST_1: sum of the source and the residual (optional)
+ */
+class CpuLayerNormalizationKernel : public ICpuKernel<CpuLayerNormalizationKernel>
+{
+private:
+    using LayerNormalizationKernelPtr = std::add_pointer<void(const ITensor *,
+                                                              const ITensor *,
+                                                              const ITensor *,
+                                                              const ITensor *,
+                                                              ITensor *,
+                                                              ITensor *,
+                                                              const LayerNormalizationInfo &,
+                                                              const Window &)>::type;
+
+public:
+    CpuLayerNormalizationKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLayerNormalizationKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src      Source tensor info. The normalization is computed along X.
+     *                      Data types supported: F16/F32/BFLOAT16.
+     * @param[in]  residual (Optional) Tensor info added to @p src before the normalization. Can be nullptr.
+     *                      Same shape and data type as @p src.
+     * @param[in]  gamma    (Optional) 1D tensor info of scales, one per element along X. Can be nullptr.
+     *                      Data types supported: same as @p src.
+     * @param[in]  beta     (Optional) 1D tensor info of offsets, one per element along X. Can be nullptr.
+     *                      Data types supported: same as @p src.
+     * @param[out] dst      Destination tensor info. Same shape as @p src. It can be the same as @p src.
+     *                      Data types supported: same as @p src or QASYMM8/QASYMM8_SIGNED.
+     * @param[out] sum      (Optional) Destination tensor info for @p src + @p residual. Can be nullptr.
+     *                      Requires @p residual. Same shape and data type as @p src.
+     * @param[in]  info     Normalization type and epsilon.
+     */
+    void configure(const ITensorInfo            *src,
+                   const ITensorInfo            *residual,
+                   const ITensorInfo            *gamma,
+                   const ITensorInfo            *beta,
+                   ITensorInfo                  *dst,
+                   ITensorInfo                  *sum,
+                   const LayerNormalizationInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLayerNormalizationKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *src,
+                           const ITensorInfo            *residual,
+                           const ITensorInfo            *gamma,
+                           const ITensorInfo            *beta,
+                           const ITensorInfo            *dst,
+                           const ITensorInfo            *sum,
+                           const LayerNormalizationInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct LayerNormalizationKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LayerNormalizationKernelPtr  ukernel;
+    };
+
+    static const std::vector<LayerNormalizationKernel> &get_available_kernels();
+
+private:
+    LayerNormalizationInfo      _info{};
+    LayerNormalizationKernelPtr _run_method{nullptr};
+    std::string                 _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULAYERNORMALIZATIONKERNEL_H
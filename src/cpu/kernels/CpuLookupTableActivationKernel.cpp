@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLookupTableActivationKernel.h"
+
+#include "arm_compute/core/CoreTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/lookup_table_activation/list.h"
+#include "src/cpu/utils/CpuSplitDimension.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLookupTableActivationKernel::LookupTableActivationKernel> available_kernels = {
+#ifdef __aarch64__
+    {"sve2_q8_lookup_table_activation",
+     [](const ActivationDataTypeISASelectorData &data)
+     {
+         return (data.dt == DataType::QASYMM8 || data.dt == DataType::QASYMM8_SIGNED) &&
+                data.cpumodel == CPUModel::A510 && data.isa.sve2;
+     },
+     REGISTER_QASYMM8_SVE2(arm_compute::cpu::sve2_q8_lookup_table_activation)},
+    {// Neon LUT implementation takes precedence
+     "neon_q8_lookup_table_activation",
+     [](const ActivationDataTypeISASelectorData &data)
+     { return data.dt == DataType::QASYMM8 || data.dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_Q8_NEON(arm_compute::cpu::neon_q8_lookup_table_activation)},
+    {"sve_fp16_lookup_table_activation",
+     [](const ActivationDataTypeISASelectorData &data)
+     { return (data.dt == DataType::F16) && data.isa.fp16 && data.isa.sve; },
+     REGISTER_FP16_SVE(arm_compute::cpu::sve_fp16_lookup_table_activation)},
+    {"neon_fp16_lookup_table_activation",
+     [](const ActivationDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_lookup_table_activation)},
+#endif // __aarch64__
+};
+
+const CpuLookupTableActivationKernel::LookupTableActivationKernel *select_kernel(DataType dt)
+{
+    // The function is not one of the built-in activations: only the data type and the CPU matter
+    const ActivationDataTypeISASelectorData selector{dt, CPUInfo::get().get_cpu_model(), CPUInfo::get().get_isa(),
+                                                     ActivationFunction::IDENTITY};
+    return CpuLookupTableActivationKernel::get_implementation(selector);
+}
+
+void init_q8_table(const LookupTableActivationInfo::Function &func,
+                   DataType                                    data_type,
+                   const UniformQuantizationInfo              &qi_in,
+                   const UniformQuantizationInfo              &qi_out,
+                   std::vector<uint8_t>                       &table)
+{
+    // The table is indexed by the bit pattern of the elements, whether they are signed or not
+    table.resize(256);
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        if (data_type == DataType::QASYMM8)
+        {
+            table[i] = quantize_qasymm8(func(dequantize_qasymm8(static_cast<uint8_t>(i), qi_in)), qi_out);
+        }
+        else
+        {
+            const float value = func(dequantize_qasymm8_signed(static_cast<int8_t>(i), qi_in));
+            table[i]          = static_cast<uint8_t>(quantize_qasymm8_signed(value, qi_out));
+        }
+    }
+}
+
+void init_fp16_table(const LookupTableActivationInfo::Function &func, std::vector<uint16_t> &table)
+{
+    // One entry per half-precision bit pattern: the function is evaluated on every F16 value, so the lookup is exact
+    table.resize(65536);
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        const float value = half_float::detail::half2float<float>(static_cast<uint16_t>(i));
+        table[i]          = half_float::detail::float2half<std::round_to_nearest>(func(value));
+    }
+}
+
+Status validate_arguments(const ITensorInfo &src, const ITensorInfo &dst, const LookupTableActivationInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info.enabled(), "No function to apply");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src.quantization_info().is_dynamic() || dst.quantization_info().is_dynamic(),
+                                    "Dynamic quantization is not supported: the table is built at configure time");
+
+    if (dst.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&src, &dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&src, &dst);
+    }
+
+    const auto *uk = select_kernel(src.data_type());
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuLookupTableActivationKernel::LookupTableActivationKernel> &
+CpuLookupTableActivationKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+void CpuLookupTableActivationKernel::configure(const ITensorInfo               *src,
+                                               ITensorInfo                     *dst,
+                                               const LookupTableActivationInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuLookupTableActivationKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*src, *dst, info));
+
+    auto_init_if_empty(*dst, *src->clone());
+
+    const auto *uk = select_kernel(src->data_type());
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLookupTableActivationKernel").append("/").append(uk->name);
+
+    if (src->data_type() == DataType::F16)
+    {
+        init_fp16_table(info.function(), _table_fp16);
+    }
+    else
+    {
+        init_q8_table(info.function(), src->data_type(), src->quantization_info().uniform(),
+                      dst->quantization_info().uniform(), _table_q8);
+    }
+
+    // Split along the outer dimensions, or along X for a single row
+    const Window win = calculate_max_window(*src, Steps());
+    _split_dimension = get_split_dimension(win, Window::DimY, Window::DimX);
+
+    ICpuKernel<CpuLookupTableActivationKernel>::configure(win);
+}
+
+Status CpuLookupTableActivationKernel::validate(const ITensorInfo               *src,
+                                                const ITensorInfo               *dst,
+                                                const LookupTableActivationInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuLookupTableActivationKernel::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*src, *dst, info));
+    return Status{};
+}
+
+void CpuLookupTableActivationKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuLookupTableActivationKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuLookupTableActivationKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    const void *table = _table_fp16.empty() ? static_cast<const void *>(_table_q8.data())
+                                            : static_cast<const void *>(_table_fp16.data());
+    _run_method(src, dst, table, window);
+}
+
+const char *CpuLookupTableActivationKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULOOKUPTABLEACTIVATIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULOOKUPTABLEACTIVATIONKERNEL_H
+
+#include "arm_compute/function_info/LookupTableActivationInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel applying an arbitrary scalar function to every element through a lookup table
+ *
+ * The table holds the result of the function for every value representable in the data type of the source, so
+ * running the kernel only costs a table lookup per element whatever the function:
+ * - QASYMM8/QASYMM8_SIGNED: 256 entries, computed on the dequantized values and requantized with the quantization
+ *   information of the destination. The lookup uses the Neon tbx or the SVE2 tbl instructions.
+ * - F16: 65536 entries, one per half-precision bit pattern, so the table is exact and no interpolation is needed.
+ *   The lookup uses the SVE gather loads when available.
+ *
+ * The table is built when the kernel is configured.
+ */
+class CpuLookupTableActivationKernel : public ICpuKernel<CpuLookupTableActivationKernel>
+{
+private:
+    using LookupTableActivationKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, const void *, const Window &)>::type;
+
+public:
+    CpuLookupTableActivationKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLookupTableActivationKernel);
+
+    /** Set the input and output tensors and build the lookup table.
+     *
+     * @param[in]  src  Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16.
+     * @param[out] dst  Destination tensor info. Can be @p src for an in-place computation.
+     *                  Data types supported: same as @p src.
+     * @param[in]  info Function to apply to every element.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const LookupTableActivationInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLookupTableActivationKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const LookupTableActivationInfo &info);
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct LookupTableActivationKernel
+    {
+        const char                                *name;
+        const ActivationDataTypeISASelectorDataPtr is_selected;
+        LookupTableActivationKernelPtr             ukernel;
+    };
+
+    static const std::vector<LookupTableActivationKernel> &get_available_kernels();
+
+private:
+    LookupTableActivationKernelPtr _run_method{nullptr};
+    std::vector<uint8_t>           _table_q8{};
+    std::vector<uint16_t>          _table_fp16{};
+    size_t                         _split_dimension{Window::DimY};
+    std::string                    _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULOOKUPTABLEACTIVATIONKERNEL_H
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuReductionKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/reduction_layer/generic/neon/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuReductionKernel::ReductionKernel> available_kernels = {
+    {"neon_fp32_reduction", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(neon_fp32_reduction)},
+    {"neon_fp16_reduction",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(neon_fp16_reduction)},
+    {"neon_s32_reduction", [](const DataTypeISASelectorData &data) { return data.dt == DataType::S32; },
+     REGISTER_INTEGER_NEON(neon_s32_reduction)},
+    {"neon_qu8_reduction", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+     REGISTER_QASYMM8_NEON(neon_qu8_reduction)},
+    {"neon_qs8_reduction", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_reduction)},
+};
+
+/** Number of X elements reduced by each task of a split reduction
+ *
+ * Large enough to amortise the scheduling of a task and the write of its partial result, and fixed so that the order
+ * of the operations does not depend on the number of threads.
+ */
+constexpr size_t split_chunk_len = 16384;
+
+uint32_t compute_axis_mask(const Coordinates &axis)
+{
+    uint32_t axis_mask = 0;
+    for (unsigned int i = 0; i < axis.num_dimensions(); ++i)
+    {
+        axis_mask |= 1U << axis[i];
+    }
+    return axis_mask;
+}
+
+TensorShape compute_output_shape(const TensorShape &shape, uint32_t axis_mask, bool keep_dims)
+{
+    TensorShape out_shape = shape;
+    // Walk the axes downwards so that removing a dimension does not shift the ones left to process
+    for (int d = Coordinates::num_max_dimensions - 1; d >= 0; --d)
+    {
+        if ((axis_mask & (1U << d)) == 0)
+        {
+            continue;
+        }
+        if (keep_dims)
+        {
+            out_shape.set(d, 1);
+        }
+        else if (static_cast<size_t>(d) < out_shape.num_dimensions())
+        {
+            out_shape.remove_dimension(d, false);
+        }
+    }
+    return out_shape;
+}
+
+/** Shape of the source with the reduced dimensions collapsed: one element per destination element */
+TensorShape compute_window_shape(const TensorShape &shape, const Coordinates &axis)
+{
+    TensorShape win_shape = shape;
+    for (unsigned int i = 0; i < axis.num_dimensions(); ++i)
+    {
+        win_shape.set(axis[i], 1, false);
+    }
+    return win_shape;
+}
+
+/** Shape of the partial results: two 32-bit slots per chunk of X and destination element */
+TensorShape compute_partials_shape(const TensorShape &shape, const Coordinates &axis, size_t num_chunks)
+{
+    TensorShape partials_shape = compute_window_shape(shape, axis);
+    partials_shape.set(0, 2 * num_chunks, false);
+    return partials_shape;
+}
+
+bool is_arg_min_max(ReductionOperation op)
+{
+    return op == ReductionOperation::ARG_IDX_MIN || op == ReductionOperation::ARG_IDX_MAX;
+}
+
+Status validate_arguments(const ITensorInfo &src,
+                          const ITensorInfo &dst,
+                          const Coordinates &axis,
+                          ReductionOperation op,
+                          bool               keep_dims,
+                          ReductionStage     stage,
+                          const ITensorInfo *partials)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis.num_dimensions() == 0, "No reduction axis");
+    for (unsigned int i = 0; i < axis.num_dimensions(); ++i)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis[i] < 0 || axis[i] >= static_cast<int>(TensorShape::num_max_dimensions),
+                                        "Reduction axis out of range");
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_arg_min_max(op) && axis.num_dimensions() != 1,
+                                    "Index operations support a single reduction axis");
+
+    const uint32_t axis_mask = compute_axis_mask(axis);
+    if (src.num_channels() == 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
+                                                             DataType::S32, DataType::F16, DataType::F32);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&src, 2, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(op != ReductionOperation::SUM);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((axis_mask & 1U) != 0, "Interleaved channels cannot be reduced along X");
+    }
+
+    if (dst.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(&dst);
+        if (is_arg_min_max(op))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&dst, 1, DataType::U32, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&src, &dst);
+            ARM_COMPUTE_RETURN_ERROR_ON(src.num_channels() != dst.num_channels());
+        }
+        const TensorInfo expected_dst = src.clone()->set_tensor_shape(
+            compute_output_shape(src.tensor_shape(), axis_mask, keep_dims));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&dst, &expected_dst);
+    }
+
+    if (stage != ReductionStage::Full)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(partials);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((axis_mask & 1U) == 0, "Only reductions along X can be split");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(partials, 1, DataType::S32);
+
+        const size_t num_chunks = partials->dimension(0) / 2;
+        ARM_COMPUTE_RETURN_ERROR_ON(num_chunks == 0 || num_chunks > src.dimension(0));
+        const TensorInfo expected_partials =
+            partials->clone()->set_tensor_shape(compute_partials_shape(src.tensor_shape(), axis, num_chunks));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(partials, &expected_partials);
+    }
+
+    const auto *uk =
+        CpuReductionKernel::get_implementation(DataTypeISASelectorData{src.data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuReductionKernel::ReductionKernel> &CpuReductionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+void CpuReductionKernel::configure(const ITensorInfo *src,
+                                   ITensorInfo       *dst,
+                                   const Coordinates &axis,
+                                   ReductionOperation op,
+                                   bool               keep_dims,
+                                   ReductionStage     stage,
+                                   const ITensorInfo *partials)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuReductionKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*src, *dst, axis, op, keep_dims, stage, partials));
+
+    _op        = op;
+    _stage     = stage;
+    _axis_mask = compute_axis_mask(axis);
+    _keep_dims = keep_dims;
+
+    const DataType dst_data_type = is_arg_min_max(op) ? DataType::S32 : src->data_type();
+    auto_init_if_empty(*dst, src->clone()
+                                 ->set_tensor_shape(compute_output_shape(src->tensor_shape(), _axis_mask, keep_dims))
+                                 .set_data_type(dst_data_type)
+                                 .reset_padding()
+                                 .set_is_resizable(true));
+
+    const auto *uk =
+        CpuReductionKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuReductionKernel").append("/").append(uk->name);
+
+    // One window step per destination element: the reduced dimensions are collapsed and walked by the ukernel.
+    // The partial stage has one window step per chunk of X instead.
+    TensorShape win_shape = compute_window_shape(src->tensor_shape(), axis);
+    if (stage == ReductionStage::Partial)
+    {
+        win_shape.set(0, partials->dimension(0) / 2, false);
+    }
+    ICpuKernel<CpuReductionKernel>::configure(calculate_max_window(win_shape, Steps()));
+}
+
+Status CpuReductionKernel::validate(const ITensorInfo *src,
+                                    const ITensorInfo *dst,
+                                    const Coordinates &axis,
+                                    ReductionOperation op,
+                                    bool               keep_dims,
+                                    ReductionStage     stage,
+                                    const ITensorInfo *partials)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuReductionKernel::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*src, *dst, axis, op, keep_dims, stage, partials));
+    return Status{};
+}
+
+TensorInfo CpuReductionKernel::split_partials_info(const ITensorInfo *src, const Coordinates &axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src);
+    const uint32_t axis_mask = compute_axis_mask(axis);
+    if ((axis_mask & 1U) == 0 || src->num_channels() != 1)
+    {
+        return TensorInfo();
+    }
+
+    // Splitting only pays off if there are more chunks than destination elements to distribute across threads
+    const TensorShape win_shape  = compute_window_shape(src->tensor_shape(), axis);
+    const size_t      num_chunks = DIV_CEIL(src->dimension(0), split_chunk_len);
+    if (num_chunks < 2 || num_chunks <= win_shape.total_size())
+    {
+        return TensorInfo();
+    }
+    return TensorInfo(compute_partials_shape(src->tensor_shape(), axis, num_chunks), 1, DataType::S32);
+}
+
+void CpuReductionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuReductionKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuReductionKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src      = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst      = tensors.get_tensor(TensorType::ACL_DST);
+    auto       partials = tensors.get_tensor(TensorType::ACL_INT);
+
+    _run_method(src, dst, partials, _op, _axis_mask, _keep_dims, _stage, window);
+}
+
+const char *CpuReductionKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUREDUCTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUREDUCTIONKERNEL_H
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/reduction_layer/generic/neon/list.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel reducing any set of axes of a tensor in a single pass
+ *
+ * Every source element is read once, whatever the number of reduced axes: when X is reduced each destination element
+ * is accumulated from all its reduced rows at once, otherwise blocks of X accumulators stay in the L1 cache while the
+ * reduced rows stream through them. No intermediate tensor is written, and the reduced dimensions can be dropped from
+ * the destination without a reshape.
+ *
+ * A long reduction along X with few destination elements can be split across threads in two stages: the
+ * @ref ReductionStage::Partial stage reduces fixed-size chunks of X into a tensor of partial results, then the
+ * @ref ReductionStage::Combine stage combines them in a fixed tree order. The chunks only depend on the shapes, so the
+ * results do not depend on the number of threads.
+ *
+ * The tensors are passed in the tensor pack as ACL_SRC, ACL_DST and, for a split reduction, ACL_INT for the partial
+ * results.
+ */
+class CpuReductionKernel : public ICpuKernel<CpuReductionKernel>
+{
+private:
+    using ReductionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     ITensor *,
+                                                     ITensor *,
+                                                     const ReductionOperation,
+                                                     uint32_t,
+                                                     bool,
+                                                     ReductionStage,
+                                                     const Window &)>::type;
+
+public:
+    CpuReductionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuReductionKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src       Source tensor info. Data types supported: QASYMM8_SIGNED/QASYMM8/S32/F16/F32.
+     *                       F32 with 2 channels is supported for @ref ReductionOperation::SUM if X is not reduced.
+     * @param[out] dst       Destination tensor info. Data types supported: same as @p src, or U32/S32 for
+     *                       @ref ReductionOperation::ARG_IDX_MIN and @ref ReductionOperation::ARG_IDX_MAX.
+     *                       Quantized results are requantized to the quantization info of @p dst.
+     * @param[in]  axis      Non-negative dimensions to reduce. The index operations support a single axis.
+     * @param[in]  op        Reduction operation to perform.
+     * @param[in]  keep_dims Whether to keep the reduced dimensions with size 1 in @p dst.
+     * @param[in]  stage     (Optional) Part of the reduction to compute. Defaults to the whole reduction.
+     * @param[in]  partials  (Optional) Partial results of a split reduction, as returned by split_partials_info().
+     *                       Only used by the @ref ReductionStage::Partial and @ref ReductionStage::Combine stages.
+     */
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *dst,
+                   const Coordinates &axis,
+                   ReductionOperation op,
+                   bool               keep_dims,
+                   ReductionStage     stage    = ReductionStage::Full,
+                   const ITensorInfo *partials = nullptr);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuReductionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           const Coordinates &axis,
+                           ReductionOperation op,
+                           bool               keep_dims,
+                           ReductionStage     stage    = ReductionStage::Full,
+                           const ITensorInfo *partials = nullptr);
+    /** Partial results needed to split a reduction along X across threads
+     *
+     * The reduction is worth splitting when X is reduced and has more chunks than there are destination elements to
+     * distribute across threads.
+     *
+     * @param[in] src  Source tensor info.
+     * @param[in] axis Non-negative dimensions to reduce.
+     *
+     * @return the info of the partial results, with a total size of 0 if the reduction should not be split
+     */
+    static TensorInfo split_partials_info(const ITensorInfo *src, const Coordinates &axis);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct ReductionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ReductionKernelPtr           ukernel;
+    };
+
+    static const std::vector<ReductionKernel> &get_available_kernels();
+
+private:
+    ReductionKernelPtr _run_method{nullptr};
+    ReductionOperation _op{ReductionOperation::SUM};
+    ReductionStage     _stage{ReductionStage::Full};
+    uint32_t           _axis_mask{0};
+    bool               _keep_dims{true};
+    std::string        _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUREDUCTIONKERNEL_H
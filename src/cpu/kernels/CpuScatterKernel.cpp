@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
@@ -33,6 +34,7 @@
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/scatter/list.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
@@ -44,6 +46,7 @@ namespace kernels
 {
 
 constexpr int max_index_length = 5;
+constexpr int max_partitions   = 128;
 
 /* Scatter */
 static const std::vector<typename CpuScatterKernel::ScatterKernel> available_kernels = {
@@ -72,11 +75,13 @@ const std::vector<typename CpuScatterKernel::ScatterKernel> &CpuScatterKernel::g
 void CpuScatterKernel::configure(const ITensorInfo *updates,
                                  const ITensorInfo *indices,
                                  ITensorInfo       *dst,
-                                 const ScatterInfo &scatter_info)
+                                 const ScatterInfo &scatter_info,
+                                 ScatterStage       stage,
+                                 const ITensorInfo *partitions)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuScatterKernel::configure");
     ARM_COMPUTE_ERROR_ON_NULLPTR(updates, dst, indices);
-    ARM_COMPUTE_ERROR_THROW_ON(validate(updates, indices, dst, scatter_info));
+    ARM_COMPUTE_ERROR_THROW_ON(validate(updates, indices, dst, scatter_info, stage, partitions));
     ARM_COMPUTE_LOG_PARAMS(updates, indices, dst, scatter_info);
 
     const auto uk = CpuScatterKernel::get_implementation<DataTypeISASelectorData>(
@@ -84,32 +89,35 @@ void CpuScatterKernel::configure(const ITensorInfo *updates,
 
     _run_method   = uk->ukernel;
     _scatter_func = scatter_info.func;
+    _stage        = stage;
     _name         = std::string("CpuScatterKernel").append("/").append(uk->name);
 
     const int index_len = indices->dimension(0);
+    const int data_dims = std::max(static_cast<int>(dst->num_dimensions()) - index_len, 0);
 
     // Check for single element data block
-    const bool is_scalar_block = (dst->num_dimensions() == static_cast<uint32_t>(index_len));
+    const bool is_scalar_block = (data_dims == 0);
 
     _data_block_length = is_scalar_block ? 1 : updates->dimension(0);
 
-    // The GWS will be 2D [x, y]
-    //  x-dimension refers to the x coordinate of the dst tensor
+    // The window is 3D [x, y, z]
+    //  x-dimension has a single step: the ukernel walks the whole data block along X
     //  y-dimension refers to the collapsed y-coordinate of the data part of the dst tensor
-    Window win;
-
-    if (!is_scalar_block)
+    //  z-dimension refers to the partitions of the destination blocks
+    size_t num_rows = 1;
+    for (int d = 1; d < data_dims; ++d)
     {
-        win = calculate_max_window(*dst, Steps(_data_block_length));
-
-        // Collapse the dimensions corresponding to indices in the execution window
-        for (int i = 0; i < index_len; ++i)
-        {
-            win.set(dst->num_dimensions() - (i + 1), Window::Dimension(0, 1, 1));
-        }
-
-        win = win.collapse(win, 1);
+        num_rows *= dst->dimension(d);
     }
+    const size_t num_partitions =
+        (stage == ScatterStage::Apply)
+            ? partitions->dimension(0) - 2 * indices->tensor_shape().total_size_upper(1) - 1
+            : 1;
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, (stage == ScatterStage::Partition) ? 1 : num_rows, 1));
+    win.set(Window::DimZ, Window::Dimension(0, num_partitions, 1));
 
     ICpuKernel::configure(win);
 }
@@ -117,7 +125,9 @@ void CpuScatterKernel::configure(const ITensorInfo *updates,
 Status CpuScatterKernel::validate(const ITensorInfo *updates,
                                   const ITensorInfo *indices,
                                   const ITensorInfo *dst,
-                                  const ScatterInfo &scatter_info)
+                                  const ScatterInfo &scatter_info,
+                                  ScatterStage       stage,
+                                  const ITensorInfo *partitions)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuScatterKernel::validate");
     ARM_COMPUTE_UNUSED(scatter_info);
@@ -172,9 +182,44 @@ Status CpuScatterKernel::validate(const ITensorInfo *updates,
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(index_len > dst_dims && dst_dims != 1,
                                     "Index length should be smaller than or equal to number of output dims");
 
+    if (stage != ScatterStage::Full)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(partitions);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(partitions, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(partitions->num_dimensions() > 1 || partitions->has_padding(),
+                                        "Partitions must be a contiguous 1D tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(partitions->dimension(0) < 2 * ind_shape.total_size_upper(1) + 2,
+                                        "Partitions tensor too small for the number of indices");
+    }
+
     return Status{};
 }
 
+TensorInfo CpuScatterKernel::partitions_info(const ITensorInfo *indices, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(indices, dst);
+
+    const int dst_dims  = dst->num_dimensions();
+    const int index_len = indices->dimension(0);
+    if (index_len > dst_dims)
+    {
+        return TensorInfo();
+    }
+
+    // Partitions are made of groups of blocks spanning at least a cache line, and every update with an in-bounds
+    // index needs an (update, destination block) pair
+    const size_t block_size     = dst->element_size() * dst->tensor_shape().total_size_lower(dst_dims - index_len);
+    const size_t group_blocks   = std::max<size_t>(1, scatter_partition_group_bytes / block_size);
+    const size_t num_blocks     = dst->tensor_shape().total_size_upper(dst_dims - index_len);
+    const size_t num_indices    = indices->tensor_shape().total_size_upper(1);
+    const size_t num_partitions = std::min<size_t>(DIV_CEIL(num_blocks, group_blocks), max_partitions);
+    if (num_partitions < 2 || num_indices < 2)
+    {
+        return TensorInfo();
+    }
+    return TensorInfo(TensorShape(2 * num_indices + num_partitions + 1), 1, DataType::S32);
+}
+
 void CpuScatterKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuScatterKernel::run_op");
@@ -185,9 +230,10 @@ void CpuScatterKernel::run_op(ITensorPack &tensors, const Window &window, const
     ARM_COMPUTE_ERROR_ON(tensors.empty());
     ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
 
-    const ITensor *updates = tensors.get_const_tensor(TensorType::ACL_SRC_1);
-    const ITensor *indices = tensors.get_const_tensor(TensorType::ACL_SRC_2);
-    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+    const ITensor *updates    = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *indices    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst        = tensors.get_tensor(TensorType::ACL_DST);
+    ITensor       *partitions = tensors.get_tensor(TensorType::ACL_INT);
 
     const ITensorInfo *dst_info  = dst->info();
     const ITensorInfo *upd_info  = updates->info();
@@ -201,7 +247,7 @@ void CpuScatterKernel::run_op(ITensorPack &tensors, const Window &window, const
         ARM_COMPUTE_ERROR("Unsupported Configuration! Padding not supported with these shapes.");
     }
 
-    _run_method(updates, indices, dst, _scatter_func, window, _data_block_length);
+    _run_method(updates, indices, dst, partitions, _scatter_func, _stage, window, _data_block_length);
 }
 
 const char *CpuScatterKernel::name() const
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,12 @@
 #ifndef ACL_SRC_CPU_KERNELS_CPUSCATTERKERNEL_H
 #define ACL_SRC_CPU_KERNELS_CPUSCATTERKERNEL_H
 
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
 
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/scatter/list.h"
 
 namespace arm_compute
 {
@@ -35,12 +37,28 @@ namespace cpu
 {
 namespace kernels
 {
-/** Arm(R) Neon(TM) kernel to perform the ScatterND operation */
+/** Arm(R) Neon(TM) kernel to perform the ScatterND operation
+ *
+ * Updates with duplicate indices are reduced in the order they appear, so the scatter cannot simply be split across
+ * the updates. It can instead be split across the destination in two stages: the @ref ScatterStage::Partition stage
+ * groups the updates by partitions of the destination blocks with a counting sort, then the
+ * @ref ScatterStage::Apply stage reduces every group on its own. Each group writes to its own destination blocks, so
+ * the groups can be reduced on different threads without atomics, and the result matches the serial scatter.
+ *
+ * The tensors are passed in the tensor pack as ACL_SRC_1 for the updates, ACL_SRC_2 for the indices, ACL_DST and, for
+ * a split scatter, ACL_INT for the partitions.
+ */
 class CpuScatterKernel : public ICpuKernel<CpuScatterKernel>
 {
 private:
-    using ScatterKernelPtr = std::add_pointer<void(
-        const ITensor *, const ITensor *, ITensor *, const ScatterFunction &, const Window &, const int)>::type;
+    using ScatterKernelPtr = std::add_pointer<void(const ITensor *,
+                                                   const ITensor *,
+                                                   ITensor *,
+                                                   ITensor *,
+                                                   const ScatterFunction &,
+                                                   ScatterStage,
+                                                   const Window &,
+                                                   const int)>::type;
 
 public:
     CpuScatterKernel() = default;
@@ -51,11 +69,16 @@ public:
      * @param[in]  indices      Input tensor info for the Indices matrix. Data type supported: S32.
      * @param[out] dst          Output tensor info. Data type supported: same as @p updates
      * @param[in]  scatter_info Attributes for Scatter Kernel
+     * @param[in]  stage        (Optional) Part of the scatter to compute. Defaults to the whole scatter.
+     * @param[in]  partitions   (Optional) Partitions of a split scatter, as returned by partitions_info().
+     *                          Only used by the @ref ScatterStage::Partition and @ref ScatterStage::Apply stages.
      */
     void configure(const ITensorInfo *updates,
                    const ITensorInfo *indices,
                    ITensorInfo       *dst,
-                   const ScatterInfo &scatter_info);
+                   const ScatterInfo &scatter_info,
+                   ScatterStage       stage      = ScatterStage::Full,
+                   const ITensorInfo *partitions = nullptr);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuScatterKernel::configure()
@@ -65,7 +88,20 @@ public:
     static Status validate(const ITensorInfo *updates,
                            const ITensorInfo *indices,
                            const ITensorInfo *dst,
-                           const ScatterInfo &scatter_info);
+                           const ScatterInfo &scatter_info,
+                           ScatterStage       stage      = ScatterStage::Full,
+                           const ITensorInfo *partitions = nullptr);
+    /** Partitions needed to split the scatter across threads
+     *
+     * The destination blocks are split into at most 128 partitions, which only depend on the shapes, so the result
+     * does not depend on the number of threads.
+     *
+     * @param[in] indices Indices tensor info.
+     * @param[in] dst     Output tensor info.
+     *
+     * @return the info of the partitions, with a total size of 0 if the scatter should not be split
+     */
+    static TensorInfo partitions_info(const ITensorInfo *indices, const ITensorInfo *dst);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -83,6 +119,7 @@ private:
     ScatterKernelPtr _run_method{nullptr};
     std::string      _name{};
     ScatterFunction  _scatter_func{};
+    ScatterStage     _stage{ScatterStage::Full};
     int              _data_block_length{};
 };
 } // namespace kernels
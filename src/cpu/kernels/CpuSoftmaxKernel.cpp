@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -226,7 +226,10 @@ void CpuSoftmaxKernel::configure(
     }
     else if (_axis > 0 && _axis <= 3)
     {
-        win = calculate_max_window(*dst, Steps(vec_size));
+        // Floating point kernels process a whole cache line of columns per step, the quantized ones size their
+        // per-thread scratch buffer for a single vector.
+        const int step = is_quantized_asymmetric ? vec_size : 64 / static_cast<int>(dst->element_size());
+        win            = calculate_max_window(*dst, Steps(step));
     }
     else
     {
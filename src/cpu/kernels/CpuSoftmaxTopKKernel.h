@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUSOFTMAXTOPKKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUSOFTMAXTOPKKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel computing the softmax probabilities of the k largest elements of every row
+ *
+ * The full softmax is never written: each row is read once to find its maximum, its sum of exponentials and its k
+ * largest logits, and only the k selected probabilities are computed.
+ */
+class CpuSoftmaxTopKKernel : public ICpuKernel<CpuSoftmaxTopKKernel>
+{
+private:
+    using SoftmaxTopKKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, ITensor *, float, unsigned int, const Window &)>::type;
+
+public:
+    CpuSoftmaxTopKKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuSoftmaxTopKKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src     Source tensor info. Softmax is computed along X. Data types supported: F16/F32.
+     * @param[out] values  Destination tensor info for the probabilities, sorted in descending order.
+     *                     Same shape as @p src with the X dimension set to @p k. Data types supported: same as @p src.
+     * @param[out] indices Destination tensor info for the positions along X of @p values.
+     *                     Same shape as @p values. Data types supported: U32.
+     * @param[in]  beta    A scaling factor for the exponent.
+     * @param[in]  k       Number of elements to select. Must be in the range [1, src's X dimension].
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, float beta, unsigned int k);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuSoftmaxTopKKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(
+        const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, float beta, unsigned int k);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct SoftmaxTopKKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        SoftmaxTopKKernelPtr         ukernel;
+    };
+
+    static const std::vector<SoftmaxTopKKernel> &get_available_kernels();
+
+private:
+    float                _beta{1.0f};
+    unsigned int         _k{1};
+    SoftmaxTopKKernelPtr _run_method{nullptr};
+    std::string          _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUSOFTMAXTOPKKERNEL_H
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuSparseFullyConnectedKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/sparse_fc/list.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuSparseFullyConnectedKernel::SparseFullyConnectedKernel> available_kernels = {
+    {"neon_fp32_sparse_fc", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_sparse_fc)}};
+
+/** Dense view of the weights as an N x K matrix whatever their storage order */
+class DenseWeights
+{
+public:
+    DenseWeights(const ITensorInfo *weights, bool transposed)
+        : _stride_n(weights->strides_in_bytes()[transposed ? 1 : 0]),
+          _stride_k(weights->strides_in_bytes()[transposed ? 0 : 1]),
+          _num_outputs(weights->dimension(transposed ? 1 : 0)),
+          _num_inputs(weights->dimension(transposed ? 0 : 1))
+    {
+    }
+
+    float at(const ITensor *weights, size_t n, size_t k) const
+    {
+        return *reinterpret_cast<const float *>(weights->buffer() + weights->info()->offset_first_element_in_bytes() +
+                                                n * _stride_n + k * _stride_k);
+    }
+
+    size_t num_outputs() const
+    {
+        return _num_outputs;
+    }
+
+    size_t num_inputs() const
+    {
+        return _num_inputs;
+    }
+
+private:
+    size_t _stride_n;
+    size_t _stride_k;
+    size_t _num_outputs;
+    size_t _num_inputs;
+};
+
+bool is_nonzero_block(
+    const ITensor *weights, const DenseWeights &view, size_t n0, size_t k0, unsigned int bh, unsigned int bw)
+{
+    for (size_t n = n0; n < n0 + bh; ++n)
+    {
+        for (size_t k = k0; k < k0 + bw; ++k)
+        {
+            if (view.at(weights, n, k) != 0.f)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+Status validate_arguments(const ITensorInfo                   *src,
+                          const ITensorInfo                   *weights,
+                          const ITensorInfo                   *bias,
+                          const ITensorInfo                   *dst,
+                          const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Only 2D sources are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->num_dimensions() > 2, "Weights must be 2D");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.max_density < 0.f || info.max_density > 1.f);
+
+    const DenseWeights view(weights, info.transpose_weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != view.num_inputs(),
+                                    "Input channels of src and weights do not match");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(view.num_outputs() % sparse_block_height(info.block_shape) != 0,
+                                    "Output channels must be a multiple of the block height");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(view.num_inputs() % sparse_block_width(info.block_shape) != 0,
+                                    "Input channels must be a multiple of the block width");
+
+    if (info.activation_info.enabled())
+    {
+        using ActFunction = ActivationLayerInfo::ActivationFunction;
+        const ActFunction act = info.activation_info.activation();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act != ActFunction::IDENTITY && act != ActFunction::RELU &&
+                                            act != ActFunction::BOUNDED_RELU && act != ActFunction::LU_BOUNDED_RELU,
+                                        "Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU can be fused");
+    }
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != view.num_outputs());
+    }
+
+    const auto uk = CpuSparseFullyConnectedKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(),
+                                                           TensorShape(view.num_outputs(), src->dimension(1)));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuSparseFullyConnectedKernel::configure(const ITensorInfo                   *src,
+                                              const ITensorInfo                   *weights,
+                                              const ITensorInfo                   *bias,
+                                              ITensorInfo                         *dst,
+                                              const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuSparseFullyConnectedKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, bias, dst, info));
+    ARM_COMPUTE_UNUSED(bias);
+
+    const DenseWeights view(weights, info.transpose_weights);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(TensorShape(view.num_outputs(), src->dimension(1))));
+
+    const auto uk = CpuSparseFullyConnectedKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuSparseFullyConnectedKernel").append("/").append(uk->name);
+    _info       = info;
+
+    // X iterates over rows of blocks rather than output channels so each work item owns whole blocks
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, view.num_outputs() / sparse_block_height(info.block_shape), 1));
+    win.set(Window::DimY, Window::Dimension(0, src->dimension(1), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuSparseFullyConnectedKernel::validate(const ITensorInfo                   *src,
+                                               const ITensorInfo                   *weights,
+                                               const ITensorInfo                   *bias,
+                                               const ITensorInfo                   *dst,
+                                               const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, bias, dst, info));
+    return Status{};
+}
+
+unsigned int CpuSparseFullyConnectedKernel::total_blocks(const ITensorInfo                   *weights,
+                                                         const SparseFullyConnectedLayerInfo &info)
+{
+    const unsigned int block_size = sparse_block_height(info.block_shape) * sparse_block_width(info.block_shape);
+    return weights->tensor_shape().total_size() / block_size;
+}
+
+unsigned int CpuSparseFullyConnectedKernel::count_nonzero_blocks(const ITensor                       *weights,
+                                                                 const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+    const DenseWeights view(weights->info(), info.transpose_weights);
+    const unsigned int bh = sparse_block_height(info.block_shape);
+    const unsigned int bw = sparse_block_width(info.block_shape);
+
+    unsigned int num_blocks = 0;
+    for (size_t n = 0; n < view.num_outputs(); n += bh)
+    {
+        for (size_t k = 0; k < view.num_inputs(); k += bw)
+        {
+            num_blocks += is_nonzero_block(weights, view, n, k, bh, bw) ? 1 : 0;
+        }
+    }
+    return num_blocks;
+}
+
+size_t CpuSparseFullyConnectedKernel::packed_weights_size(const ITensorInfo                   *weights,
+                                                          unsigned int                         num_blocks,
+                                                          const SparseFullyConnectedLayerInfo &info)
+{
+    const DenseWeights view(weights, info.transpose_weights);
+    const unsigned int bh             = sparse_block_height(info.block_shape);
+    const unsigned int bw             = sparse_block_width(info.block_shape);
+    const unsigned int num_row_blocks = view.num_outputs() / bh;
+
+    return sparse_fc_values_offset(num_row_blocks, num_blocks) + num_blocks * bh * bw * sizeof(float);
+}
+
+void CpuSparseFullyConnectedKernel::pack_weights(const ITensor                       *weights,
+                                                 ITensor                             *packed,
+                                                 const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuSparseFullyConnectedKernel::pack_weights");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed);
+
+    const DenseWeights view(weights->info(), info.transpose_weights);
+    const unsigned int bh             = sparse_block_height(info.block_shape);
+    const unsigned int bw             = sparse_block_width(info.block_shape);
+    const unsigned int num_row_blocks = view.num_outputs() / bh;
+    const unsigned int num_blocks     = count_nonzero_blocks(weights, info);
+    ARM_COMPUTE_ERROR_ON(packed->info()->total_size() < packed_weights_size(weights->info(), num_blocks, info));
+
+    uint8_t *packed_ptr = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    std::memset(packed_ptr, 0, sparse_fc_values_offset(num_row_blocks, num_blocks));
+
+    int32_t *row_ptr = reinterpret_cast<int32_t *>(packed_ptr);
+    int32_t *col_idx = row_ptr + num_row_blocks + 1;
+    float   *values  = reinterpret_cast<float *>(packed_ptr + sparse_fc_values_offset(num_row_blocks, num_blocks));
+
+    int32_t block = 0;
+    for (unsigned int rb = 0; rb < num_row_blocks; ++rb)
+    {
+        row_ptr[rb]     = block;
+        const size_t n0 = rb * bh;
+        for (size_t k0 = 0; k0 < view.num_inputs(); k0 += bw)
+        {
+            if (!is_nonzero_block(weights, view, n0, k0, bh, bw))
+            {
+                continue;
+            }
+            col_idx[block] = static_cast<int32_t>(k0);
+            for (unsigned int c = 0; c < bw; ++c)
+            {
+                for (unsigned int r = 0; r < bh; ++r)
+                {
+                    *values++ = view.at(weights, n0 + r, k0 + c);
+                }
+            }
+            ++block;
+        }
+    }
+    row_ptr[num_row_blocks] = block;
+}
+
+void CpuSparseFullyConnectedKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuSparseFullyConnectedKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *bias   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, packed, bias, dst, _info, window);
+}
+
+const char *CpuSparseFullyConnectedKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuSparseFullyConnectedKernel::SparseFullyConnectedKernel> &
+CpuSparseFullyConnectedKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
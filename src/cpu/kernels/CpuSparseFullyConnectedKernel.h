@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUSPARSEFULLYCONNECTEDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUSPARSEFULLYCONNECTEDKERNEL_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute a fully connected layer with block-sparse weights
+ *
+ * The weights are expected in the block compressed sparse row layout produced by
+ * @ref CpuSparseFullyConnectedKernel::pack_weights():
+ * - (N / block height + 1) int32 offsets to the first block of each row of blocks,
+ * - one int32 per block holding the first input channel the block covers,
+ * - the block values, aligned to 16 bytes, stored input channel major within each block.
+ */
+class CpuSparseFullyConnectedKernel : public ICpuKernel<CpuSparseFullyConnectedKernel>
+{
+private:
+    using SparseFullyConnectedKernelPtr =
+        std::add_pointer<void(const ITensor *,
+                              const ITensor *,
+                              const ITensor *,
+                              ITensor *,
+                              const SparseFullyConnectedLayerInfo &,
+                              const Window &)>::type;
+
+public:
+    struct SparseFullyConnectedKernel
+    {
+        const char                   *name;
+        const DataTypeISASelectorPtr  is_selected;
+        SparseFullyConnectedKernelPtr ukernel;
+    };
+
+    CpuSparseFullyConnectedKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuSparseFullyConnectedKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src     Source tensor info of shape [K, M]. Data types supported: F32.
+     * @param[in]  weights Dense weights tensor info. [K, N] if @ref SparseFullyConnectedLayerInfo::transpose_weights
+     *                     is set, [N, K] otherwise. Only used for shape checks. Data type supported: same as @p src.
+     * @param[in]  bias    (Optional) Bias tensor info of shape [N]. Can be nullptr. Data type supported: same as @p src.
+     * @param[out] dst     Destination tensor info of shape [N, M]. Data type supported: same as @p src.
+     * @param[in]  info    Sparse fully connected layer information.
+     */
+    void configure(const ITensorInfo                   *src,
+                   const ITensorInfo                   *weights,
+                   const ITensorInfo                   *bias,
+                   ITensorInfo                         *dst,
+                   const SparseFullyConnectedLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuSparseFullyConnectedKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *src,
+                           const ITensorInfo                   *weights,
+                           const ITensorInfo                   *bias,
+                           const ITensorInfo                   *dst,
+                           const SparseFullyConnectedLayerInfo &info);
+    /** Number of blocks the dense weights are split into
+     *
+     * @param[in] weights Dense weights tensor info.
+     * @param[in] info    Sparse fully connected layer information.
+     *
+     * @return the number of blocks, zero or not
+     */
+    static unsigned int total_blocks(const ITensorInfo *weights, const SparseFullyConnectedLayerInfo &info);
+    /** Count the blocks of the dense weights holding at least one non-zero value
+     *
+     * @param[in] weights Dense weights tensor, in the layout described in @ref configure().
+     * @param[in] info    Sparse fully connected layer information.
+     *
+     * @return the number of non-zero blocks
+     */
+    static unsigned int count_nonzero_blocks(const ITensor *weights, const SparseFullyConnectedLayerInfo &info);
+    /** Size in bytes of the packed weights buffer
+     *
+     * @param[in] weights    Dense weights tensor info.
+     * @param[in] num_blocks Number of non-zero blocks as returned by @ref count_nonzero_blocks().
+     * @param[in] info       Sparse fully connected layer information.
+     *
+     * @return the size of the buffer
+     */
+    static size_t
+    packed_weights_size(const ITensorInfo *weights, unsigned int num_blocks, const SparseFullyConnectedLayerInfo &info);
+    /** Compress the dense weights into the layout consumed by the kernel
+     *
+     * @param[in]  weights Dense weights tensor, in the layout described in @ref configure().
+     * @param[out] packed  U8 tensor of at least @ref packed_weights_size() bytes.
+     * @param[in]  info    Sparse fully connected layer information.
+     */
+    static void pack_weights(const ITensor *weights, ITensor *packed, const SparseFullyConnectedLayerInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<SparseFullyConnectedKernel> &get_available_kernels();
+
+private:
+    SparseFullyConnectedKernelPtr _run_method{nullptr};
+    SparseFullyConnectedLayerInfo _info{};
+    std::string                   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUSPARSEFULLYCONNECTEDKERNEL_H
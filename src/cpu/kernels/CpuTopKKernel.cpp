@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuTopKKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuTopKKernel::TopKKernel> available_kernels = {
+    {"neon_fp32_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(neon_fp32_topk)},
+    {"neon_fp16_topk", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(neon_fp16_topk)},
+};
+
+/** Length of the chunks a long row is split into, in elements */
+constexpr size_t split_chunk_len = 16384;
+/** Largest k for which splitting a row pays off: the partial results must stay much shorter than the chunks */
+constexpr unsigned int split_max_k = split_chunk_len / 16;
+
+TensorShape compute_topk_shape(const ITensorInfo &src, unsigned int k)
+{
+    TensorShape shape = src.tensor_shape();
+    shape.set(Window::DimX, k);
+    return shape;
+}
+
+/** Shape of the partial results: k candidates of two 32-bit slots per chunk of every row */
+TensorShape compute_partials_shape(const ITensorInfo &src, unsigned int k, size_t num_chunks)
+{
+    return compute_topk_shape(src, 2 * k * num_chunks);
+}
+
+Status validate_arguments(const ITensorInfo &src,
+                          const ITensorInfo &values,
+                          const ITensorInfo &indices,
+                          unsigned int       k,
+                          TopKStage          stage,
+                          const ITensorInfo *partials)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(&src);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k == 0 || k > src.dimension(0), "k must be in the range [1, src's X dimension]");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src.dimension(0) > std::numeric_limits<uint32_t>::max(),
+                                    "The indices along X must fit in 32 bits");
+
+    const TensorShape out_shape = compute_topk_shape(src, k);
+    if (values.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&src, &values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(values.tensor_shape(), out_shape);
+    }
+    if (indices.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&indices, 1, DataType::U32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(indices.tensor_shape(), out_shape);
+    }
+
+    if (stage != TopKStage::Full)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(partials);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(partials, 1, DataType::S32);
+
+        const size_t num_chunks = partials->dimension(0) / (2 * k);
+        ARM_COMPUTE_RETURN_ERROR_ON(num_chunks == 0 || num_chunks > src.dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(partials->tensor_shape(),
+                                                           compute_partials_shape(src, k, num_chunks));
+    }
+
+    const auto *uk =
+        CpuTopKKernel::get_implementation(DataTypeISASelectorData{src.data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuTopKKernel::TopKKernel> &CpuTopKKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+void CpuTopKKernel::configure(const ITensorInfo *src,
+                              ITensorInfo       *values,
+                              ITensorInfo       *indices,
+                              unsigned int       k,
+                              TopKStage          stage,
+                              const ITensorInfo *partials)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuTopKKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*src, *values, *indices, k, stage, partials));
+
+    const TensorShape out_shape = compute_topk_shape(*src, k);
+    auto_init_if_empty(*values, out_shape, 1, src->data_type());
+    auto_init_if_empty(*indices, out_shape, 1, DataType::U32);
+
+    const auto *uk =
+        CpuTopKKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _stage      = stage;
+    _k          = k;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuTopKKernel").append("/").append(uk->name);
+
+    // One window step per row: the ukernel walks the whole row. The partial stage has one window step per chunk of
+    // every row instead.
+    const size_t win_x = (stage == TopKStage::Partial) ? partials->dimension(0) / (2 * k) : 1;
+    ICpuKernel<CpuTopKKernel>::configure(calculate_max_window(compute_topk_shape(*src, win_x), Steps()));
+}
+
+Status CpuTopKKernel::validate(const ITensorInfo *src,
+                               const ITensorInfo *values,
+                               const ITensorInfo *indices,
+                               unsigned int       k,
+                               TopKStage          stage,
+                               const ITensorInfo *partials)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuTopKKernel::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*src, *values, *indices, k, stage, partials));
+    return Status{};
+}
+
+TensorInfo CpuTopKKernel::split_partials_info(const ITensorInfo *src, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src);
+    if (k == 0 || k > split_max_k)
+    {
+        return TensorInfo();
+    }
+
+    // Splitting only pays off if there are more chunks than rows to distribute across threads
+    const size_t num_rows   = src->tensor_shape().total_size_upper(1);
+    const size_t num_chunks = DIV_CEIL(src->dimension(0), split_chunk_len);
+    if (num_chunks < 2 || num_chunks <= num_rows)
+    {
+        return TensorInfo();
+    }
+    return TensorInfo(compute_partials_shape(*src, k, num_chunks), 1, DataType::S32);
+}
+
+void CpuTopKKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuTopKKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuTopKKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src      = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       values   = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto       indices  = tensors.get_tensor(TensorType::ACL_DST_1);
+    auto       partials = tensors.get_tensor(TensorType::ACL_INT);
+
+    _run_method(src, values, indices, partials, _k, _stage, window);
+}
+
+const char *CpuTopKKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/topk/list.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel selecting the k largest elements of every row along X, sorted in descending order, and their indices
+ *
+ * Equal values are ranked by increasing index and NaNs rank after every number. The elements of a row are compared to
+ * the k-th best value found so far with vector instructions, so only the few blocks of a long row holding a better
+ * element are looked at one element at a time.
+ *
+ * A long row can be split across threads in two stages: the @ref TopKStage::Partial stage selects the top-k of
+ * fixed-size chunks of the row into a tensor of partial results, then the @ref TopKStage::Combine stage selects the
+ * top-k of the row among them. The chunks only depend on the shapes, so the results do not depend on the number of
+ * threads.
+ *
+ * The tensors are passed in the tensor pack as ACL_SRC, ACL_DST_0 for the values, ACL_DST_1 for the indices and, for a
+ * split selection, ACL_INT for the partial results.
+ */
+class CpuTopKKernel : public ICpuKernel<CpuTopKKernel>
+{
+private:
+    using TopKKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, ITensor *, ITensor *, unsigned int, TopKStage, const Window &)>::type;
+
+public:
+    CpuTopKKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTopKKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src      Source tensor info. Data types supported: F16/F32.
+     * @param[out] values   Destination tensor info of the selected values, with k elements along X.
+     *                      Data types supported: same as @p src.
+     * @param[out] indices  Destination tensor info of the indices along X of the selected values.
+     *                      Data types supported: U32.
+     * @param[in]  k        Number of elements to select in every row. Must be in the range [1, width of @p src].
+     * @param[in]  stage    (Optional) Part of the selection to compute. Defaults to the whole selection.
+     * @param[in]  partials (Optional) Partial results of a split selection, as returned by split_partials_info().
+     *                      Only used by the @ref TopKStage::Partial and @ref TopKStage::Combine stages.
+     */
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *values,
+                   ITensorInfo       *indices,
+                   unsigned int       k,
+                   TopKStage          stage    = TopKStage::Full,
+                   const ITensorInfo *partials = nullptr);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuTopKKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *values,
+                           const ITensorInfo *indices,
+                           unsigned int       k,
+                           TopKStage          stage    = TopKStage::Full,
+                           const ITensorInfo *partials = nullptr);
+    /** Partial results needed to split the selection of long rows across threads
+     *
+     * The selection is worth splitting when the rows have more chunks than there are rows to distribute across
+     * threads, and k is small enough for the partial results to be much shorter than the rows.
+     *
+     * @param[in] src Source tensor info.
+     * @param[in] k   Number of elements to select in every row.
+     *
+     * @return the info of the partial results, with a total size of 0 if the selection should not be split
+     */
+    static TensorInfo split_partials_info(const ITensorInfo *src, unsigned int k);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct TopKKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        TopKKernelPtr                ukernel;
+    };
+
+    static const std::vector<TopKKernel> &get_available_kernels();
+
+private:
+    TopKKernelPtr _run_method{nullptr};
+    TopKStage     _stage{TopKStage::Full};
+    unsigned int  _k{0};
+    std::string   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
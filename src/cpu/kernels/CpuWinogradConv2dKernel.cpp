@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,8 +32,10 @@ namespace cpu
 {
 CpuWinogradConv2dTransformInputKernel::CpuWinogradConv2dTransformInputKernel(arm_conv::winograd::WinogradImpl &w_impl,
                                                                              arm_conv::ConvolutionArgs        &_c_args,
-                                                                             uint32_t                          nthreads)
-    : _winograd_impl{w_impl}, _conv_args{_c_args}, _nthreads{nthreads}
+                                                                             uint32_t                          nthreads,
+                                                                             unsigned int                      batch,
+                                                                             unsigned int                      row)
+    : _winograd_impl{w_impl}, _conv_args{_c_args}, _nthreads{nthreads}, _batch{batch}, _row{row}
 {
 }
 
@@ -56,7 +58,8 @@ void CpuWinogradConv2dTransformInputKernel::run_op(ITensorPack &tensors, const W
     const size_t input_col_stride   = src_strides[width_idx] / element_size_in_bytes;
     const size_t input_batch_stride = src_strides[batch_idx] / element_size_in_bytes;
     const auto   input_nhwc_ptr =
-        reinterpret_cast<const void *>(input_nhwc->buffer() + input_nhwc->info()->offset_first_element_in_bytes());
+        reinterpret_cast<const void *>(input_nhwc->buffer() + input_nhwc->info()->offset_first_element_in_bytes() +
+                                       _batch * src_strides[batch_idx] + _row * src_strides[height_idx]);
     auto win_transf_ptr = reinterpret_cast<void *>(winograd_input_transform->buffer() +
                                                    winograd_input_transform->info()->offset_first_element_in_bytes());
 
@@ -67,8 +70,10 @@ void CpuWinogradConv2dTransformInputKernel::run_op(ITensorPack &tensors, const W
 
 CpuWinogradConv2dTransformOutputKernel::CpuWinogradConv2dTransformOutputKernel(arm_conv::winograd::WinogradImpl &w_impl,
                                                                                arm_conv::ConvolutionArgs &_c_args,
-                                                                               uint32_t                   nthreads)
-    : _winograd_impl{w_impl}, _conv_args{_c_args}, _nthreads{nthreads}
+                                                                               uint32_t                   nthreads,
+                                                                               unsigned int               batch,
+                                                                               unsigned int               row)
+    : _winograd_impl{w_impl}, _conv_args{_c_args}, _nthreads{nthreads}, _batch{batch}, _row{row}
 {
 }
 
@@ -95,7 +100,8 @@ void CpuWinogradConv2dTransformOutputKernel::run_op(ITensorPack &tensors, const
     const auto   wout_transf_ptr  = reinterpret_cast<const void *>(
         winograd_output_transform->buffer() + winograd_output_transform->info()->offset_first_element_in_bytes());
     auto dst_nhwc_ptr =
-        reinterpret_cast<void *>(dst_nhwc->buffer() + dst_nhwc->info()->offset_first_element_in_bytes());
+        reinterpret_cast<void *>(dst_nhwc->buffer() + dst_nhwc->info()->offset_first_element_in_bytes() +
+                                 _batch * dst_strides[batch_idx] + _row * dst_strides[height_idx]);
     void *biases_data_ptr = nullptr;
     if (biases != nullptr)
     {
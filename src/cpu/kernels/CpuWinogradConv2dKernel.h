@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,9 +54,21 @@ public:
     /**  Prevent instances of this class from being moved it contains references.*/
     CpuWinogradConv2dTransformInputKernel &operator=(CpuWinogradConv2dTransformInputKernel &&) = delete;
 
+    /** Constructor
+     *
+     * When the convolution is executed in bands of rows, @p _c_args describe a single band of a single batch.
+     *
+     * @param[in] w_impl   Selected Winograd implementation.
+     * @param[in] _c_args  Convolution arguments of the transformed input.
+     * @param[in] nthreads Number of threads the transform is split between.
+     * @param[in] batch    (Optional) Batch of the source tensor to process.
+     * @param[in] row      (Optional) First row of the source tensor to read.
+     */
     CpuWinogradConv2dTransformInputKernel(arm_conv::winograd::WinogradImpl &w_impl,
                                           arm_conv::ConvolutionArgs        &_c_args,
-                                          uint32_t                          nthreads);
+                                          uint32_t                          nthreads,
+                                          unsigned int                      batch = 0,
+                                          unsigned int                      row   = 0);
 
     // Inherited methods overridden:
     void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -70,6 +82,8 @@ private:
     arm_conv::winograd::WinogradImpl &_winograd_impl;
     arm_conv::ConvolutionArgs        &_conv_args;
     uint32_t                          _nthreads;
+    const unsigned int                _batch;
+    const unsigned int                _row;
 };
 class CpuWinogradConv2dTransformOutputKernel : public ICpuKernel<CpuWinogradConv2dTransformOutputKernel>
 {
@@ -86,9 +100,21 @@ public:
     /**  Prevent instances of this class from being moved it contains references.*/
     CpuWinogradConv2dTransformOutputKernel &operator=(CpuWinogradConv2dTransformOutputKernel &&) = delete;
 
+    /** Constructor
+     *
+     * When the convolution is executed in bands of rows, @p _c_args describe a single band of a single batch.
+     *
+     * @param[in] w_impl   Selected Winograd implementation.
+     * @param[in] _c_args  Convolution arguments of the transformed output.
+     * @param[in] nthreads Number of threads the transform is split between.
+     * @param[in] batch    (Optional) Batch of the destination tensor to process.
+     * @param[in] row      (Optional) First row of the destination tensor to write.
+     */
     CpuWinogradConv2dTransformOutputKernel(arm_conv::winograd::WinogradImpl &w_impl,
                                            arm_conv::ConvolutionArgs        &_c_args,
-                                           uint32_t                          nthreads);
+                                           uint32_t                          nthreads,
+                                           unsigned int                      batch = 0,
+                                           unsigned int                      row   = 0);
 
     // Inherited methods overridden:
     void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -102,6 +128,8 @@ private:
     arm_conv::winograd::WinogradImpl &_winograd_impl;
     const arm_conv::ConvolutionArgs  &_conv_args;
     uint32_t                          _nthreads;
+    const unsigned int                _batch;
+    const unsigned int                _row;
 };
 
 } // namespace cpu
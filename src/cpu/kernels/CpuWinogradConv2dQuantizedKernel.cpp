@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuWinogradConv2dQuantizedKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+constexpr size_t num_winograd_matrices = 16; // Elements of a 4x4 Winograd domain tile
+
+static const std::vector<CpuWinogradConv2dQuantizedTransformInputKernel::InputTransformKernel>
+    available_input_kernels = {
+        {"neon_qu8_winograd_f2x2_3x3_input_transform",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_winograd_f2x2_3x3_input_transform)},
+        {"neon_qs8_winograd_f2x2_3x3_input_transform",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_winograd_f2x2_3x3_input_transform)},
+};
+
+static const std::vector<CpuWinogradConv2dQuantizedTransformOutputKernel::OutputTransformKernel>
+    available_output_kernels = {
+        {"neon_qu8_winograd_f2x2_3x3_output_transform",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_winograd_f2x2_3x3_output_transform)},
+        {"neon_qs8_winograd_f2x2_3x3_output_transform",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_winograd_f2x2_3x3_output_transform)},
+};
+
+/** Window over the output tiles: X and Y walk the tiles of an image, Z the batches */
+Window tiles_window(const WinogradF2x2Tiling &tiling, size_t batches)
+{
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, tiling.num_tiles_x, 1));
+    win.set(Window::DimY, Window::Dimension(0, tiling.num_tiles_y, 1));
+    win.set(Window::DimZ, Window::Dimension(0, static_cast<int>(batches), 1));
+    return win;
+}
+
+Status validate_tiling(const WinogradF2x2Tiling &tiling)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(tiling.num_tiles_x <= 0 || tiling.num_tiles_y <= 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(tiling.pad_left < 0 || tiling.pad_top < 0);
+    return Status{};
+}
+} // namespace
+
+void CpuWinogradConv2dQuantizedTransformInputKernel::configure(const ITensorInfo        *src,
+                                                               ITensorInfo              *dst,
+                                                               const WinogradF2x2Tiling &tiling)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedTransformInputKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, dst, tiling));
+    ARM_COMPUTE_UNUSED(dst);
+
+    const auto uk = get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuWinogradConv2dQuantizedTransformInputKernel").append("/").append(uk->name);
+    _tiling     = tiling;
+    _src_offset = src->quantization_info().uniform().offset;
+
+    ICpuKernel::configure(tiles_window(tiling, src->dimension(3)));
+}
+
+Status CpuWinogradConv2dQuantizedTransformInputKernel::validate(const ITensorInfo        *src,
+                                                                const ITensorInfo        *dst,
+                                                                const WinogradF2x2Tiling &tiling)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::S16);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_tiling(tiling));
+
+    const size_t num_tiles = src->dimension(3) * tiling.num_tiles_y * tiling.num_tiles_x;
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+        dst->tensor_shape(), TensorShape(src->dimension(0), num_tiles, num_winograd_matrices));
+
+    const auto *uk = get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+void CpuWinogradConv2dQuantizedTransformInputKernel::run_op(ITensorPack      &tensors,
+                                                            const Window     &window,
+                                                            const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedTransformInputKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, _tiling, _src_offset, window);
+}
+
+const char *CpuWinogradConv2dQuantizedTransformInputKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuWinogradConv2dQuantizedTransformInputKernel::InputTransformKernel> &
+CpuWinogradConv2dQuantizedTransformInputKernel::get_available_kernels()
+{
+    return available_input_kernels;
+}
+
+void CpuWinogradConv2dQuantizedTransformWeightsKernel::configure(const ITensorInfo *weights, ITensorInfo *dst)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedTransformWeightsKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(weights, dst));
+    ARM_COMPUTE_UNUSED(dst);
+
+    // Symmetric per-channel weights have no offset
+    _run_method     = (weights->data_type() == DataType::QASYMM8) ? &neon_u8_winograd_f2x2_3x3_weight_transform
+                                                                  : &neon_s8_winograd_f2x2_3x3_weight_transform;
+    _weights_offset = is_data_type_quantized_asymmetric(weights->data_type())
+                          ? weights->quantization_info().uniform().offset
+                          : 0;
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, static_cast<int>(weights->dimension(3)), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuWinogradConv2dQuantizedTransformWeightsKernel::validate(const ITensorInfo *weights, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::S16);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != 3 || weights->dimension(2) != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+        dst->tensor_shape(), TensorShape(weights->dimension(3), weights->dimension(0), num_winograd_matrices));
+    return Status{};
+}
+
+void CpuWinogradConv2dQuantizedTransformWeightsKernel::run_op(ITensorPack      &tensors,
+                                                              const Window     &window,
+                                                              const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedTransformWeightsKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(weights, dst, _weights_offset, window);
+}
+
+const char *CpuWinogradConv2dQuantizedTransformWeightsKernel::name() const
+{
+    return "CpuWinogradConv2dQuantizedTransformWeightsKernel";
+}
+
+void CpuWinogradConv2dQuantizedGemmKernel::configure(const ITensorInfo *lhs, const ITensorInfo *rhs, ITensorInfo *dst)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedGemmKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(lhs, rhs, dst));
+    ARM_COMPUTE_UNUSED(rhs, dst);
+
+    _run_method = &neon_s16_winograd_gemm;
+
+    // One matrix per step along X; along Y the rows are processed in blocks of 4, the columns of a block all at once.
+    // Both dimensions can be split between threads.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_winograd_matrices, 1));
+    win.set(Window::DimY, Window::Dimension(0, static_cast<int>(ceil_to_multiple(lhs->dimension(1), 4)), 4));
+    ICpuKernel::configure(win);
+}
+
+Status
+CpuWinogradConv2dQuantizedGemmKernel::validate(const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::S16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs, 1, DataType::S16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(lhs->dimension(2) != num_winograd_matrices ||
+                                rhs->dimension(2) != num_winograd_matrices);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(0) != rhs->dimension(1), "Mismatching K dimension");
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+        dst->tensor_shape(), TensorShape(rhs->dimension(0), lhs->dimension(1), num_winograd_matrices));
+    return Status{};
+}
+
+void CpuWinogradConv2dQuantizedGemmKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedGemmKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *rhs = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(lhs, rhs, dst, window);
+}
+
+const char *CpuWinogradConv2dQuantizedGemmKernel::name() const
+{
+    return "CpuWinogradConv2dQuantizedGemmKernel";
+}
+
+void CpuWinogradConv2dQuantizedTransformOutputKernel::configure(const ITensorInfo             *src,
+                                                                const ITensorInfo             *bias,
+                                                                ITensorInfo                   *dst,
+                                                                const WinogradF2x2Tiling      &tiling,
+                                                                const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedTransformOutputKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, bias, dst, tiling, output_stage));
+    ARM_COMPUTE_UNUSED(src, bias);
+
+    const auto uk = get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method   = uk->ukernel;
+    _name         = std::string("CpuWinogradConv2dQuantizedTransformOutputKernel").append("/").append(uk->name);
+    _tiling       = tiling;
+    _output_stage = output_stage;
+
+    ICpuKernel::configure(tiles_window(tiling, dst->dimension(3)));
+}
+
+Status CpuWinogradConv2dQuantizedTransformOutputKernel::validate(const ITensorInfo             *src,
+                                                                 const ITensorInfo             *bias,
+                                                                 const ITensorInfo             *dst,
+                                                                 const WinogradF2x2Tiling      &tiling,
+                                                                 const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_tiling(tiling));
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) > 2U * tiling.num_tiles_x ||
+                                dst->dimension(2) > 2U * tiling.num_tiles_y);
+
+    const size_t num_tiles = dst->dimension(3) * tiling.num_tiles_y * tiling.num_tiles_x;
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+        src->tensor_shape(), TensorShape(dst->dimension(0), num_tiles, num_winograd_matrices));
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != dst->dimension(0));
+    }
+    if (output_stage.is_quantized_per_channel)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_multipliers.size() < dst->dimension(0) ||
+                                    output_stage.gemmlowp_shifts.size() < dst->dimension(0));
+    }
+
+    const auto *uk = get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+void CpuWinogradConv2dQuantizedTransformOutputKernel::run_op(ITensorPack      &tensors,
+                                                             const Window     &window,
+                                                             const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantizedTransformOutputKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *bias = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst  = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, bias, dst, _tiling, _output_stage, window);
+}
+
+const char *CpuWinogradConv2dQuantizedTransformOutputKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuWinogradConv2dQuantizedTransformOutputKernel::OutputTransformKernel> &
+CpuWinogradConv2dQuantizedTransformOutputKernel::get_available_kernels()
+{
+    return available_output_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUWINOGRADCONV2DQUANTIZEDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUWINOGRADCONV2DQUANTIZEDKERNEL_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/winograd_quantized/list.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to transform the 4x4 input tiles of a quantized NHWC tensor into the int16 Winograd F(2x2, 3x3) domain */
+class CpuWinogradConv2dQuantizedTransformInputKernel
+    : public ICpuKernel<CpuWinogradConv2dQuantizedTransformInputKernel>
+{
+private:
+    using InputTransformKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, const WinogradF2x2Tiling &, int32_t, const Window &)>::type;
+
+public:
+    struct InputTransformKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        InputTransformKernelPtr      ukernel;
+    };
+
+    CpuWinogradConv2dQuantizedTransformInputKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWinogradConv2dQuantizedTransformInputKernel);
+    /** Initialise the kernel's input and output
+     *
+     * @param[in]  src    Source tensor info of shape [IFM, W, H, N]. Data layout supported: NHWC.
+     *                    Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[out] dst    Destination tensor info of shape [IFM, N * num_tiles_y * num_tiles_x, 16]. Data type
+     *                    supported: S16.
+     * @param[in]  tiling Output tiling and paddings of the convolution.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const WinogradF2x2Tiling &tiling);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWinogradConv2dQuantizedTransformInputKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const WinogradF2x2Tiling &tiling);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<InputTransformKernel> &get_available_kernels();
+
+private:
+    InputTransformKernelPtr _run_method{nullptr};
+    WinogradF2x2Tiling      _tiling{};
+    int32_t                 _src_offset{0};
+    std::string             _name{};
+};
+
+/** Kernel to transform quantized 3x3 weights into the int16 Winograd F(2x2, 3x3) domain */
+class CpuWinogradConv2dQuantizedTransformWeightsKernel
+    : public ICpuKernel<CpuWinogradConv2dQuantizedTransformWeightsKernel>
+{
+private:
+    using WeightTransformKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, int32_t, const Window &)>::type;
+
+public:
+    CpuWinogradConv2dQuantizedTransformWeightsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWinogradConv2dQuantizedTransformWeightsKernel);
+    /** Initialise the kernel's input and output
+     *
+     * @param[in]  weights Weights tensor info of shape [IFM, 3, 3, OFM]. Data layout supported: NHWC.
+     *                     Data types supported: QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
+     * @param[out] dst     Destination tensor info of shape [OFM, IFM, 16]. Data type supported: S16.
+     */
+    void configure(const ITensorInfo *weights, ITensorInfo *dst);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWinogradConv2dQuantizedTransformWeightsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *weights, const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    WeightTransformKernelPtr _run_method{nullptr};
+    int32_t                  _weights_offset{0};
+};
+
+/** Kernel to multiply the 16 Winograd domain matrices of the input with those of the weights
+ *
+ * Each product [M, K] x [K, N] is computed in int16 x int16 -> int32 arithmetic.
+ */
+class CpuWinogradConv2dQuantizedGemmKernel : public ICpuKernel<CpuWinogradConv2dQuantizedGemmKernel>
+{
+private:
+    using GemmKernelPtr = std::add_pointer<void(const ITensor *, const ITensor *, ITensor *, const Window &)>::type;
+
+public:
+    CpuWinogradConv2dQuantizedGemmKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWinogradConv2dQuantizedGemmKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  lhs Transformed input tensor info of shape [K, M, 16]. Data type supported: S16.
+     * @param[in]  rhs Transformed weights tensor info of shape [N, K, 16]. Data type supported: S16.
+     * @param[out] dst Destination tensor info of shape [N, M, 16]. Data type supported: S32.
+     */
+    void configure(const ITensorInfo *lhs, const ITensorInfo *rhs, ITensorInfo *dst);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWinogradConv2dQuantizedGemmKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    GemmKernelPtr _run_method{nullptr};
+};
+
+/** Kernel to transform the Winograd F(2x2, 3x3) domain products back to 2x2 output tiles and requantize them */
+class CpuWinogradConv2dQuantizedTransformOutputKernel
+    : public ICpuKernel<CpuWinogradConv2dQuantizedTransformOutputKernel>
+{
+private:
+    using OutputTransformKernelPtr = std::add_pointer<void(const ITensor *,
+                                                           const ITensor *,
+                                                           ITensor *,
+                                                           const WinogradF2x2Tiling &,
+                                                           const GEMMLowpOutputStageInfo &,
+                                                           const Window &)>::type;
+
+public:
+    struct OutputTransformKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        OutputTransformKernelPtr     ukernel;
+    };
+
+    CpuWinogradConv2dQuantizedTransformOutputKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWinogradConv2dQuantizedTransformOutputKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src          Winograd domain products of shape [OFM, N * num_tiles_y * num_tiles_x, 16]. Data type
+     *                          supported: S32.
+     * @param[in]  bias         (Optional) Bias tensor info of shape [OFM]. Can be nullptr. Data type supported: S32.
+     * @param[out] dst          Destination tensor info of shape [OFM, out_w, out_h, N]. Data layout supported: NHWC.
+     *                          Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  tiling       Output tiling and paddings of the convolution.
+     * @param[in]  output_stage Requantization parameters. Per-channel multipliers and shifts are read when
+     *                          is_quantized_per_channel is set.
+     */
+    void configure(const ITensorInfo             *src,
+                   const ITensorInfo             *bias,
+                   ITensorInfo                   *dst,
+                   const WinogradF2x2Tiling      &tiling,
+                   const GEMMLowpOutputStageInfo &output_stage);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWinogradConv2dQuantizedTransformOutputKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *src,
+                           const ITensorInfo             *bias,
+                           const ITensorInfo             *dst,
+                           const WinogradF2x2Tiling      &tiling,
+                           const GEMMLowpOutputStageInfo &output_stage);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<OutputTransformKernel> &get_available_kernels();
+
+private:
+    OutputTransformKernelPtr _run_method{nullptr};
+    WinogradF2x2Tiling       _tiling{};
+    GEMMLowpOutputStageInfo  _output_stage{};
+    std::string              _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUWINOGRADCONV2DQUANTIZEDKERNEL_H
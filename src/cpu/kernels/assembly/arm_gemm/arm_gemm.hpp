@@ -36,6 +36,7 @@ enum class WeightFormat
 {
     UNSPECIFIED    = 0x1,
     ANY            = 0x2,
+    SPARSE_2_4     = 0x4,
     OHWI           = 0x100100,
     OHWIo2         = 0x100200,
     OHWIo4         = 0x100400,
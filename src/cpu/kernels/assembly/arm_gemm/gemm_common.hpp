@@ -35,6 +35,28 @@ namespace arm_gemm
 struct GemmConfig;
 struct Requantize32;
 
+/* Operations applied to a block of the output once it holds final values.
+ *
+ * Implementations which support an epilogue call apply() exactly once for
+ * every output element, after bias and activation, with 'C' pointing at
+ * element (m0, n0) of the given batch and multi.  Calls for disjoint blocks
+ * may come concurrently from different threads.
+ */
+class IGemmEpilogue
+{
+public:
+    virtual void apply(void        *C,
+                       size_t       ldc,
+                       unsigned int m0,
+                       unsigned int rows,
+                       unsigned int n0,
+                       unsigned int cols,
+                       unsigned int batch,
+                       unsigned int multi) const = 0;
+
+    virtual ~IGemmEpilogue() = default;
+};
+
 // Abstract class for the GEMM/GEMV functions.
 //
 // GEMM implementations may be "native" (never require any input
@@ -177,6 +199,16 @@ public:
     {
     }
 
+    /*** Epilogue interface (optional) ***/
+    /* Set the epilogue run on each block of final output.  The object must
+     * remain valid for the duration of any execute calls.  Epilogues work
+     * on float output, so returns false if the implementation produces
+     * another type, requantizes its output or cannot run an epilogue. */
+    virtual bool set_epilogue(const IGemmEpilogue *)
+    {
+        return false;
+    }
+
     /*** Introspection interface ***/
     /* Get the configuration of this GEMM */
     virtual GemmConfig get_config() = 0;
@@ -199,6 +231,24 @@ class GemmCommon : public IGemmCommon
 {
 protected:
     GemmArrays<To, Tw, Tr> _gemm_arrays{};
+    const IGemmEpilogue   *_epilogue = nullptr;
+
+    /* Run the epilogue, if any, on rows [m0, m_max) and columns [n0, n_max) of the output. */
+    void apply_epilogue(const GemmArrays<To, Tw, Tr> &g_arrays,
+                        unsigned int                  m0,
+                        unsigned int                  m_max,
+                        unsigned int                  n0,
+                        unsigned int                  n_max,
+                        unsigned int                  batch,
+                        unsigned int                  multi) const
+    {
+        if (_epilogue != nullptr && m_max > m0 && n_max > n0)
+        {
+            Tr *C = g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (batch * g_arrays._C_batch_stride) +
+                    (m0 * g_arrays._ldc) + n0;
+            _epilogue->apply(C, g_arrays._ldc, m0, m_max - m0, n0, n_max - n0, batch, multi);
+        }
+    }
 
 public:
     void set_gemm_arrays(GemmArrays<To, Tw, Tr> &ga)
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_COMMON_NEON_FP32_IO_H
+#define ACL_SRC_CPU_KERNELS_COMMON_NEON_FP32_IO_H
+
+#include "arm_compute/core/QuantizationInfo.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Load and store helpers converting a storage type to and from blocks of 16 FP32 values
+ *
+ * For kernels that run all their arithmetic in FP32 whatever the storage type. Integer types are loaded as their raw
+ * values, leaving the scaling to the caller, and quantized with the given quantization info when stored.
+ */
+template <typename T>
+struct Fp32Io;
+
+template <>
+struct Fp32Io<float>
+{
+    static float32x4x4_t load(const float *ptr)
+    {
+        return {{vld1q_f32(ptr), vld1q_f32(ptr + 4), vld1q_f32(ptr + 8), vld1q_f32(ptr + 12)}};
+    }
+    static void store(float *ptr, const float32x4x4_t &v, const UniformQuantizationInfo & = UniformQuantizationInfo())
+    {
+        vst1q_f32(ptr, v.val[0]);
+        vst1q_f32(ptr + 4, v.val[1]);
+        vst1q_f32(ptr + 8, v.val[2]);
+        vst1q_f32(ptr + 12, v.val[3]);
+    }
+    static float to_float(float v)
+    {
+        return v;
+    }
+    static float from_float(float v, const UniformQuantizationInfo & = UniformQuantizationInfo())
+    {
+        return v;
+    }
+};
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template <>
+struct Fp32Io<float16_t>
+{
+    static float32x4x4_t load(const float16_t *ptr)
+    {
+        const float16x8_t lo = vld1q_f16(ptr);
+        const float16x8_t hi = vld1q_f16(ptr + 8);
+        return {{vcvt_f32_f16(vget_low_f16(lo)), vcvt_f32_f16(vget_high_f16(lo)), vcvt_f32_f16(vget_low_f16(hi)),
+                 vcvt_f32_f16(vget_high_f16(hi))}};
+    }
+    static void
+    store(float16_t *ptr, const float32x4x4_t &v, const UniformQuantizationInfo & = UniformQuantizationInfo())
+    {
+        vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])));
+        vst1q_f16(ptr + 8, vcombine_f16(vcvt_f16_f32(v.val[2]), vcvt_f16_f32(v.val[3])));
+    }
+    static float to_float(float16_t v)
+    {
+        return static_cast<float>(v);
+    }
+    static float16_t from_float(float v, const UniformQuantizationInfo & = UniformQuantizationInfo())
+    {
+        return static_cast<float16_t>(v);
+    }
+};
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+/** BF16 is the upper half of a FP32 value: the conversions only need integer shifts and do not depend on FEAT_BF16 */
+template <>
+struct Fp32Io<bfloat16>
+{
+    static float32x4_t widen(uint16x4_t v)
+    {
+        return vreinterpretq_f32_u32(vshll_n_u16(v, 16));
+    }
+    /** Round to nearest, ties to even, like the scalar conversion of @ref bfloat16
+     *
+     * NaNs are quieted instead of rounded, as BFCVT does: rounding could carry into the exponent and truncating could
+     * drop every set bit of the mantissa, both turning them into infinities.
+     */
+    static uint16x4_t narrow(float32x4_t v)
+    {
+        const uint32x4_t bits    = vreinterpretq_u32_f32(v);
+        const uint32x4_t odd     = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        const uint32x4_t bias    = vaddq_u32(vdupq_n_u32(0x7fff), odd);
+        const uint32x4_t is_nan  = vmvnq_u32(vceqq_f32(v, v));
+        const uint32x4_t quieted = vorrq_u32(bits, vdupq_n_u32(0x00400000));
+        return vshrn_n_u32(vbslq_u32(is_nan, quieted, vaddq_u32(bits, bias)), 16);
+    }
+    static float32x4x4_t load(const bfloat16 *ptr)
+    {
+        const uint16x8_t lo = vld1q_u16(reinterpret_cast<const uint16_t *>(ptr));
+        const uint16x8_t hi = vld1q_u16(reinterpret_cast<const uint16_t *>(ptr) + 8);
+        return {{widen(vget_low_u16(lo)), widen(vget_high_u16(lo)), widen(vget_low_u16(hi)), widen(vget_high_u16(hi))}};
+    }
+    static void
+    store(bfloat16 *ptr, const float32x4x4_t &v, const UniformQuantizationInfo & = UniformQuantizationInfo())
+    {
+        vst1q_u16(reinterpret_cast<uint16_t *>(ptr), vcombine_u16(narrow(v.val[0]), narrow(v.val[1])));
+        vst1q_u16(reinterpret_cast<uint16_t *>(ptr) + 8, vcombine_u16(narrow(v.val[2]), narrow(v.val[3])));
+    }
+    static float to_float(bfloat16 v)
+    {
+        return static_cast<float>(v);
+    }
+    static bfloat16 from_float(float v, const UniformQuantizationInfo & = UniformQuantizationInfo())
+    {
+        return bfloat16(v, true);
+    }
+};
+
+template <>
+struct Fp32Io<uint8_t>
+{
+    static void store(uint8_t *ptr, const float32x4x4_t &v, const UniformQuantizationInfo &qi)
+    {
+        vst1q_u8(ptr, vquantize(v, qi));
+    }
+    static uint8_t from_float(float v, const UniformQuantizationInfo &qi)
+    {
+        return quantize_qasymm8(v, qi);
+    }
+};
+
+template <>
+struct Fp32Io<int8_t>
+{
+    static float32x4x4_t load(const int8_t *ptr)
+    {
+        const int8x16_t v  = vld1q_s8(ptr);
+        const int16x8_t lo = vmovl_s8(vget_low_s8(v));
+        const int16x8_t hi = vmovl_s8(vget_high_s8(v));
+        return {{vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo))),
+                 vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi)))}};
+    }
+    static void store(int8_t *ptr, const float32x4x4_t &v, const UniformQuantizationInfo &qi)
+    {
+        vst1q_s8(ptr, vquantize_signed(v, qi));
+    }
+    static float to_float(int8_t v)
+    {
+        return static_cast<float>(v);
+    }
+    static int8_t from_float(float v, const UniformQuantizationInfo &qi)
+    {
+        return quantize_qasymm8_signed(v, qi);
+    }
+};
+} // namespace detail
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_COMMON_NEON_FP32_IO_H
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_DECONV_COL2IM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_DECONV_COL2IM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/deconv_col2im/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Gather the GEMM output of a transposed convolution into an NHWC tensor
+ *
+ * Row m of @p src holds, for input pixel m, the contribution of every kernel tap laid out as [kh][kw][channels].
+ * Input pixel (ix, iy) lands on output pixel (ix * stride_x + kx - pad_left, iy * stride_y + ky - pad_top), so an
+ * output pixel only visits the taps congruent to its position modulo the stride: about (kw / stride_x) * (kh /
+ * stride_y) of them, none of which would have multiplied an inserted zero.
+ */
+template <typename T>
+void deconv_col2im(const ITensor       *src,
+                   const ITensor       *bias,
+                   ITensor             *dst,
+                   const Size2D        &input_dims,
+                   const Size2D        &kernel_dims,
+                   const PadStrideInfo &info,
+                   const Window        &window)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    const int window_step_x = 16 / sizeof(T);
+    const int num_channels  = static_cast<int>(dst->info()->dimension(0));
+    const int in_w          = static_cast<int>(input_dims.width);
+    const int in_h          = static_cast<int>(input_dims.height);
+    const int kernel_w      = static_cast<int>(kernel_dims.width);
+    const int kernel_h      = static_cast<int>(kernel_dims.height);
+    const int stride_x      = static_cast<int>(info.stride().first);
+    const int stride_y      = static_cast<int>(info.stride().second);
+    const int pad_left      = static_cast<int>(info.pad_left());
+    const int pad_top       = static_cast<int>(info.pad_top());
+
+    const uint8_t *src_ptr    = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const size_t   src_stride = src->info()->strides_in_bytes()[1];
+    const T       *bias_ptr =
+        (bias != nullptr) ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                          : nullptr;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            T *out_ptr = reinterpret_cast<T *>(out.ptr());
+
+            int x = 0;
+            for (; x <= num_channels - window_step_x; x += window_step_x)
+            {
+                const auto init = (bias_ptr != nullptr) ? wrapper::vloadq(bias_ptr + x)
+                                                        : wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+                wrapper::vstore(out_ptr + x, init);
+            }
+            for (; x < num_channels; ++x)
+            {
+                out_ptr[x] = (bias_ptr != nullptr) ? bias_ptr[x] : static_cast<T>(0);
+            }
+
+            const int oy = id.z() + pad_top;
+            const int ox = id.y() + pad_left;
+            for (int ky = oy % stride_y; ky < kernel_h && ky <= oy; ky += stride_y)
+            {
+                const int iy = (oy - ky) / stride_y;
+                if (iy >= in_h)
+                {
+                    continue;
+                }
+                for (int kx = ox % stride_x; kx < kernel_w && kx <= ox; kx += stride_x)
+                {
+                    const int ix = (ox - kx) / stride_x;
+                    if (ix >= in_w)
+                    {
+                        continue;
+                    }
+
+                    const size_t row = static_cast<size_t>(ix) + in_w * (iy + static_cast<size_t>(in_h) * id[3]);
+                    const T     *col = reinterpret_cast<const T *>(src_ptr + row * src_stride) +
+                                   static_cast<size_t>(kx + kernel_w * ky) * num_channels;
+
+                    x = 0;
+                    for (; x <= num_channels - window_step_x; x += window_step_x)
+                    {
+                        const auto acc = wrapper::vadd(wrapper::vloadq(out_ptr + x), wrapper::vloadq(col + x));
+                        wrapper::vstore(out_ptr + x, acc);
+                    }
+                    for (; x < num_channels; ++x)
+                    {
+                        out_ptr[x] += col[x];
+                    }
+                }
+            }
+        },
+        out);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_DECONV_COL2IM_GENERIC_NEON_IMPL_H
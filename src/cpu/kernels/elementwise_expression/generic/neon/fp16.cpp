@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/elementwise_expression/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+// The expression is evaluated in FP32: chained FP16 operations would otherwise round after every node.
+template <>
+void load_tile<float16_t>(const float16_t *ptr, float *tile, int len)
+{
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const float16x8_t v = vld1q_f16(ptr + x);
+        vst1q_f32(tile + x, vcvt_f32_f16(vget_low_f16(v)));
+        vst1q_f32(tile + x + 4, vcvt_f32_f16(vget_high_f16(v)));
+    }
+    for (; x < len; ++x)
+    {
+        tile[x] = static_cast<float>(ptr[x]);
+    }
+    for (; (x & 3) != 0; ++x)
+    {
+        tile[x] = 0.f;
+    }
+}
+
+template <>
+void store_tile<float16_t>(const float *tile, float16_t *ptr, int len)
+{
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const float16x4_t lo = vcvt_f16_f32(vld1q_f32(tile + x));
+        const float16x4_t hi = vcvt_f16_f32(vld1q_f32(tile + x + 4));
+        vst1q_f16(ptr + x, vcombine_f16(lo, hi));
+    }
+    for (; x < len; ++x)
+    {
+        ptr[x] = static_cast<float16_t>(tile[x]);
+    }
+}
+} // namespace detail
+
+void neon_fp16_elementwise_expression(const ITensor *const           *srcs,
+                                      ITensor                         *dst,
+                                      const ElementwiseExpressionInfo &info,
+                                      const Window                    &window)
+{
+    detail::elementwise_expression<float16_t>(srcs, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
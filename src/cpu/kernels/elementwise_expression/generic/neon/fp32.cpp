@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/elementwise_expression/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+template <>
+void load_tile<float>(const float *ptr, float *tile, int len)
+{
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1q_f32(tile + x, vld1q_f32(ptr + x));
+    }
+    for (; x < len; ++x)
+    {
+        tile[x] = ptr[x];
+    }
+    for (; (x & 3) != 0; ++x)
+    {
+        tile[x] = 0.f;
+    }
+}
+
+template <>
+void store_tile<float>(const float *tile, float *ptr, int len)
+{
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1q_f32(ptr + x, vld1q_f32(tile + x));
+    }
+    for (; x < len; ++x)
+    {
+        ptr[x] = tile[x];
+    }
+}
+} // namespace detail
+
+void neon_fp32_elementwise_expression(const ITensor *const           *srcs,
+                                      ITensor                         *dst,
+                                      const ElementwiseExpressionInfo &info,
+                                      const Window                    &window)
+{
+    detail::elementwise_expression<float>(srcs, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
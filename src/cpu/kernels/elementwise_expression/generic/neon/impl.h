@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ELEMENTWISE_EXPRESSION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ELEMENTWISE_EXPRESSION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/activation/generic/neon/fp_impl.h"
+#include "src/cpu/kernels/elementwise_binary/generic/neon/impl.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Number of elements every node of the expression evaluates before moving on to the next node
+ *
+ * The intermediate results of the whole expression for one tile stay in the L1 cache, so each tensor element is read
+ * and written exactly once while each node still runs a tight vector loop without per element dispatch.
+ */
+constexpr int expression_tile = 64;
+
+constexpr ActFpImplParams ExpressionFp32Params = {static_cast<float>(1e-24), 4};
+
+using ExpressionVector = wrapper::traits::neon_vector<float, 4>;
+
+/** Load @p len elements of type T widened to FP32
+ *
+ * The tile is zero padded up to a multiple of 4 elements so the nodes never need a scalar tail.
+ */
+template <typename T>
+void load_tile(const T *ptr, float *tile, int len);
+
+/** Store the first @p len elements of a FP32 tile narrowed to type T */
+template <typename T>
+void store_tile(const float *tile, T *ptr, int len);
+
+inline void binary_tile(ElementwiseExpressionOp op, const float *a, const float *b, float *dst, int len)
+{
+    auto run = [&](auto &&fn)
+    {
+        for (int x = 0; x < len; x += 4)
+        {
+            vst1q_f32(dst + x, fn(vld1q_f32(a + x), vld1q_f32(b + x)));
+        }
+    };
+
+    switch (op)
+    {
+        case ElementwiseExpressionOp::Add:
+            run([](const float32x4_t &va, const float32x4_t &vb) { return wrapper::vadd(va, vb); });
+            break;
+        case ElementwiseExpressionOp::Sub:
+            run([](const float32x4_t &va, const float32x4_t &vb) { return wrapper::vsub(va, vb); });
+            break;
+        case ElementwiseExpressionOp::Mul:
+            run([](const float32x4_t &va, const float32x4_t &vb) { return wrapper::vmul(va, vb); });
+            break;
+        case ElementwiseExpressionOp::Div:
+            run([](const float32x4_t &va, const float32x4_t &vb)
+                { return elementwise_arithm_op<ArithmeticOperation::DIV, ExpressionVector>(va, vb); });
+            break;
+        case ElementwiseExpressionOp::Min:
+            run([](const float32x4_t &va, const float32x4_t &vb)
+                { return elementwise_arithm_op<ArithmeticOperation::MIN, ExpressionVector>(va, vb); });
+            break;
+        case ElementwiseExpressionOp::Max:
+            run([](const float32x4_t &va, const float32x4_t &vb)
+                { return elementwise_arithm_op<ArithmeticOperation::MAX, ExpressionVector>(va, vb); });
+            break;
+        case ElementwiseExpressionOp::SquaredDiff:
+            run([](const float32x4_t &va, const float32x4_t &vb)
+                { return elementwise_arithm_op<ArithmeticOperation::SQUARED_DIFF, ExpressionVector>(va, vb); });
+            break;
+        case ElementwiseExpressionOp::Prelu:
+            run([](const float32x4_t &va, const float32x4_t &vb)
+                { return elementwise_arithm_op<ArithmeticOperation::PRELU, ExpressionVector>(va, vb); });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported binary operation");
+    }
+}
+
+inline void unary_tile(ElementWiseUnary op, const float *src, float *dst, int len)
+{
+    auto run = [&](auto &&fn)
+    {
+        for (int x = 0; x < len; x += 4)
+        {
+            vst1q_f32(dst + x, fn(vld1q_f32(src + x)));
+        }
+    };
+
+    switch (op)
+    {
+        case ElementWiseUnary::RSQRT:
+            run([](const float32x4_t &v) { return wrapper::vinvsqrt(v); });
+            break;
+        case ElementWiseUnary::EXP:
+            run([](const float32x4_t &v) { return wrapper::vexpq(v); });
+            break;
+        case ElementWiseUnary::NEG:
+            run([](const float32x4_t &v) { return wrapper::vneg(v); });
+            break;
+        case ElementWiseUnary::LOG:
+            run([](const float32x4_t &v) { return wrapper::vlog(v); });
+            break;
+        case ElementWiseUnary::ABS:
+            run([](const float32x4_t &v) { return wrapper::vabs(v); });
+            break;
+        case ElementWiseUnary::SIN:
+            run([](const float32x4_t &v) { return wrapper::vsin(v); });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported unary operation");
+    }
+}
+
+inline void activation_tile(const ActivationLayerInfo &act_info, const float *src, float *dst, int len)
+{
+    dispatch_fp_neon_activation_function<float, ExpressionFp32Params>(
+        act_info.activation(), act_info,
+        [&](auto activation_op_vec, auto)
+        {
+            for (int x = 0; x < len; x += 4)
+            {
+                vst1q_f32(dst + x, activation_op_vec(vld1q_f32(src + x)));
+            }
+        });
+}
+
+/** Evaluate an elementwise expression over a window of the destination
+ *
+ * Inputs are broadcast against the destination: any input dimension of size 1 is read at coordinate 0.
+ */
+template <typename T>
+void elementwise_expression(const ITensor *const           *srcs,
+                            ITensor                         *dst,
+                            const ElementwiseExpressionInfo &info,
+                            const Window                    &window)
+{
+    const std::vector<ElementwiseExpressionNode> &nodes      = info.nodes();
+    const unsigned int                            num_inputs = info.num_inputs();
+
+    const int window_start_x = static_cast<int>(window.x().start());
+    const int window_end_x   = static_cast<int>(window.x().end());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator output(dst, win);
+
+    alignas(16) float tiles[ElementwiseExpressionInfo::max_num_nodes][expression_tile];
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            std::array<const T *, ElementwiseExpressionInfo::max_num_inputs> in_ptrs{};
+            std::array<bool, ElementwiseExpressionInfo::max_num_inputs>      in_broadcast_x{};
+            for (unsigned int i = 0; i < num_inputs; ++i)
+            {
+                const ITensorInfo *src_info = srcs[i]->info();
+
+                size_t offset = src_info->offset_first_element_in_bytes();
+                for (size_t d = 1; d < src_info->num_dimensions(); ++d)
+                {
+                    if (src_info->dimension(d) != 1)
+                    {
+                        offset += id[d] * src_info->strides_in_bytes()[d];
+                    }
+                }
+                in_ptrs[i]        = reinterpret_cast<const T *>(srcs[i]->buffer() + offset);
+                in_broadcast_x[i] = src_info->dimension(0) == 1;
+            }
+            auto *output_ptr = reinterpret_cast<T *>(output.ptr());
+
+            for (int x = window_start_x; x < window_end_x; x += expression_tile)
+            {
+                const int len        = std::min(expression_tile, window_end_x - x);
+                const int padded_len = (len + 3) & ~3;
+
+                for (size_t n = 0; n < nodes.size(); ++n)
+                {
+                    const ElementwiseExpressionNode &node = nodes[n];
+                    float                           *tile = tiles[n];
+                    switch (node.op)
+                    {
+                        case ElementwiseExpressionOp::Input:
+                            if (in_broadcast_x[node.lhs])
+                            {
+                                std::fill_n(tile, padded_len, static_cast<float>(*in_ptrs[node.lhs]));
+                            }
+                            else
+                            {
+                                load_tile<T>(in_ptrs[node.lhs] + x, tile, len);
+                            }
+                            break;
+                        case ElementwiseExpressionOp::Unary:
+                            unary_tile(node.unary_op, tiles[node.lhs], tile, padded_len);
+                            break;
+                        case ElementwiseExpressionOp::Activation:
+                            activation_tile(node.act_info, tiles[node.lhs], tile, padded_len);
+                            break;
+                        default:
+                            binary_tile(node.op, tiles[node.lhs], tiles[node.rhs], tile, padded_len);
+                            break;
+                    }
+                }
+
+                store_tile<T>(tiles[nodes.size() - 1], output_ptr + x, len);
+            }
+        },
+        output);
+}
+} // namespace detail
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ELEMENTWISE_EXPRESSION_GENERIC_NEON_IMPL_H
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "src/cpu/kernels/common/neon/fp32_io.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Number of elements of a row loaded by every step of the vector loops */
+constexpr int embedding_bag_step = 16;
+/** Number of FP32 accumulators kept on the stack: longer rows are pooled in blocks of this many elements */
+constexpr int embedding_bag_block = 512;
+/** Number of indices between the prefetch of a row and its accumulation */
+constexpr int embedding_bag_prefetch_distance = 8;
+/** Size in bytes of the cache lines requested by the software prefetches */
+constexpr int embedding_bag_cache_line = 64;
+
+/** Request the cache lines covering @p num_bytes bytes from @p ptr */
+inline void prefetch_bytes(const uint8_t *ptr, size_t num_bytes)
+{
+    for (size_t offset = 0; offset < num_bytes; offset += embedding_bag_cache_line)
+    {
+        __builtin_prefetch(ptr + offset);
+    }
+}
+
+/** Add @p len elements of @p row, multiplied by @p scale, to the accumulators @p acc */
+template <typename T>
+inline void accumulate_row(float *acc, const T *row, int len, float scale)
+{
+    int x = 0;
+    for (; x <= len - embedding_bag_step; x += embedding_bag_step)
+    {
+        const float32x4x4_t v = Fp32Io<T>::load(row + x);
+        for (int i = 0; i < 4; ++i)
+        {
+            vst1q_f32(acc + x + 4 * i, vmlaq_n_f32(vld1q_f32(acc + x + 4 * i), v.val[i], scale));
+        }
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += scale * Fp32Io<T>::to_float(row[x]);
+    }
+}
+
+/** Write @p len accumulators, multiplied by @p norm, to @p dst */
+template <typename TOut>
+inline void store_row(TOut *dst, const float *acc, int len, float norm)
+{
+    int x = 0;
+    for (; x <= len - embedding_bag_step; x += embedding_bag_step)
+    {
+        const float32x4x4_t v = {{vmulq_n_f32(vld1q_f32(acc + x), norm), vmulq_n_f32(vld1q_f32(acc + x + 4), norm),
+                                  vmulq_n_f32(vld1q_f32(acc + x + 8), norm),
+                                  vmulq_n_f32(vld1q_f32(acc + x + 12), norm)}};
+        Fp32Io<TOut>::store(dst + x, v);
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = Fp32Io<TOut>::from_float(acc[x] * norm);
+    }
+}
+} // namespace detail
+
+/** Pool the rows of @p table selected by every bag of the window
+ *
+ * The window walks the bags along Y. Bag b pools the rows indices[offsets[b]] to indices[offsets[b + 1] - 1], the last
+ * bag ending with the last index. Indices outside the table contribute zeros, like in NEGather.
+ *
+ * The rows of consecutive bags are usually far apart in a large table, so they are prefetched a fixed number of indices
+ * ahead of their accumulation. The prefetch stream continues across the bags of the window instead of restarting with
+ * every bag, which matters for the short bags of recommender models.
+ */
+template <typename T, typename TOut>
+void embedding_bag(const ITensor          *table,
+                   const ITensor          *indices,
+                   const ITensor          *offsets,
+                   const ITensor          *scales,
+                   ITensor                *dst,
+                   const EmbeddingBagInfo &info,
+                   const Window           &window)
+{
+    using namespace detail;
+
+    const ITensorInfo *table_info   = table->info();
+    const int          dim          = static_cast<int>(table_info->dimension(0));
+    const int32_t      num_rows     = static_cast<int32_t>(table_info->dimension(1));
+    const size_t       table_stride = table_info->strides_in_bytes()[1];
+    const uint8_t     *table_ptr    = table->buffer() + table_info->offset_first_element_in_bytes();
+
+    const auto *idx_ptr =
+        reinterpret_cast<const int32_t *>(indices->buffer() + indices->info()->offset_first_element_in_bytes());
+    const auto *off_ptr =
+        reinterpret_cast<const int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
+    const float *scale_ptr = nullptr;
+    if (scales != nullptr)
+    {
+        scale_ptr = reinterpret_cast<const float *>(scales->buffer() + scales->info()->offset_first_element_in_bytes());
+    }
+    const int32_t num_indices = static_cast<int32_t>(indices->info()->dimension(0));
+    const int32_t num_bags    = static_cast<int32_t>(offsets->info()->dimension(0));
+
+    const size_t dst_stride = dst->info()->strides_in_bytes()[1];
+    uint8_t     *dst_ptr    = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    // Offsets are clamped to the indices: a decreasing offset gives an empty bag
+    auto bag_begin = [&](int32_t bag) { return utility::clamp<int32_t>(off_ptr[bag], 0, num_indices); };
+    auto bag_end   = [&](int32_t bag)
+    {
+        return bag + 1 < num_bags ? utility::clamp<int32_t>(off_ptr[bag + 1], bag_begin(bag), num_indices)
+                                  : num_indices;
+    };
+    auto row_ptr = [&](int32_t pos) -> const uint8_t *
+    {
+        const int32_t idx = idx_ptr[pos];
+        return (idx >= 0 && idx < num_rows) ? table_ptr + static_cast<size_t>(idx) * table_stride : nullptr;
+    };
+
+    const int32_t first_bag    = window.y().start();
+    const int32_t last_bag     = window.y().end();
+    const bool    single_block = dim <= embedding_bag_block;
+    const int32_t window_end   = bag_end(last_bag - 1);
+    int32_t       prefetch_pos = bag_begin(first_bag);
+
+    float acc[embedding_bag_block];
+    for (int32_t bag = first_bag; bag < last_bag; ++bag)
+    {
+        const int32_t begin = bag_begin(bag);
+        const int32_t end   = bag_end(bag);
+        const float   norm  = (info.mode == EmbeddingBagMode::Mean && end > begin) ? 1.f / (end - begin) : 1.f;
+        auto         *out   = reinterpret_cast<TOut *>(dst_ptr + bag * dst_stride);
+
+        for (int x0 = 0; x0 < dim; x0 += embedding_bag_block)
+        {
+            const int    len         = std::min(embedding_bag_block, dim - x0);
+            const size_t block_bytes = len * sizeof(T);
+            const size_t block_start = x0 * sizeof(T);
+
+            // Rows wider than a block restart the prefetches for every block of the bag
+            const int32_t prefetch_end = single_block ? window_end : end;
+            prefetch_pos               = single_block ? std::max(prefetch_pos, begin) : begin;
+
+            std::fill_n(acc, len, 0.f);
+            for (int32_t pos = begin; pos < end; ++pos)
+            {
+                for (const int32_t ahead = std::min(pos + embedding_bag_prefetch_distance, prefetch_end);
+                     prefetch_pos < ahead; ++prefetch_pos)
+                {
+                    const uint8_t *ahead_row = row_ptr(prefetch_pos);
+                    if (ahead_row != nullptr)
+                    {
+                        prefetch_bytes(ahead_row + block_start, block_bytes);
+                    }
+                }
+
+                const uint8_t *row = row_ptr(pos);
+                if (row != nullptr)
+                {
+                    const float scale = scale_ptr != nullptr ? scale_ptr[idx_ptr[pos]] : 1.f;
+                    accumulate_row(acc, reinterpret_cast<const T *>(row + block_start), len, scale);
+                }
+            }
+            store_row(out + x0, acc, len, norm);
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -220,7 +220,10 @@ void CpuDepthwiseConv2dAssemblyWrapperKernel::configure(const ITensorInfo *src,
     // Destination initialization if not yet initialized
     const TensorShape dst_shape = compute_depthwise_convolution_shape(*src, *weights, info);
     auto_init_if_empty(*dst, src->clone()->set_tensor_shape(dst_shape));
-    _name = "CpuDepthwiseConv2dAssemblyWrapperKernel";
+    _name            = "CpuDepthwiseConv2dAssemblyWrapperKernel";
+    _pad_stride_info = info.pad_stride_info;
+    _kernel_rows     = weights->dimension(idx_height);
+    _is_dilated      = info.dilation != Size2D(1U, 1U);
     std::string asm_kernel_name("");
 #if defined(__aarch64__)
     switch (src->data_type())
@@ -342,7 +345,6 @@ void CpuDepthwiseConv2dAssemblyWrapperKernel::run_op(ITensorPack &tensors, const
                             "CpuDepthwiseConv2dAssemblyWrapperKernel::run_op");
     ARM_COMPUTE_ERROR_ON_NULLPTR(_kernel_asm.get());
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_UNUSED(window);
     ARM_COMPUTE_UNUSED(info);
 
     ARM_COMPUTE_ERROR_ON(tensors.empty());
@@ -369,6 +371,36 @@ void CpuDepthwiseConv2dAssemblyWrapperKernel::run_op(ITensorPack &tensors, const
     const size_t ld_dst_row   = ld_dst_col * (dst_shape[1] + dst_padding.top + dst_padding.bottom);
     const size_t ld_dst_batch = ld_dst_row * dst_shape[2];
 
+    // A destination smaller than the configured one only holds a band of output rows
+    const Window &max_window = ICpuKernel::window();
+    if (dst_shape[2] != static_cast<size_t>(max_window.z().end()) ||
+        dst_shape[3] != static_cast<size_t>(max_window[Window::DimW].end()))
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_is_dilated, "Bands are not supported with dilation");
+        ARM_COMPUTE_ERROR_ON(window.z().end() - window.z().start() != static_cast<int>(dst_shape[2]));
+
+        // Only read the input rows the band depends on; rows of the band falling outside the input become padding
+        const int stride_rows = static_cast<int>(_pad_stride_info.stride().second);
+        const int src_rows    = static_cast<int>(src_shape[2]);
+        const int pad_top     = static_cast<int>(_pad_stride_info.pad_top());
+        const int band_batch  = window[Window::DimW].start();
+        const int band_rows   = static_cast<int>(dst_shape[2]);
+        const int row_start   = window.z().start() * stride_rows - pad_top;
+        const int row_end     = row_start + (band_rows - 1) * stride_rows + static_cast<int>(_kernel_rows);
+        const int first_row   = std::max(row_start, 0);
+        const int last_row    = std::min(row_end, src_rows);
+
+        arm_conv::PaddingValues padding = assembly_utils::map_to_arm_conv_padding(_pad_stride_info);
+        padding.top                     = first_row - row_start;
+        padding.bottom                  = std::max(row_end - src_rows, 0);
+
+        const size_t src_offset = (band_batch * ld_src_batch + first_row * ld_src_row) * src->info()->element_size();
+        _kernel_asm->execute(1, last_row - first_row, src_shape[1], src_shape[0], padding, src_ptr + src_offset,
+                             ld_src_col, ld_src_row, ld_src_batch, parameters_ptr, band_rows, dst_shape[1], dst_ptr,
+                             ld_dst_col, ld_dst_row, ld_dst_batch, working_space, info.thread_id, info.num_threads);
+        return;
+    }
+
     _kernel_asm->execute(src_ptr, ld_src_col, ld_src_row, ld_src_batch, parameters_ptr, dst_ptr, ld_dst_col, ld_dst_row,
                          ld_dst_batch, working_space, info.thread_id, info.num_threads);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,7 +47,12 @@ namespace cpu
 {
 namespace kernels
 {
-/** This class is a wrapper for the depthwise convolution assembly kernels.  */
+/** This class is a wrapper for the depthwise convolution assembly kernels.
+ *
+ * The kernel can also be run on a band of output rows of a single batch: the destination tensor of the pack then only
+ * holds the band, and the window gives the batch along W and the rows of the band along Z. Dilation is not supported
+ * when running bands.
+ */
 class CpuDepthwiseConv2dAssemblyWrapperKernel final : public ICpuKernel<CpuDepthwiseConv2dAssemblyWrapperKernel>
 {
 public:
@@ -136,6 +141,9 @@ private:
     std::vector<int32_t>                                   _left_shifts{};
     std::vector<int32_t>                                   _right_shifts{};
     std::string                                            _name{};
+    PadStrideInfo                                          _pad_stride_info{};
+    unsigned int                                           _kernel_rows{0};
+    bool                                                   _is_dilated{false};
 };
 } // namespace kernels
 } // namespace cpu
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/kvcache_matmul/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+// Accumulation is done in FP32: decode steps reduce over the whole context, which quickly exceeds the precision of
+// an FP16 accumulator.
+template <>
+void load_f32x8<float16_t>(const float16_t *ptr, float32x4_t &lo, float32x4_t &hi)
+{
+    const float16x8_t v = vld1q_f16(ptr);
+    lo                  = vcvt_f32_f16(vget_low_f16(v));
+    hi                  = vcvt_f32_f16(vget_high_f16(v));
+}
+} // namespace detail
+
+void neon_fp16_kvcache_matmul(const ITensor           *lhs,
+                              const ITensor           *cache,
+                              ITensor                 *dst,
+                              const KVCacheMatMulInfo &info,
+                              unsigned int             length,
+                              const Window            &window)
+{
+    detail::kvcache_matmul<float16_t>(lhs, cache, dst, info, length, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
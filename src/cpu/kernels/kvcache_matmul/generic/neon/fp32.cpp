@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/kvcache_matmul/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+template <>
+void load_f32x8<float>(const float *ptr, float32x4_t &lo, float32x4_t &hi)
+{
+    lo = vld1q_f32(ptr);
+    hi = vld1q_f32(ptr + 4);
+}
+} // namespace detail
+
+void neon_fp32_kvcache_matmul(const ITensor           *lhs,
+                              const ITensor           *cache,
+                              ITensor                 *dst,
+                              const KVCacheMatMulInfo &info,
+                              unsigned int             length,
+                              const Window            &window)
+{
+    detail::kvcache_matmul<float>(lhs, cache, dst, info, length, window);
+}
+} // namespace cpu
+} // namespace arm_compute
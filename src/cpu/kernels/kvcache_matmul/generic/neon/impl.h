@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_KVCACHE_MATMUL_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_KVCACHE_MATMUL_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "src/cpu/kernels/kvcache_matmul/list.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Load 8 consecutive elements of type T widened to FP32 */
+template <typename T>
+void load_f32x8(const T *ptr, float32x4_t &lo, float32x4_t &hi);
+
+/** Load the first @p valid of 8 elements of type T widened to FP32, the other lanes being set to zero
+ *
+ * The elements past @p valid are never read, as they may not have been written yet.
+ */
+template <typename T>
+void load_f32x8_tail(const T *ptr, unsigned int valid, float32x4_t &lo, float32x4_t &hi)
+{
+    T tail[8] = {};
+    std::copy_n(ptr, valid, tail);
+    load_f32x8(tail, lo, hi);
+}
+
+/** Scores of a single query against the packed keys
+ *
+ * The keys of each batch are stored in blocks of @ref kvcache_key_block tokens, with the block laid out as
+ * [head_dim][kvcache_key_block]. A single broadcast multiply-accumulate per head dimension therefore updates the
+ * scores of a whole block of tokens without any horizontal reduction.
+ */
+template <typename T>
+void kvcache_matmul_key(
+    const ITensor *lhs, const ITensor *cache, ITensor *dst, float scale, unsigned int length, const Window &window)
+{
+    const unsigned int head_dim     = lhs->info()->dimension(0);
+    const unsigned int max_length   = dst->info()->dimension(0);
+    const size_t       block_stride = static_cast<size_t>(head_dim) * kvcache_key_block;
+
+    const unsigned int x_start = window.x().start();
+    const unsigned int x_end   = window.x().end();
+    const T            masked  = static_cast<T>(-std::numeric_limits<float>::infinity());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto *q    = reinterpret_cast<const T *>(lhs->ptr_to_element(Coordinates(0, 0, id.z())));
+            const auto *keys = reinterpret_cast<const T *>(cache->ptr_to_element(Coordinates(0, id.z())));
+            auto       *out  = reinterpret_cast<T *>(dst->ptr_to_element(Coordinates(0, 0, id.z())));
+
+            for (unsigned int x = x_start; x < x_end; x += kvcache_key_block)
+            {
+                const T *block = keys + (x / kvcache_key_block) * block_stride;
+
+                // Only the last active block is partial: its lanes past the active length hold stale or uninitialised
+                // keys, so they are not loaded at all
+                const unsigned int valid = (x < length) ? std::min<unsigned int>(kvcache_key_block, length - x) : 0;
+
+                float32x4_t acc_lo = vdupq_n_f32(0.f);
+                float32x4_t acc_hi = vdupq_n_f32(0.f);
+                for (unsigned int d = 0; d < head_dim; ++d)
+                {
+                    float32x4_t k_lo{};
+                    float32x4_t k_hi{};
+                    if (valid == kvcache_key_block)
+                    {
+                        load_f32x8(block + d * kvcache_key_block, k_lo, k_hi);
+                    }
+                    else
+                    {
+                        load_f32x8_tail(block + d * kvcache_key_block, valid, k_lo, k_hi);
+                    }
+
+                    const float32x4_t q_d = vdupq_n_f32(static_cast<float>(q[d]));
+                    acc_lo                = vmlaq_f32(acc_lo, k_lo, q_d);
+                    acc_hi                = vmlaq_f32(acc_hi, k_hi, q_d);
+                }
+
+                float scores[kvcache_key_block];
+                vst1q_f32(scores, vmulq_n_f32(acc_lo, scale));
+                vst1q_f32(scores + 4, vmulq_n_f32(acc_hi, scale));
+
+                const unsigned int lanes = std::min<unsigned int>(kvcache_key_block, max_length - x);
+                for (unsigned int i = 0; i < lanes; ++i)
+                {
+                    out[x + i] = (x + i < length) ? static_cast<T>(scores[i]) : masked;
+                }
+            }
+
+            // The thread owning the last active block also masks the inactive part of the row, so that a following
+            // softmax over the full row only sees the cached tokens.
+            if (x_end >= length)
+            {
+                for (unsigned int x = x_end; x < max_length; ++x)
+                {
+                    out[x] = masked;
+                }
+            }
+        });
+}
+
+/** Weighted sum of the packed values
+ *
+ * The values of each batch are stored as [max_length][roundup(head_dim, kvcache_value_block)], so each window step
+ * accumulates a cache-line wide column of the output while streaming through the active rows.
+ */
+template <typename T>
+void kvcache_matmul_value(
+    const ITensor *lhs, const ITensor *cache, ITensor *dst, unsigned int length, const Window &window)
+{
+    const unsigned int head_dim = dst->info()->dimension(0);
+    const size_t       ld       = ceil_to_multiple(head_dim, kvcache_value_block);
+
+    const unsigned int x_start = window.x().start();
+    const unsigned int x_end   = window.x().end();
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto *p      = reinterpret_cast<const T *>(lhs->ptr_to_element(Coordinates(0, 0, id.z())));
+            const auto *values = reinterpret_cast<const T *>(cache->ptr_to_element(Coordinates(0, id.z())));
+            auto       *out    = reinterpret_cast<T *>(dst->ptr_to_element(Coordinates(0, 0, id.z())));
+
+            for (unsigned int x = x_start; x < x_end; x += kvcache_value_block)
+            {
+                float32x4_t acc[4] = {vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f)};
+
+                // The padding of the rows past head_dim is never written by the append kernel
+                const unsigned int lanes   = std::min<unsigned int>(kvcache_value_block, head_dim - x);
+                const unsigned int lanes_0 = std::min(lanes, 8u);
+                const unsigned int lanes_1 = lanes - lanes_0;
+
+                const T *row = values + x;
+                for (unsigned int t = 0; t < length; ++t, row += ld)
+                {
+                    const float32x4_t w = vdupq_n_f32(static_cast<float>(p[t]));
+
+                    float32x4_t v0{};
+                    float32x4_t v1{};
+                    float32x4_t v2{};
+                    float32x4_t v3{};
+                    if (lanes == kvcache_value_block)
+                    {
+                        load_f32x8(row, v0, v1);
+                        load_f32x8(row + 8, v2, v3);
+                    }
+                    else
+                    {
+                        load_f32x8_tail(row, lanes_0, v0, v1);
+                        load_f32x8_tail(row + 8, lanes_1, v2, v3);
+                    }
+
+                    acc[0] = vmlaq_f32(acc[0], v0, w);
+                    acc[1] = vmlaq_f32(acc[1], v1, w);
+                    acc[2] = vmlaq_f32(acc[2], v2, w);
+                    acc[3] = vmlaq_f32(acc[3], v3, w);
+                }
+
+                float res[kvcache_value_block];
+                for (unsigned int i = 0; i < 4; ++i)
+                {
+                    vst1q_f32(res + 4 * i, acc[i]);
+                }
+
+                for (unsigned int i = 0; i < lanes; ++i)
+                {
+                    out[x + i] = static_cast<T>(res[i]);
+                }
+            }
+        });
+}
+
+template <typename T>
+void kvcache_matmul(const ITensor           *lhs,
+                    const ITensor           *cache,
+                    ITensor                 *dst,
+                    const KVCacheMatMulInfo &info,
+                    unsigned int             length,
+                    const Window            &window)
+{
+    if (info.operand() == KVCacheOperand::Key)
+    {
+        kvcache_matmul_key<T>(lhs, cache, dst, info.scale(), length, window);
+    }
+    else
+    {
+        kvcache_matmul_value<T>(lhs, cache, dst, length, window);
+    }
+}
+} // namespace detail
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_KVCACHE_MATMUL_GENERIC_NEON_IMPL_H
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "src/cpu/kernels/common/neon/fp32_io.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Number of elements loaded by every step of the vector loops: four independent FP32 accumulators per statistic */
+constexpr int layer_norm_block = 16;
+
+/** Sum of the lanes of the four accumulators, also available on AArch32 */
+inline float layer_norm_reduce(const float32x4x4_t &acc)
+{
+    const float32x4_t v   = vaddq_f32(vaddq_f32(acc.val[0], acc.val[1]), vaddq_f32(acc.val[2], acc.val[3]));
+    float32x2_t       res = vpadd_f32(vget_high_f32(v), vget_low_f32(v));
+    res                   = vpadd_f32(res, res);
+    return vget_lane_f32(res, 0);
+}
+
+inline float32x4x4_t layer_norm_add(const float32x4x4_t &a, const float32x4x4_t &b)
+{
+    return {{vaddq_f32(a.val[0], b.val[0]), vaddq_f32(a.val[1], b.val[1]), vaddq_f32(a.val[2], b.val[2]),
+             vaddq_f32(a.val[3], b.val[3])}};
+}
+
+inline float32x4x4_t layer_norm_mul(const float32x4x4_t &a, const float32x4x4_t &b)
+{
+    return {{vmulq_f32(a.val[0], b.val[0]), vmulq_f32(a.val[1], b.val[1]), vmulq_f32(a.val[2], b.val[2]),
+             vmulq_f32(a.val[3], b.val[3])}};
+}
+
+/** Normalize every row along X of a window
+ *
+ * Each row is read twice. The first read adds the residual, writes the sum if requested and accumulates the
+ * statistics. The second read, from the sum when it has been written, applies the normalization, the affine
+ * transform and the output conversion. Rows are independent, so the window can be split along any dimension but X.
+ *
+ * The statistics of LayerNorm are accumulated relative to the first element of the row, which keeps the one pass
+ * variance accurate when the mean is large compared to the standard deviation.
+ */
+template <typename T, typename TOut, bool IS_RMS>
+void layer_normalization(const ITensor                *src,
+                         const ITensor                *residual,
+                         const ITensor                *gamma,
+                         const ITensor                *beta,
+                         ITensor                      *dst,
+                         ITensor                      *sum,
+                         const LayerNormalizationInfo &info,
+                         const Window                 &window)
+{
+    using Io    = Fp32Io<T>;
+    using IoOut = Fp32Io<TOut>;
+
+    auto first_element = [](const ITensor *t) -> const T *
+    {
+        return t != nullptr
+                   ? reinterpret_cast<const T *>(t->buffer() + t->info()->offset_first_element_in_bytes())
+                   : nullptr;
+    };
+
+    const int                     width     = static_cast<int>(src->info()->dimension(0));
+    const float                   inv_n     = 1.f / static_cast<float>(width);
+    const UniformQuantizationInfo dst_qi    = dst->info()->quantization_info().uniform();
+    const UniformQuantizationInfo sum_qi    = UniformQuantizationInfo();
+    const T *const                gamma_ptr = first_element(gamma);
+    const T *const                beta_ptr  = first_element(beta);
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const T *in_ptr = reinterpret_cast<const T *>(src->ptr_to_element(id));
+            const T *res_ptr =
+                residual != nullptr ? reinterpret_cast<const T *>(residual->ptr_to_element(id)) : nullptr;
+            T    *sum_ptr = sum != nullptr ? reinterpret_cast<T *>(sum->ptr_to_element(id)) : nullptr;
+            TOut *out_ptr = reinterpret_cast<TOut *>(dst->ptr_to_element(id));
+
+            float shift = 0.f;
+            if (!IS_RMS)
+            {
+                shift = Io::to_float(in_ptr[0]) + (res_ptr != nullptr ? Io::to_float(res_ptr[0]) : 0.f);
+            }
+            const float32x4_t vshift = vdupq_n_f32(shift);
+
+            // First read: residual, statistics
+            float32x4x4_t acc_sum = {{vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f)}};
+            float32x4x4_t acc_sq  = acc_sum;
+
+            int x = 0;
+            for (; x <= width - layer_norm_block; x += layer_norm_block)
+            {
+                float32x4x4_t v = Io::load(in_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v = layer_norm_add(v, Io::load(res_ptr + x));
+                }
+                if (sum_ptr != nullptr)
+                {
+                    Io::store(sum_ptr + x, v, sum_qi);
+                }
+                for (int i = 0; i < 4; ++i)
+                {
+                    const float32x4_t d = IS_RMS ? v.val[i] : vsubq_f32(v.val[i], vshift);
+                    if (!IS_RMS)
+                    {
+                        acc_sum.val[i] = vaddq_f32(acc_sum.val[i], d);
+                    }
+                    acc_sq.val[i] = vmlaq_f32(acc_sq.val[i], d, d);
+                }
+            }
+
+            float sum_d  = layer_norm_reduce(acc_sum);
+            float sum_sq = layer_norm_reduce(acc_sq);
+
+            for (; x < width; ++x)
+            {
+                float v = Io::to_float(in_ptr[x]);
+                if (res_ptr != nullptr)
+                {
+                    v += Io::to_float(res_ptr[x]);
+                }
+                if (sum_ptr != nullptr)
+                {
+                    sum_ptr[x] = Io::from_float(v, sum_qi);
+                }
+                const float d = v - shift;
+                sum_d += d;
+                sum_sq += d * d;
+            }
+
+            float mean = 0.f;
+            float var  = sum_sq * inv_n;
+            if (!IS_RMS)
+            {
+                const float mean_d = sum_d * inv_n;
+                mean               = shift + mean_d;
+                var                = std::max(var - mean_d * mean_d, 0.f);
+            }
+            const float rstd = 1.f / std::sqrt(var + info.epsilon);
+
+            // Second read: normalization and affine transform
+            const T          *x_ptr = sum_ptr != nullptr ? sum_ptr : in_ptr;
+            const T          *y_ptr = sum_ptr != nullptr ? nullptr : res_ptr;
+            const float32x4_t vmean = vdupq_n_f32(mean);
+            const float32x4_t vrstd = vdupq_n_f32(rstd);
+
+            for (x = 0; x <= width - layer_norm_block; x += layer_norm_block)
+            {
+                float32x4x4_t v = Io::load(x_ptr + x);
+                if (y_ptr != nullptr)
+                {
+                    v = layer_norm_add(v, Io::load(y_ptr + x));
+                }
+                for (int i = 0; i < 4; ++i)
+                {
+                    v.val[i] = vmulq_f32(vsubq_f32(v.val[i], vmean), vrstd);
+                }
+                if (gamma_ptr != nullptr)
+                {
+                    v = layer_norm_mul(v, Io::load(gamma_ptr + x));
+                }
+                if (beta_ptr != nullptr)
+                {
+                    v = layer_norm_add(v, Io::load(beta_ptr + x));
+                }
+                IoOut::store(out_ptr + x, v, dst_qi);
+            }
+            for (; x < width; ++x)
+            {
+                float v = Io::to_float(x_ptr[x]);
+                if (y_ptr != nullptr)
+                {
+                    v += Io::to_float(y_ptr[x]);
+                }
+                v = (v - mean) * rstd;
+                if (gamma_ptr != nullptr)
+                {
+                    v *= Io::to_float(gamma_ptr[x]);
+                }
+                if (beta_ptr != nullptr)
+                {
+                    v += Io::to_float(beta_ptr[x]);
+                }
+                out_ptr[x] = IoOut::from_float(v, dst_qi);
+            }
+        });
+}
+
+template <typename T, typename TOut>
+void layer_normalization(const ITensor                *src,
+                         const ITensor                *residual,
+                         const ITensor                *gamma,
+                         const ITensor                *beta,
+                         ITensor                      *dst,
+                         ITensor                      *sum,
+                         const LayerNormalizationInfo &info,
+                         const Window                 &window)
+{
+    if (info.type == LayerNormalizationType::RMSNorm)
+    {
+        layer_normalization<T, TOut, true>(src, residual, gamma, beta, dst, sum, info, window);
+    }
+    else
+    {
+        layer_normalization<T, TOut, false>(src, residual, gamma, beta, dst, sum, info, window);
+    }
+}
+} // namespace detail
+
+/** Normalize the rows of @p src, writing @p dst in its own data type: @p T or QASYMM8/QASYMM8_SIGNED */
+template <typename T>
+void neon_layer_normalization(const ITensor                *src,
+                              const ITensor                *residual,
+                              const ITensor                *gamma,
+                              const ITensor                *beta,
+                              ITensor                      *dst,
+                              ITensor                      *sum,
+                              const LayerNormalizationInfo &info,
+                              const Window                 &window)
+{
+    switch (dst->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            detail::layer_normalization<T, uint8_t>(src, residual, gamma, beta, dst, sum, info, window);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            detail::layer_normalization<T, int8_t>(src, residual, gamma, beta, dst, sum, info, window);
+            break;
+        default:
+            detail::layer_normalization<T, T>(src, residual, gamma, beta, dst, sum, info, window);
+            break;
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
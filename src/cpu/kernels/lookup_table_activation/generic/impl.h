@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LOOKUP_TABLE_ACTIVATION_GENERIC_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LOOKUP_TABLE_ACTIVATION_GENERIC_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Look up every element of the window in a table, one row along X at a time
+ *
+ * @param[in]  src        Source tensor.
+ * @param[out] dst        Destination tensor. Can be @p src.
+ * @param[in]  window     Region on which to execute the kernel.
+ * @param[in]  lookup_row Function called as lookup_row(src_row, dst_row, num_elements) for every row of the window.
+ */
+template <typename T, typename LookupRow>
+void lookup_table_activation(const ITensor *src, ITensor *dst, const Window &window, LookupRow &&lookup_row)
+{
+    const int    window_start_x = window.x().start();
+    const size_t num_elements   = window.x().end() - window_start_x;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto input_ptr  = reinterpret_cast<const T *>(input.ptr()) + window_start_x;
+            auto       output_ptr = reinterpret_cast<T *>(output.ptr()) + window_start_x;
+            lookup_row(input_ptr, output_ptr, num_elements);
+        },
+        input, output);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LOOKUP_TABLE_ACTIVATION_GENERIC_IMPL_H
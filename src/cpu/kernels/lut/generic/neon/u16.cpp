@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Error.h"
+
+#include "src/cpu/kernels/lut/list.h"
+
+#ifdef __aarch64__
+
+#include "src/common/utils/profile/acl_profile.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void lut_u16_neon(const uint16_t *table, size_t num_strings, size_t size, const uint16_t *input, uint16_t *output)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "lut_u16_neon");
+    ARM_COMPUTE_UNUSED(num_strings);
+
+    // Neon has no gather load: the lookups are independent scalar loads, unrolled to keep several of them in flight
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const uint16_t v0 = table[input[i + 0]];
+        const uint16_t v1 = table[input[i + 1]];
+        const uint16_t v2 = table[input[i + 2]];
+        const uint16_t v3 = table[input[i + 3]];
+        const uint16_t v4 = table[input[i + 4]];
+        const uint16_t v5 = table[input[i + 5]];
+        const uint16_t v6 = table[input[i + 6]];
+        const uint16_t v7 = table[input[i + 7]];
+        output[i + 0]     = v0;
+        output[i + 1]     = v1;
+        output[i + 2]     = v2;
+        output[i + 3]     = v3;
+        output[i + 4]     = v4;
+        output[i + 5]     = v5;
+        output[i + 6]     = v6;
+        output[i + 7]     = v7;
+    }
+    for (; i < size; ++i)
+    {
+        output[i] = table[input[i]];
+    }
+}
+
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // __aarch64__
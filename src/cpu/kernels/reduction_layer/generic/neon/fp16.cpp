@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,40 +30,17 @@ namespace arm_compute
 {
 namespace cpu
 {
-void reduce_RedOpX_reduceX_float16_8(const Window            &window,
-                                     const ITensor           *input,
-                                     ITensor                 *output,
-                                     const ReductionOperation op)
+void neon_fp16_reduction(const ITensor           *src,
+                         ITensor                 *dst,
+                         ITensor                 *partials,
+                         const ReductionOperation op,
+                         uint32_t                 axis_mask,
+                         bool                     keep_dims,
+                         ReductionStage           stage,
+                         const Window            &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpX_reduceX_float16_8");
-    Reducer<RedOpX<float16_t, 8>>::reduceX(window, input, output, RedOpX<float16_t, 8>(), op);
-}
-
-void reduce_RedOpYZW_reduceY_float16_8(const Window            &window,
-                                       const ITensor           *input,
-                                       ITensor                 *output,
-                                       const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceY_float16_8");
-    Reducer<RedOpYZW<float16_t, 8>>::reduceY(window, input, output, RedOpYZW<float16_t, 8>(), op);
-}
-
-void reduce_RedOpYZW_reduceZ_float16_8(const Window            &window,
-                                       const ITensor           *input,
-                                       ITensor                 *output,
-                                       const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceZ_float16_8");
-    Reducer<RedOpYZW<float16_t, 8>>::reduceZ(window, input, output, RedOpYZW<float16_t, 8>(), op);
-}
-
-void reduce_RedOpYZW_reduceW_float16_8(const Window            &window,
-                                       const ITensor           *input,
-                                       ITensor                 *output,
-                                       const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceW_float16_8");
-    Reducer<RedOpYZW<float16_t, 8>>::reduceW(window, input, output, RedOpYZW<float16_t, 8>(), op);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_fp16_reduction");
+    reduction_fp<float16_t>(src, dst, partials, op, axis_mask, keep_dims, stage, window);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,1607 +26,885 @@
 
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
 #include "arm_compute/core/TensorInfo.h"
 
-#include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/reduction_layer/generic/neon/list.h"
 #include "support/SaturateCast.h"
 
 #include <arm_neon.h>
+#include <algorithm>
+#include <array>
+#include <limits>
 
 namespace arm_compute
 {
-// Helper function that calls vqmovun/vqmvn, vcombine and vstore, allows templating of RedOpYZW_quantized
-template <typename T>
-void combine_and_store(int16x8_t t1, int16x8_t t2, Iterator &output, int offset = 0)
+namespace cpu
+{
+namespace detail
+{
+/** Number of X elements accumulated at once when X is not reduced
+ *
+ * The partial results of a block (4KB of FP32/S32 accumulators) stay in the L1 cache while every reduced row streams
+ * through them, so each input element is read exactly once whatever the number of reduced axes.
+ */
+constexpr int reduction_block_x = 1024;
+
+/** Number of consecutive elements loaded and widened to 4 accumulator vectors at once */
+constexpr int reduction_step = 16;
+
+using ReductionStrides = std::array<size_t, Coordinates::num_max_dimensions>;
+
+/** Iterates over the rows of the reduced dimensions above X in memory order */
+class ReducedRows
 {
-    if (std::is_same<T, uint8_t>::value)
+public:
+    ReducedRows(const ITensorInfo &info, uint32_t axis_mask)
     {
-        auto res = wrapper::vcombine(wrapper::vqmovun(t1), wrapper::vqmovun(t2));
-        wrapper::vstore(output.ptr() + offset, res);
+        for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+        {
+            if ((axis_mask & (1U << d)) != 0)
+            {
+                _dims[_num_dims]    = info.dimension(d);
+                _strides[_num_dims] = info.strides_in_bytes()[d];
+                _num_rows *= _dims[_num_dims];
+                ++_num_dims;
+            }
+        }
     }
-    else
+    /** Call fn(offset_in_bytes, row_index) for every reduced row, the innermost reduced dimension first */
+    template <typename F>
+    void for_each(F &&fn) const
     {
-        auto res = wrapper::vcombine(wrapper::vqmovn(t1), wrapper::vqmovn(t2));
-        wrapper::vstore(reinterpret_cast<int8_t *>(output.ptr() + offset), res);
+        ReductionStrides counters{};
+        size_t           offset = 0;
+        for (size_t r = 0; r < _num_rows; ++r)
+        {
+            fn(offset, r);
+            for (size_t i = 0; i < _num_dims; ++i)
+            {
+                offset += _strides[i];
+                if (++counters[i] < _dims[i])
+                {
+                    break;
+                }
+                offset -= _strides[i] * _dims[i];
+                counters[i] = 0;
+            }
+        }
     }
-}
 
-template <typename T>
-uint32x4x4_t calculate_index(uint32_t idx, T a, T b, uint32x4x4_t c, ReductionOperation op, int axis)
+private:
+    ReductionStrides _dims{};
+    ReductionStrides _strides{};
+    size_t           _num_dims{0};
+    size_t           _num_rows{1};
+};
+
+/** Number of source elements reduced into each destination element */
+inline size_t reduction_num_elements(const ITensorInfo &info, uint32_t axis_mask)
 {
-    uint32x4_t mask{0};
-    if (op == ReductionOperation::ARG_IDX_MIN)
-    {
-        mask = wrapper::vcgt(b, a);
-    }
-    else
+    size_t num_elements = 1;
+    for (size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
     {
-        mask = wrapper::vclt(b, a);
+        if ((axis_mask & (1U << d)) != 0)
+        {
+            num_elements *= info.dimension(d);
+        }
     }
+    return num_elements;
+}
 
-    uint32x4_t vec_idx = {idx, idx + 1, idx + 2, idx + 3};
-    if (axis != 0)
+/** Destination strides indexed by source dimension, zero for the reduced dimensions */
+inline ReductionStrides reduction_dst_strides(const ITensorInfo &dst_info, uint32_t axis_mask, bool keep_dims)
+{
+    ReductionStrides strides{};
+    size_t           dst_dim = 0;
+    for (size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
     {
-        vec_idx = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
+        const bool is_reduced = (axis_mask & (1U << d)) != 0;
+        if (!is_reduced)
+        {
+            strides[d] = dst_info.strides_in_bytes()[dst_dim];
+        }
+        if (!is_reduced || keep_dims)
+        {
+            ++dst_dim;
+        }
     }
-    uint32x4x4_t res = {{wrapper::vbsl(mask, vec_idx, c.val[0]), 0, 0, 0}};
+    return strides;
+}
 
-    return res;
+/** Call fn(src_ptr, dst_ptr) for every row of the window, X being left to the caller */
+template <typename F>
+void for_each_reduction_row(
+    const ITensor *src, ITensor *dst, uint32_t axis_mask, bool keep_dims, const Window &window, F &&fn)
+{
+    const ITensorInfo     &src_info    = *src->info();
+    const Strides         &src_strides = src_info.strides_in_bytes();
+    const ReductionStrides dst_strides = reduction_dst_strides(*dst->info(), axis_mask, keep_dims);
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        {
+                            // The reduced dimensions are collapsed in the window, so their coordinate is always 0
+                            const uint8_t *src_ptr = src->buffer() + src_info.offset_first_element_in_bytes();
+                            uint8_t       *dst_ptr = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+                            for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+                            {
+                                src_ptr += id[d] * src_strides[d];
+                                dst_ptr += id[d] * dst_strides[d];
+                            }
+                            fn(src_ptr, dst_ptr);
+                        });
 }
 
-template <typename T>
-uint32x4x4_t calculate_index_quantized(uint32_t idx, T a, T b, uint32x4x4_t c, ReductionOperation op, int axis)
+/** Load elements of type T widened to the accumulator type AccT */
+template <typename T, typename AccT>
+struct ReductionLoad;
+
+template <>
+struct ReductionLoad<float, float>
 {
-    uint32x4x4_t mask{{0}};
-    uint8x16_t   mask_u8{0};
-    if (op == ReductionOperation::ARG_IDX_MIN)
+    void operator()(const float *ptr, float32x4_t (&v)[4]) const
     {
-        mask_u8 = wrapper::vcgt(b, a);
+        for (int i = 0; i < 4; ++i)
+        {
+            v[i] = wrapper::vloadq(ptr + 4 * i);
+        }
     }
-    else
+    float operator()(float value) const
     {
-        mask_u8 = wrapper::vclt(b, a);
+        return value;
     }
-    auto wide_u16_1 =
-        wrapper::vorr(vshll_n_u8(wrapper::vgetlow(mask_u8), 8), wrapper::vmovl(wrapper::vgetlow(mask_u8)));
-    auto wide_u16_2 =
-        wrapper::vorr(vshll_n_u8(wrapper::vgethigh(mask_u8), 8), wrapper::vmovl(wrapper::vgethigh(mask_u8)));
-    mask.val[0] =
-        wrapper::vorr(vshll_n_u16(wrapper::vgetlow(wide_u16_1), 16), wrapper::vmovl(wrapper::vgetlow(wide_u16_1)));
-    mask.val[1] =
-        wrapper::vorr(vshll_n_u16(wrapper::vgethigh(wide_u16_1), 16), wrapper::vmovl(wrapper::vgethigh(wide_u16_1)));
-    mask.val[2] =
-        wrapper::vorr(vshll_n_u16(wrapper::vgetlow(wide_u16_2), 16), wrapper::vmovl(wrapper::vgetlow(wide_u16_2)));
-    mask.val[3] =
-        wrapper::vorr(vshll_n_u16(wrapper::vgethigh(wide_u16_2), 16), wrapper::vmovl(wrapper::vgethigh(wide_u16_2)));
+};
 
-    uint32x4x4_t vec_idx = {{{idx + 0, idx + 1, idx + 2, idx + 3},
-                             {idx + 4, idx + 5, idx + 6, idx + 7},
-                             {idx + 8, idx + 9, idx + 10, idx + 11},
-                             {idx + 12, idx + 13, idx + 14, idx + 15}}};
-    if (axis != 0)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template <>
+struct ReductionLoad<float16_t, float>
+{
+    void operator()(const float16_t *ptr, float32x4_t (&v)[4]) const
     {
-        vec_idx.val[0] = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
-        vec_idx.val[1] = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
-        vec_idx.val[2] = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
-        vec_idx.val[3] = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
+        const float16x8_t a = wrapper::vloadq(ptr);
+        const float16x8_t b = wrapper::vloadq(ptr + 8);
+        v[0]                = vcvt_f32_f16(vget_low_f16(a));
+        v[1]                = vcvt_f32_f16(vget_high_f16(a));
+        v[2]                = vcvt_f32_f16(vget_low_f16(b));
+        v[3]                = vcvt_f32_f16(vget_high_f16(b));
     }
-    uint32x4x4_t res = {
-        {vbslq_u32(mask.val[0], vec_idx.val[0], c.val[0]), vbslq_u32(mask.val[1], vec_idx.val[1], c.val[1]),
-         vbslq_u32(mask.val[2], vec_idx.val[2], c.val[2]), vbslq_u32(mask.val[3], vec_idx.val[3], c.val[3])}};
-
-    return res;
-}
-
-// Helper function to calculate the minimum value of the input vector. All the elements in the output vector contain the min value.
-template <typename T>
-inline typename std::enable_if<
-    std::is_same<T, float32x4_t>::value || std::is_same<T, int32x4_t>::value,
-    typename std::conditional<std::is_same<T, float32x4_t>::value, float32x2_t, int32x2_t>::type>::type
-calculate_min(T in)
-{
-    auto pmin = wrapper::vpmin(wrapper::vgethigh(in), wrapper::vgetlow(in));
-    return wrapper::vpmin(pmin, pmin);
-}
+    float operator()(float16_t value) const
+    {
+        return static_cast<float>(value);
+    }
+};
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 
-// Helper function to calculate the minimum value of the input vector. All the elements in the output vector contain the min value.
-template <typename T>
-inline typename std::enable_if<
-    std::is_same<T, uint8x16_t>::value || std::is_same<T, int8x16_t>::value,
-    typename std::conditional<std::is_same<T, uint8x16_t>::value, uint8x8_t, int8x8_t>::type>::type
-calculate_min(T in)
+template <>
+struct ReductionLoad<int32_t, int32_t>
 {
-    auto pmin = wrapper::vpmin(wrapper::vgethigh(in), wrapper::vgetlow(in));
-    pmin      = wrapper::vpmin(pmin, pmin);
-    pmin      = wrapper::vpmin(pmin, pmin);
-    return wrapper::vpmin(pmin, pmin);
-}
+    void operator()(const int32_t *ptr, int32x4_t (&v)[4]) const
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            v[i] = wrapper::vloadq(ptr + 4 * i);
+        }
+    }
+    int32_t operator()(int32_t value) const
+    {
+        return value;
+    }
+};
 
-// Helper function to calculate the maximum value of the input vector. All the elements in the output vector contain the max value.
-template <typename T>
-inline typename std::enable_if<
-    std::is_same<T, float32x4_t>::value || std::is_same<T, int32x4_t>::value,
-    typename std::conditional<std::is_same<T, float32x4_t>::value, float32x2_t, int32x2_t>::type>::type
-calculate_max(T in)
+template <>
+struct ReductionLoad<uint8_t, int32_t>
 {
-    auto pmax = wrapper::vpmax(wrapper::vgethigh(in), wrapper::vgetlow(in));
-    return wrapper::vpmax(pmax, pmax);
-}
+    void operator()(const uint8_t *ptr, int32x4_t (&v)[4]) const
+    {
+        const uint8x16_t a  = vld1q_u8(ptr);
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(a));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(a));
+        v[0]                = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(lo)));
+        v[1]                = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(lo)));
+        v[2]                = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(hi)));
+        v[3]                = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(hi)));
+    }
+    int32_t operator()(uint8_t value) const
+    {
+        return value;
+    }
+};
 
-// Helper function to calculate the maximum value of the input vector. All the elements in the output vector contain the max value.
-template <typename T>
-inline typename std::enable_if<
-    std::is_same<T, uint8x16_t>::value || std::is_same<T, int8x16_t>::value,
-    typename std::conditional<std::is_same<T, uint8x16_t>::value, uint8x8_t, int8x8_t>::type>::type
-calculate_max(T in)
+template <>
+struct ReductionLoad<int8_t, int32_t>
 {
-    auto pmax = wrapper::vpmax(wrapper::vgethigh(in), wrapper::vgetlow(in));
-    pmax      = wrapper::vpmax(pmax, pmax);
-    pmax      = wrapper::vpmax(pmax, pmax);
-    return wrapper::vpmax(pmax, pmax);
-}
+    void operator()(const int8_t *ptr, int32x4_t (&v)[4]) const
+    {
+        const int8x16_t a  = vld1q_s8(ptr);
+        const int16x8_t lo = vmovl_s8(vget_low_s8(a));
+        const int16x8_t hi = vmovl_s8(vget_high_s8(a));
+        v[0]               = vmovl_s16(vget_low_s16(lo));
+        v[1]               = vmovl_s16(vget_high_s16(lo));
+        v[2]               = vmovl_s16(vget_low_s16(hi));
+        v[3]               = vmovl_s16(vget_high_s16(hi));
+    }
+    int32_t operator()(int8_t value) const
+    {
+        return value;
+    }
+};
 
+/** Load quantized elements of type T dequantized to FP32 */
 template <typename T>
-uint32_t calculate_vector_index(uint32x4x4_t vec_res_idx, T vec_res_value, ReductionOperation op)
+struct ReductionDequantize
 {
-    uint32x4_t res_idx_mask{0};
-    uint32x4_t mask_ones = vdupq_n_u32(0xFFFFFFFF);
-
-    if (op == ReductionOperation::ARG_IDX_MIN)
+    explicit ReductionDequantize(const UniformQuantizationInfo &qinfo)
+        : offset(static_cast<float>(qinfo.offset)), scale(qinfo.scale)
     {
-        auto pmin    = calculate_min(vec_res_value);
-        auto mask    = wrapper::vceq(vec_res_value, wrapper::vcombine(pmin, pmin));
-        res_idx_mask = wrapper::vand(vec_res_idx.val[0], mask);
     }
-    else
+    void operator()(const T *ptr, float32x4_t (&v)[4]) const
     {
-        auto pmax    = calculate_max(vec_res_value);
-        auto mask    = wrapper::vceq(vec_res_value, wrapper::vcombine(pmax, pmax));
-        res_idx_mask = wrapper::vand(vec_res_idx.val[0], mask);
+        int32x4_t q[4];
+        ReductionLoad<T, int32_t>()(ptr, q);
+        const float32x4_t voffset = vdupq_n_f32(offset);
+        const float32x4_t vscale  = vdupq_n_f32(scale);
+        for (int i = 0; i < 4; ++i)
+        {
+            v[i] = vmulq_f32(vsubq_f32(vcvtq_f32_s32(q[i]), voffset), vscale);
+        }
+    }
+    float operator()(T value) const
+    {
+        return (static_cast<float>(value) - offset) * scale;
     }
 
-    res_idx_mask = wrapper::vadd(res_idx_mask, mask_ones);
-    auto pmin    = wrapper::vpmin(wrapper::vgethigh(res_idx_mask), wrapper::vgetlow(res_idx_mask));
-    pmin         = wrapper::vpmin(pmin, pmin);
-    uint32_t res = wrapper::vgetlane(pmin, 0);
-
-    return (res - 0xFFFFFFFF);
-}
+    float offset;
+    float scale;
+};
 
-template <typename T>
-uint32_t calculate_vector_index_quantized(uint32x4x4_t vec_res_idx, T vec_res_value, ReductionOperation op)
+struct ReduceSum
 {
-    uint32x4x4_t res_idx_mask{{0}};
-    uint32x4_t   mask_ones = vdupq_n_u32(0xFFFFFFFF);
-    uint8x16_t   mask_u8{0};
-    if (op == ReductionOperation::ARG_IDX_MIN)
+    template <typename V>
+    static V vec(const V &acc, const V &v)
     {
-        auto pmin = calculate_min(vec_res_value);
-        mask_u8   = wrapper::vceq(vec_res_value, wrapper::vcombine(pmin, pmin));
+        return wrapper::vadd(acc, v);
     }
-    else
+    template <typename S>
+    static S scalar(S acc, S v)
     {
-        auto pmax = calculate_max(vec_res_value);
-        mask_u8   = wrapper::vceq(vec_res_value, wrapper::vcombine(pmax, pmax));
+        return acc + v;
     }
-
-    // Widen vectors
-    auto wide_u16_1 =
-        wrapper::vorr(vshll_n_u8(wrapper::vgetlow(mask_u8), 8), wrapper::vmovl(wrapper::vgetlow(mask_u8)));
-    auto wide_u16_2 =
-        wrapper::vorr(vshll_n_u8(wrapper::vgethigh(mask_u8), 8), wrapper::vmovl(wrapper::vgethigh(mask_u8)));
-    auto wide_u32_1 =
-        wrapper::vorr(vshll_n_u16(wrapper::vgetlow(wide_u16_1), 16), wrapper::vmovl(wrapper::vgetlow(wide_u16_1)));
-    auto wide_u32_2 =
-        wrapper::vorr(vshll_n_u16(wrapper::vgethigh(wide_u16_1), 16), wrapper::vmovl(wrapper::vgethigh(wide_u16_1)));
-    auto wide_u32_3 =
-        wrapper::vorr(vshll_n_u16(wrapper::vgetlow(wide_u16_2), 16), wrapper::vmovl(wrapper::vgetlow(wide_u16_2)));
-    auto wide_u32_4 =
-        wrapper::vorr(vshll_n_u16(wrapper::vgethigh(wide_u16_2), 16), wrapper::vmovl(wrapper::vgethigh(wide_u16_2)));
-    res_idx_mask.val[0] = wrapper::vand(vec_res_idx.val[0], wide_u32_1);
-    res_idx_mask.val[1] = wrapper::vand(vec_res_idx.val[1], wide_u32_2);
-    res_idx_mask.val[2] = wrapper::vand(vec_res_idx.val[2], wide_u32_3);
-    res_idx_mask.val[3] = wrapper::vand(vec_res_idx.val[3], wide_u32_4);
-    res_idx_mask.val[0] = wrapper::vadd(res_idx_mask.val[0], mask_ones);
-    res_idx_mask.val[1] = wrapper::vadd(res_idx_mask.val[1], mask_ones);
-    res_idx_mask.val[2] = wrapper::vadd(res_idx_mask.val[2], mask_ones);
-    res_idx_mask.val[3] = wrapper::vadd(res_idx_mask.val[3], mask_ones);
-
-    uint32_t res  = 0xFFFFFFFF;
-    int      iter = 0;
-    do
+    template <typename S>
+    static S identity()
     {
-        auto pmin = wrapper::vpmin(wrapper::vgethigh(res_idx_mask.val[iter]), wrapper::vgetlow(res_idx_mask.val[iter]));
-        pmin      = wrapper::vpmin(pmin, pmin);
-        res       = std::min(wrapper::vgetlane(pmin, 0), res);
-        iter++;
-    } while (iter < 4);
-
-    return (res - 0xFFFFFFFF);
-}
+        return S(0);
+    }
+};
 
-#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-template <>
-uint32x4x4_t inline calculate_index(
-    uint32_t idx, float16x8_t a, float16x8_t b, uint32x4x4_t c, ReductionOperation op, int axis)
+struct ReduceSumSquare
 {
-    uint32x4x2_t mask{0};
-    uint16x8_t   mask_u16{0};
-    if (op == ReductionOperation::ARG_IDX_MIN)
+    template <typename V>
+    static V vec(const V &acc, const V &v)
     {
-        mask_u16 = wrapper::vcgt(b, a);
+        return wrapper::vmla(acc, v, v);
     }
-    else
+    template <typename S>
+    static S scalar(S acc, S v)
     {
-        mask_u16 = wrapper::vclt(b, a);
+        return acc + v * v;
     }
-    mask.val[0]          = wrapper::vmovl(wrapper::vgetlow(mask_u16));
-    mask.val[1]          = wrapper::vmovl(wrapper::vgethigh(mask_u16));
-    uint32x4x2_t vec_idx = {{{idx + 0, idx + 1, idx + 2, idx + 3}, {idx + 4, idx + 5, idx + 6, idx + 7}}};
-    if (axis != 0)
+    template <typename S>
+    static S identity()
     {
-        vec_idx.val[0] = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
-        vec_idx.val[1] = wrapper::vdup_n(idx, wrapper::traits::vector_128_tag{});
+        return S(0);
     }
-    uint32x4x4_t res = {wrapper::vbsl(mask.val[0], vec_idx.val[0], c.val[0]),
-                        wrapper::vbsl(mask.val[1], vec_idx.val[1], c.val[1]), 0, 0};
-
-    return res;
-}
+};
 
-// Helper function to calculate the minimum value of the input vector. All the elements in the output vector contain the min value.
-inline float16x4_t calculate_min(float16x8_t in)
-{
-    auto pmin = wrapper::vpmin(wrapper::vgethigh(in), wrapper::vgetlow(in));
-    pmin      = wrapper::vpmin(pmin, pmin);
-    return wrapper::vpmin(pmin, pmin);
-}
-// Helper function to calculate the maximum value of the input vector. All the elements in the output vector contain the max value.
-inline float16x4_t calculate_max(float16x8_t in)
+struct ReduceProd
 {
-    auto pmax = wrapper::vpmax(wrapper::vgethigh(in), wrapper::vgetlow(in));
-    pmax      = wrapper::vpmax(pmax, pmax);
-    return wrapper::vpmax(pmax, pmax);
-}
+    template <typename V>
+    static V vec(const V &acc, const V &v)
+    {
+        return wrapper::vmul(acc, v);
+    }
+    template <typename S>
+    static S scalar(S acc, S v)
+    {
+        return acc * v;
+    }
+    template <typename S>
+    static S identity()
+    {
+        return S(1);
+    }
+};
 
-template <>
-inline uint32_t calculate_vector_index(uint32x4x4_t vec_res_idx, float16x8_t vec_res_value, ReductionOperation op)
+struct ReduceMin
 {
-    uint32x4x2_t res_idx_mask{0};
-    uint32x4_t   mask_ones = vdupq_n_u32(0xFFFFFFFF);
-    uint16x8_t   mask_u16;
-    if (op == ReductionOperation::ARG_IDX_MIN)
+    template <typename V>
+    static V vec(const V &acc, const V &v)
     {
-        auto pmin = calculate_min(vec_res_value);
-        mask_u16  = wrapper::vceq(vec_res_value, wrapper::vcombine(pmin, pmin));
+        return wrapper::vmin(acc, v);
     }
-    else
+    template <typename S>
+    static S scalar(S acc, S v)
     {
-        auto pmax = calculate_max(vec_res_value);
-        mask_u16  = wrapper::vceq(vec_res_value, wrapper::vcombine(pmax, pmax));
+        return std::min(acc, v);
     }
-
-    // Widen vectors
-    auto wide_u32_1 =
-        wrapper::vorr(vshll_n_u16(wrapper::vgetlow(mask_u16), 8), wrapper::vmovl(wrapper::vgetlow(mask_u16)));
-    auto wide_u32_2 =
-        wrapper::vorr(vshll_n_u16(wrapper::vgethigh(mask_u16), 8), wrapper::vmovl(wrapper::vgethigh(mask_u16)));
-    res_idx_mask.val[0] = wrapper::vand(vec_res_idx.val[0], wide_u32_1);
-    res_idx_mask.val[1] = wrapper::vand(vec_res_idx.val[1], wide_u32_2);
-    res_idx_mask.val[0] = wrapper::vadd(res_idx_mask.val[0], mask_ones);
-    res_idx_mask.val[1] = wrapper::vadd(res_idx_mask.val[1], mask_ones);
-
-    uint32_t res  = 0xFFFFFFFF;
-    uint32_t iter = 0;
-    do
+    template <typename S>
+    static S identity()
     {
-        auto pmin = wrapper::vpmin(wrapper::vgethigh(res_idx_mask.val[iter]), wrapper::vgetlow(res_idx_mask.val[iter]));
-        pmin      = wrapper::vpmin(pmin, pmin);
-        res       = std::min(wrapper::vgetlane(pmin, 0), res);
-        iter++;
-    } while (iter < 2);
-
-    return (res - 0xFFFFFFFF);
-}
-#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        return std::numeric_limits<S>::has_infinity ? std::numeric_limits<S>::infinity()
+                                                    : std::numeric_limits<S>::max();
+    }
+    /** Lanes where @p v strictly improves on @p acc, so that ties keep the first index */
+    template <typename V>
+    static uint32x4_t is_better_vec(const V &v, const V &acc)
+    {
+        return wrapper::vclt(v, acc);
+    }
+    template <typename S>
+    static bool is_better(S v, S acc)
+    {
+        return v < acc;
+    }
+};
 
-template <class F>
-class Reducer
+struct ReduceMax
 {
-public:
-    static void reduceX(const Window &window, const ITensor *input, ITensor *output, F f, const ReductionOperation op)
+    template <typename V>
+    static V vec(const V &acc, const V &v)
     {
-        // Set out window
-        Window out_window(window);
-        out_window.set(Window::DimX, Window::Dimension(0, 1, 1));
-
-        f(window, out_window, input, output, op);
+        return wrapper::vmax(acc, v);
     }
-    static void reduceY(const Window &window, const ITensor *input, ITensor *output, F f, const ReductionOperation op)
+    template <typename S>
+    static S scalar(S acc, S v)
     {
-        // Set in window
-        Window in_window(window);
-        Window out_window(window);
-
-        in_window.set(Window::DimY, Window::Dimension(0, 1, 1));
-        out_window.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), output->info()->dimension(1)));
-
-        f(in_window, out_window, input, output, 1, op);
+        return std::max(acc, v);
     }
-    static void reduceZ(const Window &window, const ITensor *input, ITensor *output, F f, const ReductionOperation op)
+    template <typename S>
+    static S identity()
     {
-        // Set in window
-        Window in_window(window);
-        Window out_window(window);
-
-        in_window.set(Window::DimZ, Window::Dimension(0, 1, 1));
-        out_window.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(2), output->info()->dimension(2)));
-
-        f(in_window, out_window, input, output, 2, op);
+        return std::numeric_limits<S>::has_infinity ? -std::numeric_limits<S>::infinity()
+                                                    : std::numeric_limits<S>::lowest();
     }
-    static void reduceW(const Window &window, const ITensor *input, ITensor *output, F f, const ReductionOperation op)
+    /** Lanes where @p v strictly improves on @p acc, so that ties keep the first index */
+    template <typename V>
+    static uint32x4_t is_better_vec(const V &v, const V &acc)
     {
-        // Set in/out window
-        Window in_window(window);
-        Window out_window(window);
-
-        in_window.set(3, Window::Dimension(0, 1, 1));
-        out_window.set(3, Window::Dimension(0, 1, 1));
-
-        f(in_window, out_window, input, output, 3, op);
+        return wrapper::vcgt(v, acc);
+    }
+    template <typename S>
+    static bool is_better(S v, S acc)
+    {
+        return v > acc;
     }
 };
 
-template <typename T, int S>
-struct RedOpX
+/** Reduce every row of @p rows into one value, X being reduced as well */
+template <typename Op, typename T, typename AccT, typename Load>
+AccT reduce_rows_x(const uint8_t *src_ptr, const ReducedRows &rows, int len, const Load &load)
 {
-    /** SIMD vector tag type. */
-    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+    using AccVec = typename wrapper::traits::neon_vector<AccT, 4>::type;
 
-    inline void operator()(
-        const Window &in_window, Window &out_window, const ITensor *in, ITensor *out, const ReductionOperation op)
+    AccVec vacc[4];
+    for (int i = 0; i < 4; ++i)
     {
-        const size_t input_dim_0    = in->info()->dimension(0);
-        const int    window_step_x  = 16 / sizeof(T);
-        const auto   window_start_x = static_cast<int>(in_window.x().start());
-        const auto   window_end_x   = static_cast<int>(in_window.x().end());
-
-        Window in_win_no_pad = in_window;
-        in_win_no_pad.set(Window::DimX, Window::Dimension(0, 1, 1));
-
-        Iterator input(in, in_win_no_pad);
-        Iterator output(out, out_window);
-
-        execute_window_loop(
-            in_win_no_pad,
-            [&](const Coordinates &)
+        vacc[i] = wrapper::vdup_n(Op::template identity<AccT>(), wrapper::traits::vector_128_tag{});
+    }
+    AccT tail = Op::template identity<AccT>();
+
+    rows.for_each(
+        [&](size_t offset, size_t)
+        {
+            const auto *in = reinterpret_cast<const T *>(src_ptr + offset);
+            int         x  = 0;
+            for (; x <= len - reduction_step; x += reduction_step)
             {
-                const auto input_ptr = reinterpret_cast<const T *>(input.ptr());
-
-                auto init_res_value = static_cast<T>(0.f);
-                switch (op)
-                {
-                    case ReductionOperation::ARG_IDX_MAX:
-                    case ReductionOperation::ARG_IDX_MIN:
-                    case ReductionOperation::MIN:
-                    case ReductionOperation::MAX:
-                    {
-                        init_res_value = static_cast<T>(*input_ptr);
-                        break;
-                    }
-                    case ReductionOperation::PROD:
-                    {
-                        init_res_value = static_cast<T>(1.f);
-                        break;
-                    }
-                    default:
-                        break;
-                }
-                auto         vec_res_value = wrapper::vdup_n(init_res_value, ExactTagType{});
-                uint32x4x4_t vec_res_idx{{0}};
-
-                // Compute window_step_x elements per iteration
-                int x = window_start_x;
-                for (; x <= (window_end_x - window_step_x); x += window_step_x)
+                AccVec v[4];
+                load(in + x, v);
+                for (int i = 0; i < 4; ++i)
                 {
-                    const auto vec_elements = wrapper::vloadq(input_ptr + x);
-                    switch (op)
-                    {
-                        case ReductionOperation::SUM_SQUARE:
-                            vec_res_value = wrapper::vadd(wrapper::vmul(vec_elements, vec_elements), vec_res_value);
-                            break;
-                        case ReductionOperation::MEAN_SUM:
-                        case ReductionOperation::SUM:
-                            vec_res_value = wrapper::vadd(vec_elements, vec_res_value);
-                            break;
-                        case ReductionOperation::PROD:
-                            vec_res_value = wrapper::vmul(vec_elements, vec_res_value);
-                            break;
-                        case ReductionOperation::ARG_IDX_MIN:
-                        {
-                            auto temp_vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                            vec_res_idx = calculate_index<decltype(vec_res_value)>(x, temp_vec_res_value, vec_res_value,
-                                                                                   vec_res_idx, op, 0);
-                            vec_res_value = temp_vec_res_value;
-                            break;
-                        }
-                        case ReductionOperation::ARG_IDX_MAX:
-                        {
-                            auto temp_vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                            vec_res_idx = calculate_index<decltype(vec_res_value)>(x, temp_vec_res_value, vec_res_value,
-                                                                                   vec_res_idx, op, 0);
-                            vec_res_value = temp_vec_res_value;
-                            break;
-                        }
-                        case ReductionOperation::MIN:
-                        {
-                            vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                            break;
-                        }
-                        case ReductionOperation::MAX:
-                        {
-                            vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                            break;
-                        }
-                        default:
-                            ARM_COMPUTE_ERROR("Not supported");
-                    }
+                    vacc[i] = Op::vec(vacc[i], v[i]);
                 }
+            }
+            for (; x < len; ++x)
+            {
+                tail = Op::scalar(tail, load(in[x]));
+            }
+        });
 
-                switch (op)
-                {
-                    case ReductionOperation::SUM:
-                    case ReductionOperation::MEAN_SUM:
-                    case ReductionOperation::SUM_SQUARE:
-                    {
-#ifdef ARM_COMPUTE_DEBUG_ENABLED
-                        auto res = static_cast<T>(0.f);
-                        for (int i = 0; i < S; ++i)
-                        {
-                            res += wrapper::vgetlane(vec_res_value, i);
-                        }
-#else  // ARM_COMPUTE_DEBUG_ENABLED
-                        auto carry_res =
-                            wrapper::vpadd(wrapper::vgethigh(vec_res_value), wrapper::vgetlow(vec_res_value));
-                        for (int i = 0; i < S / 4; ++i)
-                        {
-                            carry_res = wrapper::vpadd(carry_res, carry_res);
-                        }
-                        auto res = wrapper::vgetlane(carry_res, 0);
-#endif // ARM_COMPUTE_DEBUG_ENABLED
-                        if (op == ReductionOperation::SUM_SQUARE)
-                        {
-                            // Compute left-over elements
-                            for (; x < window_end_x; ++x)
-                            {
-                                res += (*(input_ptr + x)) * (*(input_ptr + x));
-                            }
-                        }
-                        else
-                        {
-                            // Compute left-over elements
-                            for (; x < window_end_x; ++x)
-                            {
-                                res += *(input_ptr + x);
-                            }
-                        }
-
-                        if (op == ReductionOperation::MEAN_SUM)
-                        {
-                            res /= input_dim_0;
-                        }
-
-                        *(reinterpret_cast<T *>(output.ptr())) = res;
-                        break;
-                    }
-                    case ReductionOperation::PROD:
-                    {
-                        auto carry_res =
-                            wrapper::vmul(wrapper::vgethigh(vec_res_value), wrapper::vgetlow(vec_res_value));
-                        T res = 1;
-                        for (int i = 0; i < S / 2; ++i)
-                        {
-                            res *= wrapper::vgetlane(carry_res, i);
-                        }
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            res *= *(input_ptr + x);
-                        }
-
-                        *(reinterpret_cast<T *>(output.ptr())) = res;
-                        break;
-                    }
-                    case ReductionOperation::ARG_IDX_MIN:
-                    {
-                        auto idx = calculate_vector_index<decltype(vec_res_value)>(vec_res_idx, vec_res_value, op);
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_min(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            if (*(input_ptr + x) < res)
-                            {
-                                idx = x;
-                                res = *(input_ptr + x);
-                            }
-                        }
-                        *(reinterpret_cast<uint32_t *>(output.ptr())) = idx;
-                        break;
-                    }
-                    case ReductionOperation::ARG_IDX_MAX:
-                    {
-                        auto idx = calculate_vector_index<decltype(vec_res_value)>(vec_res_idx, vec_res_value, op);
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_max(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            if (*(input_ptr + x) > res)
-                            {
-                                idx = x;
-                                res = *(input_ptr + x);
-                            }
-                        }
-                        *(reinterpret_cast<uint32_t *>(output.ptr())) = idx;
-                        break;
-                    }
-                    case ReductionOperation::MIN:
-                    {
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_min(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            res = *(input_ptr + x) < res ? *(input_ptr + x) : res;
-                        }
-                        *(reinterpret_cast<T *>(output.ptr())) = res;
-                        break;
-                    }
-                    case ReductionOperation::MAX:
-                    {
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_max(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            res = *(input_ptr + x) > res ? *(input_ptr + x) : res;
-                        }
-                        *(reinterpret_cast<T *>(output.ptr())) = res;
-                        break;
-                    }
-                    default:
-                        ARM_COMPUTE_ERROR("Not supported");
-                }
-            },
-            input, output);
+    // Fold the lanes in a fixed order so the result does not depend on how the work was split
+    AccT lanes[reduction_step];
+    for (int i = 0; i < 4; ++i)
+    {
+        wrapper::vstore(lanes + 4 * i, vacc[i]);
     }
-};
-
-template <typename T>
-struct RedOpX_quantized
-{
-    inline void operator()(
-        const Window &in_window, Window &out_window, const ITensor *in, ITensor *out, const ReductionOperation op)
+    AccT res = lanes[0];
+    for (int i = 1; i < reduction_step; ++i)
     {
-        using PromotedType = typename wrapper::traits::promote<typename wrapper::traits::promote<T>::type>::type;
-
-        const auto oq_info = out->info()->quantization_info().uniform();
-
-        const TensorInfo              in_info = *(in->info());
-        const UniformQuantizationInfo iq_info = in_info.quantization_info().uniform();
-
-        const int  window_step_x  = 16 / sizeof(T);
-        const auto window_start_x = static_cast<int>(in_window.x().start());
-        const auto window_end_x   = static_cast<int>(in_window.x().end());
-
-        Window in_win_no_pad = in_window;
-        in_win_no_pad.set(Window::DimX, Window::Dimension(0, 1, 1));
-
-        Iterator input(in, in_win_no_pad);
-        Iterator output(out, out_window);
-
-        const auto  in_offset = static_cast<float>(iq_info.offset);
-        const float in_scale  = iq_info.scale;
-
-        const auto  out_offset = static_cast<float>(oq_info.offset);
-        const float out_scale  = oq_info.scale;
-
-        const auto num_elements = static_cast<float>(in_info.dimension(0));
-
-        const float A = in_scale / (out_scale * num_elements);
-        const float B = out_offset - (in_scale * in_offset) / (out_scale);
+        res = Op::scalar(res, lanes[i]);
+    }
+    return Op::scalar(res, tail);
+}
 
-        execute_window_loop(
-            in_win_no_pad,
-            [&](const Coordinates &)
+/** Reduce every row of @p rows into @p len accumulators, X not being reduced */
+template <typename Op, typename T, typename AccT, typename Load>
+void reduce_rows_block(const uint8_t *src_ptr, const ReducedRows &rows, int len, const Load &load, AccT *acc)
+{
+    using AccVec = typename wrapper::traits::neon_vector<AccT, 4>::type;
+
+    std::fill_n(acc, len, Op::template identity<AccT>());
+    rows.for_each(
+        [&](size_t offset, size_t)
+        {
+            const auto *in = reinterpret_cast<const T *>(src_ptr + offset);
+            int         x  = 0;
+            for (; x <= len - reduction_step; x += reduction_step)
             {
-                const auto input_ptr = reinterpret_cast<T *>(input.ptr());
-
-                auto vec_res_value1 =
-                    wrapper::vdup_n(static_cast<PromotedType>(0.f), wrapper::traits::vector_128_tag{});
-                auto vec_res_value2 =
-                    wrapper::vdup_n(static_cast<PromotedType>(0.f), wrapper::traits::vector_128_tag{});
-                auto vec_res_value3 =
-                    wrapper::vdup_n(static_cast<PromotedType>(0.f), wrapper::traits::vector_128_tag{});
-                auto vec_res_value4 =
-                    wrapper::vdup_n(static_cast<PromotedType>(0.f), wrapper::traits::vector_128_tag{});
-
-                auto vec_res_value1_f = vdupq_n_f32(static_cast<float>(1.f));
-                auto vec_res_value2_f = vdupq_n_f32(static_cast<float>(1.f));
-                auto vec_res_value3_f = vdupq_n_f32(static_cast<float>(1.f));
-                auto vec_res_value4_f = vdupq_n_f32(static_cast<float>(1.f));
-
-                typename wrapper::traits::neon_vector<T, 16>::type vec_res_value = {0};
-
-                if (op == ReductionOperation::ARG_IDX_MAX || op == ReductionOperation::ARG_IDX_MIN ||
-                    op == ReductionOperation::MIN || op == ReductionOperation::MAX)
+                AccVec v[4];
+                load(in + x, v);
+                for (int i = 0; i < 4; ++i)
                 {
-                    vec_res_value = wrapper::vdup_n(*input_ptr, wrapper::traits::vector_128_tag{});
+                    AccT *a = acc + x + 4 * i;
+                    wrapper::vstore(a, Op::vec(wrapper::vloadq(a), v[i]));
                 }
+            }
+            for (; x < len; ++x)
+            {
+                acc[x] = Op::scalar(acc[x], load(in[x]));
+            }
+        });
+}
 
-                uint32x4x4_t vec_res_idx{{0}};
-                // Compute window_step_x elements per iteration
-                int x = window_start_x;
-                for (; x <= (window_end_x - window_step_x); x += window_step_x)
+/** Find the index of the extremum along the single reduced axis above X for @p len consecutive X elements */
+template <typename Op, typename T, typename AccT, typename Load>
+void arg_reduce_rows_block(
+    const uint8_t *src_ptr, const ReducedRows &rows, int len, const Load &load, AccT *acc, uint32_t *idx)
+{
+    using AccVec = typename wrapper::traits::neon_vector<AccT, 4>::type;
+
+    std::fill_n(acc, len, Op::template identity<AccT>());
+    std::fill_n(idx, len, 0U);
+    rows.for_each(
+        [&](size_t offset, size_t r)
+        {
+            const auto      *in = reinterpret_cast<const T *>(src_ptr + offset);
+            const uint32x4_t vr = vdupq_n_u32(static_cast<uint32_t>(r));
+            int              x  = 0;
+            for (; x <= len - reduction_step; x += reduction_step)
+            {
+                AccVec v[4];
+                load(in + x, v);
+                for (int i = 0; i < 4; ++i)
                 {
-                    const auto vec_elements = wrapper::vloadq(input_ptr + x);
-                    switch (op)
-                    {
-                        case ReductionOperation::SUM:
-                        case ReductionOperation::MEAN_SUM:
-                        {
-                            const auto temp16x8t_1 = wrapper::vmovl(wrapper::vgetlow(vec_elements));
-                            const auto temp16x8t_2 = wrapper::vmovl(wrapper::vgethigh(vec_elements));
-
-                            const auto temp32x4t_1 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_1));
-                            const auto temp32x4t_2 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_1));
-                            const auto temp32x4t_3 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_2));
-                            const auto temp32x4t_4 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_2));
-
-                            vec_res_value1 = wrapper::vadd(temp32x4t_1, vec_res_value1);
-                            vec_res_value2 = wrapper::vadd(temp32x4t_2, vec_res_value2);
-                            vec_res_value3 = wrapper::vadd(temp32x4t_3, vec_res_value3);
-                            vec_res_value4 = wrapper::vadd(temp32x4t_4, vec_res_value4);
-                            break;
-                        }
-                        case ReductionOperation::PROD:
-                        {
-                            const auto offset32x4f_4 = vdupq_n_f32(iq_info.offset);
-                            const auto scale32x4f_4  = vdupq_n_f32(iq_info.scale);
-
-                            const auto temp16x8t_1 = wrapper::vmovl(wrapper::vgetlow(vec_elements));
-                            const auto temp16x8t_2 = wrapper::vmovl(wrapper::vgethigh(vec_elements));
-
-                            const auto temp32x4t_1 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_1));
-                            const auto temp32x4t_2 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_1));
-                            const auto temp32x4t_3 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_2));
-                            const auto temp32x4t_4 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_2));
-
-                            auto temp32x4f_1 = wrapper::vcvt<float>(temp32x4t_1);
-                            auto temp32x4f_2 = wrapper::vcvt<float>(temp32x4t_2);
-                            auto temp32x4f_3 = wrapper::vcvt<float>(temp32x4t_3);
-                            auto temp32x4f_4 = wrapper::vcvt<float>(temp32x4t_4);
-
-                            //de-quantize vec_elements
-                            temp32x4f_1 = vmulq_f32(vsubq_f32(temp32x4f_1, offset32x4f_4), scale32x4f_4);
-                            temp32x4f_2 = vmulq_f32(vsubq_f32(temp32x4f_2, offset32x4f_4), scale32x4f_4);
-                            temp32x4f_3 = vmulq_f32(vsubq_f32(temp32x4f_3, offset32x4f_4), scale32x4f_4);
-                            temp32x4f_4 = vmulq_f32(vsubq_f32(temp32x4f_4, offset32x4f_4), scale32x4f_4);
-
-                            vec_res_value1_f = vmulq_f32(temp32x4f_1, vec_res_value1_f);
-                            vec_res_value2_f = vmulq_f32(temp32x4f_2, vec_res_value2_f);
-                            vec_res_value3_f = vmulq_f32(temp32x4f_3, vec_res_value3_f);
-                            vec_res_value4_f = vmulq_f32(temp32x4f_4, vec_res_value4_f);
-                            break;
-                        }
-                        case ReductionOperation::ARG_IDX_MIN:
-                        {
-                            auto temp_vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                            vec_res_idx             = calculate_index_quantized<decltype(vec_res_value)>(
-                                x, temp_vec_res_value, vec_res_value, vec_res_idx, op, 0);
-                            vec_res_value = temp_vec_res_value;
-                            break;
-                        }
-                        case ReductionOperation::ARG_IDX_MAX:
-                        {
-                            auto temp_vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                            vec_res_idx             = calculate_index_quantized<decltype(vec_res_value)>(
-                                x, temp_vec_res_value, vec_res_value, vec_res_idx, op, 0);
-                            vec_res_value = temp_vec_res_value;
-                            break;
-                        }
-                        case ReductionOperation::MIN:
-                        {
-                            vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                            break;
-                        }
-                        case ReductionOperation::MAX:
-                        {
-                            vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                            break;
-                        }
-                        default:
-                            ARM_COMPUTE_ERROR("Not supported");
-                    }
+                    AccT            *a    = acc + x + 4 * i;
+                    uint32_t        *ia   = idx + x + 4 * i;
+                    const AccVec     va   = wrapper::vloadq(a);
+                    const uint32x4_t mask = Op::is_better_vec(v[i], va);
+                    wrapper::vstore(a, wrapper::vbsl(mask, v[i], va));
+                    wrapper::vstore(ia, wrapper::vbsl(mask, vr, wrapper::vloadq(ia)));
                 }
-
-                switch (op)
+            }
+            for (; x < len; ++x)
+            {
+                const AccT value = load(in[x]);
+                if (Op::is_better(value, acc[x]))
                 {
-                    case ReductionOperation::ARG_IDX_MIN:
-                    {
-                        auto idx =
-                            calculate_vector_index_quantized<decltype(vec_res_value)>(vec_res_idx, vec_res_value, op);
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_min(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            if (*(input_ptr + x) < res)
-                            {
-                                idx = x;
-                                res = *(input_ptr + x);
-                            }
-                        }
-                        *(reinterpret_cast<uint32_t *>(output.ptr())) = idx;
-                        break;
-                    }
-                    case ReductionOperation::ARG_IDX_MAX:
-                    {
-                        auto idx =
-                            calculate_vector_index_quantized<decltype(vec_res_value)>(vec_res_idx, vec_res_value, op);
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_max(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            if (*(input_ptr + x) > res)
-                            {
-                                idx = x;
-                                res = *(input_ptr + x);
-                            }
-                        }
-                        *(reinterpret_cast<uint32_t *>(output.ptr())) = idx;
-                        break;
-                    }
-                    case ReductionOperation::MIN:
-                    {
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_min(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            res = *(input_ptr + x) < res ? *(input_ptr + x) : res;
-                        }
-                        *(reinterpret_cast<T *>(output.ptr())) = res;
-                        break;
-                    }
-                    case ReductionOperation::MAX:
-                    {
-                        auto res = static_cast<T>(wrapper::vgetlane(calculate_max(vec_res_value), 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            res = *(input_ptr + x) > res ? *(input_ptr + x) : res;
-                        }
-                        *(reinterpret_cast<T *>(output.ptr())) = res;
-                        break;
-                    }
-                    case ReductionOperation::PROD:
-                    {
-                        auto carry_res = wrapper::vmul(vec_res_value1_f, vec_res_value2_f);
-                        carry_res      = wrapper::vmul(carry_res, vec_res_value3_f);
-                        carry_res      = wrapper::vmul(carry_res, vec_res_value4_f);
-
-                        float res = wrapper::vgetlane(carry_res, 0);
-                        res *= wrapper::vgetlane(carry_res, 1);
-                        res *= wrapper::vgetlane(carry_res, 2);
-                        res *= wrapper::vgetlane(carry_res, 3);
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            //de-quantize input
-                            if (std::is_same<T, uint8_t>::value)
-                            {
-                                res *= dequantize_qasymm8(*(input_ptr + x), iq_info);
-                            }
-                            else
-                            {
-                                res *= dequantize_qasymm8_signed(*(input_ptr + x), iq_info);
-                            }
-                        }
-
-                        //re-quantize result
-                        if (std::is_same<T, uint8_t>::value)
-                        {
-                            res = quantize_qasymm8(res, iq_info);
-                        }
-                        else
-                        {
-                            res = quantize_qasymm8_signed(res, iq_info);
-                        }
-
-                        *reinterpret_cast<T *>(output.ptr()) = static_cast<T>(res);
-                        break;
-                    }
-                    case ReductionOperation::SUM:
-                    case ReductionOperation::MEAN_SUM:
-                    {
-                        auto carry_res = wrapper::vadd(vec_res_value1, vec_res_value2);
-                        carry_res      = wrapper::vadd(carry_res, vec_res_value3);
-                        carry_res      = wrapper::vadd(carry_res, vec_res_value4);
-
-                        auto carry_paddition =
-                            wrapper::vpadd(wrapper::vgethigh(carry_res), wrapper::vgetlow(carry_res));
-                        carry_paddition = wrapper::vpadd(carry_paddition, carry_paddition);
-                        auto res        = static_cast<int32_t>(wrapper::vgetlane(carry_paddition, 0));
-
-                        // Compute left-over elements
-                        for (; x < window_end_x; ++x)
-                        {
-                            res += *(input_ptr + x);
-                        }
-
-                        if (op == ReductionOperation::MEAN_SUM)
-                        {
-                            const float resFinal                 = A * (static_cast<float>(res)) + B;
-                            *reinterpret_cast<T *>(output.ptr()) = utils::cast::saturate_cast<T>(resFinal);
-                        }
-                        else
-                        {
-                            // Subtract accumulated offsets
-                            res -= (in_info.dimension(0) - 1) * iq_info.offset;
-                            *reinterpret_cast<T *>(output.ptr()) = utils::cast::saturate_cast<T>(res);
-                        }
-
-                        break;
-                    }
-                    default:
-                        ARM_COMPUTE_ERROR("Not supported");
+                    acc[x] = value;
+                    idx[x] = static_cast<uint32_t>(r);
                 }
-            },
-            input, output);
-    }
-};
+            }
+        });
+}
 
-template <typename T, int S>
-struct RedOpYZW
+/** Reduce the axes of @p axis_mask for the destination elements covered by @p window
+ *
+ * @param[in] finalize Function converting an accumulator to the destination type
+ */
+template <typename Op, typename T, typename AccT, typename Load, typename Finalize>
+void reduce_window(const ITensor   *src,
+                   ITensor         *dst,
+                   uint32_t         axis_mask,
+                   bool             keep_dims,
+                   const Window    &window,
+                   const Load      &load,
+                   const Finalize  &finalize)
 {
-    /** SIMD vector tag type. */
-    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
-    using neon_vector  = typename wrapper::traits::neon_vector<T, S>::type;
+    const ITensorInfo &src_info = *src->info();
+    const ReducedRows  rows(src_info, axis_mask);
 
-    inline void operator()(const Window            &in_window,
-                           Window                  &out_window,
-                           const ITensor           *in,
-                           ITensor                 *out,
-                           int                      axis,
-                           const ReductionOperation op)
+    if ((axis_mask & 1U) != 0)
     {
-        const TensorInfo in_info            = *(in->info());
-        const int        window_step_x      = 16 / sizeof(T);
-        const auto       window_start_x_tmp = static_cast<int>(in_window.x().start());
-        const auto       window_end_x_tmp   = static_cast<int>(in_window.x().end());
-        // As it split over x-axis, need to set the correct spiltted window start and end.
-        const auto window_start_x = static_cast<int>(0);
-        const auto window_end_x   = static_cast<int>(in_window.shape().x());
-
-        Window in_win_no_pad = in_window;
-        in_win_no_pad.set(Window::DimX, Window::Dimension(window_start_x_tmp, window_end_x_tmp, in_window.shape().x()));
-        Window out_win_no_pad = out_window;
-        out_win_no_pad.set(Window::DimX,
-                           Window::Dimension(window_start_x_tmp, window_end_x_tmp, out_window.shape().x()));
-
-        Iterator input(in, in_win_no_pad);
-        Iterator output(out, out_win_no_pad);
-
-        execute_window_loop(
-            in_win_no_pad,
-            [&](const Coordinates &)
-            {
-                const auto input_ptr = reinterpret_cast<T *>(input.ptr());
-
-                // Compute window_step_x elements per iteration
-                int x = window_start_x;
-                for (; x <= (window_end_x - window_step_x); x += window_step_x)
-                {
-                    neon_vector vec_res_value = {0};
-                    switch (op)
-                    {
-                        case ReductionOperation::ARG_IDX_MAX:
-                        case ReductionOperation::ARG_IDX_MIN:
-                        case ReductionOperation::MIN:
-                        case ReductionOperation::MAX:
-                        {
-                            vec_res_value = wrapper::vloadq(input_ptr + x);
-                            break;
-                        }
-                        case ReductionOperation::PROD:
-                        {
-                            vec_res_value = wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{});
-                            break;
-                        }
-                        default:
-                        {
-                            vec_res_value = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
-                            break;
-                        }
-                    }
-                    uint32x4x4_t vec_res_idx{{0}};
-
-                    for (unsigned int dim = 0; dim < in_info.dimension(axis); ++dim)
-                    {
-                        const T *in_ptr =
-                            reinterpret_cast<T *>(input.ptr() + x * sizeof(T) + in_info.strides_in_bytes()[axis] * dim);
-                        const auto vec_elements = wrapper::vloadq(in_ptr);
-                        switch (op)
-                        {
-                            case ReductionOperation::SUM:
-                            case ReductionOperation::MEAN_SUM:
-                                vec_res_value = wrapper::vadd(vec_elements, vec_res_value);
-                                break;
-                            case ReductionOperation::SUM_SQUARE:
-                                vec_res_value = wrapper::vadd(wrapper::vmul(vec_elements, vec_elements), vec_res_value);
-                                break;
-                            case ReductionOperation::PROD:
-                                vec_res_value = wrapper::vmul(vec_elements, vec_res_value);
-                                break;
-                            case ReductionOperation::ARG_IDX_MIN:
-                            {
-                                auto temp_vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                                vec_res_idx =
-                                    calculate_index(dim, temp_vec_res_value, vec_res_value, vec_res_idx, op, axis);
-                                vec_res_value = temp_vec_res_value;
-                                break;
-                            }
-                            case ReductionOperation::ARG_IDX_MAX:
-                            {
-                                auto temp_vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                                vec_res_idx =
-                                    calculate_index(dim, temp_vec_res_value, vec_res_value, vec_res_idx, op, axis);
-                                vec_res_value = temp_vec_res_value;
-                                break;
-                            }
-                            case ReductionOperation::MIN:
-                            {
-                                vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                                break;
-                            }
-                            case ReductionOperation::MAX:
-                            {
-                                vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                                break;
-                            }
-                            default:
-                                ARM_COMPUTE_ERROR("Not supported");
-                        }
-                    }
-
-                    if (op == ReductionOperation::MEAN_SUM)
-                    {
-                        auto vec_width_inv =
-                            wrapper::vinv(wrapper::vdup_n(static_cast<T>(in_info.dimension(axis)), ExactTagType{}));
-                        vec_res_value = wrapper::vmul(vec_res_value, vec_width_inv);
-                    }
-
-                    if (op == ReductionOperation::ARG_IDX_MIN || op == ReductionOperation::ARG_IDX_MAX)
-                    {
-                        wrapper::vstore(reinterpret_cast<uint32_t *>(output.ptr()) + x, vec_res_idx.val[0]);
-#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-                        if (std::is_same<T, float16_t>::value)
-                        {
-                            wrapper::vstore(reinterpret_cast<uint32_t *>(output.ptr()) + x + 4, vec_res_idx.val[1]);
-                        }
-#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-                    }
-                    else
-                    {
-                        wrapper::vstore(reinterpret_cast<T *>(output.ptr() + x * sizeof(T)), vec_res_value);
-                    }
-                }
-
-                // Compute left-over elements
-                for (; x < window_end_x; ++x)
-                {
-                    auto res_value = 0.f;
-                    switch (op)
-                    {
-                        case ReductionOperation::ARG_IDX_MAX:
-                        case ReductionOperation::ARG_IDX_MIN:
-                        case ReductionOperation::MIN:
-                        case ReductionOperation::MAX:
-                        {
-                            res_value = *(input_ptr + x);
-                            break;
-                        }
-                        case ReductionOperation::PROD:
-                        {
-                            res_value = static_cast<T>(1.f);
-                            break;
-                        }
-                        default:
-                        {
-                            res_value = static_cast<T>(0.f);
-                            break;
-                        }
-                    }
-
-                    uint32_t res_idx = 0;
-                    for (unsigned int dim = 0; dim < in_info.dimension(axis); ++dim)
-                    {
-                        const T *in_ptr =
-                            reinterpret_cast<T *>(input.ptr() + x * sizeof(T) + in_info.strides_in_bytes()[axis] * dim);
-
-                        switch (op)
-                        {
-                            case ReductionOperation::SUM:
-                            case ReductionOperation::MEAN_SUM:
-                                res_value += *in_ptr;
-                                break;
-                            case ReductionOperation::SUM_SQUARE:
-                                res_value += *in_ptr * *in_ptr;
-                                break;
-                            case ReductionOperation::PROD:
-                                res_value *= *in_ptr;
-                                break;
-                            case ReductionOperation::ARG_IDX_MIN:
-                            {
-                                if (*in_ptr < res_value)
-                                {
-                                    res_value = *in_ptr;
-                                    res_idx   = dim;
-                                }
-                                break;
-                            }
-                            case ReductionOperation::ARG_IDX_MAX:
-                            {
-                                if (*in_ptr > res_value)
-                                {
-                                    res_value = *in_ptr;
-                                    res_idx   = dim;
-                                }
-                                break;
-                            }
-                            case ReductionOperation::MIN:
-                            {
-                                res_value = *in_ptr < res_value ? *in_ptr : res_value;
-                                break;
-                            }
-                            case ReductionOperation::MAX:
-                            {
-                                res_value = *in_ptr > res_value ? *in_ptr : res_value;
-                                break;
-                            }
-                            default:
-                                ARM_COMPUTE_ERROR("Not supported");
-                        }
-                    }
-
-                    if (op == ReductionOperation::MEAN_SUM)
-                    {
-                        res_value /= in_info.dimension(axis);
-                    }
-
-                    if (op == ReductionOperation::ARG_IDX_MIN || op == ReductionOperation::ARG_IDX_MAX)
-                    {
-                        *(reinterpret_cast<uint32_t *>(output.ptr()) + x) = res_idx;
-                    }
-                    else
-                    {
-                        *(reinterpret_cast<T *>(output.ptr() + x * sizeof(T))) = res_value;
-                    }
-                }
-            },
-            input, output);
+        const int len = static_cast<int>(src_info.dimension(0));
+        for_each_reduction_row(src, dst, axis_mask, keep_dims, window,
+                               [&](const uint8_t *src_ptr, uint8_t *dst_ptr)
+                               {
+                                   *reinterpret_cast<T *>(dst_ptr) =
+                                       finalize(reduce_rows_x<Op, T, AccT>(src_ptr, rows, len, load));
+                               });
+        return;
     }
-};
 
-template <typename T, int S, int axis, ReductionOperation op>
-struct RedOpYZW_complex
+    // Interleaved channels are reduced independently, so they are processed as consecutive X elements
+    const int num_channels   = static_cast<int>(src_info.num_channels());
+    const int window_start_x = static_cast<int>(window.x().start()) * num_channels;
+    const int window_end_x   = static_cast<int>(window.x().end()) * num_channels;
+
+    alignas(16) AccT acc[reduction_block_x];
+    for_each_reduction_row(src, dst, axis_mask, keep_dims, window,
+                           [&](const uint8_t *src_ptr, uint8_t *dst_ptr)
+                           {
+                               auto *out = reinterpret_cast<T *>(dst_ptr);
+                               for (int x = window_start_x; x < window_end_x; x += reduction_block_x)
+                               {
+                                   const int len = std::min(reduction_block_x, window_end_x - x);
+                                   reduce_rows_block<Op, T>(src_ptr + x * sizeof(T), rows, len, load, acc);
+                                   for (int i = 0; i < len; ++i)
+                                   {
+                                       out[x + i] = finalize(acc[i]);
+                                   }
+                               }
+                           });
+}
+
+/** Compute the index of the extremum along the single axis of @p axis_mask, the first one on ties */
+template <typename Op, typename T, typename AccT, typename Load>
+void arg_reduce_window(
+    const ITensor *src, ITensor *dst, uint32_t axis_mask, bool keep_dims, const Window &window, const Load &load)
 {
-    /** SIMD vector tag type. */
-    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
-    using neon_vector  = typename wrapper::traits::neon_vector<T, S>::type;
+    const ITensorInfo &src_info = *src->info();
+    const ReducedRows  rows(src_info, axis_mask);
 
-    inline void operator()(
-        const Window &in_window, Window &out_window, const ITensor *in, ITensor *out, int, const ReductionOperation)
+    if ((axis_mask & 1U) != 0)
     {
-        ARM_COMPUTE_ERROR_ON(axis != 2);
-        ARM_COMPUTE_ERROR_ON(op != ReductionOperation::SUM);
+        // Find the extremum with full vectors first, then the first element equal to it
+        const int len = static_cast<int>(src_info.dimension(0));
+        for_each_reduction_row(src, dst, axis_mask, keep_dims, window,
+                               [&](const uint8_t *src_ptr, uint8_t *dst_ptr)
+                               {
+                                   const AccT  best = reduce_rows_x<Op, T, AccT>(src_ptr, rows, len, load);
+                                   const auto *in   = reinterpret_cast<const T *>(src_ptr);
+                                   uint32_t    idx  = 0;
+                                   for (int x = 0; x < len; ++x)
+                                   {
+                                       if (load(in[x]) == best)
+                                       {
+                                           idx = static_cast<uint32_t>(x);
+                                           break;
+                                       }
+                                   }
+                                   *reinterpret_cast<uint32_t *>(dst_ptr) = idx;
+                               });
+        return;
+    }
 
-        const TensorInfo in_info            = *(in->info());
-        const size_t     stride_z           = in_info.strides_in_bytes()[axis];
-        const int        window_step_x      = 16 / sizeof(T);
-        const auto       window_start_x_tmp = static_cast<int>(in_window.x().start());
-        const auto       window_end_x_tmp   = static_cast<int>(in_window.x().end());
-        // As it split over x-axis, need to set the correct spiltted window start and end.
-        const auto window_start_x = static_cast<int>(0);
-        const auto window_end_x   = static_cast<int>(in_window.shape().x());
+    const int window_start_x = static_cast<int>(window.x().start());
+    const int window_end_x   = static_cast<int>(window.x().end());
+
+    alignas(16) AccT     acc[reduction_block_x];
+    alignas(16) uint32_t idx[reduction_block_x];
+    for_each_reduction_row(src, dst, axis_mask, keep_dims, window,
+                           [&](const uint8_t *src_ptr, uint8_t *dst_ptr)
+                           {
+                               auto *out = reinterpret_cast<uint32_t *>(dst_ptr);
+                               for (int x = window_start_x; x < window_end_x; x += reduction_block_x)
+                               {
+                                   const int len = std::min(reduction_block_x, window_end_x - x);
+                                   arg_reduce_rows_block<Op, T>(src_ptr + x * sizeof(T), rows, len, load, acc, idx);
+                                   std::copy_n(idx, len, out + x);
+                               }
+                           });
+}
 
-        Window in_win_no_pad = in_window;
-        in_win_no_pad.set(Window::DimX, Window::Dimension(window_start_x_tmp, window_end_x_tmp, in_window.shape().x()));
-        Window out_win_no_pad = out_window;
-        out_win_no_pad.set(Window::DimX,
-                           Window::Dimension(window_start_x_tmp, window_end_x_tmp, out_window.shape().x()));
+/** Reduce every chunk of X covered by @p window into @p partials
+ *
+ * The window iterates over the chunks along X. Each partial result takes two 32-bit slots of @p partials: the
+ * accumulator and, for the index operations, the index of the extremum in the chunk.
+ */
+template <typename Op, typename T, typename AccT, typename Load>
+void partial_reduce_window(const ITensor *src,
+                           ITensor       *partials,
+                           uint32_t       axis_mask,
+                           bool           is_arg,
+                           const Window  &window,
+                           const Load    &load)
+{
+    const ITensorInfo &src_info      = *src->info();
+    const ITensorInfo &partials_info = *partials->info();
+    const ReducedRows  rows(src_info, axis_mask);
+
+    // The chunk length only depends on the shapes, so the partial results do not depend on the number of threads
+    const int len        = static_cast<int>(src_info.dimension(0));
+    const int num_chunks = static_cast<int>(partials_info.dimension(0) / 2);
+    const int chunk_len  = DIV_CEIL(len, num_chunks);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const uint8_t *src_ptr = src->buffer() + src_info.offset_first_element_in_bytes();
+            uint8_t       *out_ptr = partials->buffer() + partials_info.offset_first_element_in_bytes();
+            for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+            {
+                src_ptr += id[d] * src_info.strides_in_bytes()[d];
+                out_ptr += id[d] * partials_info.strides_in_bytes()[d];
+            }
 
-        Iterator input(in, in_win_no_pad);
-        Iterator output(out, out_win_no_pad);
+            const int start = id.x() * chunk_len;
+            const int end   = std::min(len, start + chunk_len);
+            auto     *out   = reinterpret_cast<AccT *>(out_ptr) + 2 * id.x();
 
-        execute_window_loop(
-            in_win_no_pad,
-            [&](const Coordinates &)
+            const AccT best = reduce_rows_x<Op, T, AccT>(src_ptr + start * sizeof(T), rows, end - start, load);
+            out[0]          = best;
+            if (is_arg)
             {
-                // Compute window_step_x elements per iteration
-                int x = window_start_x;
-                for (; x <= (window_end_x - window_step_x); x += window_step_x)
+                const auto *in  = reinterpret_cast<const T *>(src_ptr);
+                uint32_t    idx = static_cast<uint32_t>(start);
+                for (int x = start; x < end; ++x)
                 {
-                    neon_vector vec_res_value_0 = {0};
-                    neon_vector vec_res_value_1 = {0};
-
-                    vec_res_value_0 = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
-                    vec_res_value_1 = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
-
-                    T *out_ptr = reinterpret_cast<T *>(output.ptr() + 2 * x * sizeof(T));
-                    for (unsigned int dim = 0; dim < in_info.dimension(axis); ++dim)
+                    if (load(in[x]) == best)
                     {
-                        T *in_ptr_0 = reinterpret_cast<T *>(input.ptr() + 2 * x * sizeof(T) + stride_z * dim);
-                        T *in_ptr_1 = reinterpret_cast<T *>(input.ptr() + 2 * x * sizeof(T) + 16 + stride_z * dim);
-
-                        const auto vec_elements_0 = wrapper::vloadq(in_ptr_0);
-                        const auto vec_elements_1 = wrapper::vloadq(in_ptr_1);
-
-                        vec_res_value_0 = wrapper::vadd(vec_elements_0, vec_res_value_0);
-                        vec_res_value_1 = wrapper::vadd(vec_elements_1, vec_res_value_1);
+                        idx = static_cast<uint32_t>(x);
+                        break;
                     }
-
-                    wrapper::vstore(out_ptr, vec_res_value_0);
-                    wrapper::vstore(out_ptr + 4, vec_res_value_1);
                 }
+                *reinterpret_cast<uint32_t *>(out + 1) = idx;
+            }
+        });
+}
 
-                // Compute left-over elements
-                for (; x < window_end_x; ++x)
-                {
-                    auto res_value_0 = 0.f;
-                    auto res_value_1 = 0.f;
+/** Combine the partial results of every destination element covered by @p window in a fixed tree order
+ *
+ * The partial results of adjacent chunks are combined pairwise, then the results of adjacent pairs and so on, so the
+ * order of the operations only depends on the number of chunks. The partial results are overwritten.
+ */
+template <typename Op, typename T, typename AccT, typename Finalize>
+void combine_partials_window(ITensor        *partials,
+                             ITensor        *dst,
+                             uint32_t        axis_mask,
+                             bool            keep_dims,
+                             bool            is_arg,
+                             const Window   &window,
+                             const Finalize &finalize)
+{
+    const int num_chunks = static_cast<int>(partials->info()->dimension(0) / 2);
+
+    for_each_reduction_row(partials, dst, axis_mask, keep_dims, window,
+                           [&](const uint8_t *partials_ptr, uint8_t *dst_ptr)
+                           {
+                               auto *acc = reinterpret_cast<AccT *>(const_cast<uint8_t *>(partials_ptr));
+                               auto *idx = reinterpret_cast<uint32_t *>(acc);
+                               for (int step = 1; step < num_chunks; step *= 2)
+                               {
+                                   for (int c = 0; c + step < num_chunks; c += 2 * step)
+                                   {
+                                       const int lhs = 2 * c;
+                                       const int rhs = 2 * (c + step);
+                                       if (!is_arg)
+                                       {
+                                           acc[lhs] = Op::scalar(acc[lhs], acc[rhs]);
+                                       }
+                                       else if (Op::is_better(acc[rhs], acc[lhs]))
+                                       {
+                                           // Ties keep the left chunk, which holds the lower index
+                                           acc[lhs]     = acc[rhs];
+                                           idx[lhs + 1] = idx[rhs + 1];
+                                       }
+                                   }
+                               }
+                               if (is_arg)
+                               {
+                                   *reinterpret_cast<uint32_t *>(dst_ptr) = idx[1];
+                               }
+                               else
+                               {
+                                   *reinterpret_cast<T *>(dst_ptr) = finalize(acc[0]);
+                               }
+                           });
+}
 
-                    T *out_ptr = reinterpret_cast<T *>(output.ptr() + 2 * x * sizeof(T));
-                    for (unsigned int dim = 0; dim < in_info.dimension(axis); ++dim)
-                    {
-                        T *in_ptr = reinterpret_cast<T *>(input.ptr() + 2 * x * sizeof(T) + stride_z * dim);
-                        res_value_0 += *in_ptr;
-                        res_value_1 += *(in_ptr + 1);
-                    }
-                    *out_ptr       = res_value_0;
-                    *(out_ptr + 1) = res_value_1;
-                }
-            },
-            input, output);
+/** Run the @p stage of a reduction computing a value, accumulating the elements loaded by @p load in AccT */
+template <typename Op, typename T, typename AccT, typename Load, typename Finalize>
+void reduce_stage(const ITensor  *src,
+                  ITensor        *dst,
+                  ITensor        *partials,
+                  uint32_t        axis_mask,
+                  bool            keep_dims,
+                  ReductionStage  stage,
+                  const Window   &window,
+                  const Load     &load,
+                  const Finalize &finalize)
+{
+    switch (stage)
+    {
+        case ReductionStage::Partial:
+            partial_reduce_window<Op, T, AccT>(src, partials, axis_mask, false, window, load);
+            break;
+        case ReductionStage::Combine:
+            combine_partials_window<Op, T, AccT>(partials, dst, axis_mask, keep_dims, false, window, finalize);
+            break;
+        default:
+            reduce_window<Op, T, AccT>(src, dst, axis_mask, keep_dims, window, load, finalize);
+            break;
     }
-};
+}
 
-template <typename T>
-struct RedOpYZW_quantized
+/** Run the @p stage of a reduction computing the index of an extremum */
+template <typename Op, typename T, typename AccT, typename Load>
+void arg_reduce_stage(const ITensor *src,
+                      ITensor       *dst,
+                      ITensor       *partials,
+                      uint32_t       axis_mask,
+                      bool           keep_dims,
+                      ReductionStage stage,
+                      const Window  &window,
+                      const Load    &load)
 {
-    inline void operator()(const Window            &in_window,
-                           Window                  &out_window,
-                           const ITensor           *in,
-                           ITensor                 *out,
-                           int                      axis,
-                           const ReductionOperation op)
+    switch (stage)
     {
-        const TensorInfo              in_info = *(in->info());
-        const UniformQuantizationInfo iq_info = in_info.quantization_info().uniform();
-        using PromotedType = typename wrapper::traits::promote<typename wrapper::traits::promote<T>::type>::type;
-
-        const auto oq_info = out->info()->quantization_info().uniform();
-
-        const int  window_step_x      = 16 / sizeof(T);
-        const auto window_start_x_tmp = static_cast<int>(in_window.x().start());
-        const auto window_end_x_tmp   = static_cast<int>(in_window.x().end());
-        // As it split over x-axis, need to set the correct spiltted window start and end.
-        const auto window_start_x = static_cast<int>(0);
-        const auto window_end_x   = static_cast<int>(in_window.shape().x());
-
-        Window in_win_no_pad = in_window;
-        in_win_no_pad.set(Window::DimX, Window::Dimension(window_start_x_tmp, window_end_x_tmp, in_window.shape().x()));
-        Window out_win_no_pad = out_window;
-        out_win_no_pad.set(Window::DimX,
-                           Window::Dimension(window_start_x_tmp, window_end_x_tmp, out_window.shape().x()));
-
-        Iterator input(in, in_win_no_pad);
-        Iterator output(out, out_win_no_pad);
-
-        using vector_type =
-            typename wrapper::traits::neon_bitvector<PromotedType, wrapper::traits::BitWidth::W128>::type;
-        using vector_type_f = typename wrapper::traits::neon_vector<float, 4>::type;
-
-        vector_type vec_res_value1{};
-        vector_type vec_res_value2{};
-        vector_type vec_res_value3{};
-        vector_type vec_res_value4{};
-
-        vector_type_f vec_res_value1_f{};
-        vector_type_f vec_res_value2_f{};
-        vector_type_f vec_res_value3_f{};
-        vector_type_f vec_res_value4_f{};
-
-        const float in_offset = static_cast<float>(iq_info.offset);
-        const float in_scale  = iq_info.scale;
-
-        const float out_offset = static_cast<float>(oq_info.offset);
-        const float out_scale  = oq_info.scale;
-
-        const float num_elements = static_cast<float>(in_info.dimension(axis));
-
-        const float A = in_scale / (out_scale * num_elements);
-        const float B = out_offset - (in_scale * in_offset) / (out_scale);
-
-        const auto vec_A = wrapper::vdup_n(static_cast<float>(A), wrapper::traits::vector_128_tag{});
-        const auto vec_B = wrapper::vdup_n(static_cast<float>(B), wrapper::traits::vector_128_tag{});
-
-        execute_window_loop(
-            in_win_no_pad,
-            [&](const Coordinates &)
-            {
-                const auto input_ptr = reinterpret_cast<T *>(input.ptr());
-
-                // Compute window_step_x elements per iteration
-                int x = window_start_x;
-                for (; x <= (window_end_x - window_step_x); x += window_step_x)
-                {
-                    uint32x4x4_t vec_res_idx{{0}};
-                    vec_res_value1 = wrapper::vdup_n(static_cast<PromotedType>(0), wrapper::traits::vector_128_tag{});
-                    vec_res_value2 = wrapper::vdup_n(static_cast<PromotedType>(0), wrapper::traits::vector_128_tag{});
-                    vec_res_value3 = wrapper::vdup_n(static_cast<PromotedType>(0), wrapper::traits::vector_128_tag{});
-                    vec_res_value4 = wrapper::vdup_n(static_cast<PromotedType>(0), wrapper::traits::vector_128_tag{});
-
-                    vec_res_value1_f = wrapper::vdup_n(static_cast<float>(1), wrapper::traits::vector_128_tag{});
-                    vec_res_value2_f = wrapper::vdup_n(static_cast<float>(1), wrapper::traits::vector_128_tag{});
-                    vec_res_value3_f = wrapper::vdup_n(static_cast<float>(1), wrapper::traits::vector_128_tag{});
-                    vec_res_value4_f = wrapper::vdup_n(static_cast<float>(1), wrapper::traits::vector_128_tag{});
-
-                    auto vec_res_value = wrapper::vloadq(input_ptr + x);
-
-                    for (unsigned int index_dim = 0; index_dim < in_info.dimension(axis); ++index_dim)
-                    {
-                        const T   *in_ptr       = input_ptr + x + in_info.strides_in_bytes()[axis] * index_dim;
-                        const auto vec_elements = wrapper::vloadq(in_ptr);
-                        switch (op)
-                        {
-                            case ReductionOperation::SUM:
-                            case ReductionOperation::MEAN_SUM:
-                            {
-                                const auto temp16x8t_1 = wrapper::vmovl(wrapper::vgetlow(vec_elements));
-                                const auto temp16x8t_2 = wrapper::vmovl(wrapper::vgethigh(vec_elements));
-
-                                const auto temp32x4t_1 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_1));
-                                const auto temp32x4t_2 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_1));
-                                const auto temp32x4t_3 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_2));
-                                const auto temp32x4t_4 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_2));
-
-                                vec_res_value1 = wrapper::vadd(temp32x4t_1, vec_res_value1);
-                                vec_res_value2 = wrapper::vadd(temp32x4t_2, vec_res_value2);
-                                vec_res_value3 = wrapper::vadd(temp32x4t_3, vec_res_value3);
-                                vec_res_value4 = wrapper::vadd(temp32x4t_4, vec_res_value4);
-                                break;
-                            }
-                            case ReductionOperation::PROD:
-                            {
-                                const auto offset32x4f_4 = wrapper::vdup_n(static_cast<float>(iq_info.offset),
-                                                                           wrapper::traits::vector_128_tag{});
-                                const auto scale32x4f_4 =
-                                    wrapper::vdup_n(iq_info.scale, wrapper::traits::vector_128_tag{});
-
-                                const auto temp16x8t_1 = wrapper::vmovl(wrapper::vgetlow(vec_elements));
-                                const auto temp16x8t_2 = wrapper::vmovl(wrapper::vgethigh(vec_elements));
-
-                                const auto temp32x4t_1 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_1));
-                                const auto temp32x4t_2 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_1));
-                                const auto temp32x4t_3 = wrapper::vmovl(wrapper::vgetlow(temp16x8t_2));
-                                const auto temp32x4t_4 = wrapper::vmovl(wrapper::vgethigh(temp16x8t_2));
-
-                                auto temp32x4f_1 = wrapper::vcvt<float>(temp32x4t_1);
-                                auto temp32x4f_2 = wrapper::vcvt<float>(temp32x4t_2);
-                                auto temp32x4f_3 = wrapper::vcvt<float>(temp32x4t_3);
-                                auto temp32x4f_4 = wrapper::vcvt<float>(temp32x4t_4);
-
-                                //de-quantize vec_elements
-                                temp32x4f_1 = wrapper::vmul(wrapper::vsub(temp32x4f_1, offset32x4f_4), scale32x4f_4);
-                                temp32x4f_2 = wrapper::vmul(wrapper::vsub(temp32x4f_2, offset32x4f_4), scale32x4f_4);
-                                temp32x4f_3 = wrapper::vmul(wrapper::vsub(temp32x4f_3, offset32x4f_4), scale32x4f_4);
-                                temp32x4f_4 = wrapper::vmul(wrapper::vsub(temp32x4f_4, offset32x4f_4), scale32x4f_4);
-
-                                vec_res_value1_f = wrapper::vmul(temp32x4f_1, vec_res_value1_f);
-                                vec_res_value2_f = wrapper::vmul(temp32x4f_2, vec_res_value2_f);
-                                vec_res_value3_f = wrapper::vmul(temp32x4f_3, vec_res_value3_f);
-                                vec_res_value4_f = wrapper::vmul(temp32x4f_4, vec_res_value4_f);
-                                break;
-                            }
-                            case ReductionOperation::ARG_IDX_MIN:
-                            {
-                                auto temp_vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                                vec_res_idx   = calculate_index_quantized(index_dim, temp_vec_res_value, vec_res_value,
-                                                                          vec_res_idx, op, axis);
-                                vec_res_value = temp_vec_res_value;
-                                break;
-                            }
-                            case ReductionOperation::ARG_IDX_MAX:
-                            {
-                                auto temp_vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                                vec_res_idx   = calculate_index_quantized(index_dim, temp_vec_res_value, vec_res_value,
-                                                                          vec_res_idx, op, axis);
-                                vec_res_value = temp_vec_res_value;
-                                break;
-                            }
-                            case ReductionOperation::MIN:
-                            {
-                                vec_res_value = wrapper::vmin(vec_elements, vec_res_value);
-                                break;
-                            }
-                            case ReductionOperation::MAX:
-                            {
-                                vec_res_value = wrapper::vmax(vec_elements, vec_res_value);
-                                break;
-                            }
-                            default:
-                                ARM_COMPUTE_ERROR("Not supported");
-                        }
-                    }
-
-                    switch (op)
-                    {
-                        case ReductionOperation::ARG_IDX_MIN:
-                        case ReductionOperation::ARG_IDX_MAX:
-                        {
-                            wrapper::vstore(reinterpret_cast<uint32_t *>(output.ptr() + 4 * x), vec_res_idx.val[0]);
-                            wrapper::vstore(reinterpret_cast<uint32_t *>(output.ptr() + 4 * x) + 4, vec_res_idx.val[1]);
-                            wrapper::vstore(reinterpret_cast<uint32_t *>(output.ptr() + 4 * x) + 8, vec_res_idx.val[2]);
-                            wrapper::vstore(reinterpret_cast<uint32_t *>(output.ptr() + 4 * x) + 12,
-                                            vec_res_idx.val[3]);
-                            break;
-                        }
-                        case ReductionOperation::MIN:
-                        case ReductionOperation::MAX:
-                        {
-                            wrapper::vstore(reinterpret_cast<T *>(output.ptr() + x), vec_res_value);
-                            break;
-                        }
-                        case ReductionOperation::SUM:
-                        {
-                            // Subtract offsets
-                            auto offsets = vdupq_n_s32((in_info.dimension(axis) - 1) * iq_info.offset);
-
-                            auto vec_res_s_value1 = wrapper::vreinterpret(vec_res_value1);
-                            auto vec_res_s_value2 = wrapper::vreinterpret(vec_res_value2);
-                            auto vec_res_s_value3 = wrapper::vreinterpret(vec_res_value3);
-                            auto vec_res_s_value4 = wrapper::vreinterpret(vec_res_value4);
-
-                            vec_res_s_value1 = wrapper::vsub(vec_res_s_value1, offsets);
-                            vec_res_s_value2 = wrapper::vsub(vec_res_s_value2, offsets);
-                            vec_res_s_value3 = wrapper::vsub(vec_res_s_value3, offsets);
-                            vec_res_s_value4 = wrapper::vsub(vec_res_s_value4, offsets);
-
-                            const auto temp16x8t_1 =
-                                wrapper::vcombine(wrapper::vqmovn(vec_res_s_value1), wrapper::vqmovn(vec_res_s_value2));
-                            const auto temp16x8t_2 =
-                                wrapper::vcombine(wrapper::vqmovn(vec_res_s_value3), wrapper::vqmovn(vec_res_s_value4));
-
-                            combine_and_store<T>(temp16x8t_1, temp16x8t_2, output, x);
-                            break;
-                        }
-                        case ReductionOperation::MEAN_SUM:
-                        {
-                            vec_res_value1_f = wrapper::vmla(vec_B, wrapper::vcvt<float>(vec_res_value1), vec_A);
-                            vec_res_value2_f = wrapper::vmla(vec_B, wrapper::vcvt<float>(vec_res_value2), vec_A);
-                            vec_res_value3_f = wrapper::vmla(vec_B, wrapper::vcvt<float>(vec_res_value3), vec_A);
-                            vec_res_value4_f = wrapper::vmla(vec_B, wrapper::vcvt<float>(vec_res_value4), vec_A);
-
-#ifdef __aarch64__
-                            vec_res_value1 = wrapper::vcvtn<PromotedType>(vec_res_value1_f);
-                            vec_res_value2 = wrapper::vcvtn<PromotedType>(vec_res_value2_f);
-                            vec_res_value3 = wrapper::vcvtn<PromotedType>(vec_res_value3_f);
-                            vec_res_value4 = wrapper::vcvtn<PromotedType>(vec_res_value4_f);
-#else  // defined(__aarch64__)
-                            vec_res_value1    = wrapper::vcvt<PromotedType>(vec_res_value1_f);
-                            vec_res_value2    = wrapper::vcvt<PromotedType>(vec_res_value2_f);
-                            vec_res_value3    = wrapper::vcvt<PromotedType>(vec_res_value3_f);
-                            vec_res_value4    = wrapper::vcvt<PromotedType>(vec_res_value4_f);
-#endif // __aarch64__
-
-                            const auto temp16x8t_1 =
-                                wrapper::vcombine(wrapper::vqmovn(vec_res_value1), wrapper::vqmovn(vec_res_value2));
-                            const auto temp16x8t_2 =
-                                wrapper::vcombine(wrapper::vqmovn(vec_res_value3), wrapper::vqmovn(vec_res_value4));
-                            auto res = wrapper::vcombine(wrapper::vqmovn(temp16x8t_1), wrapper::vqmovn(temp16x8t_2));
-
-                            wrapper::vstore(reinterpret_cast<T *>(output.ptr() + x), res);
-                            break;
-                        }
-                        case ReductionOperation::PROD:
-                        {
-                            const auto offset32x4f_4 =
-                                wrapper::vdup_n(static_cast<float>(iq_info.offset), wrapper::traits::vector_128_tag{});
-                            const auto iscale32x4f_4 = vinvq_f32(vdupq_n_f32(iq_info.scale));
-
-                            //re-quantize
-                            vec_res_value1_f =
-                                wrapper::vadd(wrapper::vmul(vec_res_value1_f, iscale32x4f_4), offset32x4f_4);
-                            vec_res_value2_f =
-                                wrapper::vadd(wrapper::vmul(vec_res_value2_f, iscale32x4f_4), offset32x4f_4);
-                            vec_res_value3_f =
-                                wrapper::vadd(wrapper::vmul(vec_res_value3_f, iscale32x4f_4), offset32x4f_4);
-                            vec_res_value4_f =
-                                wrapper::vadd(wrapper::vmul(vec_res_value4_f, iscale32x4f_4), offset32x4f_4);
-
-                            vec_res_value1 = wrapper::vcvt<T>(vec_res_value1_f);
-                            vec_res_value2 = wrapper::vcvt<T>(vec_res_value2_f);
-                            vec_res_value3 = wrapper::vcvt<T>(vec_res_value3_f);
-                            vec_res_value4 = wrapper::vcvt<T>(vec_res_value4_f);
-
-                            const auto temp16x8t_1 =
-                                wrapper::vcombine(wrapper::vqmovn(vec_res_value1), wrapper::vqmovn(vec_res_value2));
-                            const auto temp16x8t_2 =
-                                wrapper::vcombine(wrapper::vqmovn(vec_res_value3), wrapper::vqmovn(vec_res_value4));
-                            auto res = wrapper::vcombine(wrapper::vqmovn(temp16x8t_1), wrapper::vqmovn(temp16x8t_2));
+        case ReductionStage::Partial:
+            partial_reduce_window<Op, T, AccT>(src, partials, axis_mask, true, window, load);
+            break;
+        case ReductionStage::Combine:
+            combine_partials_window<Op, T, AccT>(partials, dst, axis_mask, keep_dims, true, window,
+                                                 [](AccT acc) { return static_cast<T>(acc); });
+            break;
+        default:
+            arg_reduce_window<Op, T, AccT>(src, dst, axis_mask, keep_dims, window, load);
+            break;
+    }
+}
 
-                            wrapper::vstore(reinterpret_cast<T *>(output.ptr() + x), res);
-                            break;
-                        }
-                        default:
-                            ARM_COMPUTE_ERROR("Not supported");
-                    }
-                }
+/** Run the @p stage of the reduction @p op, accumulating the elements loaded by @p load in AccT */
+template <typename T, typename AccT, typename Load, typename Finalize>
+void reduce_op(const ITensor     *src,
+               ITensor           *dst,
+               ITensor           *partials,
+               ReductionOperation op,
+               uint32_t           axis_mask,
+               bool               keep_dims,
+               ReductionStage     stage,
+               const Window      &window,
+               const Load        &load,
+               const Finalize    &finalize)
+{
+    switch (op)
+    {
+        case ReductionOperation::SUM:
+        case ReductionOperation::MEAN_SUM:
+            reduce_stage<ReduceSum, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load, finalize);
+            break;
+        case ReductionOperation::SUM_SQUARE:
+            reduce_stage<ReduceSumSquare, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load,
+                                                   finalize);
+            break;
+        case ReductionOperation::PROD:
+            reduce_stage<ReduceProd, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load, finalize);
+            break;
+        case ReductionOperation::MIN:
+            reduce_stage<ReduceMin, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load, finalize);
+            break;
+        case ReductionOperation::MAX:
+            reduce_stage<ReduceMax, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load, finalize);
+            break;
+        case ReductionOperation::ARG_IDX_MIN:
+            arg_reduce_stage<ReduceMin, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load);
+            break;
+        case ReductionOperation::ARG_IDX_MAX:
+            arg_reduce_stage<ReduceMax, T, AccT>(src, dst, partials, axis_mask, keep_dims, stage, window, load);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported reduction operation");
+    }
+}
+} // namespace detail
 
-                // Compute left-over elements
-                for (; x < window_end_x; ++x)
-                {
-                    float   res_value   = 0.f;
-                    int32_t res_value_q = 0;
+/** Reduce a floating-point tensor, accumulating in FP32 */
+template <typename T>
+void reduction_fp(const ITensor     *src,
+                  ITensor           *dst,
+                  ITensor           *partials,
+                  ReductionOperation op,
+                  uint32_t           axis_mask,
+                  bool               keep_dims,
+                  ReductionStage     stage,
+                  const Window      &window)
+{
+    const float scale =
+        op == ReductionOperation::MEAN_SUM ? 1.f / detail::reduction_num_elements(*src->info(), axis_mask) : 1.f;
+    detail::reduce_op<T, float>(src, dst, partials, op, axis_mask, keep_dims, stage, window,
+                                detail::ReductionLoad<T, float>(),
+                                [scale](float acc) { return static_cast<T>(acc * scale); });
+}
 
-                    switch (op)
-                    {
-                        case ReductionOperation::ARG_IDX_MAX:
-                        case ReductionOperation::ARG_IDX_MIN:
-                        case ReductionOperation::MIN:
-                        case ReductionOperation::MAX:
-                        {
-                            res_value = *(input_ptr + x);
-                            break;
-                        }
-                        case ReductionOperation::PROD:
-                        {
-                            res_value = static_cast<T>(1.0f);
-                            break;
-                        }
-                        default:
-                        {
-                            res_value = static_cast<T>(0.0f);
-                            break;
-                        }
-                    }
-                    uint32_t res_idx = 0;
+/** Reduce a S32 tensor, accumulating in S32 */
+inline void reduction_s32(const ITensor     *src,
+                          ITensor           *dst,
+                          ITensor           *partials,
+                          ReductionOperation op,
+                          uint32_t           axis_mask,
+                          bool               keep_dims,
+                          ReductionStage     stage,
+                          const Window      &window)
+{
+    const detail::ReductionLoad<int32_t, int32_t> load{};
+    if (op == ReductionOperation::MEAN_SUM)
+    {
+        // Round half away from zero without going through FP32, which cannot represent every S32 sum
+        const auto num_elements = static_cast<int32_t>(detail::reduction_num_elements(*src->info(), axis_mask));
+        detail::reduce_op<int32_t, int32_t>(src, dst, partials, op, axis_mask, keep_dims, stage, window, load,
+                                            [num_elements](int32_t acc)
+                                            {
+                                                return acc >= 0 ? (acc + num_elements / 2) / num_elements
+                                                                : (acc - num_elements / 2) / num_elements;
+                                            });
+    }
+    else
+    {
+        detail::reduce_op<int32_t, int32_t>(src, dst, partials, op, axis_mask, keep_dims, stage, window, load,
+                                            [](int32_t acc) { return acc; });
+    }
+}
 
-                    for (unsigned int dim = 0; dim < in_info.dimension(axis); ++dim)
-                    {
-                        const T *in_ptr =
-                            reinterpret_cast<T *>(input.ptr() + x + in_info.strides_in_bytes()[axis] * dim);
-                        switch (op)
-                        {
-                            case ReductionOperation::SUM:
-                            {
-                                res_value += *in_ptr;
-                                break;
-                            }
-                            case ReductionOperation::MEAN_SUM:
-                            {
-                                res_value_q += *in_ptr;
-                                break;
-                            }
-                            case ReductionOperation::SUM_SQUARE:
-                            {
-                                res_value += *in_ptr * *in_ptr;
-                                break;
-                            }
-                            case ReductionOperation::PROD:
-                            {
-                                //de-quantize input
-                                if (std::is_same<T, uint8_t>::value)
-                                {
-                                    res_value *= dequantize_qasymm8(*in_ptr, iq_info);
-                                }
-                                else
-                                {
-                                    res_value *= dequantize_qasymm8_signed(*in_ptr, iq_info);
-                                }
-                                break;
-                            }
-                            case ReductionOperation::ARG_IDX_MIN:
-                            {
-                                if (*in_ptr < res_value)
-                                {
-                                    res_value = *in_ptr;
-                                    res_idx   = dim;
-                                }
-                                break;
-                            }
-                            case ReductionOperation::ARG_IDX_MAX:
-                            {
-                                if (*in_ptr > res_value)
-                                {
-                                    res_value = *in_ptr;
-                                    res_idx   = dim;
-                                }
-                                break;
-                            }
-                            case ReductionOperation::MIN:
-                            {
-                                res_value = *in_ptr < res_value ? *in_ptr : res_value;
-                                break;
-                            }
-                            case ReductionOperation::MAX:
-                            {
-                                res_value = *in_ptr > res_value ? *in_ptr : res_value;
-                                break;
-                            }
-                            default:
-                                ARM_COMPUTE_ERROR("Not supported");
-                        }
-                    }
+/** Reduce a QASYMM8/QASYMM8_SIGNED tensor and requantize the result to the destination quantization info */
+template <typename T>
+void reduction_quantized(const ITensor     *src,
+                         ITensor           *dst,
+                         ITensor           *partials,
+                         ReductionOperation op,
+                         uint32_t           axis_mask,
+                         bool               keep_dims,
+                         ReductionStage     stage,
+                         const Window      &window)
+{
+    const UniformQuantizationInfo iq_info = src->info()->quantization_info().uniform();
+    const UniformQuantizationInfo oq_info = dst->info()->quantization_info().uniform();
 
-                    switch (op)
-                    {
-                        case ReductionOperation::MEAN_SUM:
-                        {
-                        // Apply previously calculated coefficients (with rounding on aarch64)
-#ifdef __aarch64__
-                            const int32_t res = arm_compute::round(A * (static_cast<float>(res_value_q)) + B,
-                                                                   RoundingPolicy::TO_NEAREST_EVEN);
-#else  // defined(__aarch64__)
-                            const int32_t res = A * (static_cast<float>(res_value_q)) + B;
-#endif // __aarch64__
-                            *reinterpret_cast<T *>(output.ptr() + x) = utils::cast::saturate_cast<T>(res);
-                            break;
-                        }
-                        case ReductionOperation::SUM:
-                        {
-                            // Subtract accumulated offsets
-                            res_value -= (in_info.dimension(axis) - 1) * iq_info.offset;
-                            *reinterpret_cast<T *>(output.ptr() + x) = utils::cast::saturate_cast<T>(res_value);
-                            break;
-                        }
-                        case ReductionOperation::PROD:
-                        {
-                            //re-quantize result
-                            T res = 0;
-                            if (std::is_same<T, uint8_t>::value)
-                            {
-                                res = quantize_qasymm8(res_value, iq_info);
-                            }
-                            else
-                            {
-                                res = quantize_qasymm8_signed(res_value, iq_info);
-                            }
-                            *(reinterpret_cast<T *>(output.ptr() + x)) = res;
-                            break;
-                        }
-                        case ReductionOperation::ARG_IDX_MIN:
-                        case ReductionOperation::ARG_IDX_MAX:
-                        {
-                            *(reinterpret_cast<uint32_t *>(output.ptr() + x * 4)) = res_idx;
-                            break;
-                        }
-                        default:
-                            *(reinterpret_cast<T *>(output.ptr() + x)) = res_value;
-                    }
-                }
-            },
-            input, output);
+    if (op == ReductionOperation::PROD || op == ReductionOperation::SUM_SQUARE)
+    {
+        // The result does not depend linearly on the inputs, so accumulate the dequantized values in FP32
+        detail::reduce_op<T, float>(src, dst, partials, op, axis_mask, keep_dims, stage, window,
+                                    detail::ReductionDequantize<T>(iq_info), [&oq_info](float acc)
+                                    { return Qasymm8QuantizationHelper<T>::quantize(acc, oq_info); });
+        return;
     }
-};
 
+    // Sums and extrema accumulate the quantized values in S32: scales and offsets only apply to the result, as
+    // dst = ratio * (acc - k * in_offset) + out_offset with k the number of input offsets accumulated.
+    const auto  num_elements = static_cast<float>(detail::reduction_num_elements(*src->info(), axis_mask));
+    const float ratio        = iq_info.scale / oq_info.scale;
+    const float k            = op == ReductionOperation::SUM ? num_elements : 1.f;
+    const float a            = op == ReductionOperation::MEAN_SUM ? ratio / num_elements : ratio;
+    const float b            = oq_info.offset - k * iq_info.offset * ratio;
+    detail::reduce_op<T, int32_t>(src, dst, partials, op, axis_mask, keep_dims, stage, window,
+                                  detail::ReductionLoad<T, int32_t>(), [a, b](int32_t acc)
+                                  { return utils::cast::saturate_cast<T>(static_cast<float>(acc) * a + b); });
+}
+} // namespace cpu
 } // namespace arm_compute
 #endif // ACL_SRC_CPU_KERNELS_REDUCTION_LAYER_GENERIC_NEON_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,6 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/cpu/kernels/reduction_layer/generic/neon/impl.h"
 
@@ -29,39 +28,17 @@ namespace arm_compute
 {
 namespace cpu
 {
-void reduce_RedOpX_reduceX_S32_4(const Window            &window,
-                                 const ITensor           *input,
-                                 ITensor                 *output,
-                                 const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpX_reduceX_S32_4");
-    Reducer<RedOpX<int32_t, 4>>::reduceX(window, input, output, RedOpX<int32_t, 4>(), op);
-}
-
-void reduce_RedOpYZW_reduceY_S32_4(const Window            &window,
-                                   const ITensor           *input,
-                                   ITensor                 *output,
-                                   const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceY_S32_4");
-    Reducer<RedOpYZW<int32_t, 4>>::reduceY(window, input, output, RedOpYZW<int32_t, 4>(), op);
-}
-void reduce_RedOpYZW_reduceZ_S32_4(const Window            &window,
-                                   const ITensor           *input,
-                                   ITensor                 *output,
-                                   const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceZ_S32_4");
-    Reducer<RedOpYZW<int32_t, 4>>::reduceZ(window, input, output, RedOpYZW<int32_t, 4>(), op);
-}
-
-void reduce_RedOpYZW_reduceW_S32_4(const Window            &window,
-                                   const ITensor           *input,
-                                   ITensor                 *output,
-                                   const ReductionOperation op)
+void neon_s32_reduction(const ITensor           *src,
+                        ITensor                 *dst,
+                        ITensor                 *partials,
+                        const ReductionOperation op,
+                        uint32_t                 axis_mask,
+                        bool                     keep_dims,
+                        ReductionStage           stage,
+                        const Window            &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceW_S32_4");
-    Reducer<RedOpYZW<int32_t, 4>>::reduceW(window, input, output, RedOpYZW<int32_t, 4>(), op);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_s32_reduction");
+    reduction_s32(src, dst, partials, op, axis_mask, keep_dims, stage, window);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,35 +30,27 @@ namespace arm_compute
 {
 namespace cpu
 {
-
-#define DECLARE_REDUCTION_KERNEL(func_name) \
-    void func_name(const Window &window, const ITensor *in, ITensor *out, const ReductionOperation op)
-
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_complex_reduceZ_float32_4_2_SUM);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_float32_4);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_float32_4);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_float32_4);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_float32_4);
-
-DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_float16_8);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_float16_8);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_float16_8);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_float16_8);
-
-DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_S32_4);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_S32_4);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_S32_4);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_S32_4);
-
-DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_qasymm8);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_qasymm8);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_qasymm8);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_qasymm8);
-
-DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_qasymm8_signed);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_qasymm8_signed);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_qasymm8_signed);
-DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_qasymm8_signed);
+/** Part of the reduction computed by a micro-kernel
+ *
+ * A long reduction along X is split into fixed-size chunks of X: the partial result of every chunk is written to an
+ * intermediate tensor, then the partial results of each destination element are combined in a fixed tree order.
+ */
+enum class ReductionStage
+{
+    Full,    /**< Reduce the source into the destination */
+    Partial, /**< Reduce chunks of X of the source into the partial results */
+    Combine  /**< Combine the partial results into the destination */
+};
+
+#define DECLARE_REDUCTION_KERNEL(func_name)                                                          \
+    void func_name(const ITensor *src, ITensor *dst, ITensor *partials, const ReductionOperation op, \
+                   uint32_t axis_mask, bool keep_dims, ReductionStage stage, const Window &window)
+
+DECLARE_REDUCTION_KERNEL(neon_fp32_reduction);
+DECLARE_REDUCTION_KERNEL(neon_fp16_reduction);
+DECLARE_REDUCTION_KERNEL(neon_s32_reduction);
+DECLARE_REDUCTION_KERNEL(neon_qu8_reduction);
+DECLARE_REDUCTION_KERNEL(neon_qs8_reduction);
 
 #undef DECLARE_REDUCTION_KERNEL
 } // namespace cpu
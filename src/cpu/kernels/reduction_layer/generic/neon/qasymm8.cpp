@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,6 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/cpu/kernels/reduction_layer/generic/neon/impl.h"
 
@@ -29,40 +28,17 @@ namespace arm_compute
 {
 namespace cpu
 {
-void reduce_RedOpX_reduceX_qasymm8(const Window            &window,
-                                   const ITensor           *input,
-                                   ITensor                 *output,
-                                   const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpX_reduceX_qasymm8");
-    Reducer<RedOpX_quantized<uint8_t>>::reduceX(window, input, output, RedOpX_quantized<uint8_t>(), op);
-}
-
-void reduce_RedOpYZW_reduceY_qasymm8(const Window            &window,
-                                     const ITensor           *input,
-                                     ITensor                 *output,
-                                     const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceY_qasymm8");
-    Reducer<RedOpYZW_quantized<uint8_t>>::reduceY(window, input, output, RedOpYZW_quantized<uint8_t>(), op);
-}
-
-void reduce_RedOpYZW_reduceZ_qasymm8(const Window            &window,
-                                     const ITensor           *input,
-                                     ITensor                 *output,
-                                     const ReductionOperation op)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceZ_qasymm8");
-    Reducer<RedOpYZW_quantized<uint8_t>>::reduceZ(window, input, output, RedOpYZW_quantized<uint8_t>(), op);
-}
-
-void reduce_RedOpYZW_reduceW_qasymm8(const Window            &window,
-                                     const ITensor           *input,
-                                     ITensor                 *output,
-                                     const ReductionOperation op)
+void neon_qu8_reduction(const ITensor           *src,
+                        ITensor                 *dst,
+                        ITensor                 *partials,
+                        const ReductionOperation op,
+                        uint32_t                 axis_mask,
+                        bool                     keep_dims,
+                        ReductionStage           stage,
+                        const Window            &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "reduce_RedOpYZW_reduceW_qasymm8");
-    Reducer<RedOpYZW_quantized<uint8_t>>::reduceW(window, input, output, RedOpYZW_quantized<uint8_t>(), op);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_qu8_reduction");
+    reduction_quantized<uint8_t>(src, dst, partials, op, axis_mask, keep_dims, stage, window);
 }
 } // namespace cpu
 } // namespace arm_compute
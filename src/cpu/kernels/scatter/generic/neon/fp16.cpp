@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,31 +35,14 @@ namespace cpu
 void scatter_fp16_neon(const ITensor         *src,
                        const ITensor         *indices,
                        ITensor               *dst,
+                       ITensor               *partitions,
                        const ScatterFunction &scatter_func,
+                       ScatterStage           stage,
                        const Window          &window,
                        const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_fp16_neon");
-    switch (scatter_func)
-    {
-        case ScatterFunction::Update:
-            scatter_neon<ScatterFunction::Update, float16_t>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Add:
-            scatter_neon<ScatterFunction::Add, float16_t>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Sub:
-            scatter_neon<ScatterFunction::Sub, float16_t>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Max:
-            scatter_neon<ScatterFunction::Max, float16_t>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Min:
-            scatter_neon<ScatterFunction::Min, float16_t>(src, indices, dst, window, data_block_length);
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
-    }
+    scatter_generic<float16_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 } // namespace cpu
 } // namespace arm_compute
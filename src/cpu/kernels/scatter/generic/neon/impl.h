@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,16 +32,198 @@
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/CpuTypes.h"
+#include "src/cpu/kernels/scatter/list.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
 namespace cpu
 {
+namespace detail
+{
+constexpr int scatter_max_index_length = 5;
+
+/** Destination shape read in the order of the index tuples, i.e. outermost dimension first */
+inline void scatter_index_shape(const ITensorInfo &dst_info, int32_t (&shape)[scatter_max_index_length])
+{
+    const int dst_dims = dst_info.num_dimensions();
+    for (int i = 1; i <= scatter_max_index_length; ++i)
+    {
+        shape[i - 1] = dst_info.tensor_shape()[std::max(dst_dims - i, 0)];
+    }
+}
+
+/** Flattened position of the destination block addressed by an index tuple, or -1 if the tuple is out of bounds */
+inline int32_t
+scatter_block_index(const int32_t *idx_ptr, const int32_t (&shape)[scatter_max_index_length], int index_len)
+{
+    int32_t index = 0;
+    for (int i = 0; i < index_len; ++i)
+    {
+        if (idx_ptr[i] >= shape[i] || idx_ptr[i] < 0)
+        {
+            return -1;
+        }
+        index = index * shape[i] + idx_ptr[i];
+    }
+    return index;
+}
+
+/** Reduce a block of updates into a block of the destination */
+template <ScatterFunction sf, typename ScalarType>
+inline void scatter_block(ScalarType *dst_ptr, const ScalarType *upt_ptr, const int data_block_length)
+{
+    constexpr int vec_size = 16 / sizeof(ScalarType);
+
+    int x = 0;
+    for (; x <= (data_block_length - vec_size); x += vec_size)
+    {
+        const auto update_val_vec = wrapper::vloadq(upt_ptr + x);
+        const auto dst_val_vec    = wrapper::vloadq(dst_ptr + x);
+
+        switch (sf)
+        {
+            case ScatterFunction::Update:
+                wrapper::vstore(dst_ptr + x, update_val_vec);
+                break;
+            case ScatterFunction::Add:
+                wrapper::vstore(dst_ptr + x, wrapper::vadd(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Sub:
+                wrapper::vstore(dst_ptr + x, wrapper::vsub(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Max:
+                wrapper::vstore(dst_ptr + x, wrapper::vmax(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Min:
+                wrapper::vstore(dst_ptr + x, wrapper::vmin(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Mul:
+                wrapper::vstore(dst_ptr + x, wrapper::vmul(dst_val_vec, update_val_vec));
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+        }
+    }
+
+    for (; x < data_block_length; ++x)
+    {
+        const ScalarType update_val = upt_ptr[x];
+        const ScalarType dst_val    = dst_ptr[x];
+        ScalarType       output_val;
+        switch (sf)
+        {
+            case ScatterFunction::Update:
+                output_val = update_val;
+                break;
+            case ScatterFunction::Add:
+                output_val = dst_val + update_val;
+                break;
+            case ScatterFunction::Sub:
+                output_val = dst_val - update_val;
+                break;
+            case ScatterFunction::Max:
+                output_val = std::max(dst_val, update_val);
+                break;
+            case ScatterFunction::Min:
+                output_val = std::min(dst_val, update_val);
+                break;
+            case ScatterFunction::Mul:
+                output_val = dst_val * update_val;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+        }
+        dst_ptr[x] = output_val;
+    }
+}
+} // namespace detail
+
+/** Group the updates by the partition of the destination blocks they are reduced into
+ *
+ * The destination blocks are dealt round-robin to the partitions in groups of consecutive blocks spanning at least a
+ * cache line, so that the few destinations of heavily colliding updates still land in different partitions while
+ * threads do not share cache lines of the destination. The partitions tensor
+ * holds an (update, destination block) pair of S32 values for every update with an in-bounds index, sorted by
+ * partition with a stable counting sort, followed by the offsets of the first pair of each partition and the total
+ * number of pairs. Updates keep their original order within a partition, so reducing a partition on its own gives the
+ * same result as the serial scatter.
+ *
+ * @param[in]  indices    Indices tensor.
+ * @param[in]  dst        Destination tensor.
+ * @param[out] partitions Partitions tensor. Data type supported: S32.
+ */
+inline void scatter_partition(const ITensor *indices, const ITensor *dst, ITensor *partitions)
+{
+    const ITensorInfo *idx_info = indices->info();
+
+    int32_t dst_shape[detail::scatter_max_index_length];
+    detail::scatter_index_shape(*dst->info(), dst_shape);
+
+    const int    index_len         = idx_info->dimension(0);
+    const size_t num_indices       = idx_info->tensor_shape().total_size_upper(1);
+    const size_t indices_strides_y = idx_info->strides_in_bytes()[1];
+    const int    num_partitions    = partitions->info()->dimension(0) - 2 * num_indices - 1;
+
+    const ITensorInfo *dst_info     = dst->info();
+    const int          data_dims    = std::max(static_cast<int>(dst_info->num_dimensions()) - index_len, 0);
+    const size_t       block_size   = dst_info->element_size() * dst_info->tensor_shape().total_size_lower(data_dims);
+    const int32_t      group_blocks = std::max<size_t>(1, scatter_partition_group_bytes / block_size);
+
+    int32_t *entries = reinterpret_cast<int32_t *>(partitions->ptr_to_element(Coordinates(0)));
+    int32_t *offsets = entries + 2 * num_indices;
+
+    const auto partition_of = [&](int32_t block) { return (block / group_blocks) % num_partitions; };
+
+    // Count the updates of every partition, then turn the counts into offsets
+    std::fill_n(offsets, num_partitions + 1, 0);
+    const uint8_t *idx_ptr_raw = indices->ptr_to_element(Coordinates(0));
+    for (size_t u = 0; u < num_indices; ++u)
+    {
+        const int32_t block =
+            detail::scatter_block_index(reinterpret_cast<const int32_t *>(idx_ptr_raw + u * indices_strides_y),
+                                        dst_shape, index_len);
+        if (block >= 0)
+        {
+            ++offsets[partition_of(block) + 1];
+        }
+    }
+    for (int p = 0; p < num_partitions; ++p)
+    {
+        offsets[p + 1] += offsets[p];
+    }
+
+    std::vector<int32_t> cursors(offsets, offsets + num_partitions);
+    for (size_t u = 0; u < num_indices; ++u)
+    {
+        const int32_t block =
+            detail::scatter_block_index(reinterpret_cast<const int32_t *>(idx_ptr_raw + u * indices_strides_y),
+                                        dst_shape, index_len);
+        if (block >= 0)
+        {
+            const int32_t pos    = cursors[partition_of(block)]++;
+            entries[2 * pos]     = static_cast<int32_t>(u);
+            entries[2 * pos + 1] = block;
+        }
+    }
+}
+
+/** Scatter the updates into the destination
+ *
+ * The window walks the rows of the data blocks along Y. Without a partitions tensor, all the updates are reduced in
+ * order. Otherwise, every step along Z reduces the updates of one partition as grouped by @ref scatter_partition, so
+ * different partitions write to disjoint destination blocks and can run on different threads.
+ */
 template <arm_compute::ScatterFunction sf, typename ScalarType>
-void scatter_neon(
-    const ITensor *updates, const ITensor *indices, ITensor *dst, const Window &window, const int data_block_length)
+void scatter_neon(const ITensor *updates,
+                  const ITensor *indices,
+                  ITensor       *dst,
+                  const ITensor *partitions,
+                  const Window  &window,
+                  const int      data_block_length)
 {
     const auto updates_info = updates->info();
     const auto idx_info     = indices->info();
@@ -49,130 +231,120 @@ void scatter_neon(
 
     const auto indices_strides_y = idx_info->strides_in_bytes()[1];
 
-    const int     dst_dims         = dst_info->num_dimensions();
-    constexpr int max_index_length = 5;
-    int32_t       dst_shape[max_index_length];
-    for (int i = 1; i <= max_index_length; ++i)
-    {
-        dst_shape[i - 1] = dst_info->tensor_shape()[std::max(dst_dims - i, 0)];
-    }
+    int32_t dst_shape[detail::scatter_max_index_length];
+    detail::scatter_index_shape(*dst_info, dst_shape);
 
     const int  index_len = idx_info->dimension(0);
     const auto num_dims  = dst_info->num_dimensions();
     const int  ind_dims  = idx_info->num_dimensions();
+    const int  data_dims = std::max(static_cast<int>(num_dims) - index_len, 0);
 
     const int upt_block_stride = updates_info->strides_in_bytes()[updates_info->num_dimensions() - (ind_dims - 1)];
 
     const int out_block_stride = dst_info->strides_in_bytes()[num_dims - index_len];
 
-    TensorShape  ind_collapsed = idx_info->tensor_shape().collapsed_from(1);
-    const size_t num_indices   = ind_collapsed[1];
+    const size_t num_indices = idx_info->tensor_shape().total_size_upper(1);
 
-    Iterator updates_it(updates, window);
-    Iterator dst_it(dst, window);
+    const uint8_t *updates_base = updates->ptr_to_element(Coordinates(0));
+    uint8_t       *dst_base     = dst->ptr_to_element(Coordinates(0));
+    const uint8_t *idx_base     = indices->ptr_to_element(Coordinates(0));
 
-    constexpr int vec_size         = 16 / sizeof(ScalarType);
-    uint8_t      *idx_ptr_raw_base = indices->ptr_to_element(arm_compute::Coordinates(0));
+    const int32_t *entries = nullptr;
+    const int32_t *offsets = nullptr;
+    if (partitions != nullptr)
+    {
+        entries = reinterpret_cast<const int32_t *>(partitions->ptr_to_element(Coordinates(0)));
+        offsets = entries + 2 * num_indices;
+    }
 
     execute_window_loop(
         window,
-        [&](const Coordinates &)
+        [&](const Coordinates &id)
         {
-            uint8_t *idx_ptr_raw = idx_ptr_raw_base;
-            for (size_t index_element = 0; index_element < num_indices; ++index_element)
+            // Rows of the data blocks are collapsed along Y
+            size_t upt_row_offset = 0;
+            size_t dst_row_offset = 0;
+            int    row            = id.y();
+            for (int d = 1; d < data_dims; ++d)
             {
-                int32_t *idx_ptr = reinterpret_cast<int32_t *>(idx_ptr_raw);
-
-                // Out of bounds check
-                bool out_of_bounds = false;
-                for (int i = 0; i < index_len; ++i)
-                {
-                    if (idx_ptr[i] >= dst_shape[i] || idx_ptr[i] < 0)
-                    {
-                        out_of_bounds = true;
-                    }
-                }
-
-                idx_ptr_raw += indices_strides_y;
-
-                if (out_of_bounds)
-                {
-                    continue;
-                }
-
-                int32_t index = 0;
-                for (int i = 0; i < index_len; ++i)
-                {
-                    index = index * dst_shape[i] + idx_ptr[i];
-                }
-
-                const uint8_t *upt_from_index_ptr = updates_it.ptr() + index_element * upt_block_stride;
+                const int coord = row % dst_info->dimension(d);
+                row /= dst_info->dimension(d);
+                upt_row_offset += coord * updates_info->strides_in_bytes()[d];
+                dst_row_offset += coord * dst_info->strides_in_bytes()[d];
+            }
 
-                uint8_t *dst_from_index_ptr = dst_it.ptr() + index * out_block_stride;
+            const auto reduce = [&](size_t index_element, int32_t index)
+            {
+                const uint8_t *upt_from_index_ptr = updates_base + upt_row_offset + index_element * upt_block_stride;
+                uint8_t       *dst_from_index_ptr = dst_base + dst_row_offset + index * out_block_stride;
+                detail::scatter_block<sf>(reinterpret_cast<ScalarType *>(dst_from_index_ptr),
+                                          reinterpret_cast<const ScalarType *>(upt_from_index_ptr), data_block_length);
+            };
 
-                int x = 0;
-                for (; x <= (data_block_length - vec_size); x += vec_size)
+            if (partitions == nullptr)
+            {
+                for (size_t index_element = 0; index_element < num_indices; ++index_element)
                 {
-                    const auto update_val_vec =
-                        wrapper::vloadq(reinterpret_cast<const ScalarType *>(upt_from_index_ptr) + x);
-                    const auto dst_val_vec = wrapper::vloadq(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x);
-
-                    switch (sf)
+                    const int32_t index = detail::scatter_block_index(
+                        reinterpret_cast<const int32_t *>(idx_base + index_element * indices_strides_y), dst_shape,
+                        index_len);
+                    if (index >= 0)
                     {
-                        case ScatterFunction::Update:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x, update_val_vec);
-                            break;
-                        case ScatterFunction::Add:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vadd(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Sub:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vsub(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Max:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vmax(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Min:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vmin(dst_val_vec, update_val_vec));
-                            break;
-                        default:
-                            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+                        reduce(index_element, index);
                     }
                 }
-
-                for (; x < data_block_length; ++x)
+            }
+            else
+            {
+                for (int32_t e = offsets[id.z()]; e < offsets[id.z() + 1]; ++e)
                 {
-                    const ScalarType update_val = *(reinterpret_cast<const ScalarType *>(upt_from_index_ptr) + x);
-                    const ScalarType dst_val    = *(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x);
-                    ScalarType       output_val;
-                    switch (sf)
-                    {
-                        case ScatterFunction::Update:
-                            output_val = update_val;
-                            break;
-                        case ScatterFunction::Add:
-                            output_val = dst_val + update_val;
-                            break;
-                        case ScatterFunction::Sub:
-                            output_val = dst_val - update_val;
-                            break;
-                        case ScatterFunction::Max:
-                            output_val = std::max(dst_val, update_val);
-                            break;
-                        case ScatterFunction::Min:
-                            output_val = std::min(dst_val, update_val);
-                            break;
-                        default:
-                            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
-                    }
-                    *(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x) = output_val;
+                    reduce(entries[2 * e], entries[2 * e + 1]);
                 }
             }
-        },
-        updates_it, dst_it);
+        });
+}
+
+/** Run a stage of the scatter for the given reduction function */
+template <typename ScalarType>
+void scatter_generic(const ITensor         *updates,
+                     const ITensor         *indices,
+                     ITensor               *dst,
+                     ITensor               *partitions,
+                     const ScatterFunction &scatter_func,
+                     ScatterStage           stage,
+                     const Window          &window,
+                     const int              data_block_length)
+{
+    if (stage == ScatterStage::Partition)
+    {
+        scatter_partition(indices, dst, partitions);
+        return;
+    }
+
+    const ITensor *groups = (stage == ScatterStage::Apply) ? partitions : nullptr;
+    switch (scatter_func)
+    {
+        case ScatterFunction::Update:
+            scatter_neon<ScatterFunction::Update, ScalarType>(updates, indices, dst, groups, window, data_block_length);
+            break;
+        case ScatterFunction::Add:
+            scatter_neon<ScatterFunction::Add, ScalarType>(updates, indices, dst, groups, window, data_block_length);
+            break;
+        case ScatterFunction::Sub:
+            scatter_neon<ScatterFunction::Sub, ScalarType>(updates, indices, dst, groups, window, data_block_length);
+            break;
+        case ScatterFunction::Max:
+            scatter_neon<ScatterFunction::Max, ScalarType>(updates, indices, dst, groups, window, data_block_length);
+            break;
+        case ScatterFunction::Min:
+            scatter_neon<ScatterFunction::Min, ScalarType>(updates, indices, dst, groups, window, data_block_length);
+            break;
+        case ScatterFunction::Mul:
+            scatter_neon<ScatterFunction::Mul, ScalarType>(updates, indices, dst, groups, window, data_block_length);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+    }
 }
 } // namespace cpu
 } // namespace arm_compute
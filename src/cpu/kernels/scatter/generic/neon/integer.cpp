@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,101 +30,82 @@ namespace arm_compute
 {
 namespace cpu
 {
-template <typename ScalarType>
-void scatter_integer_generic(const ITensor         *src,
-                             const ITensor         *indices,
-                             ITensor               *dst,
-                             const ScatterFunction &scatter_func,
-                             const Window          &window,
-                             const int              data_block_length)
-{
-    switch (scatter_func)
-    {
-        case ScatterFunction::Update:
-            scatter_neon<ScatterFunction::Update, ScalarType>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Add:
-            scatter_neon<ScatterFunction::Add, ScalarType>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Sub:
-            scatter_neon<ScatterFunction::Sub, ScalarType>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Max:
-            scatter_neon<ScatterFunction::Max, ScalarType>(src, indices, dst, window, data_block_length);
-            break;
-        case ScatterFunction::Min:
-            scatter_neon<ScatterFunction::Min, ScalarType>(src, indices, dst, window, data_block_length);
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
-    }
-    return;
-}
-
 void scatter_s32_neon(const ITensor         *src,
                       const ITensor         *indices,
                       ITensor               *dst,
+                      ITensor               *partitions,
                       const ScatterFunction &scatter_func,
+                      ScatterStage           stage,
                       const Window          &window,
                       const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_s32_neon");
-    scatter_integer_generic<int32_t>(src, indices, dst, scatter_func, window, data_block_length);
+    scatter_generic<int32_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 
 void scatter_s16_neon(const ITensor         *src,
                       const ITensor         *indices,
                       ITensor               *dst,
+                      ITensor               *partitions,
                       const ScatterFunction &scatter_func,
+                      ScatterStage           stage,
                       const Window          &window,
                       const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_s16_neon");
-    scatter_integer_generic<int16_t>(src, indices, dst, scatter_func, window, data_block_length);
+    scatter_generic<int16_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 
 void scatter_s8_neon(const ITensor         *src,
                      const ITensor         *indices,
                      ITensor               *dst,
+                     ITensor               *partitions,
                      const ScatterFunction &scatter_func,
+                     ScatterStage           stage,
                      const Window          &window,
                      const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_s8_neon");
-    scatter_integer_generic<int8_t>(src, indices, dst, scatter_func, window, data_block_length);
+    scatter_generic<int8_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 
 void scatter_u32_neon(const ITensor         *src,
                       const ITensor         *indices,
                       ITensor               *dst,
+                      ITensor               *partitions,
                       const ScatterFunction &scatter_func,
+                      ScatterStage           stage,
                       const Window          &window,
                       const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_u32_neon");
-    scatter_integer_generic<uint32_t>(src, indices, dst, scatter_func, window, data_block_length);
+    scatter_generic<uint32_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 
 void scatter_u16_neon(const ITensor         *src,
                       const ITensor         *indices,
                       ITensor               *dst,
+                      ITensor               *partitions,
                       const ScatterFunction &scatter_func,
+                      ScatterStage           stage,
                       const Window          &window,
                       const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_u16_neon");
-    scatter_integer_generic<uint16_t>(src, indices, dst, scatter_func, window, data_block_length);
+    scatter_generic<uint16_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 
 void scatter_u8_neon(const ITensor         *src,
                      const ITensor         *indices,
                      ITensor               *dst,
+                     ITensor               *partitions,
                      const ScatterFunction &scatter_func,
+                     ScatterStage           stage,
                      const Window          &window,
                      const int              data_block_length)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "scatter_u8_neon");
-    scatter_integer_generic<uint8_t>(src, indices, dst, scatter_func, window, data_block_length);
+    scatter_generic<uint8_t>(src, indices, dst, partitions, scatter_func, stage, window, data_block_length);
 }
 } // namespace cpu
 } // namespace arm_compute
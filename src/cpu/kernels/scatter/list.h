@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,9 +28,25 @@ namespace arm_compute
 {
 namespace cpu
 {
-#define DECLARE_SCATTER_KERNEL(func_name)                                                                         \
-    void func_name(const ITensor *src, const ITensor *indices, ITensor *dst, const ScatterFunction &scatter_func, \
-                   const Window &window, const int data_block_length)
+/** Part of the scatter computed by a micro-kernel
+ *
+ * Updates with duplicate indices have to be reduced in order, so a scatter is split across threads by first grouping
+ * the updates by partitions of the destination blocks, then reducing every group on its own.
+ */
+enum class ScatterStage
+{
+    Full,      /**< Reduce all the updates in order */
+    Partition, /**< Group the updates by the partition of the destination blocks they are reduced into */
+    Apply      /**< Reduce the updates of every partition in order */
+};
+
+/** Destination blocks are dealt to the partitions in groups spanning at least a cache line */
+constexpr size_t scatter_partition_group_bytes = 64;
+
+#define DECLARE_SCATTER_KERNEL(func_name)                                                         \
+    void func_name(const ITensor *src, const ITensor *indices, ITensor *dst, ITensor *partitions, \
+                   const ScatterFunction &scatter_func, ScatterStage stage, const Window &window, \
+                   const int data_block_length)
 
 DECLARE_SCATTER_KERNEL(scatter_fp32_neon);
 DECLARE_SCATTER_KERNEL(scatter_fp16_neon);
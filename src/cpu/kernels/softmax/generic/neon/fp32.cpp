@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,5 +67,12 @@ template void neon_fp32_softmax<false>(const ITensor *in,
                                        const Window  &window,
                                        const void    *lut_ptr);
 
+void neon_fp32_softmax_topk(
+    const ITensor *in, ITensor *values, ITensor *indices, float beta, unsigned int k, const Window &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_fp32_softmax_topk");
+    return neon_softmax_topk_float<float>(in, values, indices, beta, k, window);
+}
+
 } // namespace cpu
 } // namespace arm_compute
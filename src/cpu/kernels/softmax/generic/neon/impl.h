@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,9 @@
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -59,6 +62,180 @@ inline float wrapper_vaddv(const float32x4_t &a, int sum_stages)
 } // namespace
 #endif // __aarch64__
 
+/** Rows larger than this are normalised online: they do not stay in L1 between the passes of the three-pass kernel */
+constexpr int softmax_online_min_row_bytes = 32 * 1024;
+
+/** Number of vectors loaded per step of the online maximum and sum */
+constexpr int softmax_online_block_vectors = 4;
+
+/** Largest lane of a 128-bit vector */
+template <typename T, typename VectorType>
+inline T neon_softmax_vmaxv(const VectorType &vec)
+{
+#ifdef __aarch64__
+    return wrapper::vmaxv(vec);
+#else  // __aarch64__
+    constexpr int stages    = (16 / sizeof(T)) == 8 ? 2 : 1;
+    auto          carry_max = wrapper::vpmax(wrapper::vgethigh(vec), wrapper::vgetlow(vec));
+    for (int i = 0; i < stages; ++i)
+    {
+        carry_max = wrapper::vpmax(carry_max, carry_max);
+    }
+    return wrapper::vgetlane(carry_max, 0);
+#endif // __aarch64__
+}
+
+/** Sum of the lanes of a 128-bit vector */
+template <typename T, typename VectorType>
+inline T neon_softmax_vaddv(const VectorType &vec)
+{
+    constexpr int stages = (16 / sizeof(T)) == 8 ? 2 : 1;
+#ifdef __aarch64__
+    return wrapper_vaddv(vec, stages);
+#else  // __aarch64__
+    auto sum_res = wrapper::vpadd(wrapper::vgethigh(vec), wrapper::vgetlow(vec));
+    for (int i = 0; i < stages; ++i)
+    {
+        sum_res = wrapper::vpadd(sum_res, sum_res);
+    }
+    return wrapper::vgetlane(sum_res, 0);
+#endif // __aarch64__
+}
+
+/** Compute the maximum of a row and the sum of exp((x - max) * beta) in a single read of the row
+ *
+ * Every lane keeps a running maximum and a sum of exponentials relative to it, and the sum is rescaled whenever the
+ * maximum of a block of vectors raises it. The lanes are merged the same way at the end of the row.
+ *
+ * @p on_block is called with the offset and the lane-wise maximum of every block of vectors, and @p on_element with
+ * the offset of every leftover element, so that callers can filter the row in the same pass.
+ */
+template <typename T, typename BlockFn, typename ElementFn>
+inline void neon_softmax_online_max_sum(
+    const T *in_ptr, int width, float beta, T &max_val, T &sum, BlockFn &&on_block, ElementFn &&on_element)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int vec_size   = 16 / sizeof(T);
+    constexpr int block_size = softmax_online_block_vectors * vec_size;
+
+    const auto beta_vec = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
+
+    // Starting from the lowest finite value keeps the rescaling factor defined for lanes holding only -inf
+    auto vec_max = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
+    auto vec_sum = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+
+    int x = 0;
+    for (; x <= (width - block_size); x += block_size)
+    {
+        const auto v0 = wrapper::vloadq(in_ptr + x);
+        const auto v1 = wrapper::vloadq(in_ptr + x + vec_size);
+        const auto v2 = wrapper::vloadq(in_ptr + x + 2 * vec_size);
+        const auto v3 = wrapper::vloadq(in_ptr + x + 3 * vec_size);
+
+        const auto block_max = wrapper::vmax(wrapper::vmax(v0, v1), wrapper::vmax(v2, v3));
+        on_block(x, block_max);
+
+        const auto new_max = wrapper::vmax(vec_max, block_max);
+        const auto rescale = wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, new_max), beta_vec));
+        vec_sum            = wrapper::vmul(vec_sum, rescale);
+        vec_max            = new_max;
+
+        const auto e0 = wrapper::vexpq(wrapper::vmul(wrapper::vsub(v0, vec_max), beta_vec));
+        const auto e1 = wrapper::vexpq(wrapper::vmul(wrapper::vsub(v1, vec_max), beta_vec));
+        const auto e2 = wrapper::vexpq(wrapper::vmul(wrapper::vsub(v2, vec_max), beta_vec));
+        const auto e3 = wrapper::vexpq(wrapper::vmul(wrapper::vsub(v3, vec_max), beta_vec));
+        vec_sum       = wrapper::vadd(vec_sum, wrapper::vadd(wrapper::vadd(e0, e1), wrapper::vadd(e2, e3)));
+    }
+
+    // Merge the lanes
+    max_val = neon_softmax_vmaxv<T>(vec_max);
+    vec_sum = wrapper::vmul(
+        vec_sum,
+        wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, wrapper::vdup_n(max_val, ExactTagType{})), beta_vec)));
+    sum = neon_softmax_vaddv<T>(vec_sum);
+
+    // Compute left-over elements
+    for (; x < width; ++x)
+    {
+        const T value = in_ptr[x];
+        on_element(x);
+        if (value > max_val)
+        {
+            sum     = static_cast<T>(sum * std::exp((max_val - value) * beta));
+            max_val = value;
+        }
+        sum += static_cast<T>(std::exp((value - max_val) * beta));
+    }
+}
+
+/** Two-pass softmax along X: an online maximum and sum, then the normalisation
+ *
+ * The row is read twice and written once, instead of read three times and written twice, at the cost of a few more
+ * exponentials. It pays off once the row no longer stays in L1 between the passes.
+ */
+template <typename T, bool IS_LOG>
+void neon_softmax_x_float_online(const ITensor *in, ITensor *out, float beta, const Window &window)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int vec_size = 16 / sizeof(T);
+
+    const int  input_width = in->info()->valid_region().shape.x();
+    const auto beta_vec    = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
+
+    Iterator in_it(in, window);
+    Iterator out_it(out, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const T *in_ptr  = reinterpret_cast<const T *>(in_it.ptr());
+            T       *out_ptr = reinterpret_cast<T *>(out_it.ptr());
+
+            T max_val{};
+            T sum{};
+            neon_softmax_online_max_sum<T>(
+                in_ptr, input_width, beta, max_val, sum, [](int, const auto &) {}, [](int) {});
+
+            const T sum_transformed = IS_LOG ? static_cast<T>(std::log(sum)) : static_cast<T>(T(1) / sum);
+
+            /* Normalize exponentials */
+            const auto vec_max = wrapper::vdup_n(max_val, ExactTagType{});
+            const auto sum_vec = wrapper::vdup_n(sum_transformed, ExactTagType{});
+
+            int x = 0;
+            for (; x <= (input_width - vec_size); x += vec_size)
+            {
+                const auto vec_elements = wrapper::vmul(wrapper::vsub(wrapper::vloadq(in_ptr + x), vec_max), beta_vec);
+                if (IS_LOG)
+                {
+                    wrapper::vstore(out_ptr + x, wrapper::vsub(vec_elements, sum_vec));
+                }
+                else
+                {
+                    wrapper::vstore(out_ptr + x, wrapper::vmul(wrapper::vexpq(vec_elements), sum_vec));
+                }
+            }
+
+            /* Run remaining elements */
+            for (; x < input_width; ++x)
+            {
+                const T element = static_cast<T>((in_ptr[x] - max_val) * beta);
+                if (IS_LOG)
+                {
+                    out_ptr[x] = element - sum_transformed;
+                }
+                else
+                {
+                    out_ptr[x] = static_cast<T>(std::exp(element) * sum_transformed);
+                }
+            }
+        },
+        in_it, out_it);
+}
+
 // The template implementation for float data types is stored in the header file because
 // we need all fp16 instantiated code to live in fp16.cpp files.
 template <typename T, bool IS_LOG>
@@ -69,6 +246,11 @@ void neon_softmax_x_float(const ITensor *in, void *const tmp, ITensor *out, floa
 
     const int input_width = in->info()->valid_region().shape.x();
 
+    if (input_width * static_cast<int>(sizeof(T)) > softmax_online_min_row_bytes)
+    {
+        return neon_softmax_x_float_online<T, IS_LOG>(in, out, beta, window);
+    }
+
     Iterator in_it(in, window);
     Iterator out_it(out, window);
 
@@ -229,192 +411,290 @@ void neon_softmax_x_float(const ITensor *in, void *const tmp, ITensor *out, floa
         },
         in_it, out_it);
 }
+/** Compute the softmax of NumVec adjacent vectors of columns along a non-X axis
+ *
+ * The vectors are processed side by side so that each row of the reduction axis is fetched as one contiguous block
+ * and the exponentials of independent vectors can be interleaved.
+ */
+template <typename T, bool IS_LOG, int NumVec>
+inline void neon_softmax_non_x_float_block(const uint8_t *in_ptr,
+                                           uint8_t       *out_ptr,
+                                           unsigned int   in_axis_stride,
+                                           unsigned int   out_axis_stride,
+                                           int            axis_width,
+                                           float          beta)
+{
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    using VectorType   = typename wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int vec_size = 16 / sizeof(T);
+    const auto    beta_vec = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
+
+    VectorType vec_max[NumVec];
+    VectorType vec_sum[NumVec];
+    for (int v = 0; v < NumVec; ++v)
+    {
+        vec_max[v] = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
+        vec_sum[v] = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+    }
+
+    /* Compute Max */
+    for (int i = 0; i < axis_width; ++i)
+    {
+        const T *const base_ptr_in = reinterpret_cast<const T *>(in_ptr + i * in_axis_stride);
+        for (int v = 0; v < NumVec; ++v)
+        {
+            vec_max[v] = wrapper::vmax(vec_max[v], wrapper::vloadq(base_ptr_in + v * vec_size));
+        }
+    }
+
+    /* Compute exponentials and sum */
+    for (int i = 0; i < axis_width; ++i)
+    {
+        const T *const base_ptr_in  = reinterpret_cast<const T *>(in_ptr + i * in_axis_stride);
+        T *const       base_ptr_out = reinterpret_cast<T *>(out_ptr + i * out_axis_stride);
+        for (int v = 0; v < NumVec; ++v)
+        {
+            auto vec_elements = wrapper::vsub(wrapper::vloadq(base_ptr_in + v * vec_size), vec_max[v]);
+            if (IS_LOG)
+            {
+                vec_elements = wrapper::vmul(vec_elements, beta_vec);
+                vec_sum[v]   = wrapper::vadd(vec_sum[v], wrapper::vexpq(vec_elements));
+            }
+            else
+            {
+                vec_elements = wrapper::vexpq(wrapper::vmul(vec_elements, beta_vec));
+                vec_sum[v]   = wrapper::vadd(vec_sum[v], vec_elements);
+            }
+            wrapper::vstore(base_ptr_out + v * vec_size, vec_elements);
+        }
+    }
+
+    const auto vec_one = wrapper::vdup_n(static_cast<T>(1), ExactTagType{});
+    for (int v = 0; v < NumVec; ++v)
+    {
+        vec_sum[v] = IS_LOG ? wrapper::vlog(vec_sum[v]) : wrapper::vdiv(vec_one, vec_sum[v]);
+    }
+
+    /* Normalize exponentials */
+    for (int i = 0; i < axis_width; ++i)
+    {
+        T *const base_ptr_out = reinterpret_cast<T *>(out_ptr + i * out_axis_stride);
+        for (int v = 0; v < NumVec; ++v)
+        {
+            const auto vec_in = wrapper::vloadq(base_ptr_out + v * vec_size);
+            if (IS_LOG)
+            {
+                wrapper::vstore(base_ptr_out + v * vec_size, wrapper::vsub(vec_in, vec_sum[v]));
+            }
+            else
+            {
+                wrapper::vstore(base_ptr_out + v * vec_size, wrapper::vmul(vec_in, vec_sum[v]));
+            }
+        }
+    }
+}
+
+/** Compute the softmax of fewer columns than a vector holds along a non-X axis */
+template <typename T, bool IS_LOG>
+inline void neon_softmax_non_x_float_leftover(const uint8_t *in_ptr,
+                                              uint8_t       *out_ptr,
+                                              unsigned int   in_axis_stride,
+                                              unsigned int   out_axis_stride,
+                                              int            axis_width,
+                                              float          beta,
+                                              int            num_columns)
+{
+    constexpr int vec_size = 16 / sizeof(T);
+    ARM_COMPUTE_ERROR_ON(num_columns > vec_size);
+
+    T max_val[vec_size];
+    T sum[vec_size];
+    std::fill_n(max_val, vec_size, support::cpp11::lowest<T>());
+    std::fill_n(sum, vec_size, static_cast<T>(0));
+
+    for (int i = 0; i < axis_width; ++i)
+    {
+        const T *const base_ptr_in = reinterpret_cast<const T *>(in_ptr + i * in_axis_stride);
+        for (int j = 0; j < num_columns; ++j)
+        {
+            max_val[j] = std::max(max_val[j], base_ptr_in[j]);
+        }
+    }
+
+    for (int i = 0; i < axis_width; ++i)
+    {
+        const T *const base_ptr_in  = reinterpret_cast<const T *>(in_ptr + i * in_axis_stride);
+        T *const       base_ptr_out = reinterpret_cast<T *>(out_ptr + i * out_axis_stride);
+        for (int j = 0; j < num_columns; ++j)
+        {
+            T element = base_ptr_in[j] - max_val[j];
+            if (IS_LOG)
+            {
+                element = element * static_cast<T>(beta);
+                sum[j] += static_cast<T>(std::exp(element));
+            }
+            else
+            {
+                element = static_cast<T>(std::exp(element * static_cast<T>(beta)));
+                sum[j] += element;
+            }
+            base_ptr_out[j] = element;
+        }
+    }
+
+    for (int j = 0; j < num_columns; ++j)
+    {
+        sum[j] = IS_LOG ? static_cast<T>(std::log(sum[j])) : static_cast<T>(1 / sum[j]);
+    }
+
+    for (int i = 0; i < axis_width; ++i)
+    {
+        T *const base_ptr_out = reinterpret_cast<T *>(out_ptr + i * out_axis_stride);
+        for (int j = 0; j < num_columns; ++j)
+        {
+            if (IS_LOG)
+            {
+                base_ptr_out[j] -= sum[j];
+            }
+            else
+            {
+                base_ptr_out[j] *= sum[j];
+            }
+        }
+    }
+}
+
+/** Compute the softmax along a non-X axis directly on the strided tensor
+ *
+ * Each window step covers a block of adjacent X columns: the reduction walks the softmax axis with the columns spread
+ * across the SIMD lanes, so no permutation of the tensor is needed. A full block spans a 64-byte cache line.
+ */
 template <typename T, bool IS_LOG>
 void neon_softmax_non_x_float(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window)
 {
     ARM_COMPUTE_UNUSED(tmp);
 
-    Iterator in_it(in, window);
-    Iterator out_it(out, window);
+    constexpr int vec_size   = 16 / sizeof(T);
+    constexpr int block_vecs = 64 / 16;
 
-    /** SIMD vector tag type. */
-    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
-
-    const auto         beta_vec        = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
-    constexpr int      vec_size        = 16 / sizeof(T);
     const ITensorInfo *in_info         = in->info();
     const ITensorInfo *out_info        = out->info();
     const int          x_width         = in_info->valid_region().shape.x();
+    const int          window_step_x   = static_cast<int>(window.x().step());
     const unsigned int in_axis_stride  = in_info->strides_in_bytes()[axis];
     const unsigned int out_axis_stride = out_info->strides_in_bytes()[axis];
     const int          axis_width      = in_info->dimension(axis);
 
+    Iterator in_it(in, window);
+    Iterator out_it(out, window);
+
     execute_window_loop(
         window,
         [&](const Coordinates &winCoords)
         {
-            const bool vector_exceeds_bounds = (winCoords[0] + vec_size) > x_width;
+            const int num_columns = std::min(window_step_x, x_width - winCoords[0]);
 
-            /* Get pointers */
             const uint8_t *in_ptr  = in_it.ptr();
             uint8_t       *out_ptr = out_it.ptr();
 
-            // Init max value
-            auto vec_max = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
-
-            /* Compute Max */
+            int x = 0;
+            for (; x <= num_columns - block_vecs * vec_size; x += block_vecs * vec_size)
             {
-                if (!vector_exceeds_bounds)
-                {
-                    int i = 0;
-                    for (; i < axis_width; ++i)
-                    {
-                        const auto current_value =
-                            wrapper::vloadq(reinterpret_cast<const T *>((i * in_axis_stride) + in_ptr));
-                        vec_max = wrapper::vmax(vec_max, current_value);
-                    }
-                }
-                else
-                {
-                    int i = 0;
-                    for (; i < axis_width; ++i)
-                    {
-                        const T *const base_ptr_in = reinterpret_cast<const T *>((i * in_axis_stride) + in_ptr);
-                        int            j           = 0;
-                        for (; j < (x_width - winCoords[0]); ++j)
-                        {
-                            const auto current_value = *(base_ptr_in + j);
-                            vec_max[j]               = std::max(vec_max[j], current_value);
-                        }
-                    }
-                }
-            } // compute max
+                neon_softmax_non_x_float_block<T, IS_LOG, block_vecs>(in_ptr + x * sizeof(T), out_ptr + x * sizeof(T),
+                                                                      in_axis_stride, out_axis_stride, axis_width,
+                                                                      beta);
+            }
+            for (; x <= num_columns - vec_size; x += vec_size)
+            {
+                neon_softmax_non_x_float_block<T, IS_LOG, 1>(in_ptr + x * sizeof(T), out_ptr + x * sizeof(T),
+                                                             in_axis_stride, out_axis_stride, axis_width, beta);
+            }
+            if (x < num_columns)
+            {
+                neon_softmax_non_x_float_leftover<T, IS_LOG>(in_ptr + x * sizeof(T), out_ptr + x * sizeof(T),
+                                                             in_axis_stride, out_axis_stride, axis_width, beta,
+                                                             num_columns - x);
+            }
+        },
+        in_it, out_it);
+}
+/** Softmax probabilities of the k largest elements of every row along X, sorted in descending order
+ *
+ * The maximum, the sum of exponentials and the k largest logits are all found in a single read of the row. Blocks of
+ * vectors whose maximum does not beat the current k-th largest logit are skipped without looking at their elements,
+ * and exponentials are only computed again for the k selected logits. Ties keep the lowest index first.
+ */
+template <typename T>
+void neon_softmax_topk_float(
+    const ITensor *in, ITensor *values, ITensor *indices, float beta, unsigned int k, const Window &window)
+{
+    constexpr int block_size = softmax_online_block_vectors * 16 / static_cast<int>(sizeof(T));
 
-            auto vec_sum_transformed = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+    const int input_width = in->info()->valid_region().shape.x();
 
-            auto vec_elements = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
-            /* Init sum to zero */
-            auto vec_sum = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+    Iterator in_it(in, window);
+    Iterator values_it(values, window);
+    Iterator indices_it(indices, window);
 
-            /* Compute exponentials and sum */
-            {
-                if (!vector_exceeds_bounds)
-                {
-                    const auto vec_one = wrapper::vdup_n(static_cast<T>(1), ExactTagType{});
-                    /* Loop over row and compute exponentials and sum */
-                    int i = 0;
-                    for (; i < axis_width; ++i)
-                    {
-                        vec_elements = wrapper::vloadq(reinterpret_cast<const T *>((i * in_axis_stride) + in_ptr));
-                        vec_elements = wrapper::vsub(vec_elements, vec_max);
-                        if (IS_LOG)
-                        {
-                            vec_elements = wrapper::vmul(vec_elements, beta_vec);
-                            vec_sum      = wrapper::vadd(vec_sum, wrapper::vexpq(vec_elements));
-                        }
-                        else
-                        {
-                            vec_elements = wrapper::vexpq(wrapper::vmul(vec_elements, beta_vec));
-                            vec_sum      = wrapper::vadd(vec_sum, vec_elements);
-                        }
+    std::vector<T>        top_values(k);
+    std::vector<uint32_t> top_indices(k);
 
-                        wrapper::vstore(reinterpret_cast<T *>((i * out_axis_stride) + out_ptr), vec_elements);
-                    }
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const T *in_ptr = reinterpret_cast<const T *>(in_it.ptr());
 
-                    if (!IS_LOG)
-                    {
-                        vec_sum_transformed = wrapper::vdiv(vec_one, vec_sum);
-                    }
-                    else
-                    {
-                        vec_sum_transformed = wrapper::vlog(vec_sum);
-                    }
-                }
-                else
+            unsigned int count  = 0;
+            auto         insert = [&](int x)
+            {
+                const T value = in_ptr[x];
+                if (count == k && !(value > top_values[k - 1]))
                 {
-                    int i = 0;
-                    for (; i < axis_width; ++i)
-                    {
-                        const T *const base_ptr_in  = reinterpret_cast<const T *>((i * in_axis_stride) + in_ptr);
-                        T *const       base_ptr_out = reinterpret_cast<T *>((i * out_axis_stride) + out_ptr);
-                        int            j            = 0;
-                        for (; j < (x_width - winCoords[0]); ++j)
-                        {
-                            vec_elements[j] = *(base_ptr_in + j);
-                            vec_elements[j] -= vec_max[j];
-                            if (IS_LOG)
-                            {
-                                vec_elements[j] *= beta;
-                                vec_sum[j] += std::exp(vec_elements[j]);
-                            }
-                            else
-                            {
-                                vec_elements[j] = std::exp(vec_elements[j] * beta);
-                                vec_sum[j] += vec_elements[j];
-                            }
-                            *(base_ptr_out + j) = vec_elements[j];
-                        }
-                    }
-                    int j = 0;
-                    for (; j < (x_width - winCoords[0]); ++j)
-                    {
-                        if (!IS_LOG)
-                        {
-                            vec_sum_transformed[j] = 1 / vec_sum[j];
-                        }
-                        else
-                        {
-                            vec_sum_transformed[j] = std::log(vec_sum[j]);
-                        }
-                    }
+                    return;
                 }
-            } // Compute exponentials and sum
-
-            /* Normalize exponentials */
-            {
-                if (!vector_exceeds_bounds)
+                unsigned int pos = (count < k) ? count++ : k - 1;
+                for (; pos > 0 && value > top_values[pos - 1]; --pos)
                 {
-                    /* Loop over row and compute softmax */
-                    int i = 0;
-                    for (; i < axis_width; ++i)
-                    {
-                        T *const base_ptr_out = reinterpret_cast<T *>((i * out_axis_stride) + out_ptr);
-                        auto     vec_in       = wrapper::vloadq(base_ptr_out);
-                        if (IS_LOG)
-                        {
-                            wrapper::vstore(base_ptr_out, wrapper::vsub(vec_in, vec_sum_transformed));
-                        }
-                        else
-                        {
-                            wrapper::vstore(base_ptr_out, wrapper::vmul(vec_in, vec_sum_transformed));
-                        }
-                    }
+                    top_values[pos]  = top_values[pos - 1];
+                    top_indices[pos] = top_indices[pos - 1];
                 }
-                else
+                top_values[pos]  = value;
+                top_indices[pos] = static_cast<uint32_t>(x);
+            };
+
+            T max_val{};
+            T sum{};
+            neon_softmax_online_max_sum<T>(
+                in_ptr, input_width, beta, max_val, sum,
+                [&](int x, const auto &block_max)
                 {
-                    int i = 0;
-                    for (; i < axis_width; ++i)
+                    if (count < k || neon_softmax_vmaxv<T>(block_max) > top_values[k - 1])
                     {
-                        T *const base_ptr_out = reinterpret_cast<T *>((i * out_axis_stride) + out_ptr);
-                        int      j            = 0;
-                        for (; j < (x_width - winCoords[0]); ++j)
+                        for (int i = 0; i < block_size; ++i)
                         {
-                            if (IS_LOG)
-                            {
-                                *(base_ptr_out + j) -= vec_sum_transformed[j];
-                            }
-                            else
-                            {
-                                *(base_ptr_out + j) *= vec_sum_transformed[j];
-                            }
+                            insert(x + i);
                         }
                     }
-                }
-            } // Normalize exponentials
+                },
+                insert);
+
+            T        *values_ptr  = reinterpret_cast<T *>(values_it.ptr());
+            uint32_t *indices_ptr = reinterpret_cast<uint32_t *>(indices_it.ptr());
+
+            const float inv_sum = 1.f / static_cast<float>(sum);
+            for (unsigned int i = 0; i < k; ++i)
+            {
+                values_ptr[i]  = static_cast<T>(std::exp((top_values[i] - max_val) * beta) * inv_sum);
+                indices_ptr[i] = top_indices[i];
+            }
         },
-        in_it, out_it);
+        in_it, values_it, indices_it);
 }
+
 template <typename T, bool IS_LOG>
 void neon_softmax_x_quantized(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,13 @@ DECLARE_SOFTMAX_KERNEL(neon_fp16_softmax);
 DECLARE_SOFTMAX_KERNEL(neon_qasymm8_softmax);
 DECLARE_SOFTMAX_KERNEL(neon_qasymm8_signed_softmax);
 
+#define DECLARE_SOFTMAX_TOPK_KERNEL(func_name)                                                          \
+    void func_name(const ITensor *in, ITensor *values, ITensor *indices, float beta, unsigned int k, \
+                   const Window &window)
+
+DECLARE_SOFTMAX_TOPK_KERNEL(neon_fp32_softmax_topk);
+DECLARE_SOFTMAX_TOPK_KERNEL(neon_fp16_softmax_topk);
+
 #ifdef ARM_COMPUTE_ENABLE_SME2
 
 void sme2_fp32_softmax(const ITensor *in,
@@ -87,6 +94,7 @@ void sve_softmax_bf16(const ITensor *in,
 #endif // ARM_COMPUTE_ENABLE_BF16
 
 #undef DECLARE_SOFTMAX_KERNEL
+#undef DECLARE_SOFTMAX_TOPK_KERNEL
 } // namespace cpu
 } // namespace arm_compute
 
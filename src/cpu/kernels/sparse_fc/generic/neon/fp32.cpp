@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/sparse_fc/list.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+struct SparseFcArgs
+{
+    const int32_t *row_ptr;
+    const int32_t *col_idx;
+    const float   *values;
+    const float   *bias;
+    float32x4_t    lo;
+    float32x4_t    hi;
+};
+
+inline float32x4_t clamp(const SparseFcArgs &args, float32x4_t v)
+{
+    return vminq_f32(vmaxq_f32(v, args.lo), args.hi);
+}
+
+inline float32x4_t load_bias(const SparseFcArgs &args, int offset)
+{
+    return (args.bias != nullptr) ? vld1q_f32(args.bias + offset) : vdupq_n_f32(0.f);
+}
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    const float32x2_t t = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(t, t), 0);
+#endif // __aarch64__
+}
+
+/** 1x4 blocks: 4 consecutive weights of a single output channel, reduced once per row block */
+void row_block_1x4(const SparseFcArgs &args, const float *src, float *dst, int rb)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    int       j   = args.row_ptr[rb];
+    const int end = args.row_ptr[rb + 1];
+    for (; j + 1 < end; j += 2)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(args.values + j * 4), vld1q_f32(src + args.col_idx[j]));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(args.values + (j + 1) * 4), vld1q_f32(src + args.col_idx[j + 1]));
+    }
+    if (j < end)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(args.values + j * 4), vld1q_f32(src + args.col_idx[j]));
+    }
+
+    const float res = reduce_add(vaddq_f32(acc0, acc1)) + ((args.bias != nullptr) ? args.bias[rb] : 0.f);
+    dst[rb]         = vgetq_lane_f32(clamp(args, vdupq_n_f32(res)), 0);
+}
+
+/** 4x4 blocks: stored input-major so every input channel scales a column of 4 outputs */
+void row_block_4x4(const SparseFcArgs &args, const float *src, float *dst, int rb)
+{
+    float32x4_t acc0 = load_bias(args, rb * 4);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    for (int j = args.row_ptr[rb]; j < args.row_ptr[rb + 1]; ++j)
+    {
+        const float       *v  = args.values + j * 16;
+        const float32x4_t  in = vld1q_f32(src + args.col_idx[j]);
+        const float32x2_t  lo = vget_low_f32(in);
+        const float32x2_t  hi = vget_high_f32(in);
+
+        acc0 = vmlaq_lane_f32(acc0, vld1q_f32(v), lo, 0);
+        acc1 = vmlaq_lane_f32(acc1, vld1q_f32(v + 4), lo, 1);
+        acc0 = vmlaq_lane_f32(acc0, vld1q_f32(v + 8), hi, 0);
+        acc1 = vmlaq_lane_f32(acc1, vld1q_f32(v + 12), hi, 1);
+    }
+
+    vst1q_f32(dst + rb * 4, clamp(args, vaddq_f32(acc0, acc1)));
+}
+
+/** 8x1 blocks: a single input channel broadcast over 8 outputs */
+void row_block_8x1(const SparseFcArgs &args, const float *src, float *dst, int rb)
+{
+    float32x4_t acc0 = load_bias(args, rb * 8);
+    float32x4_t acc1 = load_bias(args, rb * 8 + 4);
+
+    for (int j = args.row_ptr[rb]; j < args.row_ptr[rb + 1]; ++j)
+    {
+        const float      *v  = args.values + j * 8;
+        const float32x4_t in = vdupq_n_f32(src[args.col_idx[j]]);
+
+        acc0 = vmlaq_f32(acc0, vld1q_f32(v), in);
+        acc1 = vmlaq_f32(acc1, vld1q_f32(v + 4), in);
+    }
+
+    vst1q_f32(dst + rb * 8, clamp(args, acc0));
+    vst1q_f32(dst + rb * 8 + 4, clamp(args, acc1));
+}
+} // namespace
+
+void neon_fp32_sparse_fc(const ITensor                       *src,
+                         const ITensor                       *packed,
+                         const ITensor                       *bias,
+                         ITensor                             *dst,
+                         const SparseFullyConnectedLayerInfo &info,
+                         const Window                        &window)
+{
+    const unsigned int block_height   = sparse_block_height(info.block_shape);
+    const unsigned int num_row_blocks = dst->info()->dimension(0) / block_height;
+
+    const uint8_t *packed_ptr = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+
+    SparseFcArgs args{};
+    args.row_ptr = reinterpret_cast<const int32_t *>(packed_ptr);
+    args.col_idx = args.row_ptr + num_row_blocks + 1;
+    args.values  = reinterpret_cast<const float *>(
+        packed_ptr + sparse_fc_values_offset(num_row_blocks, args.row_ptr[num_row_blocks]));
+    args.bias =
+        (bias != nullptr) ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                          : nullptr;
+
+    float lo = std::numeric_limits<float>::lowest();
+    float hi = std::numeric_limits<float>::max();
+    if (info.activation_info.enabled())
+    {
+        switch (info.activation_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                lo = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                lo = 0.f;
+                hi = info.activation_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                lo = info.activation_info.b();
+                hi = info.activation_info.a();
+                break;
+            default:
+                break;
+        }
+    }
+    args.lo = vdupq_n_f32(lo);
+    args.hi = vdupq_n_f32(hi);
+
+    void (*row_block)(const SparseFcArgs &, const float *, float *, int) = nullptr;
+    switch (info.block_shape)
+    {
+        case SparseBlockShape::Block4x4:
+            row_block = &row_block_4x4;
+            break;
+        case SparseBlockShape::Block8x1:
+            row_block = &row_block_8x1;
+            break;
+        case SparseBlockShape::Block1x4:
+        default:
+            row_block = &row_block_1x4;
+            break;
+    }
+
+    const uint8_t *src_ptr    = src->buffer() + src->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr    = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    const size_t   src_stride = src->info()->strides_in_bytes()[1];
+    const size_t   dst_stride = dst->info()->strides_in_bytes()[1];
+
+    // Row blocks are the outer loop so the blocks of one row stay in cache while every source row is processed.
+    for (int rb = window.x().start(); rb < window.x().end(); ++rb)
+    {
+        for (int m = window.y().start(); m < window.y().end(); ++m)
+        {
+            row_block(args, reinterpret_cast<const float *>(src_ptr + m * src_stride),
+                      reinterpret_cast<float *>(dst_ptr + m * dst_stride), rb);
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
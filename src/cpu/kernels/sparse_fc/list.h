@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_SPARSE_FC_LIST_H
+#define ACL_SRC_CPU_KERNELS_SPARSE_FC_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of output channels covered by a block */
+inline unsigned int sparse_block_height(SparseBlockShape shape)
+{
+    switch (shape)
+    {
+        case SparseBlockShape::Block4x4:
+            return 4;
+        case SparseBlockShape::Block8x1:
+            return 8;
+        case SparseBlockShape::Block1x4:
+        default:
+            return 1;
+    }
+}
+
+/** Number of input channels covered by a block */
+inline unsigned int sparse_block_width(SparseBlockShape shape)
+{
+    return (shape == SparseBlockShape::Block8x1) ? 1 : 4;
+}
+
+/** Byte offset of the block values in a packed weights buffer
+ *
+ * The buffer starts with the (num_row_blocks + 1) row offsets followed by the first input channel of each of the
+ * num_blocks blocks, all int32.
+ */
+inline size_t sparse_fc_values_offset(unsigned int num_row_blocks, unsigned int num_blocks)
+{
+    return ceil_to_multiple((num_row_blocks + 1 + num_blocks) * sizeof(int32_t), static_cast<size_t>(16));
+}
+
+#define DECLARE_SPARSE_FC_KERNEL(func_name)                                                   \
+    void func_name(const ITensor *src, const ITensor *packed, const ITensor *bias, ITensor *dst, \
+                   const SparseFullyConnectedLayerInfo &info, const Window &window)
+
+DECLARE_SPARSE_FC_KERNEL(neon_fp32_sparse_fc);
+
+#undef DECLARE_SPARSE_FC_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_SPARSE_FC_LIST_H
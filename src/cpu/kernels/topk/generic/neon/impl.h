@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/topk/list.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Number of vectors compared to the selection threshold at once */
+constexpr int topk_block_vectors = 4;
+/** Minimum number of candidates buffered between two partial selections */
+constexpr size_t topk_min_capacity = 256;
+/** Index of the unused partial results of a chunk shorter than k */
+constexpr uint32_t topk_invalid_index = 0xFFFFFFFFU;
+
+/** Whether any lane of @p mask is set */
+inline bool topk_any(uint32x4_t mask)
+{
+#ifdef __aarch64__
+    return vmaxvq_u32(mask) != 0;
+#else  // __aarch64__
+    const uint32x2_t m = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return (vget_lane_u32(m, 0) | vget_lane_u32(m, 1)) != 0;
+#endif // __aarch64__
+}
+
+/** Vector helpers comparing blocks of @ref topk_block_vectors vectors of a row to the selection threshold
+ *
+ * NaN lanes never compare greater, which matches their rank after every number.
+ */
+template <typename T>
+struct TopKVector;
+
+template <>
+struct TopKVector<float>
+{
+    using type                = float32x4_t;
+    static constexpr int size = 4;
+
+    static float32x4_t dup(float value)
+    {
+        return vdupq_n_f32(value);
+    }
+    static bool any_greater(const float *ptr, const float32x4_t &threshold)
+    {
+        const uint32x4_t m0 = vcgtq_f32(vld1q_f32(ptr), threshold);
+        const uint32x4_t m1 = vcgtq_f32(vld1q_f32(ptr + 4), threshold);
+        const uint32x4_t m2 = vcgtq_f32(vld1q_f32(ptr + 8), threshold);
+        const uint32x4_t m3 = vcgtq_f32(vld1q_f32(ptr + 12), threshold);
+        return topk_any(vorrq_u32(vorrq_u32(m0, m1), vorrq_u32(m2, m3)));
+    }
+};
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+struct TopKVector<float16_t>
+{
+    using type                = float16x8_t;
+    static constexpr int size = 8;
+
+    static float16x8_t dup(float16_t value)
+    {
+        return vdupq_n_f16(value);
+    }
+    static bool any_greater(const float16_t *ptr, const float16x8_t &threshold)
+    {
+        const uint16x8_t m0 = vcgtq_f16(vld1q_f16(ptr), threshold);
+        const uint16x8_t m1 = vcgtq_f16(vld1q_f16(ptr + 8), threshold);
+        const uint16x8_t m2 = vcgtq_f16(vld1q_f16(ptr + 16), threshold);
+        const uint16x8_t m3 = vcgtq_f16(vld1q_f16(ptr + 24), threshold);
+        return topk_any(vreinterpretq_u32_u16(vorrq_u16(vorrq_u16(m0, m1), vorrq_u16(m2, m3))));
+    }
+};
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+template <typename T>
+struct TopKCandidate
+{
+    T        value;
+    uint32_t index;
+};
+
+/** Whether @p a ranks before @p b: larger values first, NaNs after every number and the lower index first on ties */
+template <typename T>
+inline bool topk_ranks_before(const TopKCandidate<T> &a, const TopKCandidate<T> &b)
+{
+    const bool a_is_nan = a.value != a.value;
+    const bool b_is_nan = b.value != b.value;
+    if (a_is_nan || b_is_nan)
+    {
+        return (a_is_nan == b_is_nan) ? a.index < b.index : b_is_nan;
+    }
+    if (a.value != b.value)
+    {
+        return a.value > b.value;
+    }
+    return a.index < b.index;
+}
+
+/** Streaming selection of the k best elements of a row
+ *
+ * Elements are buffered as candidates until the buffer is full, then a partial selection keeps the k best candidates
+ * and the k-th best value becomes a threshold the following elements must beat. Elements are pushed in increasing
+ * index order, so an element equal to the threshold ranks after it and is dropped as well. Once the threshold is set,
+ * rows are compared to it block by block with vector instructions and only the blocks holding a greater element are
+ * looked at one element at a time: past the first few blocks, a long row is read at the speed of the comparisons.
+ */
+template <typename T>
+class TopKSelector
+{
+public:
+    explicit TopKSelector(unsigned int k)
+        : _k(k), _capacity(std::max<size_t>(2 * static_cast<size_t>(k), topk_min_capacity))
+    {
+        _candidates.reserve(_capacity);
+    }
+
+    /** Forget the candidates of the previous row */
+    void reset()
+    {
+        _candidates.clear();
+        _has_threshold = false;
+    }
+
+    /** Push a single element, which must have a greater index than the elements already pushed */
+    void push(T value, uint32_t index)
+    {
+        if (_has_threshold && !(value > _threshold))
+        {
+            return;
+        }
+        _candidates.push_back({value, index});
+        if (_candidates.size() == _capacity)
+        {
+            compact();
+        }
+    }
+
+    /** Push the @p len consecutive elements at @p row, the first one having index @p first_index */
+    void push_row(const T *row, int len, uint32_t first_index)
+    {
+        constexpr int block_size = topk_block_vectors * TopKVector<T>::size;
+
+        int x = 0;
+        for (; x <= len - block_size; x += block_size)
+        {
+            if (_has_threshold && !TopKVector<T>::any_greater(row + x, _vthreshold))
+            {
+                continue;
+            }
+            for (int i = x; i < x + block_size; ++i)
+            {
+                push(row[i], first_index + i);
+            }
+        }
+        for (; x < len; ++x)
+        {
+            push(row[x], first_index + x);
+        }
+    }
+
+    /** Sort the best candidates
+     *
+     * @return the number of sorted candidates at the start of candidates(): k, or fewer if fewer were pushed
+     */
+    size_t sort()
+    {
+        const size_t count = std::min<size_t>(_k, _candidates.size());
+        if (count != 0 && count < _candidates.size())
+        {
+            std::nth_element(_candidates.begin(), _candidates.begin() + (count - 1), _candidates.end(),
+                             topk_ranks_before<T>);
+        }
+        std::sort(_candidates.begin(), _candidates.begin() + count, topk_ranks_before<T>);
+        return count;
+    }
+
+    const TopKCandidate<T> *candidates() const
+    {
+        return _candidates.data();
+    }
+
+private:
+    void compact()
+    {
+        std::nth_element(_candidates.begin(), _candidates.begin() + (_k - 1), _candidates.end(), topk_ranks_before<T>);
+        _candidates.resize(_k);
+
+        // A NaN ranks after every number, so it cannot be used to filter the next elements
+        const T kth    = _candidates[_k - 1].value;
+        _has_threshold = !(kth != kth);
+        _threshold     = kth;
+        _vthreshold    = TopKVector<T>::dup(kth);
+    }
+
+    unsigned int                  _k;
+    size_t                        _capacity;
+    std::vector<TopKCandidate<T>> _candidates{};
+    bool                          _has_threshold{false};
+    T                             _threshold{};
+    typename TopKVector<T>::type  _vthreshold{};
+};
+
+/** Address of the first element of the row of @p tensor at the coordinates @p id, whatever the X coordinate */
+inline uint8_t *topk_row_ptr(const ITensor *tensor, const Coordinates &id)
+{
+    const ITensorInfo &info = *tensor->info();
+    uint8_t           *ptr  = tensor->buffer() + info.offset_first_element_in_bytes();
+    for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+    {
+        ptr += id[d] * info.strides_in_bytes()[d];
+    }
+    return ptr;
+}
+
+/** Write the @p count sorted candidates of @p selector to a row of values and a row of indices */
+template <typename T>
+void topk_store_row(const TopKSelector<T> &selector, size_t count, uint8_t *values_ptr, uint8_t *indices_ptr)
+{
+    const TopKCandidate<T> *candidates = selector.candidates();
+    auto                   *values     = reinterpret_cast<T *>(values_ptr);
+    auto                   *indices    = reinterpret_cast<uint32_t *>(indices_ptr);
+    for (size_t i = 0; i < count; ++i)
+    {
+        values[i]  = candidates[i].value;
+        indices[i] = candidates[i].index;
+    }
+}
+
+/** Select the top-k of every row covered by @p window */
+template <typename T>
+void topk_full_window(const ITensor *src, ITensor *values, ITensor *indices, unsigned int k, const Window &window)
+{
+    const int       len = static_cast<int>(src->info()->dimension(0));
+    TopKSelector<T> selector(k);
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            selector.reset();
+                            selector.push_row(reinterpret_cast<const T *>(topk_row_ptr(src, id)), len, 0);
+                            const size_t count = selector.sort();
+                            topk_store_row(selector, count, topk_row_ptr(values, id), topk_row_ptr(indices, id));
+                        });
+}
+
+/** Select the top-k of every chunk of a row covered by @p window into @p partials
+ *
+ * The window iterates over the chunks along X. Each chunk writes k candidates to @p partials, each taking two 32-bit
+ * slots: the value and its index. The candidates of a chunk shorter than k are padded with @ref topk_invalid_index.
+ */
+template <typename T>
+void topk_partial_window(const ITensor *src, ITensor *partials, unsigned int k, const Window &window)
+{
+    // The chunk length only depends on the shapes, so the results do not depend on the number of threads
+    const int len        = static_cast<int>(src->info()->dimension(0));
+    const int num_chunks = static_cast<int>(partials->info()->dimension(0) / (2 * k));
+    const int chunk_len  = DIV_CEIL(len, num_chunks);
+
+    TopKSelector<T> selector(k);
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            const int start = std::min(len, id.x() * chunk_len);
+                            const int end   = std::min(len, start + chunk_len);
+                            const T  *row   = reinterpret_cast<const T *>(topk_row_ptr(src, id));
+
+                            selector.reset();
+                            selector.push_row(row + start, end - start, static_cast<uint32_t>(start));
+                            const size_t count = selector.sort();
+
+                            const TopKCandidate<T> *candidates = selector.candidates();
+                            auto *out = reinterpret_cast<uint32_t *>(topk_row_ptr(partials, id)) + 2 * k * id.x();
+                            for (size_t i = 0; i < k; ++i)
+                            {
+                                if (i < count)
+                                {
+                                    std::memcpy(out + 2 * i, &candidates[i].value, sizeof(T));
+                                    out[2 * i + 1] = candidates[i].index;
+                                }
+                                else
+                                {
+                                    out[2 * i]     = 0;
+                                    out[2 * i + 1] = topk_invalid_index;
+                                }
+                            }
+                        });
+}
+
+/** Select the top-k of every row covered by @p window among the candidates of its chunks in @p partials */
+template <typename T>
+void topk_combine_window(
+    const ITensor *partials, ITensor *values, ITensor *indices, unsigned int k, const Window &window)
+{
+    const size_t    num_partials = partials->info()->dimension(0) / 2;
+    TopKSelector<T> selector(k);
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            const auto *in = reinterpret_cast<const uint32_t *>(topk_row_ptr(partials, id));
+
+                            // The chunks are pushed in order and the candidates of a chunk are sorted, so the
+                            // candidates equal to the threshold still arrive in increasing index order
+                            selector.reset();
+                            for (size_t i = 0; i < num_partials; ++i)
+                            {
+                                if (in[2 * i + 1] != topk_invalid_index)
+                                {
+                                    T value;
+                                    std::memcpy(&value, in + 2 * i, sizeof(T));
+                                    selector.push(value, in[2 * i + 1]);
+                                }
+                            }
+                            const size_t count = selector.sort();
+                            topk_store_row(selector, count, topk_row_ptr(values, id), topk_row_ptr(indices, id));
+                        });
+}
+} // namespace detail
+
+template <typename T>
+void topk(const ITensor *src,
+          ITensor       *values,
+          ITensor       *indices,
+          ITensor       *partials,
+          unsigned int   k,
+          TopKStage      stage,
+          const Window  &window)
+{
+    switch (stage)
+    {
+        case TopKStage::Partial:
+            detail::topk_partial_window<T>(src, partials, k, window);
+            break;
+        case TopKStage::Combine:
+            detail::topk_combine_window<T>(partials, values, indices, k, window);
+            break;
+        default:
+            detail::topk_full_window<T>(src, values, indices, k, window);
+            break;
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
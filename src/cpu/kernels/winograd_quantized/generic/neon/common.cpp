@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/winograd_quantized/generic/neon/impl.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+template <int lane>
+inline void mla_lane(int32x4_t (&acc)[4][2], const int16x4_t (&a)[4], const int16x8_t &b)
+{
+    for (int r = 0; r < 4; ++r)
+    {
+        acc[r][0] = vmlal_lane_s16(acc[r][0], vget_low_s16(b), a[r], lane);
+        acc[r][1] = vmlal_lane_s16(acc[r][1], vget_high_s16(b), a[r], lane);
+    }
+}
+} // namespace
+
+void neon_u8_winograd_f2x2_3x3_weight_transform(const ITensor *weights,
+                                                ITensor       *dst,
+                                                int32_t        weights_offset,
+                                                const Window  &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "neon_u8_winograd_f2x2_3x3_weight_transform");
+    winograd_f2x2_3x3_weight_transform<uint8_t>(weights, dst, weights_offset, window);
+}
+
+void neon_s8_winograd_f2x2_3x3_weight_transform(const ITensor *weights,
+                                                ITensor       *dst,
+                                                int32_t        weights_offset,
+                                                const Window  &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "neon_s8_winograd_f2x2_3x3_weight_transform");
+    winograd_f2x2_3x3_weight_transform<int8_t>(weights, dst, weights_offset, window);
+}
+
+void neon_s16_winograd_gemm(const ITensor *lhs, const ITensor *rhs, ITensor *dst, const Window &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_s16_winograd_gemm");
+
+    const int K = static_cast<int>(lhs->info()->dimension(0));
+    const int M = static_cast<int>(lhs->info()->dimension(1));
+    const int N = static_cast<int>(rhs->info()->dimension(0));
+
+    const size_t lhs_row_stride    = lhs->info()->strides_in_bytes()[1] / sizeof(int16_t);
+    const size_t lhs_matrix_stride = lhs->info()->strides_in_bytes()[2] / sizeof(int16_t);
+    const size_t rhs_row_stride    = rhs->info()->strides_in_bytes()[1] / sizeof(int16_t);
+    const size_t rhs_matrix_stride = rhs->info()->strides_in_bytes()[2] / sizeof(int16_t);
+    const size_t dst_row_stride    = dst->info()->strides_in_bytes()[1] / sizeof(int32_t);
+    const size_t dst_matrix_stride = dst->info()->strides_in_bytes()[2] / sizeof(int32_t);
+
+    const auto lhs_ptr =
+        reinterpret_cast<const int16_t *>(lhs->buffer() + lhs->info()->offset_first_element_in_bytes());
+    const auto rhs_ptr =
+        reinterpret_cast<const int16_t *>(rhs->buffer() + rhs->info()->offset_first_element_in_bytes());
+    const auto dst_ptr = reinterpret_cast<int32_t *>(dst->buffer() + dst->info()->offset_first_element_in_bytes());
+
+    const int32x4_t vzero = vdupq_n_s32(0);
+
+    for (int z = window.x().start(); z < window.x().end(); ++z)
+    {
+        const int16_t *rhs_matrix = rhs_ptr + z * rhs_matrix_stride;
+
+        // Blocks of 4 rows x 8 columns; the products are accumulated with wrap-around, see impl.h
+        for (int m0 = window.y().start(); m0 < std::min(window.y().end(), M); m0 += window.y().step())
+        {
+            const int rows = std::min(4, M - m0);
+
+            // Missing rows of the last block repeat the previous one and are not stored
+            const int16_t *a[4];
+            int32_t       *c[4];
+            for (int r = 0; r < 4; ++r)
+            {
+                const int row = m0 + std::min(r, rows - 1);
+                a[r]          = lhs_ptr + z * lhs_matrix_stride + row * lhs_row_stride;
+                c[r]          = dst_ptr + z * dst_matrix_stride + row * dst_row_stride;
+            }
+
+            int n = 0;
+            for (; n <= N - 8; n += 8)
+            {
+                int32x4_t acc[4][2] = {{vzero, vzero}, {vzero, vzero}, {vzero, vzero}, {vzero, vzero}};
+
+                int k = 0;
+                for (; k <= K - 4; k += 4)
+                {
+                    const int16x4_t a_k[4] = {vld1_s16(a[0] + k), vld1_s16(a[1] + k), vld1_s16(a[2] + k),
+                                              vld1_s16(a[3] + k)};
+                    mla_lane<0>(acc, a_k, vld1q_s16(rhs_matrix + (k + 0) * rhs_row_stride + n));
+                    mla_lane<1>(acc, a_k, vld1q_s16(rhs_matrix + (k + 1) * rhs_row_stride + n));
+                    mla_lane<2>(acc, a_k, vld1q_s16(rhs_matrix + (k + 2) * rhs_row_stride + n));
+                    mla_lane<3>(acc, a_k, vld1q_s16(rhs_matrix + (k + 3) * rhs_row_stride + n));
+                }
+                for (; k < K; ++k)
+                {
+                    const int16x8_t b = vld1q_s16(rhs_matrix + k * rhs_row_stride + n);
+                    for (int r = 0; r < 4; ++r)
+                    {
+                        acc[r][0] = vmlal_n_s16(acc[r][0], vget_low_s16(b), a[r][k]);
+                        acc[r][1] = vmlal_n_s16(acc[r][1], vget_high_s16(b), a[r][k]);
+                    }
+                }
+
+                for (int r = 0; r < rows; ++r)
+                {
+                    vst1q_s32(c[r] + n, acc[r][0]);
+                    vst1q_s32(c[r] + n + 4, acc[r][1]);
+                }
+            }
+
+            // Left-over columns
+            for (; n < N; ++n)
+            {
+                for (int r = 0; r < rows; ++r)
+                {
+                    uint32_t acc = 0;
+                    for (int k = 0; k < K; ++k)
+                    {
+                        acc += static_cast<uint32_t>(static_cast<int32_t>(a[r][k]) *
+                                                     rhs_matrix[k * rhs_row_stride + n]);
+                    }
+                    c[r][n] = static_cast<int32_t>(acc);
+                }
+            }
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
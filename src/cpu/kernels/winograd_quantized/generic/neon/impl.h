@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_WINOGRAD_QUANTIZED_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_WINOGRAD_QUANTIZED_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/cpu/kernels/winograd_quantized/list.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace winograd_quantized
+{
+// Input and weight transforms cannot overflow int16. The GEMM output and the output transform rely on two's
+// complement wrap-around instead: only the final 4 * convolution sum is guaranteed to fit int32, see
+// CpuWinogradConv2dQuantized::validate().
+inline int16x8_t add(int16x8_t a, int16x8_t b)
+{
+    return vaddq_s16(a, b);
+}
+
+inline int16x8_t sub(int16x8_t a, int16x8_t b)
+{
+    return vsubq_s16(a, b);
+}
+
+inline int16_t add(int16_t a, int16_t b)
+{
+    return static_cast<int16_t>(a + b);
+}
+
+inline int16_t sub(int16_t a, int16_t b)
+{
+    return static_cast<int16_t>(a - b);
+}
+
+inline int32x4_t add(int32x4_t a, int32x4_t b)
+{
+    return vaddq_s32(a, b);
+}
+
+inline int32x4_t sub(int32x4_t a, int32x4_t b)
+{
+    return vsubq_s32(a, b);
+}
+
+inline int32_t add(int32_t a, int32_t b)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+}
+
+inline int32_t sub(int32_t a, int32_t b)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(a) - static_cast<uint32_t>(b));
+}
+
+/** V = B^T d B, with B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]. Element (i, j) is written to out[4 * i + j] */
+template <typename V>
+inline void input_transform_4x4(const V (&d)[4][4], V (&out)[16])
+{
+    V t[4][4];
+    for (int j = 0; j < 4; ++j)
+    {
+        t[0][j] = sub(d[0][j], d[2][j]);
+        t[1][j] = add(d[1][j], d[2][j]);
+        t[2][j] = sub(d[2][j], d[1][j]);
+        t[3][j] = sub(d[1][j], d[3][j]);
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        out[4 * i + 0] = sub(t[i][0], t[i][2]);
+        out[4 * i + 1] = add(t[i][1], t[i][2]);
+        out[4 * i + 2] = sub(t[i][2], t[i][1]);
+        out[4 * i + 3] = sub(t[i][1], t[i][3]);
+    }
+}
+
+/** Y = A^T M A, with A^T = [1 1 1 0; 0 1 -1 -1]. Element (i, j) of M is read from m[4 * i + j] */
+template <typename V>
+inline void output_transform_4x4(const V (&m)[16], V (&y)[2][2])
+{
+    V t[2][4];
+    for (int j = 0; j < 4; ++j)
+    {
+        t[0][j] = add(add(m[j], m[4 + j]), m[8 + j]);
+        t[1][j] = sub(sub(m[4 + j], m[8 + j]), m[12 + j]);
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+        y[i][0] = add(add(t[i][0], t[i][1]), t[i][2]);
+        y[i][1] = sub(sub(t[i][1], t[i][2]), t[i][3]);
+    }
+}
+
+inline int16x8_t load_centred(const uint8_t *ptr, const int16x8_t &offset)
+{
+    return vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr))), offset);
+}
+
+inline int16x8_t load_centred(const int8_t *ptr, const int16x8_t &offset)
+{
+    return vsubq_s16(vmovl_s8(vld1_s8(ptr)), offset);
+}
+
+inline void store_narrow(uint8_t *ptr, const int32x4_t &lo, const int32x4_t &hi)
+{
+    vst1_u8(ptr, vqmovun_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+}
+
+inline void store_narrow(int8_t *ptr, const int32x4_t &lo, const int32x4_t &hi)
+{
+    vst1_s8(ptr, vqmovn_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+}
+
+/** Vector counterpart of the per-channel @ref finalize_quantization_symm, stopping before the narrowing */
+inline int32x4_t requantize(const int32x4_t &in,
+                            const int32x4_t &multiplier,
+                            const int32x4_t &shift,
+                            const int32x4_t &offset,
+                            const int32x4_t &min,
+                            const int32x4_t &max)
+{
+    const int32x4_t res_shift_gt0 = rounding_divide_by_pow2(vqdmulhq_s32(in, multiplier), shift);
+    const int32x4_t res_shift_lt0 =
+        vqdmulhq_s32(vmulq_s32(in, vshlq_s32(vdupq_n_s32(1), vnegq_s32(shift))), multiplier);
+    const int32x4_t res = vbslq_s32(vcltq_s32(shift, vdupq_n_s32(0)), res_shift_lt0, res_shift_gt0);
+    return vminq_s32(vmaxq_s32(vaddq_s32(res, offset), min), max);
+}
+} // namespace winograd_quantized
+
+/** Transform the 4x4 input tiles of an NHWC tensor into the Winograd domain
+ *
+ * @p dst has shape [channels, tiles, 16]: matrix xi holds element xi of every transformed tile, so the 16 products with
+ * the transformed weights are independent [tiles, channels] x [channels, OFM] GEMMs. The input zero point is removed
+ * first, which makes the implicit zero padding exact.
+ */
+template <typename T>
+void winograd_f2x2_3x3_input_transform(
+    const ITensor *src, ITensor *dst, const WinogradF2x2Tiling &tiling, int32_t src_offset, const Window &window)
+{
+    using namespace winograd_quantized;
+
+    const ITensorInfo *src_info  = src->info();
+    const int          channels  = static_cast<int>(src_info->dimension(0));
+    const int          src_w     = static_cast<int>(src_info->dimension(1));
+    const int          src_h     = static_cast<int>(src_info->dimension(2));
+    const Strides     &src_strides = src_info->strides_in_bytes();
+
+    const size_t dst_tile_stride   = dst->info()->strides_in_bytes()[1];
+    const size_t dst_matrix_stride = dst->info()->strides_in_bytes()[2] / sizeof(int16_t);
+
+    const uint8_t *src_ptr = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const int16x8_t voffset = vdupq_n_s16(static_cast<int16_t>(src_offset));
+    const int16x8_t vzero   = vdupq_n_s16(0);
+
+    for (int b = window.z().start(); b < window.z().end(); ++b)
+    {
+        for (int ty = window.y().start(); ty < window.y().end(); ++ty)
+        {
+            for (int tx = window.x().start(); tx < window.x().end(); ++tx)
+            {
+                // Input pixels falling in the padding are left null and read as zero
+                const T *patch[4][4];
+                for (int i = 0; i < 4; ++i)
+                {
+                    const int y = 2 * ty - tiling.pad_top + i;
+                    for (int j = 0; j < 4; ++j)
+                    {
+                        const int x = 2 * tx - tiling.pad_left + j;
+                        patch[i][j] =
+                            (y >= 0 && y < src_h && x >= 0 && x < src_w)
+                                ? reinterpret_cast<const T *>(src_ptr + b * src_strides[3] + y * src_strides[2] +
+                                                              x * src_strides[1])
+                                : nullptr;
+                    }
+                }
+
+                const int tile = (b * tiling.num_tiles_y + ty) * tiling.num_tiles_x + tx;
+                auto      out  = reinterpret_cast<int16_t *>(dst_ptr + tile * dst_tile_stride);
+
+                int c = 0;
+                for (; c <= channels - 8; c += 8)
+                {
+                    int16x8_t d[4][4];
+                    int16x8_t v[16];
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        for (int j = 0; j < 4; ++j)
+                        {
+                            d[i][j] = (patch[i][j] != nullptr) ? load_centred(patch[i][j] + c, voffset) : vzero;
+                        }
+                    }
+                    input_transform_4x4(d, v);
+                    for (int xi = 0; xi < 16; ++xi)
+                    {
+                        vst1q_s16(out + xi * dst_matrix_stride + c, v[xi]);
+                    }
+                }
+
+                // Left-over channels
+                for (; c < channels; ++c)
+                {
+                    int16_t d[4][4];
+                    int16_t v[16];
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        for (int j = 0; j < 4; ++j)
+                        {
+                            d[i][j] = (patch[i][j] != nullptr)
+                                          ? static_cast<int16_t>(static_cast<int32_t>(patch[i][j][c]) - src_offset)
+                                          : 0;
+                        }
+                    }
+                    input_transform_4x4(d, v);
+                    for (int xi = 0; xi < 16; ++xi)
+                    {
+                        out[xi * dst_matrix_stride + c] = v[xi];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** Transform the Winograd domain products back to 2x2 output tiles and requantize them
+ *
+ * The transforms of the input and the weights are scaled by 1 and 4 respectively, so the spatial result is exactly 4
+ * times the integer convolution: the shift by 2 loses nothing and what follows is the regular GEMMLowp output stage.
+ */
+template <typename T>
+void winograd_f2x2_3x3_output_transform(const ITensor                 *src,
+                                        const ITensor                 *bias,
+                                        ITensor                       *dst,
+                                        const WinogradF2x2Tiling      &tiling,
+                                        const GEMMLowpOutputStageInfo &output_stage,
+                                        const Window                  &window)
+{
+    using namespace winograd_quantized;
+
+    const ITensorInfo *dst_info    = dst->info();
+    const int          channels    = static_cast<int>(dst_info->dimension(0));
+    const int          dst_w       = static_cast<int>(dst_info->dimension(1));
+    const int          dst_h       = static_cast<int>(dst_info->dimension(2));
+    const Strides     &dst_strides = dst_info->strides_in_bytes();
+
+    const size_t src_tile_stride   = src->info()->strides_in_bytes()[1];
+    const size_t src_matrix_stride = src->info()->strides_in_bytes()[2] / sizeof(int32_t);
+
+    const uint8_t *src_ptr = src->buffer() + src->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    const int32_t *bias_ptr = (bias != nullptr) ? reinterpret_cast<const int32_t *>(
+                                                      bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                                                : nullptr;
+
+    const bool     per_channel = output_stage.is_quantized_per_channel;
+    const int32_t *multipliers = output_stage.gemmlowp_multipliers.data();
+    const int32_t *shifts      = output_stage.gemmlowp_shifts.data();
+    const T        min         = static_cast<T>(output_stage.gemmlowp_min_bound);
+    const T        max         = static_cast<T>(output_stage.gemmlowp_max_bound);
+
+    const int32x4_t voffset = vdupq_n_s32(output_stage.gemmlowp_offset);
+    const int32x4_t vmin    = vdupq_n_s32(output_stage.gemmlowp_min_bound);
+    const int32x4_t vmax    = vdupq_n_s32(output_stage.gemmlowp_max_bound);
+    const int32x4_t vzero   = vdupq_n_s32(0);
+
+    for (int b = window.z().start(); b < window.z().end(); ++b)
+    {
+        for (int ty = window.y().start(); ty < window.y().end(); ++ty)
+        {
+            for (int tx = window.x().start(); tx < window.x().end(); ++tx)
+            {
+                // Output pixels beyond the edge of the destination are computed but not stored
+                T *out[2][2];
+                for (int i = 0; i < 2; ++i)
+                {
+                    const int y = 2 * ty + i;
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        const int x = 2 * tx + j;
+                        out[i][j]   = (y < dst_h && x < dst_w)
+                                          ? reinterpret_cast<T *>(dst_ptr + b * dst_strides[3] + y * dst_strides[2] +
+                                                                x * dst_strides[1])
+                                          : nullptr;
+                    }
+                }
+
+                const int tile = (b * tiling.num_tiles_y + ty) * tiling.num_tiles_x + tx;
+                const auto in  = reinterpret_cast<const int32_t *>(src_ptr + tile * src_tile_stride);
+
+                int c = 0;
+                for (; c <= channels - 8; c += 8)
+                {
+                    int32x4_t res[2][2][2];
+                    for (int h = 0; h < 2; ++h)
+                    {
+                        const int ch = c + 4 * h;
+                        int32x4_t m[16];
+                        int32x4_t y[2][2];
+                        for (int xi = 0; xi < 16; ++xi)
+                        {
+                            m[xi] = vld1q_s32(in + xi * src_matrix_stride + ch);
+                        }
+                        output_transform_4x4(m, y);
+
+                        const int32x4_t vbias = (bias_ptr != nullptr) ? vld1q_s32(bias_ptr + ch) : vzero;
+                        const int32x4_t vmult =
+                            per_channel ? vld1q_s32(multipliers + ch) : vdupq_n_s32(output_stage.gemmlowp_multiplier);
+                        const int32x4_t vshift =
+                            per_channel ? vld1q_s32(shifts + ch) : vdupq_n_s32(output_stage.gemmlowp_shift);
+                        for (int i = 0; i < 2; ++i)
+                        {
+                            for (int j = 0; j < 2; ++j)
+                            {
+                                res[i][j][h] = requantize(vaddq_s32(vshrq_n_s32(y[i][j], 2), vbias), vmult, vshift,
+                                                          voffset, vmin, vmax);
+                            }
+                        }
+                    }
+                    for (int i = 0; i < 2; ++i)
+                    {
+                        for (int j = 0; j < 2; ++j)
+                        {
+                            if (out[i][j] != nullptr)
+                            {
+                                store_narrow(out[i][j] + c, res[i][j][0], res[i][j][1]);
+                            }
+                        }
+                    }
+                }
+
+                // Left-over channels
+                for (; c < channels; ++c)
+                {
+                    int32_t m[16];
+                    int32_t y[2][2];
+                    for (int xi = 0; xi < 16; ++xi)
+                    {
+                        m[xi] = in[xi * src_matrix_stride + c];
+                    }
+                    output_transform_4x4(m, y);
+
+                    const int32_t bias_value = (bias_ptr != nullptr) ? bias_ptr[c] : 0;
+                    const int32_t mult       = per_channel ? multipliers[c] : output_stage.gemmlowp_multiplier;
+                    const int32_t shift      = per_channel ? shifts[c] : output_stage.gemmlowp_shift;
+                    for (int i = 0; i < 2; ++i)
+                    {
+                        for (int j = 0; j < 2; ++j)
+                        {
+                            if (out[i][j] != nullptr)
+                            {
+                                out[i][j][c] = finalize_quantization((y[i][j] >> 2) + bias_value, mult, shift,
+                                                                     output_stage.gemmlowp_offset, min, max, true);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** Transform NHWC weights [IFM, 3, 3, OFM] into the 16 int16 matrices [IFM, OFM] of the Winograd domain
+ *
+ * U = G' (g - offset) G'^T with G' = [2 0 0; 1 1 1; 1 -1 1; 0 0 2], i.e. four times the usual G = [1 0 0; 1/2 1/2 1/2;
+ * 1/2 -1/2 1/2; 0 0 1], keeps the transform integral. Only the OFM range of @p window is processed.
+ */
+template <typename TW>
+void winograd_f2x2_3x3_weight_transform(const ITensor *weights,
+                                        ITensor       *dst,
+                                        int32_t        weights_offset,
+                                        const Window  &window)
+{
+    const ITensorInfo *w_info    = weights->info();
+    const int          channels  = static_cast<int>(w_info->dimension(0));
+    const Strides     &w_strides = w_info->strides_in_bytes();
+
+    const size_t dst_row_stride    = dst->info()->strides_in_bytes()[1] / sizeof(int16_t);
+    const size_t dst_matrix_stride = dst->info()->strides_in_bytes()[2] / sizeof(int16_t);
+
+    const uint8_t *w_ptr   = weights->buffer() + w_info->offset_first_element_in_bytes();
+    auto           dst_ptr = reinterpret_cast<int16_t *>(dst->buffer() + dst->info()->offset_first_element_in_bytes());
+
+    for (int n = window.x().start(); n < window.x().end(); ++n)
+    {
+        for (int k = 0; k < channels; ++k)
+        {
+            int32_t g[3][3];
+            for (int ky = 0; ky < 3; ++ky)
+            {
+                for (int kx = 0; kx < 3; ++kx)
+                {
+                    g[ky][kx] = static_cast<int32_t>(*reinterpret_cast<const TW *>(
+                                    w_ptr + k * w_strides[0] + kx * w_strides[1] + ky * w_strides[2] +
+                                    n * w_strides[3])) -
+                                weights_offset;
+                }
+            }
+
+            int32_t t[4][3];
+            for (int j = 0; j < 3; ++j)
+            {
+                t[0][j] = 2 * g[0][j];
+                t[1][j] = g[0][j] + g[1][j] + g[2][j];
+                t[2][j] = g[0][j] - g[1][j] + g[2][j];
+                t[3][j] = 2 * g[2][j];
+            }
+
+            int16_t *out = dst_ptr + k * dst_row_stride + n;
+            for (int i = 0; i < 4; ++i)
+            {
+                out[(4 * i + 0) * dst_matrix_stride] = static_cast<int16_t>(2 * t[i][0]);
+                out[(4 * i + 1) * dst_matrix_stride] = static_cast<int16_t>(t[i][0] + t[i][1] + t[i][2]);
+                out[(4 * i + 2) * dst_matrix_stride] = static_cast<int16_t>(t[i][0] - t[i][1] + t[i][2]);
+                out[(4 * i + 3) * dst_matrix_stride] = static_cast<int16_t>(2 * t[i][2]);
+            }
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_WINOGRAD_QUANTIZED_GENERIC_NEON_IMPL_H
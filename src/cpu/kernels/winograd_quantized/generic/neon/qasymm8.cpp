@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/winograd_quantized/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_qu8_winograd_f2x2_3x3_input_transform(
+    const ITensor *src, ITensor *dst, const WinogradF2x2Tiling &tiling, int32_t src_offset, const Window &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "neon_qu8_winograd_f2x2_3x3_input_transform");
+    winograd_f2x2_3x3_input_transform<uint8_t>(src, dst, tiling, src_offset, window);
+}
+
+void neon_qu8_winograd_f2x2_3x3_output_transform(const ITensor                 *src,
+                                                  const ITensor                 *bias,
+                                                  ITensor                       *dst,
+                                                  const WinogradF2x2Tiling      &tiling,
+                                                  const GEMMLowpOutputStageInfo &output_stage,
+                                                  const Window                  &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "neon_qu8_winograd_f2x2_3x3_output_transform");
+    winograd_f2x2_3x3_output_transform<uint8_t>(src, bias, dst, tiling, output_stage, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_WINOGRAD_QUANTIZED_LIST_H
+#define ACL_SRC_CPU_KERNELS_WINOGRAD_QUANTIZED_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Tiling of a Winograd F(2x2, 3x3) convolution: every 2x2 output tile reads a 4x4 input tile */
+struct WinogradF2x2Tiling
+{
+    int pad_left{0};    /**< Columns of zero padding on the left of the input */
+    int pad_top{0};     /**< Rows of zero padding on top of the input */
+    int num_tiles_x{0}; /**< Number of output tiles along the width */
+    int num_tiles_y{0}; /**< Number of output tiles along the height */
+};
+
+#define DECLARE_WINOGRAD_QUANTIZED_INPUT_TRANSFORM_KERNEL(func_name)                                 \
+    void func_name(const ITensor *src, ITensor *dst, const WinogradF2x2Tiling &tiling, int32_t src_offset, \
+                   const Window &window)
+
+#define DECLARE_WINOGRAD_QUANTIZED_OUTPUT_TRANSFORM_KERNEL(func_name)                             \
+    void func_name(const ITensor *src, const ITensor *bias, ITensor *dst, const WinogradF2x2Tiling &tiling, \
+                   const GEMMLowpOutputStageInfo &output_stage, const Window &window)
+
+#define DECLARE_WINOGRAD_QUANTIZED_WEIGHT_TRANSFORM_KERNEL(func_name) \
+    void func_name(const ITensor *weights, ITensor *dst, int32_t weights_offset, const Window &window)
+
+#define DECLARE_WINOGRAD_QUANTIZED_GEMM_KERNEL(func_name) \
+    void func_name(const ITensor *lhs, const ITensor *rhs, ITensor *dst, const Window &window)
+
+DECLARE_WINOGRAD_QUANTIZED_INPUT_TRANSFORM_KERNEL(neon_qu8_winograd_f2x2_3x3_input_transform);
+DECLARE_WINOGRAD_QUANTIZED_INPUT_TRANSFORM_KERNEL(neon_qs8_winograd_f2x2_3x3_input_transform);
+DECLARE_WINOGRAD_QUANTIZED_OUTPUT_TRANSFORM_KERNEL(neon_qu8_winograd_f2x2_3x3_output_transform);
+DECLARE_WINOGRAD_QUANTIZED_OUTPUT_TRANSFORM_KERNEL(neon_qs8_winograd_f2x2_3x3_output_transform);
+DECLARE_WINOGRAD_QUANTIZED_WEIGHT_TRANSFORM_KERNEL(neon_u8_winograd_f2x2_3x3_weight_transform);
+DECLARE_WINOGRAD_QUANTIZED_WEIGHT_TRANSFORM_KERNEL(neon_s8_winograd_f2x2_3x3_weight_transform);
+DECLARE_WINOGRAD_QUANTIZED_GEMM_KERNEL(neon_s16_winograd_gemm);
+
+#undef DECLARE_WINOGRAD_QUANTIZED_INPUT_TRANSFORM_KERNEL
+#undef DECLARE_WINOGRAD_QUANTIZED_OUTPUT_TRANSFORM_KERNEL
+#undef DECLARE_WINOGRAD_QUANTIZED_WEIGHT_TRANSFORM_KERNEL
+#undef DECLARE_WINOGRAD_QUANTIZED_GEMM_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_WINOGRAD_QUANTIZED_LIST_H
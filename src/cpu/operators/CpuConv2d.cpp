@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
+#include "src/cpu/operators/CpuWinogradConv2dQuantized.h"
 
 namespace arm_compute
 {
@@ -58,22 +59,54 @@ void CpuConv2d::configure(ITensorInfo               *input,
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuConv2d::configure");
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
                                                    act_info, enable_fast_math, num_groups));
 
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                            enable_fast_math, num_groups);
 
+    // Grouped convolutions run all of their groups as GEMM multis of a single direct GEMM convolution
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation,
+                                                             act_info, enable_fast_math);
+    configure(method, input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math,
+              num_groups);
+}
+
+void CpuConv2d::configure(ConvolutionMethod          method,
+                          ITensorInfo               *input,
+                          ITensorInfo               *weights,
+                          const ITensorInfo         *biases,
+                          ITensorInfo               *output,
+                          const PadStrideInfo       &conv_info,
+                          const WeightsInfo         &weights_info,
+                          const Size2D              &dilation,
+                          const ActivationLayerInfo &act_info,
+                          bool                       enable_fast_math,
+                          unsigned int               num_groups)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(method, input, weights, biases, output, conv_info, weights_info,
+                                                   dilation, act_info, enable_fast_math, num_groups));
+
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
-            auto f = std::make_unique<CpuWinogradConv2d>();
-            f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
-            _function = std::move(f);
+            if (is_data_type_quantized_asymmetric(input->data_type()))
+            {
+                auto f = std::make_unique<CpuWinogradConv2dQuantized>();
+                f->configure(input, weights, biases, output, conv_info, act_info);
+                _function = std::move(f);
+            }
+            else
+            {
+                auto f = std::make_unique<CpuWinogradConv2d>();
+                f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
+                _function = std::move(f);
+            }
             break;
         }
         case ConvolutionMethod::GEMM:
@@ -117,15 +150,50 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
                            unsigned int               num_groups)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuConv2d::validate");
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation,
+                                                             act_info, enable_fast_math);
+    return CpuConv2d::validate(method, input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                               enable_fast_math, num_groups);
+}
+
+Status CpuConv2d::validate(ConvolutionMethod          method,
+                           const ITensorInfo         *input,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *biases,
+                           const ITensorInfo         *output,
+                           const PadStrideInfo       &conv_info,
+                           const WeightsInfo         &weights_info,
+                           const Size2D              &dilation,
+                           const ActivationLayerInfo &act_info,
+                           bool                       enable_fast_math,
+                           unsigned int               num_groups)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1) && (method != ConvolutionMethod::GEMM_CONV2D),
+                                    "Grouping (num_groups != 1) is only supported by GEMM_CONV2D on Neon");
+    // Winograd and direct convolution have no notion of dilation
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        (method == ConvolutionMethod::WINOGRAD || method == ConvolutionMethod::DIRECT) && dilation != Size2D(1U, 1U),
+        "Dilation is only supported by the GEMM based methods");
 
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
+            if (is_data_type_quantized_asymmetric(input->data_type()))
+            {
+                ARM_COMPUTE_RETURN_ON_ERROR(
+                    CpuWinogradConv2dQuantized::validate(input, weights, biases, output, conv_info, act_info));
+            }
+            else
+            {
+                ARM_COMPUTE_RETURN_ON_ERROR(
+                    CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
+            }
             break;
         case ConvolutionMethod::GEMM:
             ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info,
@@ -138,13 +206,35 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
             ARM_COMPUTE_RETURN_ON_ERROR(CpuDirectConv2d::validate(input, weights, biases, output, conv_info, act_info));
             break;
         default:
-            ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            ARM_COMPUTE_RETURN_ERROR_MSG("Not supported.");
     }
 
     return Status{};
 }
 
+std::vector<ConvolutionMethod> CpuConv2d::get_supported_convolution_methods(const ITensorInfo         *input,
+                                                                            const ITensorInfo         *weights,
+                                                                            const ITensorInfo         *biases,
+                                                                            const ITensorInfo         *output,
+                                                                            const PadStrideInfo       &conv_info,
+                                                                            const WeightsInfo         &weights_info,
+                                                                            const Size2D              &dilation,
+                                                                            const ActivationLayerInfo &act_info,
+                                                                            bool enable_fast_math)
+{
+    std::vector<ConvolutionMethod> methods;
+    for (const auto method : {ConvolutionMethod::GEMM, ConvolutionMethod::GEMM_CONV2D, ConvolutionMethod::WINOGRAD,
+                              ConvolutionMethod::DIRECT})
+    {
+        if (bool(CpuConv2d::validate(method, input, weights, biases, output, conv_info, weights_info, dilation,
+                                     act_info, enable_fast_math)))
+        {
+            methods.push_back(method);
+        }
+    }
+    return methods;
+}
+
 ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *input,
                                                     const ITensorInfo         *weights,
                                                     const ITensorInfo         *output,
@@ -208,6 +298,12 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
 
     if (dilation != Size2D(1U, 1U))
     {
+        // The indirect GEMM reads the dilated taps in place, instead of expanding them with im2col
+        if (input->data_layout() == DataLayout::NHWC &&
+            bool(CpuGemmDirectConv2d::validate(input, weights, nullptr, output, info)))
+        {
+            return ConvolutionMethod::GEMM_CONV2D;
+        }
         return ConvolutionMethod::GEMM;
     }
     else
@@ -284,6 +380,14 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
         {
             return ConvolutionMethod::WINOGRAD;
         }
+        // The quantized Winograd GEMM runs on int16 operands: its 2.25 times fewer multiplications only pay off when
+        // the int8 GEMM cannot use the dot product instructions either. Its validation also rejects the configurations
+        // where the int32 accumulators could overflow.
+        if (!CPUInfo::get().has_dotprod() &&
+            bool(CpuWinogradConv2dQuantized::validate(input, weights, nullptr, output, conv_info, act_info)))
+        {
+            return ConvolutionMethod::WINOGRAD;
+        }
         if (gemmDirectConv2d_validates)
         {
             return ConvolutionMethod::GEMM_CONV2D;
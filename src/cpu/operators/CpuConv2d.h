@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,8 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -108,7 +110,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported
+     *                              for NHWC tensors, with all the groups run by GEMM_CONV2D in a single workload
      */
     void configure(ITensorInfo               *src,
                    ITensorInfo               *weights,
@@ -120,6 +123,23 @@ public:
                    const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                    bool                       enable_fast_math = false,
                    unsigned int               num_groups       = 1);
+    /** Set the input and output tensors, running the convolution with the given method
+     *
+     * Similar to CpuConv2d::configure() but bypasses the method selection heuristics.
+     *
+     * @param[in] method Convolution method to use. Supported methods: GEMM/GEMM_CONV2D/WINOGRAD/DIRECT
+     */
+    void configure(ConvolutionMethod          method,
+                   ITensorInfo               *src,
+                   ITensorInfo               *weights,
+                   const ITensorInfo         *biases,
+                   ITensorInfo               *dst,
+                   const PadStrideInfo       &conv_info,
+                   const WeightsInfo         &weights_info     = WeightsInfo(),
+                   const Size2D              &dilation         = Size2D(1U, 1U),
+                   const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                   bool                       enable_fast_math = false,
+                   unsigned int               num_groups       = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref CpuConv2d
      *
      * Similar to CpuConv2d::configure()
@@ -136,6 +156,39 @@ public:
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                            bool                       enable_fast_math = false,
                            unsigned int               num_groups       = 1);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuConv2d with the given method
+     *
+     * Similar to CpuConv2d::configure() with an explicit convolution method
+     *
+     * @return a status
+     */
+    static Status validate(ConvolutionMethod          method,
+                           const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *biases,
+                           const ITensorInfo         *output,
+                           const PadStrideInfo       &conv_info,
+                           const WeightsInfo         &weights_info     = WeightsInfo(),
+                           const Size2D              &dilation         = Size2D(1U, 1U),
+                           const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                           bool                       enable_fast_math = false,
+                           unsigned int               num_groups       = 1);
+    /** Static function to list every convolution method @ref CpuConv2d can run the given configuration with
+     *
+     * Similar to CpuConv2d::validate()
+     *
+     * @return The methods that validate, in no particular order
+     */
+    static std::vector<ConvolutionMethod>
+    get_supported_convolution_methods(const ITensorInfo         *src,
+                                      const ITensorInfo         *weights,
+                                      const ITensorInfo         *biases,
+                                      const ITensorInfo         *dst,
+                                      const PadStrideInfo       &conv_info,
+                                      const WeightsInfo         &weights_info     = WeightsInfo(),
+                                      const Size2D              &dilation         = Size2D(1U, 1U),
+                                      const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                                      bool                       enable_fast_math = false);
     /** Static function to check if given info will return the convolution called by @ref CpuConv2d
      *
      * @param[in] src              Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
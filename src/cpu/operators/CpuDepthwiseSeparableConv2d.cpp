@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuDepthwiseSeparableConv2d.h"
+
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/internal/CpuDepthwiseConv2dAssemblyWrapperKernel.h"
+#include "src/cpu/operators/CpuDepthwiseConv2dAssemblyDispatch.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+constexpr size_t dwc_alignment = 4096;
+
+/** Get the number of depthwise output rows produced and consumed at a time
+ *
+ * A band of depthwise output is sized to stay in the private caches of the worker threads until the GEMM reads it
+ * back, leaving room for the input rows and the weights panels. Bands are kept large enough for every thread to own
+ * a row and for the GEMM to amortise streaming the pointwise weights.
+ */
+unsigned int get_band_rows(const TensorShape &dwc_dst_shape, size_t element_size, unsigned int nthreads)
+{
+    constexpr size_t min_band_points = 64;
+
+    const size_t row_size   = dwc_dst_shape[0] * dwc_dst_shape[1] * element_size;
+    const size_t cache_size = static_cast<size_t>(CPUInfo::get().get_L2_cache_size()) * nthreads / 2;
+
+    size_t band_rows = std::max<size_t>(cache_size / row_size, nthreads);
+    band_rows        = std::max(band_rows, DIV_CEIL(min_band_points, dwc_dst_shape[1]));
+    return static_cast<unsigned int>(std::min(band_rows, dwc_dst_shape[2]));
+}
+
+/** Initialise the band buffer, seen as a [IFM, width, rows] depthwise destination and as the GEMM [K, M] source,
+ *  and the [OFM, M] GEMM destination of a band
+ */
+void init_band_infos(const ITensorInfo *src,
+                     const TensorShape &dwc_dst_shape,
+                     const ITensorInfo *pwc_weights,
+                     unsigned int       band_rows,
+                     TensorInfo        &dwc_band_info,
+                     TensorInfo        &gemm_src_info,
+                     TensorInfo        &gemm_dst_info)
+{
+    const size_t band_points = dwc_dst_shape[1] * band_rows;
+    const TensorShape band_shape(dwc_dst_shape[0], dwc_dst_shape[1], band_rows);
+    dwc_band_info = src->clone()->set_tensor_shape(band_shape).set_is_resizable(true);
+    gemm_src_info = src->clone()->set_tensor_shape(TensorShape(dwc_dst_shape[0], band_points)).set_is_resizable(true);
+    gemm_dst_info =
+        src->clone()->set_tensor_shape(TensorShape(pwc_weights->dimension(3), band_points)).set_is_resizable(true);
+}
+
+/** The [IFM, 1, 1, OFM] pointwise weights seen as the transposed [K, N] GEMM weights */
+TensorInfo pwc_gemm_weights_info(const ITensorInfo *pwc_weights)
+{
+    return TensorInfo(TensorShape(pwc_weights->dimension(0), pwc_weights->dimension(3)), 1, pwc_weights->data_type());
+}
+
+cpu::AsmGemmInfo init_assembly_metadata(const ActivationLayerInfo &act_info)
+{
+    cpu::AsmGemmInfo asm_info;
+    asm_info.method          = cpu::AsmConvMethod::Im2Col;
+    asm_info.activation_info = act_info;
+    asm_info.transpose_b     = true;
+    return asm_info;
+}
+} // namespace
+
+CpuDepthwiseSeparableConv2d::CpuDepthwiseSeparableConv2d()
+    : _dwc_kernel(nullptr),
+      _gemm_asm_func(std::make_unique<CpuGemmAssemblyDispatch>()),
+      _aux_mem(AuxTensorIdx::Count),
+      _dwc_band_info(),
+      _gemm_src_info(),
+      _gemm_dst_info(),
+      _dwc_workspace_info(),
+      _dwc_storage_info(),
+      _band_rows(0),
+      _is_prepared(false)
+{
+}
+
+CpuDepthwiseSeparableConv2d::~CpuDepthwiseSeparableConv2d() = default;
+
+void CpuDepthwiseSeparableConv2d::configure(const ITensorInfo         *src,
+                                            const ITensorInfo         *dwc_weights,
+                                            const ITensorInfo         *dwc_biases,
+                                            const ITensorInfo         *pwc_weights,
+                                            const ITensorInfo         *pwc_biases,
+                                            ITensorInfo               *dst,
+                                            const ConvolutionInfo     &dwc_info,
+                                            const ActivationLayerInfo &pwc_act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2d::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dwc_weights, pwc_weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuDepthwiseSeparableConv2d::validate(src, dwc_weights, dwc_biases, pwc_weights,
+                                                                     pwc_biases, dst, dwc_info, pwc_act_info));
+    ARM_COMPUTE_LOG_PARAMS(src, dwc_weights, dwc_biases, pwc_weights, pwc_biases, dst, dwc_info, pwc_act_info);
+
+    const unsigned int num_threads   = NEScheduler::get().num_threads();
+    const TensorShape  dwc_dst_shape = compute_depthwise_convolution_shape(*src, *dwc_weights, dwc_info);
+    const TensorShape  dst_shape     = TensorShape(pwc_weights->dimension(3), dwc_dst_shape[1], dwc_dst_shape[2])
+                                      .set(3, src->tensor_shape()[3]);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(dst_shape));
+
+    _is_prepared = false;
+    _band_rows   = get_band_rows(dwc_dst_shape, src->element_size(), num_threads);
+    init_band_infos(src, dwc_dst_shape, pwc_weights, _band_rows, _dwc_band_info, _gemm_src_info, _gemm_dst_info);
+
+    // Configure the depthwise kernel on the whole tensors, it is then run on one band of output rows at a time
+    TensorInfo dwc_dst_info = src->clone()->set_tensor_shape(dwc_dst_shape).set_is_resizable(true);
+    _dwc_kernel             = std::make_unique<kernels::CpuDepthwiseConv2dAssemblyWrapperKernel>();
+    _dwc_kernel->configure(src, dwc_weights, dwc_biases, &dwc_dst_info, dwc_info, NEScheduler::get().cpu_info());
+    ARM_COMPUTE_ERROR_ON_MSG(!_dwc_kernel->is_configured(), "No depthwise assembly kernel for this configuration");
+
+    // Configure the 1x1 convolution as a GEMM on a band
+    const TensorInfo pwc_info = pwc_gemm_weights_info(pwc_weights);
+    _gemm_asm_func->configure(&_gemm_src_info, &pwc_info, pwc_biases, &_gemm_dst_info,
+                              init_assembly_metadata(pwc_act_info));
+    ARM_COMPUTE_ERROR_ON_MSG(!_gemm_asm_func->is_configured(), "No assembly GEMM for this configuration");
+
+    // Add auxiliary memory requirements of the assembly dispatch
+    const auto asm_mem_req = _gemm_asm_func->workspace();
+    for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = asm_mem_req[slot];
+    }
+
+    const size_t dwc_workspace_size = _dwc_kernel->get_working_size(num_threads);
+    const size_t dwc_storage_size   = _dwc_kernel->get_storage_size();
+    _dwc_workspace_info             = TensorInfo(TensorShape(dwc_workspace_size), 1, DataType::U8);
+    _dwc_storage_info               = TensorInfo(TensorShape(dwc_storage_size), 1, DataType::U8);
+
+    _aux_mem[DwcWorkspace] =
+        MemoryInfo(offset_int_vec(DwcWorkspace), MemoryLifetime::Temporary, dwc_workspace_size, dwc_alignment);
+    _aux_mem[DwcStorage] =
+        MemoryInfo(offset_int_vec(DwcStorage), MemoryLifetime::Persistent, dwc_storage_size, dwc_alignment);
+    _aux_mem[Band] = MemoryInfo(offset_int_vec(Band), MemoryLifetime::Temporary, _dwc_band_info.total_size());
+}
+
+Status CpuDepthwiseSeparableConv2d::validate(const ITensorInfo         *src,
+                                             const ITensorInfo         *dwc_weights,
+                                             const ITensorInfo         *dwc_biases,
+                                             const ITensorInfo         *pwc_weights,
+                                             const ITensorInfo         *pwc_biases,
+                                             const ITensorInfo         *dst,
+                                             const ConvolutionInfo     &dwc_info,
+                                             const ActivationLayerInfo &pwc_act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dwc_weights, pwc_weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dwc_weights, pwc_weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dwc_info.dilation != Size2D(1U, 1U), "Dilation is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dwc_info.act_info.enabled() &&
+                                        !CpuDepthwiseConv2dAssemblyDispatch::is_activation_supported(dwc_info.act_info),
+                                    "Depthwise activation not supported by the assembly kernels");
+
+    // Validate the depthwise convolution
+    const TensorShape dwc_dst_shape = compute_depthwise_convolution_shape(*src, *dwc_weights, dwc_info);
+    const TensorInfo  dwc_dst_info  = src->clone()->set_tensor_shape(dwc_dst_shape).set_is_resizable(true);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        CpuDepthwiseConv2dAssemblyDispatch::validate(src, dwc_weights, dwc_biases, &dwc_dst_info, dwc_info));
+
+    // Validate the pointwise convolution
+    ARM_COMPUTE_RETURN_ERROR_ON(pwc_weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(pwc_weights->dimension(0) != dwc_dst_shape[0]);
+    ARM_COMPUTE_RETURN_ERROR_ON(pwc_weights->dimension(1) != 1 || pwc_weights->dimension(2) != 1);
+    if (pwc_biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, pwc_biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(pwc_biases->dimension(0) != pwc_weights->dimension(3));
+        ARM_COMPUTE_RETURN_ERROR_ON(pwc_biases->num_dimensions() > 1);
+    }
+
+    const TensorShape dst_shape =
+        TensorShape(pwc_weights->dimension(3), dwc_dst_shape[1], dwc_dst_shape[2]).set(3, src->tensor_shape()[3]);
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+        // The GEMM writes every band straight into the destination as a contiguous block of rows
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->has_padding(), "Padding of the destination is not supported");
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pwc_act_info.enabled() &&
+                                        !CpuGemmAssemblyDispatch::is_activation_supported(pwc_act_info),
+                                    "Pointwise activation not supported by the assembly GEMM");
+
+    const unsigned int band_rows =
+        get_band_rows(dwc_dst_shape, src->element_size(), NEScheduler::get().num_threads());
+    TensorInfo dwc_band_info{};
+    TensorInfo gemm_src_info{};
+    TensorInfo gemm_dst_info{};
+    init_band_infos(src, dwc_dst_shape, pwc_weights, band_rows, dwc_band_info, gemm_src_info, gemm_dst_info);
+    const TensorInfo pwc_info = pwc_gemm_weights_info(pwc_weights);
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmAssemblyDispatch::validate(&gemm_src_info, &pwc_info, pwc_biases, &gemm_dst_info,
+                                                                  init_assembly_metadata(pwc_act_info)));
+
+    return Status{};
+}
+
+void CpuDepthwiseSeparableConv2d::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDepthwiseSeparableConv2d::run");
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    const ITensor *src         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *pwc_weights = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    const ITensor *pwc_biases  = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+    ITensor       *dst         = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler dwc_workspace(offset_int_vec(DwcWorkspace), _dwc_workspace_info, tensors);
+    CpuAuxTensorHandler dwc_storage(offset_int_vec(DwcStorage), _dwc_storage_info, tensors);
+    CpuAuxTensorHandler dwc_band(offset_int_vec(Band), _dwc_band_info, tensors);
+    CpuAuxTensorHandler gemm_src(_gemm_src_info, *dwc_band.get());
+    TensorInfo          pwc_info = pwc_gemm_weights_info(pwc_weights->info());
+    CpuAuxTensorHandler pwc_gemm_weights(pwc_info, *pwc_weights, _aux_mem[GemmPretranspose].size > 0);
+
+    ITensorPack dwc_pack{{TensorType::ACL_SRC_0, src},
+                         {TensorType::ACL_DST, dwc_band.get()},
+                         {TensorType::ACL_INT_0, dwc_workspace.get()},
+                         {TensorType::ACL_INT_1, dwc_storage.get()}};
+
+    // Every band writes a contiguous block of rows of the destination, which the GEMM sees as its own matrix
+    Tensor      gemm_dst{};
+    ITensorPack gemm_pack{{TensorType::ACL_SRC_0, gemm_src.get()},
+                          {TensorType::ACL_SRC_1, pwc_gemm_weights.get()},
+                          {TensorType::ACL_SRC_2, pwc_biases},
+                          {TensorType::ACL_DST, &gemm_dst}};
+    for (int slot = GemmWorkspace; slot <= GemmPretranspose; ++slot)
+    {
+        gemm_pack.add_tensor(offset_int_vec(slot), tensors.get_tensor(offset_int_vec(slot)));
+    }
+    gemm_dst.allocator()->soft_init(_gemm_dst_info);
+
+    // The window of every band carries its batch along W and its rows along Z. The assembly kernel threads over the
+    // band internally, so the window is split along the channels (x), which only sets the number of threads
+    Window dwc_window = _dwc_kernel->window();
+
+    const unsigned int n_batches = dst->info()->dimension(3);
+    const unsigned int dst_rows  = dst->info()->dimension(2);
+    const Strides     &strides   = dst->info()->strides_in_bytes();
+    uint8_t *const     dst_ptr   = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    for (unsigned int batch = 0; batch < n_batches; ++batch)
+    {
+        for (unsigned int row = 0; row < dst_rows; row += _band_rows)
+        {
+            // The last band is moved up to stay full height, recomputing a few rows rather than reconfiguring
+            const unsigned int band_row = std::min(row, dst_rows - _band_rows);
+
+            dwc_window.set(Window::DimZ, Window::Dimension(band_row, band_row + _band_rows));
+            dwc_window.set(Window::DimW, Window::Dimension(batch, batch + 1));
+            NEScheduler::get().schedule_op(_dwc_kernel.get(), Window::DimX, dwc_window, dwc_pack);
+
+            gemm_dst.allocator()->import_memory(dst_ptr + batch * strides[3] + band_row * strides[2]);
+            _gemm_asm_func->run(gemm_pack);
+        }
+    }
+}
+
+void CpuDepthwiseSeparableConv2d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        const ITensor *dwc_weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        const ITensor *dwc_biases  = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+        const ITensor *pwc_weights = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+        const ITensor *pwc_biases  = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(dwc_weights, pwc_weights);
+
+        // Pack the depthwise weights and biases
+        CpuAuxTensorHandler dwc_storage(offset_int_vec(DwcStorage), _dwc_storage_info, tensors);
+
+        const auto weights_ptr = dwc_weights->buffer() + dwc_weights->info()->offset_first_element_in_bytes();
+        const auto bias_ptr =
+            (dwc_biases) ? dwc_biases->buffer() + dwc_biases->info()->offset_first_element_in_bytes() : nullptr;
+        auto parameters_ptr = dwc_storage.get()->buffer() + dwc_storage.get()->info()->offset_first_element_in_bytes();
+
+        const auto   weights_shape   = dwc_weights->info()->tensor_shape();
+        const auto   weights_padding = dwc_weights->info()->padding();
+        const size_t ld_weights_col  = weights_shape[0] + weights_padding.left + weights_padding.right;
+        const size_t ld_weights_row =
+            ld_weights_col * (weights_shape[1] + weights_padding.top + weights_padding.bottom);
+        _dwc_kernel->pack_parameters(parameters_ptr, bias_ptr, weights_ptr, ld_weights_col, ld_weights_row);
+
+        // Transform the pointwise weights through the assembly dispatch
+        TensorInfo          pwc_info = pwc_gemm_weights_info(pwc_weights->info());
+        CpuAuxTensorHandler pwc_gemm_weights(pwc_info, *pwc_weights);
+        ITensorPack         gemm_pack{{TensorType::ACL_SRC_1, pwc_gemm_weights.get()},
+                                      {TensorType::ACL_SRC_2, pwc_biases}};
+        for (int slot = GemmWorkspace; slot <= GemmPretranspose; ++slot)
+        {
+            gemm_pack.add_tensor(offset_int_vec(slot), tensors.get_tensor(offset_int_vec(slot)));
+        }
+        _gemm_asm_func->prepare(gemm_pack);
+
+        dwc_weights->mark_as_unused();
+        if (dwc_biases != nullptr)
+        {
+            dwc_biases->mark_as_unused();
+        }
+        if (_aux_mem[GemmPretranspose].size > 0)
+        {
+            pwc_weights->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuDepthwiseSeparableConv2d::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUDEPTHWISESEPARABLECONV2D_H
+#define ACL_SRC_CPU_OPERATORS_CPUDEPTHWISESEPARABLECONV2D_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+namespace arm_compute
+{
+struct ConvolutionInfo;
+
+namespace cpu
+{
+namespace kernels
+{
+class CpuDepthwiseConv2dAssemblyWrapperKernel;
+} // namespace kernels
+
+/** Basic function to run a depthwise convolution followed by a 1x1 convolution
+ *
+ * The depthwise output is produced in bands of output rows into a buffer sized to stay in the private caches of the
+ * worker threads, and each band is consumed straight away by the assembly GEMM computing the 1x1 convolution.
+ * The depthwise output therefore never makes a round trip through memory.
+ *
+ * Pack slots: ACL_SRC_0 src, ACL_SRC_1 depthwise weights, ACL_SRC_2 depthwise biases, ACL_SRC_3 pointwise weights,
+ * ACL_SRC_4 pointwise biases and ACL_DST dst.
+ */
+class CpuDepthwiseSeparableConv2d : public ICpuOperator
+{
+public:
+    CpuDepthwiseSeparableConv2d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDepthwiseSeparableConv2d);
+    ~CpuDepthwiseSeparableConv2d();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |src3           |src4           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  src          Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                          while every optional dimension from 4 and above represent a batch of inputs.
+     *                          Data types supported: F16/F32.
+     * @param[in]  dwc_weights  Depthwise weights tensor info. These are 3D tensors with shape [IFM * depth_multiplier, kernel_x, kernel_y].
+     *                          Data type supported: Same as @p src.
+     * @param[in]  dwc_biases   (Optional) Depthwise biases tensor info. A 1D tensor with shape [IFM * depth_multiplier].
+     *                          Data type supported: Same as @p src.
+     * @param[in]  pwc_weights  Pointwise weights tensor info. These are 4D tensors with shape [IFM * depth_multiplier, 1, 1, OFM].
+     *                          Data type supported: Same as @p src.
+     * @param[in]  pwc_biases   (Optional) Pointwise biases tensor info. A 1D tensor with shape [OFM].
+     *                          Data type supported: Same as @p src.
+     * @param[out] dst          Destination tensor info. 3 lower dimensions represent a single output [OFM, width, height],
+     *                          while the rest represent batch of outputs. Data types supported: Same as @p src.
+     * @param[in]  dwc_info     Depthwise convolution meta-data. Its activation is applied between the two convolutions.
+     * @param[in]  pwc_act_info (Optional) Activation applied to the output of the pointwise convolution.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *dwc_weights,
+                   const ITensorInfo         *dwc_biases,
+                   const ITensorInfo         *pwc_weights,
+                   const ITensorInfo         *pwc_biases,
+                   ITensorInfo               *dst,
+                   const ConvolutionInfo     &dwc_info,
+                   const ActivationLayerInfo &pwc_act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuDepthwiseSeparableConv2d
+     *
+     * Similar to CpuDepthwiseSeparableConv2d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *dwc_weights,
+                           const ITensorInfo         *dwc_biases,
+                           const ITensorInfo         *pwc_weights,
+                           const ITensorInfo         *pwc_biases,
+                           const ITensorInfo         *dst,
+                           const ConvolutionInfo     &dwc_info,
+                           const ActivationLayerInfo &pwc_act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        GemmWorkspace = 0,
+        GemmPrePretransposedB,
+        GemmPretranspose,
+        /* Slots above (0-2) are reserved for CpuGemmAssemblyDispatch */
+        DwcWorkspace,
+        DwcStorage,
+        Band,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuDepthwiseConv2dAssemblyWrapperKernel> _dwc_kernel;
+    std::unique_ptr<CpuGemmAssemblyDispatch>                           _gemm_asm_func;
+    experimental::MemoryRequirements                                   _aux_mem;
+    TensorInfo                                                         _dwc_band_info;
+    TensorInfo                                                         _gemm_src_info;
+    TensorInfo                                                         _gemm_dst_info;
+    TensorInfo                                                         _dwc_workspace_info;
+    TensorInfo                                                         _dwc_storage_info;
+    unsigned int                                                       _band_rows;
+    bool                                                               _is_prepared;
+};
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_OPERATORS_CPUDEPTHWISESEPARABLECONV2D_H
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuEmbeddingBag.h"
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/CpuEmbeddingBagKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuEmbeddingBag::configure(const ITensorInfo      *table,
+                                const ITensorInfo      *indices,
+                                const ITensorInfo      *offsets,
+                                const ITensorInfo      *scales,
+                                ITensorInfo            *dst,
+                                const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuEmbeddingBag::configure");
+    ARM_COMPUTE_LOG_PARAMS(table, indices, offsets, scales, dst);
+    auto kernel = std::make_unique<kernels::CpuEmbeddingBagKernel>();
+    kernel->configure(table, indices, offsets, scales, dst, info);
+    _kernel = std::move(kernel);
+}
+
+Status CpuEmbeddingBag::validate(const ITensorInfo      *table,
+                                 const ITensorInfo      *indices,
+                                 const ITensorInfo      *offsets,
+                                 const ITensorInfo      *scales,
+                                 const ITensorInfo      *dst,
+                                 const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuEmbeddingBag::validate");
+    return kernels::CpuEmbeddingBagKernel::validate(table, indices, offsets, scales, dst, info);
+}
+
+void CpuEmbeddingBag::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuEmbeddingBag::run");
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    // Bags are independent: every thread pools a contiguous range of bags
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUEMBEDDINGBAG_H
+#define ACL_SRC_CPU_OPERATORS_CPUEMBEDDINGBAG_H
+
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuEmbeddingBagKernel */
+class CpuEmbeddingBag : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  table   2D tensor info of the embedding table. Data types supported: F16/F32/S8.
+     * @param[in]  indices 1D tensor info of the rows to gather. Data types supported: S32.
+     * @param[in]  offsets 1D tensor info of the first index of every bag. Data types supported: S32.
+     * @param[in]  scales  (Optional) 1D tensor info of per-row scales. Can be nullptr, except for S8 tables.
+     *                     Data types supported: F32.
+     * @param[out] dst     2D destination tensor info, one row per bag.
+     *                     Data types supported: F32 for S8 tables, same as @p table otherwise.
+     * @param[in]  info    Pooling applied to every bag.
+     */
+    void configure(const ITensorInfo      *table,
+                   const ITensorInfo      *indices,
+                   const ITensorInfo      *offsets,
+                   const ITensorInfo      *scales,
+                   ITensorInfo            *dst,
+                   const EmbeddingBagInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuEmbeddingBag::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo      *table,
+                           const ITensorInfo      *indices,
+                           const ITensorInfo      *offsets,
+                           const ITensorInfo      *scales,
+                           const ITensorInfo      *dst,
+                           const EmbeddingBagInfo &info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUEMBEDDINGBAG_H
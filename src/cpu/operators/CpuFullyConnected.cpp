@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -118,7 +118,7 @@ Status validate_mm(const ITensorInfo         *src,
     {
         GEMMInfo gemm_info;
         gemm_info.set_weight_format(weight_format);
-        gemm_info.set_fixed_format(weight_format != WeightFormat::UNSPECIFIED);
+        gemm_info.set_fixed_format(weight_format != WeightFormat::UNSPECIFIED && !is_sparse_format(weight_format));
         gemm_info.set_fast_math(enable_fast_math);
         gemm_info.set_activation_info(act);
         ARM_COMPUTE_RETURN_ON_ERROR(CpuGemm::validate(src, weights, biases, dst, 1.f, 1.0f, gemm_info));
@@ -252,7 +252,8 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     _is_prepared              = false;
     _trans_weights_idx        = AuxTensorIdx::Count;
     _enable_fast_math         = fc_info.enable_fast_math;
-    _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
+    _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED &&
+                                !is_sparse_format(weights_info.weight_format());
     _weight_format            = weights_info.weight_format();
     _dynamic_weights          = !weights->are_values_constant() && _needs_weights_reshape;
 
@@ -370,7 +371,8 @@ Status CpuFullyConnected::has_opt_impl(arm_compute::WeightFormat &expected_weigh
     GEMMInfo gemm_info;
     gemm_info.set_activation_info(fc_info.activation_info);
     gemm_info.set_fast_math(fc_info.enable_fast_math);
-    gemm_info.set_fixed_format(weights_info.weight_format() != WeightFormat::UNSPECIFIED);
+    gemm_info.set_fixed_format(weights_info.weight_format() != WeightFormat::UNSPECIFIED &&
+                               !is_sparse_format(weights_info.weight_format()));
     gemm_info.set_weight_format(weights_info.weight_format());
 
     return CpuGemm::has_opt_impl(expected_weight_format, src, weights, biases, dst, gemm_info);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,6 +60,57 @@ cpu::AsmGemmInfo init_assembly_metadata(const GEMMInfo &info)
 
     return asm_info;
 }
+
+/** Fold alpha, the beta-scaled addition of matrix C and activations the assembly kernels cannot run natively into
+ *  the assembly epilogue, so that the output is only written once.
+ *
+ * @return True if @p asm_info now carries an epilogue supported by the assembly dispatcher
+ */
+bool fuse_assembly_epilogue(const ITensorInfo *a,
+                            const ITensorInfo *b,
+                            const ITensorInfo *c,
+                            const ITensorInfo *d,
+                            float              alpha,
+                            float              beta,
+                            const GEMMInfo    &info,
+                            cpu::AsmGemmInfo  &asm_info)
+{
+    const bool                 is_c_bias    = beta == 1 && c != nullptr;
+    const bool                 run_addition = beta != 0 && beta != 1 && c != nullptr;
+    const ActivationLayerInfo &activation   = info.activation_info();
+    const bool                 native_activation =
+        !activation.enabled() || cpu::CpuGemmAssemblyDispatch::is_activation_supported(activation);
+
+    if (alpha == 1.f && !run_addition && native_activation)
+    {
+        return false;
+    }
+
+    // The activation has to follow the scaling and the addition, so it moves into the epilogue as well
+    cpu::AsmGemmInfo fused_info = asm_info;
+    fused_info.activation_info  = ActivationLayerInfo();
+    if (alpha != 1.f)
+    {
+        fused_info.epilogue.push_back({cpu::AsmGemmEpilogueOp::Type::Scale, alpha, ActivationLayerInfo()});
+    }
+    if (run_addition)
+    {
+        fused_info.epilogue.push_back({cpu::AsmGemmEpilogueOp::Type::AddMatrix, beta, ActivationLayerInfo()});
+    }
+    if (activation.enabled())
+    {
+        fused_info.epilogue.push_back({cpu::AsmGemmEpilogueOp::Type::Activation, 1.f, activation});
+    }
+
+    if (!bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, d, fused_info)) ||
+        !bool(cpu::CpuGemmAssemblyDispatch::validate_epilogue(d, run_addition ? c : nullptr, fused_info)))
+    {
+        return false;
+    }
+
+    asm_info = fused_info;
+    return true;
+}
 } // namespace
 
 void CpuGemm::configure(const ITensorInfo *a,
@@ -75,23 +126,27 @@ void CpuGemm::configure(const ITensorInfo *a,
     ARM_COMPUTE_ERROR_THROW_ON(CpuGemm::validate(a, b, c, d, alpha, beta, gemm_info));
     ARM_COMPUTE_LOG_PARAMS(a, b, c, d, alpha, beta, gemm_info);
 
-    const cpu::AsmGemmInfo asm_info  = init_assembly_metadata(gemm_info);
-    const bool             is_c_bias = beta == 1 && c != nullptr;
-    const bool             run_optimised =
+    cpu::AsmGemmInfo asm_info  = init_assembly_metadata(gemm_info);
+    const bool       is_c_bias = beta == 1 && c != nullptr;
+    const bool       epilogue  = fuse_assembly_epilogue(a, b, c, d, alpha, beta, gemm_info, asm_info);
+    const bool       run_optimised =
         bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_c_bias) ? c : nullptr, d, asm_info)) &&
-        (c == nullptr || beta == 0.f || beta == 1.f) && // Optimized GeMM doesn't support beta coefficient.
+        (c == nullptr || beta == 0.f || beta == 1.f ||
+         epilogue) && // Optimized GeMM only supports a beta coefficient through its epilogue.
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
+    const bool fused = run_optimised && epilogue;
 
     // Check if we need to reshape the matrix B only on the first run
     _is_prepared                      = false;
     _reshape_b_only_on_first_run      = b->are_values_constant();
     _run_vector_matrix_multiplication = a->dimension(1) < 2;
-    _run_alpha_scale                  = alpha != 1.f;
+    _run_alpha_scale                  = alpha != 1.f && !fused;
     _run_bias_addition                = is_c_bias;
-    _run_addition                     = beta != 0 && beta != 1 && c != nullptr;
+    _run_addition                     = beta != 0 && beta != 1 && c != nullptr && !fused;
+    _run_epilogue_addition            = beta != 0 && beta != 1 && c != nullptr && fused;
     _run_activation =
-        gemm_info.activation_info().enabled() &&
+        gemm_info.activation_info().enabled() && !fused &&
         (!run_optimised ||
          (run_optimised && !cpu::CpuGemmAssemblyDispatch::is_activation_supported(gemm_info.activation_info())));
 
@@ -341,12 +396,14 @@ Status CpuGemm::validate(const ITensorInfo *a,
 
     // Check if we need to run the optimized assembly kernel
     cpu::AsmGemmInfo asm_info = init_assembly_metadata(gemm_info);
+    const bool       epilogue = fuse_assembly_epilogue(a, b, c, d, alpha, beta, gemm_info, asm_info);
 
     // Note we use b instead of b_to_use here because asm_info also captures the pretranspose_b() flag
     // so we pass the original b to CpuGemmAssemblyDispatch
     const bool run_optimised =
         bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, d, asm_info)) &&
-        (c == nullptr || beta == 0.f || beta == 1.f) && // Optimized GeMM doesn't support beta coefficient.
+        (c == nullptr || beta == 0.f || beta == 1.f ||
+         epilogue) && // Optimized GeMM only supports a beta coefficient through its epilogue.
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
@@ -442,6 +499,8 @@ void CpuGemm::run(ITensorPack &tensors)
         // Pass c to asm dispatch only if it's the bias tensor
         ITensorPack asm_pack = tensors;
         asm_pack.add_const_tensor(ACL_SRC_2, _run_bias_addition ? c : nullptr);
+        // Matrix C scaled by beta is added by the assembly epilogue
+        asm_pack.add_const_tensor(ACL_SRC_3, _run_epilogue_addition ? c : nullptr);
         _asm_glue->run(asm_pack);
         if (_run_alpha_scale)
         {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,8 +48,8 @@ namespace cpu
 /** Basic function to execute GEMM. This function calls the following kernels:
  *
  * If optimized assembly is available:
- *  -# @ref cpu::CpuGemmAssemblyDispatch
- *  -# @ref cpu::CpuActivation (if alpha != 1.0)
+ *  -# @ref cpu::CpuGemmAssemblyDispatch (alpha, beta and the activation are fused into its epilogue for F32 outputs)
+ *  -# @ref cpu::CpuActivation (if alpha != 1.0 and they could not be fused)
  * Else:
  *  -# @ref cpu::kernels::CpuGemmInterleave4x4Kernel (if the output tensor is a matrix)
  *  -# @ref cpu::kernels::CpuGemmTranspose1xWKernel (if the output tensor is a matrix)
@@ -175,6 +175,7 @@ private:
     bool _run_addition{false};
     bool _run_bias_addition{false};
     bool _run_activation{false};
+    bool _run_epilogue_addition{false}; /**< If the assembly epilogue adds matrix C scaled by beta */
     bool _reshape_b_only_on_first_run{false};
     bool _is_prepared{false};
 
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmDeconv2d.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::misc::shape_calculator;
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** [IFM, kernel_w, kernel_h, OFM] -> [OFM, kernel_w, kernel_h, IFM], i.e. the GEMM's [N, K] right-hand side */
+const PermutationVector weights_permutation(3U, 1U, 2U, 0U);
+
+struct GemmDeconvInfos
+{
+    TensorInfo src_2d{};
+    TensorInfo permuted_weights{};
+    TensorInfo weights_2d{};
+    TensorInfo gemm_output{};
+    TensorInfo col2im_output{};
+};
+
+GemmDeconvInfos compute_infos(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *dst)
+{
+    const size_t num_pixels = src->dimension(1) * src->dimension(2) * src->dimension(3);
+    const size_t num_taps   = weights->dimension(1) * weights->dimension(2);
+
+    // Quantized deconvolutions are accumulated in S32 up to the requantization of the output
+    const DataType acc_type = is_data_type_quantized_asymmetric(src->data_type()) ? DataType::S32 : src->data_type();
+
+    GemmDeconvInfos infos;
+    infos.src_2d = src->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+        TensorShape(src->dimension(0), num_pixels));
+    infos.permuted_weights = weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+        compute_permutation_output_shape(*weights, weights_permutation));
+    infos.weights_2d = infos.permuted_weights.clone()->set_tensor_shape(
+        TensorShape(weights->dimension(3) * num_taps, weights->dimension(0)));
+    infos.gemm_output = src->clone()
+                            ->set_is_resizable(true)
+                            .reset_padding()
+                            .set_tensor_shape(TensorShape(weights->dimension(3) * num_taps, num_pixels))
+                            .set_data_type(acc_type)
+                            .set_quantization_info(QuantizationInfo());
+    infos.col2im_output = dst->clone()
+                              ->set_is_resizable(true)
+                              .reset_padding()
+                              .set_data_type(acc_type)
+                              .set_quantization_info(QuantizationInfo());
+
+    // The GEMMLowp offset contribution expects the negated offsets of its operands
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        const UniformQuantizationInfo uiqinfo = src->quantization_info().uniform();
+        const UniformQuantizationInfo uwqinfo = weights->quantization_info().uniform();
+        infos.src_2d.set_quantization_info(QuantizationInfo(uiqinfo.scale, -uiqinfo.offset));
+        infos.weights_2d.set_quantization_info(QuantizationInfo(uwqinfo.scale, -uwqinfo.offset));
+    }
+    return infos;
+}
+
+/** Requantize the S32 sums of the taps into the destination, without any activation */
+Status make_output_stage_info(const ITensorInfo       *src,
+                              const ITensorInfo       *weights,
+                              const ITensorInfo       *dst,
+                              GEMMLowpOutputStageInfo &os_info)
+{
+    const auto min_max = quantization::get_min_max_values_from_quantized_data_type(dst->data_type());
+
+    os_info.type               = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    os_info.gemmlowp_offset    = dst->quantization_info().uniform().offset;
+    os_info.gemmlowp_min_bound = min_max.first;
+    os_info.gemmlowp_max_bound = min_max.second;
+    os_info.output_data_type   = dst->data_type();
+    return quantization::calculate_quantized_multipliers(src->quantization_info(), weights->quantization_info(),
+                                                         dst->quantization_info(), os_info);
+}
+
+GEMMInfo make_gemm_info(bool enable_fast_math)
+{
+    return GEMMInfo(false /* is_a_reshaped */, false /* is_b_reshaped */, true /* reshape_b_only_on_first_run */,
+                    0 /* depth_output_gemm3d */, false /* reinterpret_input_as_3d */,
+                    false /* retain_internal_weights */, GEMMLowpOutputStageInfo(), false /* fp_mixed_precision */,
+                    enable_fast_math);
+}
+} // namespace
+
+CpuGemmDeconv2d::CpuGemmDeconv2d()
+    : _permute_weights(),
+      _gemm(),
+      _gemmlowp(),
+      _col2im_kernel(),
+      _output_stage(),
+      _src_2d(),
+      _permuted_weights(),
+      _weights_2d(),
+      _gemm_output(),
+      _col2im_output(),
+      _is_quantized(false),
+      _is_prepared(false),
+      _aux_mem(Count)
+{
+}
+
+CpuGemmDeconv2d::~CpuGemmDeconv2d() = default;
+
+void CpuGemmDeconv2d::configure(const ITensorInfo   *src,
+                                const ITensorInfo   *weights,
+                                const ITensorInfo   *bias,
+                                ITensorInfo         *dst,
+                                const PadStrideInfo &info,
+                                bool                 enable_fast_math)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmDeconv2d::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmDeconv2d::validate(src, weights, bias, dst, info, enable_fast_math));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, bias, dst, info, enable_fast_math);
+
+    const auto out_dims = deconvolution_output_dimensions(src->dimension(1), src->dimension(2), weights->dimension(1),
+                                                          weights->dimension(2), info);
+    auto_init_if_empty(*dst,
+                       src->clone()->set_tensor_shape(compute_deconvolution_output_shape(out_dims, *src, *weights)));
+
+    const GemmDeconvInfos infos = compute_infos(src, weights, dst);
+    _src_2d                     = infos.src_2d;
+    _permuted_weights           = infos.permuted_weights;
+    _weights_2d                 = infos.weights_2d;
+    _gemm_output                = infos.gemm_output;
+    _col2im_output              = infos.col2im_output;
+    _is_quantized               = is_data_type_quantized_asymmetric(src->data_type());
+    _is_prepared                = false;
+
+    _permute_weights = std::make_unique<CpuPermute>();
+    _permute_weights->configure(weights, &_permuted_weights, weights_permutation);
+
+    experimental::MemoryRequirements gemm_mem_req;
+    if (_is_quantized)
+    {
+        _gemmlowp = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
+        _gemmlowp->configure(&_src_2d, &_weights_2d, nullptr, &_gemm_output, make_gemm_info(enable_fast_math));
+        gemm_mem_req = _gemmlowp->workspace();
+    }
+    else
+    {
+        _gemm = std::make_unique<CpuGemm>();
+        _gemm->configure(&_src_2d, &_weights_2d, nullptr, &_gemm_output, 1.f, 0.f, make_gemm_info(enable_fast_math));
+        gemm_mem_req = _gemm->workspace();
+    }
+
+    _col2im_kernel = std::make_unique<kernels::CpuDeconvolutionCol2ImKernel>();
+    _col2im_kernel->configure(&_gemm_output, bias, _is_quantized ? &_col2im_output : dst,
+                              Size2D(src->dimension(1), src->dimension(2)),
+                              Size2D(weights->dimension(1), weights->dimension(2)), info);
+
+    if (_is_quantized)
+    {
+        GEMMLowpOutputStageInfo os_info;
+        ARM_COMPUTE_ERROR_THROW_ON(make_output_stage_info(src, weights, dst, os_info));
+        _output_stage = std::make_unique<CpuGemmLowpOutputStage>();
+        _output_stage->configure(&_col2im_output, nullptr, dst, os_info);
+    }
+
+    for (unsigned int cont = 0; cont < gemm_mem_req.size(); ++cont)
+    {
+        _aux_mem[cont] = gemm_mem_req[cont];
+    }
+
+    // The permuted weights only need to outlive prepare() when the GEMM transforms them again
+    const bool gemm_trans_wei = _aux_mem[GemmAsmPretransposedRHS].size > 0 ||
+                                (_is_quantized ? _aux_mem[GemmLowpTransposed1xWRHS].size > 0
+                                               : _aux_mem[GemmTransposed1xWRHS].size > 0);
+    _aux_mem[PermutedWeights] = MemoryInfo(offset_int_vec(PermutedWeights),
+                                           gemm_trans_wei ? MemoryLifetime::Prepare : MemoryLifetime::Persistent,
+                                           _permuted_weights.total_size());
+    _aux_mem[GemmOutput] = MemoryInfo(offset_int_vec(GemmOutput), MemoryLifetime::Temporary, _gemm_output.total_size());
+    if (_is_quantized)
+    {
+        _aux_mem[Col2ImOutput] =
+            MemoryInfo(offset_int_vec(Col2ImOutput), MemoryLifetime::Temporary, _col2im_output.total_size());
+    }
+}
+
+Status CpuGemmDeconv2d::validate(const ITensorInfo   *src,
+                                 const ITensorInfo   *weights,
+                                 const ITensorInfo   *bias,
+                                 const ITensorInfo   *dst,
+                                 const PadStrideInfo &info,
+                                 bool                 enable_fast_math)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmDeconv2d::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->quantization_info().scale().size() > 1,
+                                    "Per channel quantized weights are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->has_padding(), "The input is reinterpreted as a matrix and cannot be padded");
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(((src->dimension(1) - 1) * info.stride().first + weights->dimension(1)) <
+                                (info.pad_left() + info.pad_right()));
+    ARM_COMPUTE_RETURN_ERROR_ON(((src->dimension(2) - 1) * info.stride().second + weights->dimension(2)) <
+                                (info.pad_top() + info.pad_bottom()));
+
+    const auto out_dims = deconvolution_output_dimensions(src->dimension(1), src->dimension(2), weights->dimension(1),
+                                                          weights->dimension(2), info);
+    const TensorInfo dst_info =
+        (dst->total_size() != 0)
+            ? TensorInfo(*dst)
+            : TensorInfo(src->clone()->set_tensor_shape(compute_deconvolution_output_shape(out_dims, *src, *weights)));
+
+    const bool            is_quantized = is_data_type_quantized_asymmetric(src->data_type());
+    const GemmDeconvInfos infos        = compute_infos(src, weights, &dst_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuPermute::validate(weights, &infos.permuted_weights, weights_permutation));
+    if (is_quantized)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmLowpMatrixMultiplyCore::validate(
+            &infos.src_2d, &infos.weights_2d, nullptr, &infos.gemm_output, make_gemm_info(enable_fast_math)));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuGemm::validate(&infos.src_2d, &infos.weights_2d, nullptr, &infos.gemm_output,
+                                                      1.f, 0.f, make_gemm_info(enable_fast_math)));
+    }
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDeconvolutionCol2ImKernel::validate(
+        &infos.gemm_output, bias, is_quantized ? &infos.col2im_output : &dst_info,
+        Size2D(src->dimension(1), src->dimension(2)), Size2D(weights->dimension(1), weights->dimension(2)), info));
+
+    if (is_quantized)
+    {
+        GEMMLowpOutputStageInfo os_info;
+        ARM_COMPUTE_RETURN_ON_ERROR(make_output_stage_info(src, weights, &dst_info, os_info));
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            CpuGemmLowpOutputStage::validate(&infos.col2im_output, nullptr, &dst_info, os_info));
+    }
+
+    return Status{};
+}
+
+void CpuGemmDeconv2d::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmDeconv2d::run");
+    prepare(tensors);
+
+    auto src  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto bias = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto dst  = tensors.get_tensor(TensorType::ACL_DST);
+
+    // Once transformed by the GEMM, the permuted weights are no longer read
+    const bool          use_permuted_wei = _aux_mem[PermutedWeights].lifetime == MemoryLifetime::Persistent;
+    CpuAuxTensorHandler src_2d(_src_2d, *src);
+    CpuAuxTensorHandler permuted_wei(offset_int_vec(PermutedWeights), _permuted_weights, tensors,
+                                     false /* pack_inject */, !use_permuted_wei /* bypass_alloc */,
+                                     !use_permuted_wei /* bypass_import */);
+    CpuAuxTensorHandler weights_2d(_weights_2d, *permuted_wei.get(), !use_permuted_wei);
+    CpuAuxTensorHandler gemm_output(offset_int_vec(GemmOutput), _gemm_output, tensors, false);
+
+    // The bias is added by the col2im kernel, not by the GEMM
+    ITensorPack gemm_pack = tensors;
+    gemm_pack.remove_tensor(TensorType::ACL_SRC_2);
+    gemm_pack.add_const_tensor(TensorType::ACL_SRC_0, src_2d.get());
+    gemm_pack.add_const_tensor(TensorType::ACL_SRC_1, weights_2d.get());
+    gemm_pack.add_tensor(TensorType::ACL_DST, gemm_output.get());
+    _is_quantized ? _gemmlowp->run(gemm_pack) : _gemm->run(gemm_pack);
+
+    CpuAuxTensorHandler col2im_output(offset_int_vec(Col2ImOutput), _col2im_output, tensors, false,
+                                      !_is_quantized /* bypass_alloc */);
+
+    ITensorPack col2im_pack = {{TensorType::ACL_SRC_0, gemm_output.get()},
+                               {TensorType::ACL_SRC_1, bias},
+                               {TensorType::ACL_DST, _is_quantized ? col2im_output.get() : dst}};
+    NEScheduler::get().schedule_op(_col2im_kernel.get(), Window::DimY, _col2im_kernel->window(), col2im_pack);
+
+    if (_is_quantized)
+    {
+        ITensorPack output_stage_pack = {{TensorType::ACL_SRC, col2im_output.get()}, {TensorType::ACL_DST, dst}};
+        _output_stage->run(output_stage_pack);
+    }
+}
+
+void CpuGemmDeconv2d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmDeconv2d::prepare");
+        auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+        CpuAuxTensorHandler permuted_wei(offset_int_vec(PermutedWeights), _permuted_weights, tensors);
+        ITensorPack         permute_pack = {{TensorType::ACL_SRC, weights}, {TensorType::ACL_DST, permuted_wei.get()}};
+        _permute_weights->run(permute_pack);
+        weights->mark_as_unused();
+
+        CpuAuxTensorHandler weights_2d(_weights_2d, *permuted_wei.get());
+        ITensorPack         gemm_pack = tensors;
+        gemm_pack.remove_tensor(TensorType::ACL_SRC_2);
+        gemm_pack.add_const_tensor(TensorType::ACL_SRC_1, weights_2d.get());
+        _is_quantized ? _gemmlowp->prepare(gemm_pack) : _gemm->prepare(gemm_pack);
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGemmDeconv2d::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMDECONV2D_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMDECONV2D_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuDeconvolutionCol2ImKernel.h"
+#include "src/cpu/operators/CpuGemm.h"
+#include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
+#include "src/cpu/operators/CpuGemmLowpOutputStage.h"
+#include "src/cpu/operators/CpuPermute.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic operator to compute a strided transposed convolution without upsampling the input
+ *
+ * Every input pixel is multiplied by the whole kernel in a single GEMM, [IFM, W * H * N] x [OFM * kernel_w * kernel_h,
+ * IFM], and the partial outputs are then summed into place by @ref kernels::CpuDeconvolutionCol2ImKernel. Compared
+ * with upsampling followed by a unit stride convolution this saves the stride_x * stride_y times larger intermediate
+ * tensor and the multiplications by its inserted zeros.
+ *
+ * Quantized deconvolutions accumulate in S32 through the GEMM and the col2im kernel, and are only requantized once
+ * every tap has been summed into an output pixel.
+ *
+ * The weights are expected to be constant: they are permuted once in @ref prepare().
+ *
+ * This operator runs the following kernels/operators:
+ * -# @ref CpuPermute (only once, on the weights)
+ * -# @ref CpuGemm (if floating point) or @ref CpuGemmLowpMatrixMultiplyCore (if quantized)
+ * -# @ref kernels::CpuDeconvolutionCol2ImKernel
+ * -# @ref CpuGemmLowpOutputStage (if quantized)
+ */
+class CpuGemmDeconv2d : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuGemmDeconv2d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmDeconv2d);
+    /** Default destructor */
+    ~CpuGemmDeconv2d();
+    /** Configure the operator
+     *
+     * @param[in]  src              Source tensor info of shape [IFM, W, H, N] with no padding. Data layout supported:
+     *                              NHWC. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights          Weights tensor info of shape [IFM, kernel_w, kernel_h, OFM]. Data type supported:
+     *                              same as @p src, with a single quantization scale if quantized.
+     * @param[in]  bias             (Optional) Bias tensor info of shape [OFM]. Can be nullptr. Data type supported:
+     *                              same as @p src, S32 if @p src is QASYMM8/QASYMM8_SIGNED.
+     * @param[out] dst              Destination tensor info. Data type supported: same as @p src.
+     * @param[in]  info             Strides and paddings of the deconvolution.
+     * @param[in]  enable_fast_math (Optional) Enable fast math computation in the GEMM. Default is false.
+     */
+    void configure(const ITensorInfo   *src,
+                   const ITensorInfo   *weights,
+                   const ITensorInfo   *bias,
+                   ITensorInfo         *dst,
+                   const PadStrideInfo &info,
+                   bool                 enable_fast_math = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuGemmDeconv2d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo   *src,
+                           const ITensorInfo   *weights,
+                           const ITensorInfo   *bias,
+                           const ITensorInfo   *dst,
+                           const PadStrideInfo &info,
+                           bool                 enable_fast_math = false);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        GemmAsmPretransposedRHS  = 2, // CpuGemmAssemblyDispatch::Pretranspose
+        GemmTransposed1xWRHS     = 5, // CpuGemm::Transposed1xWRHS
+        GemmLowpTransposed1xWRHS = 6, // CpuGemmLowpMatrixMultiplyCore::TmpB
+        /* Slots 0 - 9 reserved and shared by CpuGemmLowpMatrixMultiplyCore and CpuGemm */
+        PermutedWeights = 10,
+        GemmOutput,
+        Col2ImOutput,
+        Count
+    };
+
+    std::unique_ptr<CpuPermute>                             _permute_weights;
+    std::unique_ptr<CpuGemm>                                _gemm;
+    std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>          _gemmlowp;
+    std::unique_ptr<kernels::CpuDeconvolutionCol2ImKernel> _col2im_kernel;
+    std::unique_ptr<CpuGemmLowpOutputStage>                 _output_stage;
+    TensorInfo                                              _src_2d;
+    TensorInfo                                              _permuted_weights;
+    TensorInfo                                              _weights_2d;
+    TensorInfo                                              _gemm_output;
+    TensorInfo                                              _col2im_output;
+    bool                                                    _is_quantized;
+    bool                                                    _is_prepared;
+    experimental::MemoryRequirements                        _aux_mem;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMDECONV2D_H
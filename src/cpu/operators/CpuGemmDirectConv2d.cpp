@@ -78,10 +78,11 @@ GEMMLowpOutputStageInfo calculate_output_stage_metadata(const ITensorInfo
     quantization::calculate_quantized_multipliers(iqinfo, wqinfo, oqinfo, os_info);
     return os_info;
 }
-cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect)
+cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info)
 {
+    // Groups are mapped onto GEMM multis, which only the indirect pointer table can address
     cpu::AsmGemmInfo asm_info;
-    asm_info.method                  = is_indirect ? cpu::AsmConvMethod::Indirect : cpu::AsmConvMethod::Conv;
+    asm_info.method                  = info.num_groups > 1 ? cpu::AsmConvMethod::Indirect : cpu::AsmConvMethod::Conv;
     asm_info.ps_info                 = info.conv_info;
     asm_info.activation_info         = info.act_info;
     asm_info.depth_output_gemm3d     = true;
@@ -89,9 +90,12 @@ cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect
     asm_info.padding_top             = info.conv_info.pad_top();
     asm_info.padding_left            = info.conv_info.pad_left();
     asm_info.padding_value           = 0.f;
+    asm_info.dilation                = info.dilation;
+    asm_info.num_groups              = info.num_groups;
     asm_info.negated_offsets         = false;
     asm_info.fast_mode               = info.enable_fast_math;
-    asm_info.fixed_format            = info.weights_info.weight_format() != WeightFormat::UNSPECIFIED;
+    asm_info.fixed_format            = info.weights_info.weight_format() != WeightFormat::UNSPECIFIED &&
+                                       !is_sparse_format(info.weights_info.weight_format());
     asm_info.weight_format           = info.weights_info.weight_format();
     asm_info.use_fp32_acc            = info.use_fp32_acc;
     return asm_info;
@@ -129,7 +133,7 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src,
     _weights_permute_func->configure(weights, &_perm_weights, PermutationVector{3, 0, 1, 2});
 
     // Configure assembly dispatch
-    cpu::AsmGemmInfo asm_info = init_assembly_metadata(info, false);
+    cpu::AsmGemmInfo asm_info = init_assembly_metadata(info);
     if (is_data_type_quantized(src->data_type()))
     {
         asm_info.output_stage = calculate_output_stage_metadata(src, weights, dst, info.act_info);
@@ -158,7 +162,8 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src,
     else
     {
         // We must permute weights if they are WeightFormat::UNSPECIFIED
-        if (info.weights_info.weight_format() == WeightFormat::UNSPECIFIED)
+        if (info.weights_info.weight_format() == WeightFormat::UNSPECIFIED ||
+            is_sparse_format(info.weights_info.weight_format()))
             _aux_mem[PermutedWeights] =
                 MemoryInfo(offset_int_vec(PermutedWeights), MemoryLifetime::Persistent, weights->total_size());
     }
@@ -180,13 +185,14 @@ Status CpuGemmDirectConv2d::validate(const ITensorInfo *src,
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
     }
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_groups > 1, "Grouping (num_groups != 1) is not supported on Cpu");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_groups == 0);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
     const DataType    data_type = src->data_type();
     const TensorShape i_shape   = src->tensor_shape();
     const TensorShape w_shape   = weights->tensor_shape();
-    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] != i_shape[0]);
-    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation != Size2D(1U, 1U));
+    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] * info.num_groups != i_shape[0]);
+    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[3] % info.num_groups != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation.x() == 0 || info.dilation.y() == 0);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
     // Validate Permute
@@ -218,8 +224,14 @@ Status CpuGemmDirectConv2d::validate(const ITensorInfo *src,
 
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
 
-    cpu::AsmGemmInfo asm_info = init_assembly_metadata(info, false);
-    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(src, weights, biases, dst, asm_info));
+    // Grouped convolutions check the per-group shapes against the permuted [OFM, IFM / num_groups, KW, KH] weights
+    const auto grouped_weights = weights->clone();
+    grouped_weights->set_tensor_shape(
+        misc::shape_calculator::compute_permutation_output_shape(*weights, PermutationVector{3, 0, 1, 2}));
+    const ITensorInfo *asm_weights = info.num_groups > 1 ? grouped_weights.get() : weights;
+
+    cpu::AsmGemmInfo asm_info = init_assembly_metadata(info);
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(src, asm_weights, biases, dst, asm_info));
     return Status{};
 }
 void CpuGemmDirectConv2d::run(ITensorPack &tensors)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,13 +62,14 @@ public:
      * @param[in] src     Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
      *                    while every optional dimension from 4 and above represent a batch of inputs.
      *                    Data types supported: QASYMM8/QASYMM8_SIGNED/BFLOAT16/F16/F32.
-     * @param[in] weights Weights tensor info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM].
+     * @param[in] weights Weights tensor info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM].
      *                    Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL/BFLOAT16/F16/F32.
      * @param[in] biases  Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
      *                    Data type supported: Should match @p input data type, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
      * @param[in] dst     Destination tensor info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                    Data types supported: Same as @p input.
-     * @param[in] info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] info    Contains padding, stride, dilation and grouping information. Grouped convolutions are run
+     *                    as an indirect GEMM with one GEMM multi per group and do not support QSYMM8_PER_CHANNEL weights.
      */
     void configure(const ITensorInfo *src,
                    const ITensorInfo *weights,
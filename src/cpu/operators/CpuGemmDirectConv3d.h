@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMDIRECTCONV3D_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMDIRECTCONV3D_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+struct Conv3dInfo;
+namespace cpu
+{
+/** Basic function to run a NDHWC 3D convolution as a single indirect GEMM
+ *
+ * Every output point is a row of the GEMM and every kernel tap a section of the reduction: the assembly dispatch
+ * builds a table of pointers to the input rows once, padded taps point to a row holding the zero point, so no
+ * im2col buffer is materialised. The weights layout [OFM, IFM, kernel_x, kernel_y, kernel_z] is already the
+ * reduction-major matrix the GEMM expects and is used as is.
+ */
+class CpuGemmDirectConv3d : public ICpuOperator
+{
+public:
+    CpuGemmDirectConv3d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmDirectConv3d);
+    ~CpuGemmDirectConv3d();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NDHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |
+     * |QASYMM8        |QASYMM8        |S32            |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32            |QASYMM8_SIGNED |
+     *
+     * @param[in]  src     Source tensor info. 4 lower dimensions represent a single input [IFM, width, height, depth],
+     *                     while every optional dimension from 5 and above represent a batch of inputs.
+     *                     Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights Weights tensor info. Weights are 5D tensor with dimensions [OFM, IFM, kernel_x, kernel_y, kernel_z].
+     *                     Data type supported: Same as @p src.
+     * @param[in]  biases  Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                     Data type supported: Same as @p src, except for src of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[out] dst     Destination tensor info. 4 lower dimensions represent a single output [OFM, width, height, depth],
+     *                     while the rest represent batch of outputs. Data types supported: Same as @p src.
+     * @param[in]  info    Contains padding, stride and activation information described in @ref Conv3dInfo.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *biases,
+                   ITensorInfo       *dst,
+                   const Conv3dInfo  &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmDirectConv3d
+     *
+     * Similar to CpuGemmDirectConv3d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *biases,
+                           const ITensorInfo *dst,
+                           const Conv3dInfo  &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        GemmTemp0 = 0,
+        GemmTemp1,
+        Pretranspose,
+        /* Slots above (0-2) are reserved for CpuGemmAssemblyDispatch */
+        Count
+    };
+
+    std::unique_ptr<CpuGemmAssemblyDispatch> _gemm_asm_func;
+    std::unique_ptr<CpuActivation>           _activation_func;
+    experimental::MemoryRequirements         _aux_mem;
+    bool                                     _run_activation;
+    bool                                     _is_prepared;
+};
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMDIRECTCONV3D_H
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuKVCacheMatMul.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+CpuKVCacheMatMul::CpuKVCacheMatMul()
+    : _append_kernel(), _matmul_kernel(), _packed_cache_info(), _info(), _length(0), _aux_mem(AuxTensorIdx::Count)
+{
+}
+
+CpuKVCacheMatMul::~CpuKVCacheMatMul() = default;
+
+void CpuKVCacheMatMul::configure(const ITensorInfo *lhs, ITensorInfo *dst, const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheMatMul::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuKVCacheMatMul::validate(lhs, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(lhs, dst);
+
+    _info              = info;
+    _length            = 0;
+    _packed_cache_info = kernels::CpuKVCacheAppendKernel::packed_cache_info(lhs->data_type(), info, lhs->dimension(2));
+
+    _append_kernel = std::make_unique<kernels::CpuKVCacheAppendKernel>();
+    _append_kernel->configure(&_packed_cache_info, info);
+
+    _matmul_kernel = std::make_unique<kernels::CpuKVCacheMatMulKernel>();
+    _matmul_kernel->configure(lhs, &_packed_cache_info, dst, info);
+
+    // The cache outlives every run, so it can't share memory with other temporaries
+    _aux_mem[AuxTensorIdx::PackedCache] = MemoryInfo(offset_int_vec(AuxTensorIdx::PackedCache),
+                                                     MemoryLifetime::Persistent, _packed_cache_info.total_size());
+}
+
+Status CpuKVCacheMatMul::validate(const ITensorInfo *lhs, const ITensorInfo *dst, const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheMatMul::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, dst);
+
+    const TensorInfo packed_cache_info =
+        kernels::CpuKVCacheAppendKernel::packed_cache_info(lhs->data_type(), info, lhs->dimension(2));
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuKVCacheMatMulKernel::validate(lhs, &packed_cache_info, dst, info));
+
+    return Status{};
+}
+
+void CpuKVCacheMatMul::append(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheMatMul::append");
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    const ITensor *rows = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(rows);
+    // Writing past the capacity would overrun the cache: keep the check in release builds
+    ARM_COMPUTE_EXIT_ON_MSG(_length + rows->info()->dimension(1) > _info.max_length(), "Cache capacity exceeded");
+    ARM_COMPUTE_ERROR_THROW_ON(
+        kernels::CpuKVCacheAppendKernel::validate(rows->info(), &_packed_cache_info, _info, _length));
+
+    CpuAuxTensorHandler cache(offset_int_vec(AuxTensorIdx::PackedCache), _packed_cache_info, tensors, false);
+
+    ITensorPack append_pack{{TensorType::ACL_SRC, rows}, {TensorType::ACL_DST, cache.get()}};
+
+    Window win = _append_kernel->window();
+    win.set(Window::DimY, Window::Dimension(0, rows->info()->dimension(1), 1));
+
+    // Decode steps append a single row per batch, so split over the batches unless a whole prompt is appended
+    const unsigned int split_dim = (rows->info()->dimension(1) > rows->info()->dimension(2)) ? Window::DimY : Window::DimZ;
+
+    _append_kernel->set_position(_length);
+    NEScheduler::get().schedule_op(_append_kernel.get(), split_dim, win, append_pack);
+
+    _length += rows->info()->dimension(1);
+}
+
+void CpuKVCacheMatMul::reset()
+{
+    _length = 0;
+}
+
+unsigned int CpuKVCacheMatMul::length() const
+{
+    return _length;
+}
+
+void CpuKVCacheMatMul::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuKVCacheMatMul::run");
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    ARM_COMPUTE_EXIT_ON_MSG(_length == 0, "The cache is empty");
+
+    const ITensor *lhs = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler cache(offset_int_vec(AuxTensorIdx::PackedCache), _packed_cache_info, tensors, false);
+
+    ITensorPack matmul_pack{{TensorType::ACL_SRC_0, lhs}, {TensorType::ACL_SRC_1, cache.get()}, {TensorType::ACL_DST, dst}};
+
+    _matmul_kernel->set_length(_length);
+    const Window win = _matmul_kernel->active_window();
+
+    // Attention usually has enough heads to keep every thread busy, otherwise split along the row
+    const unsigned int batches   = win.num_iterations(Window::DimZ);
+    const unsigned int split_dim = (batches >= NEScheduler::get().num_threads()) ? Window::DimZ : Window::DimX;
+
+    NEScheduler::get().schedule_op(_matmul_kernel.get(), split_dim, win, matmul_pack);
+}
+
+experimental::MemoryRequirements CpuKVCacheMatMul::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
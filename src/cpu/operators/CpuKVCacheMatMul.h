@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUKVCACHEMATMUL_H
+#define ACL_SRC_CPU_OPERATORS_CPUKVCACHEMATMUL_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuKVCacheAppendKernel.h"
+#include "src/cpu/kernels/CpuKVCacheMatMulKernel.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic operator to run a decode step matrix multiplication against an appendable key/value cache
+ *
+ * The operator owns the fill level of the cache: rows are packed into the persistent cache buffer by @ref append()
+ * and @ref run() only ever reads the rows appended so far, so the active length can grow without reconfiguring.
+ *
+ * This operator runs the following kernels:
+ * -# @ref kernels::CpuKVCacheAppendKernel
+ * -# @ref kernels::CpuKVCacheMatMulKernel
+ */
+class CpuKVCacheMatMul : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuKVCacheMatMul();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuKVCacheMatMul);
+    /** Default destructor */
+    ~CpuKVCacheMatMul();
+    /** Configure the operator
+     *
+     * @param[in]  lhs  Left-hand side tensor info. For @ref KVCacheOperand::Key, a query of shape [head_dim, 1, batches].
+     *                  For @ref KVCacheOperand::Value, weights of shape [max_length, 1, batches] of which only the
+     *                  first active length entries are read. Data types supported: F16/F32.
+     * @param[out] dst  Destination tensor info. For @ref KVCacheOperand::Key, scores of shape [max_length, 1, batches]
+     *                  where entries past the active length are set to -infinity.
+     *                  For @ref KVCacheOperand::Value, [head_dim, 1, batches]. Data type supported: same as @p lhs.
+     * @param[in]  info Cache information.
+     */
+    void configure(const ITensorInfo *lhs, ITensorInfo *dst, const KVCacheMatMulInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuKVCacheMatMul::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs, const ITensorInfo *dst, const KVCacheMatMulInfo &info);
+    /** Append rows to the cache
+     *
+     * @param[in] tensors Tensor pack holding the rows to append of shape [head_dim, num_rows, batches] as ACL_SRC,
+     *                    and the cache workspace.
+     */
+    void append(ITensorPack &tensors);
+    /** Discard all the cached rows */
+    void reset();
+    /** Number of rows currently held in the cache
+     *
+     * @return the active length
+     */
+    unsigned int length() const;
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        PackedCache = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuKVCacheAppendKernel> _append_kernel;
+    std::unique_ptr<kernels::CpuKVCacheMatMulKernel> _matmul_kernel;
+    TensorInfo                                       _packed_cache_info;
+    KVCacheMatMulInfo                                _info;
+    unsigned int                                     _length;
+    experimental::MemoryRequirements                 _aux_mem;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUKVCACHEMATMUL_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPULAYERNORMALIZATION_H
+#define ACL_SRC_CPU_OPERATORS_CPULAYERNORMALIZATION_H
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuLayerNormalizationKernel */
+class CpuLayerNormalization : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src      Source tensor info. The normalization is computed along X.
+     *                      Data types supported: F16/F32/BFLOAT16.
+     * @param[in]  residual (Optional) Tensor info added to @p src before the normalization. Can be nullptr.
+     * @param[in]  gamma    (Optional) 1D tensor info of scales along X. Can be nullptr.
+     * @param[in]  beta     (Optional) 1D tensor info of offsets along X. Can be nullptr.
+     * @param[out] dst      Destination tensor info. Data types supported: same as @p src or QASYMM8/QASYMM8_SIGNED.
+     * @param[out] sum      (Optional) Destination tensor info for @p src + @p residual. Can be nullptr.
+     * @param[in]  info     Normalization type and epsilon.
+     */
+    void configure(const ITensorInfo            *src,
+                   const ITensorInfo            *residual,
+                   const ITensorInfo            *gamma,
+                   const ITensorInfo            *beta,
+                   ITensorInfo                  *dst,
+                   ITensorInfo                  *sum,
+                   const LayerNormalizationInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuLayerNormalization::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *src,
+                           const ITensorInfo            *residual,
+                           const ITensorInfo            *gamma,
+                           const ITensorInfo            *beta,
+                           const ITensorInfo            *dst,
+                           const ITensorInfo            *sum,
+                           const LayerNormalizationInfo &info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    unsigned int _split_dimension{Window::DimY};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPULAYERNORMALIZATION_H
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuReduction.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuReductionKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuSplitDimension.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuReduction::configure(
+    const ITensorInfo *src, ITensorInfo *dst, const Coordinates &axis, ReductionOperation op, bool keep_dims)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuReduction::configure");
+    ARM_COMPUTE_LOG_PARAMS(src, dst, axis, op, keep_dims);
+
+    _partials = kernels::CpuReductionKernel::split_partials_info(src, axis);
+    _aux_mem  = MemoryRequirements(InternalTensorIdx::COUNT);
+
+    auto kernel = std::make_unique<kernels::CpuReductionKernel>();
+    if (_partials.total_size() != 0)
+    {
+        auto partial_kernel = std::make_unique<kernels::CpuReductionKernel>();
+        partial_kernel->configure(src, dst, axis, op, keep_dims, ReductionStage::Partial, &_partials);
+        kernel->configure(src, dst, axis, op, keep_dims, ReductionStage::Combine, &_partials);
+        _partial_kernel = std::move(partial_kernel);
+
+        _aux_mem[InternalTensorIdx::PARTIALS] =
+            MemoryInfo(offset_int_vec(InternalTensorIdx::PARTIALS), MemoryLifetime::Temporary, _partials.total_size());
+    }
+    else
+    {
+        kernel->configure(src, dst, axis, op, keep_dims);
+    }
+
+    // Destination elements are independent: the dimension with the most of them is X for a reduction over the
+    // spatial dimensions and the batches for a reduction along X.
+    _split_dimension = get_split_dimension(kernel->window(), Window::DimX, Window::DimX);
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuReduction::validate(
+    const ITensorInfo *src, const ITensorInfo *dst, const Coordinates &axis, ReductionOperation op, bool keep_dims)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuReduction::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+
+    const TensorInfo partials = kernels::CpuReductionKernel::split_partials_info(src, axis);
+    if (partials.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuReductionKernel::validate(src, dst, axis, op, keep_dims,
+                                                                          ReductionStage::Partial, &partials));
+        return kernels::CpuReductionKernel::validate(src, dst, axis, op, keep_dims, ReductionStage::Combine,
+                                                     &partials);
+    }
+    return kernels::CpuReductionKernel::validate(src, dst, axis, op, keep_dims);
+}
+
+void CpuReduction::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuReduction::run");
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    if (_partial_kernel != nullptr)
+    {
+        CpuAuxTensorHandler partials(offset_int_vec(InternalTensorIdx::PARTIALS), _partials, tensors, true);
+
+        ITensorPack pack = {{TensorType::ACL_SRC, tensors.get_const_tensor(TensorType::ACL_SRC)},
+                            {TensorType::ACL_DST, tensors.get_tensor(TensorType::ACL_DST)},
+                            {TensorType::ACL_INT, partials.get()}};
+
+        // There are more chunks than destination elements, so the partial stage is split along the chunks
+        NEScheduler::get().schedule_op(_partial_kernel.get(), Window::DimX, _partial_kernel->window(), pack);
+        NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), pack);
+        return;
+    }
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuReduction::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
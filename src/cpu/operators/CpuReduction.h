@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUREDUCTION_H
+#define ACL_SRC_CPU_OPERATORS_CPUREDUCTION_H
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuReductionKernel
+ *
+ * A long reduction along X with fewer destination elements than chunks of X is split across threads: a first kernel
+ * reduces the chunks into a temporary tensor of partial results, then a second kernel combines them in a fixed order.
+ */
+class CpuReduction : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src       Source tensor info. Data types supported: QASYMM8_SIGNED/QASYMM8/S32/F16/F32.
+     * @param[out] dst       Destination tensor info. Data types supported: same as @p src, or U32/S32 for
+     *                       @ref ReductionOperation::ARG_IDX_MIN and @ref ReductionOperation::ARG_IDX_MAX.
+     * @param[in]  axis      Non-negative dimensions to reduce. The index operations support a single axis.
+     * @param[in]  op        Reduction operation to perform.
+     * @param[in]  keep_dims Whether to keep the reduced dimensions with size 1 in @p dst.
+     */
+    void
+    configure(const ITensorInfo *src, ITensorInfo *dst, const Coordinates &axis, ReductionOperation op, bool keep_dims);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuReduction::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           const Coordinates &axis,
+                           ReductionOperation op,
+                           bool               keep_dims);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum InternalTensorIdx
+    {
+        PARTIALS = 0,
+        COUNT
+    };
+
+    std::unique_ptr<ICPPKernel>      _partial_kernel{nullptr};
+    TensorInfo                       _partials{};
+    experimental::MemoryRequirements _aux_mem{};
+    unsigned int                     _split_dimension{Window::DimX};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUREDUCTION_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,12 @@
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/kernels/CpuScatterKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuSplitDimension.h"
+
+using namespace arm_compute::experimental;
 
 namespace arm_compute
 {
@@ -60,9 +65,27 @@ void CpuScatter::configure(const ITensorInfo *src,
         _copy_operator = std::move(j);
         _run_copy      = true;
     }
+    _partitions = kernels::CpuScatterKernel::partitions_info(indices, dst);
+    _aux_mem    = MemoryRequirements(InternalTensorIdx::COUNT);
+
     auto k = std::make_unique<kernels::CpuScatterKernel>();
+    if (_partitions.total_size() != 0)
+    {
+        auto p = std::make_unique<kernels::CpuScatterKernel>();
+        p->configure(updates, indices, dst, scatter_info, ScatterStage::Partition, &_partitions);
+        k->configure(updates, indices, dst, scatter_info, ScatterStage::Apply, &_partitions);
+        _partition_kernel = std::move(p);
 
-    k->configure(updates, indices, dst, scatter_info);
+        _aux_mem[InternalTensorIdx::PARTITIONS] = MemoryInfo(offset_int_vec(InternalTensorIdx::PARTITIONS),
+                                                             MemoryLifetime::Temporary, _partitions.total_size());
+    }
+    else
+    {
+        k->configure(updates, indices, dst, scatter_info);
+    }
+
+    // Partitions and data rows write to disjoint parts of dst
+    _split_dimension = get_split_dimension(k->window(), Window::DimY, Window::DimY);
 
     _kernel = std::move(k);
 }
@@ -83,6 +106,14 @@ Status CpuScatter::validate(const ITensorInfo *src,
         ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuCopy::validate(src, dst)); // Validate copy kernel
     }
 
+    const TensorInfo partitions = kernels::CpuScatterKernel::partitions_info(indices, dst);
+    if (partitions.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuScatterKernel::validate(updates, indices, dst, scatter_info,
+                                                                        ScatterStage::Partition, &partitions));
+        return kernels::CpuScatterKernel::validate(updates, indices, dst, scatter_info, ScatterStage::Apply,
+                                                   &partitions);
+    }
     return kernels::CpuScatterKernel::validate(updates, indices, dst, scatter_info);
 }
 
@@ -105,7 +136,27 @@ void CpuScatter::run(ITensorPack &tensors)
         ITensorPack copy_pack{{ACL_SRC, src}, {ACL_DST, dst}};
         _copy_operator->run(copy_pack);
     }
-    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+
+    if (_partition_kernel != nullptr)
+    {
+        CpuAuxTensorHandler partitions(offset_int_vec(InternalTensorIdx::PARTITIONS), _partitions, tensors, true);
+
+        ITensorPack pack = {{TensorType::ACL_SRC_1, tensors.get_const_tensor(TensorType::ACL_SRC_1)},
+                            {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_2)},
+                            {TensorType::ACL_DST, dst},
+                            {TensorType::ACL_INT, partitions.get()}};
+
+        // Grouping the updates is a single pass over the indices
+        NEScheduler::get().schedule_op(_partition_kernel.get(), Window::DimX, _partition_kernel->window(), pack);
+        NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), pack);
+        return;
+    }
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuScatter::workspace() const
+{
+    return _aux_mem;
 }
 } // namespace cpu
 } // namespace arm_compute
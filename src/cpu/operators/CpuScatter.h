@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #define ACL_SRC_CPU_OPERATORS_CPUSCATTER_H
 
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
 
 #include "src/cpu/ICpuKernel.h"
@@ -36,7 +37,11 @@ namespace arm_compute
 {
 namespace cpu
 {
-/** Basic function to execute Scatter in Neon ™ */
+/** Basic function to execute Scatter in Neon ™
+ *
+ * When the destination has several blocks, the scatter is split across threads: a first kernel groups the updates by
+ * partitions of the destination blocks into a temporary tensor, then a second kernel reduces the groups in parallel.
+ */
 class CpuScatter : public ICpuOperator
 {
 public:
@@ -72,14 +77,25 @@ public:
                            const ScatterInfo &scatter_info);
 
     // Inherited methods overridden:
-    void run(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
-    std::unique_ptr<ICPPKernel>   _scatter_kernel{nullptr};
-    std::unique_ptr<cpu::CpuCopy> _copy_operator{nullptr};
-    std::unique_ptr<cpu::CpuFill> _fill_operator{nullptr};
-    bool                          _fill_zero{false};
-    bool                          _run_copy{false};
+    enum InternalTensorIdx
+    {
+        PARTITIONS = 0,
+        COUNT
+    };
+
+    std::unique_ptr<ICPPKernel>      _scatter_kernel{nullptr};
+    std::unique_ptr<ICPPKernel>      _partition_kernel{nullptr};
+    std::unique_ptr<cpu::CpuCopy>    _copy_operator{nullptr};
+    std::unique_ptr<cpu::CpuFill>    _fill_operator{nullptr};
+    TensorInfo                       _partitions{};
+    experimental::MemoryRequirements _aux_mem{};
+    unsigned int                     _split_dimension{Window::DimY};
+    bool                             _fill_zero{false};
+    bool                             _run_copy{false};
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 #include "src/core/helpers/SoftmaxHelpers.h"
 #include "src/cpu/kernels/CpuSoftmaxKernel.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuSplitDimension.h"
 
 using namespace arm_compute::experimental;
 
@@ -78,6 +79,11 @@ void CpuSoftmaxGeneric::configure(const ITensorInfo *src, ITensorInfo *dst, floa
     // Softmax 2D case
     sm->configure(tmp_input, dst, beta, is_log, actual_axis, &_tmp);
 
+    // Columns along a non-X axis are independent, so the work can be split along any other dimension instead of
+    // only along X, which is often narrow for attention shapes.
+    _split_dimension = (actual_axis != 0) ? get_split_dimension(sm->window(), Window::DimX, Window::DimX, actual_axis)
+                                          : Window::DimY;
+
     _softmax_kernel = std::move(sm);
 
     if (_tmp.total_size() > 0)
@@ -128,14 +134,7 @@ void CpuSoftmaxGeneric::run(ITensorPack &tensors)
 
     softmax_pack = {{TensorType::ACL_SRC_0, src}, {TensorType::ACL_DST_0, dst}, {TensorType::ACL_DST_1, tmp.get()}};
 
-    if (_axis == 0)
-    {
-        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimY, _softmax_kernel->window(), softmax_pack);
-    }
-    else
-    {
-        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimX, _softmax_kernel->window(), softmax_pack);
-    }
+    NEScheduler::get().schedule_op(_softmax_kernel.get(), _split_dimension, _softmax_kernel->window(), softmax_pack);
 }
 
 experimental::MemoryRequirements CpuSoftmaxGeneric::workspace() const
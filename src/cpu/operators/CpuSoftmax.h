@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,6 @@
 
 #include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
-#include "src/cpu/operators/CpuPermute.h"
 
 #include <memory>
 
@@ -47,10 +46,10 @@ class CpuSoftmaxKernel;
  * Log Softmax is calculated by :
  * @f[ out = (x - max(x) * beta) - log(\sum{e^{x - max(x) * beta}}) @f]
  *
- * This function runs the following function/kernels:
- * -# If axis is not 0:
- * -# @ref CpuPermute
+ * This function runs the following kernels:
  * -# @ref kernels::CpuSoftmaxKernel
+ *
+ * Any axis is reduced in place on the strided tensor, without permuting it.
  */
 class CpuSoftmaxGeneric : public ICpuOperator
 {
@@ -84,8 +83,6 @@ private:
     enum InternalTensorIdx
     {
         TMP = 0,
-        PERMUTED_SRC,
-        PERMUTED_DST,
         COUNT
     };
 
@@ -95,7 +92,8 @@ private:
 
     experimental::MemoryRequirements _aux_mem{};
 
-    unsigned int _axis = 0;
+    unsigned int _axis            = 0;
+    unsigned int _split_dimension = Window::DimY;
 };
 
 } // namespace cpu
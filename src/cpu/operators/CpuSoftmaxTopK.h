@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUSOFTMAXTOPK_H
+#define ACL_SRC_CPU_OPERATORS_CPUSOFTMAXTOPK_H
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuSoftmaxTopKKernel */
+class CpuSoftmaxTopK : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src     Source tensor info. Softmax is computed along X. Data types supported: F16/F32.
+     * @param[out] values  Destination tensor info for the k largest probabilities, in descending order.
+     *                     Data types supported: same as @p src.
+     * @param[out] indices Destination tensor info for the positions along X of @p values. Data types supported: U32.
+     * @param[in]  beta    A scaling factor for the exponent.
+     * @param[in]  k       Number of elements to select.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, float beta, unsigned int k);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuSoftmaxTopK::configure()
+     *
+     * @return a status
+     */
+    static Status validate(
+        const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, float beta, unsigned int k);
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUSOFTMAXTOPK_H
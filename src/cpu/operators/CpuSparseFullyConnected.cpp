@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuSparseFullyConnected.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+FullyConnectedLayerInfo to_dense_info(const SparseFullyConnectedLayerInfo &info)
+{
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.activation_info   = info.activation_info;
+    fc_info.transpose_weights = info.transpose_weights;
+    return fc_info;
+}
+} // namespace
+
+CpuSparseFullyConnected::CpuSparseFullyConnected()
+    : _sparse_kernel(),
+      _dense_fc(),
+      _packed_weights(),
+      _weights_info(),
+      _info(),
+      _use_dense(false),
+      _is_prepared(false),
+      _aux_mem(Count)
+{
+}
+
+CpuSparseFullyConnected::~CpuSparseFullyConnected() = default;
+
+void CpuSparseFullyConnected::configure(const ITensorInfo                   *src,
+                                        const ITensorInfo                   *weights,
+                                        const ITensorInfo                   *biases,
+                                        ITensorInfo                         *dst,
+                                        const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuSparseFullyConnected::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuSparseFullyConnected::validate(src, weights, biases, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst);
+
+    _info         = info;
+    _weights_info = *weights;
+    _use_dense    = false;
+    _is_prepared  = false;
+
+    _sparse_kernel = std::make_unique<kernels::CpuSparseFullyConnectedKernel>();
+    _sparse_kernel->configure(src, weights, biases, dst, info);
+
+    // Both paths are configured as the choice depends on the weights values, only known when preparing
+    _dense_fc = std::make_unique<CpuFullyConnected>();
+    _dense_fc->configure(src, weights, biases, dst, to_dense_info(info));
+
+    // Keep the slots of the dense operator and add the packed weights after them
+    const experimental::MemoryRequirements fc_mem_req = _dense_fc->workspace();
+    _aux_mem = experimental::MemoryRequirements(Count);
+    std::copy(fc_mem_req.begin(), fc_mem_req.end(), _aux_mem.begin());
+
+    // The sparse path is only taken up to max_density, which bounds the number of packed blocks
+    const unsigned int total_blocks = kernels::CpuSparseFullyConnectedKernel::total_blocks(weights, info);
+    const unsigned int max_blocks =
+        std::min(total_blocks, static_cast<unsigned int>(info.max_density * static_cast<float>(total_blocks)));
+    const size_t packed_size = kernels::CpuSparseFullyConnectedKernel::packed_weights_size(weights, max_blocks, info);
+    _packed_weights          = TensorInfo(TensorShape(packed_size), 1, DataType::U8);
+    _aux_mem[PackedWeights] =
+        experimental::MemoryInfo(offset_int_vec(PackedWeights), experimental::MemoryLifetime::Persistent, packed_size);
+}
+
+Status CpuSparseFullyConnected::validate(const ITensorInfo                   *src,
+                                         const ITensorInfo                   *weights,
+                                         const ITensorInfo                   *biases,
+                                         const ITensorInfo                   *dst,
+                                         const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuSparseFullyConnected::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!weights->are_values_constant(),
+                                    "The weights are compressed once when preparing and must be constant");
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuSparseFullyConnectedKernel::validate(src, weights, biases, dst, info));
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuFullyConnected::validate(src, weights, biases, dst, to_dense_info(info)));
+    return Status{};
+}
+
+bool CpuSparseFullyConnected::uses_dense_fallback() const
+{
+    return _use_dense;
+}
+
+void CpuSparseFullyConnected::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuSparseFullyConnected::prepare");
+
+        const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+        const unsigned int num_blocks = kernels::CpuSparseFullyConnectedKernel::count_nonzero_blocks(weights, _info);
+        const unsigned int total_blocks = kernels::CpuSparseFullyConnectedKernel::total_blocks(&_weights_info, _info);
+        _use_dense = static_cast<float>(num_blocks) > _info.max_density * static_cast<float>(total_blocks);
+
+        if (_use_dense)
+        {
+            _dense_fc->prepare(tensors);
+        }
+        else
+        {
+            CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors, false);
+            kernels::CpuSparseFullyConnectedKernel::pack_weights(weights, packed_weights.get(), _info);
+            weights->mark_as_unused();
+        }
+
+        _is_prepared = true;
+    }
+}
+
+void CpuSparseFullyConnected::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuSparseFullyConnected::run");
+    prepare(tensors);
+
+    if (_use_dense)
+    {
+        _dense_fc->run(tensors);
+        return;
+    }
+
+    CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors, false);
+
+    ITensorPack sparse_pack{{TensorType::ACL_SRC_0, tensors.get_const_tensor(TensorType::ACL_SRC_0)},
+                            {TensorType::ACL_SRC_1, packed_weights.get()},
+                            {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_2)},
+                            {TensorType::ACL_DST, tensors.get_tensor(TensorType::ACL_DST)}};
+
+    // Batched inputs reuse each row of blocks across rows of the source, otherwise split the output channels
+    const Window      &win       = _sparse_kernel->window();
+    const unsigned int split_dim = (win.num_iterations(Window::DimY) >= NEScheduler::get().num_threads())
+                                       ? Window::DimY
+                                       : Window::DimX;
+
+    NEScheduler::get().schedule_op(_sparse_kernel.get(), split_dim, win, sparse_pack);
+}
+
+experimental::MemoryRequirements CpuSparseFullyConnected::workspace() const
+{
+    if (!_is_prepared)
+    {
+        return _aux_mem;
+    }
+
+    // Drop the persistent memory of the path that was not selected
+    experimental::MemoryRequirements req = _aux_mem;
+    for (int i = 0; i < Count; ++i)
+    {
+        const bool is_sparse_slot = (i == PackedWeights);
+        if (req[i].lifetime == experimental::MemoryLifetime::Persistent && is_sparse_slot == _use_dense)
+        {
+            req[i].size = 0;
+        }
+    }
+    return req;
+}
+} // namespace cpu
+} // namespace arm_compute
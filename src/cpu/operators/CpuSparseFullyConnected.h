@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUSPARSEFULLYCONNECTED_H
+#define ACL_SRC_CPU_OPERATORS_CPUSPARSEFULLYCONNECTED_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuSparseFullyConnectedKernel.h"
+#include "src/cpu/operators/CpuFullyConnected.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic operator to compute a fully connected layer with block-sparse weights
+ *
+ * The weights are inspected once in @ref prepare(): when the fraction of non-zero blocks is at most
+ * @ref SparseFullyConnectedLayerInfo::max_density they are compressed into a persistent auxiliary tensor and the
+ * sparse kernel is used, otherwise the operator falls back to @ref CpuFullyConnected and its workspace is used.
+ * The packed weights are sized for the densest weights that still take the sparse path. Once prepared,
+ * @ref workspace() only reports the persistent memory of the selected path.
+ *
+ * This operator runs the following kernels:
+ * -# @ref kernels::CpuSparseFullyConnectedKernel
+ *
+ * or, when the weights are too dense:
+ * -# @ref CpuFullyConnected
+ */
+class CpuSparseFullyConnected : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuSparseFullyConnected();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuSparseFullyConnected);
+    /** Default destructor */
+    ~CpuSparseFullyConnected();
+    /** Configure the operator
+     *
+     * @param[in]  src     Source tensor info of shape [K, M]. Data types supported: F32.
+     * @param[in]  weights Constant weights tensor info. [K, N] if @ref SparseFullyConnectedLayerInfo::transpose_weights
+     *                     is set, [N, K] otherwise. Data type supported: same as @p src.
+     * @param[in]  biases  Bias tensor info of shape [N]. Can be nullptr. Data type supported: same as @p src.
+     * @param[out] dst     Destination tensor info of shape [N, M]. Data type supported: same as @p src.
+     * @param[in]  info    Sparse fully connected layer information.
+     */
+    void configure(const ITensorInfo                   *src,
+                   const ITensorInfo                   *weights,
+                   const ITensorInfo                   *biases,
+                   ITensorInfo                         *dst,
+                   const SparseFullyConnectedLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuSparseFullyConnected::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *src,
+                           const ITensorInfo                   *weights,
+                           const ITensorInfo                   *biases,
+                           const ITensorInfo                   *dst,
+                           const SparseFullyConnectedLayerInfo &info);
+    /** Whether the dense path was selected
+     *
+     * @note Only meaningful once the operator has been prepared.
+     *
+     * @return true if the weights were too dense to be compressed
+     */
+    bool uses_dense_fallback() const;
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        // Slots 0 - 12 reserved for CpuFullyConnected
+        PackedWeights = 13,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuSparseFullyConnectedKernel> _sparse_kernel;
+    std::unique_ptr<CpuFullyConnected>                      _dense_fc;
+    TensorInfo                                              _packed_weights;
+    TensorInfo                                              _weights_info;
+    SparseFullyConnectedLayerInfo                           _info;
+    bool                                                    _use_dense;
+    bool                                                    _is_prepared;
+    experimental::MemoryRequirements                        _aux_mem;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUSPARSEFULLYCONNECTED_H
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUTOPK_H
+#define ACL_SRC_CPU_OPERATORS_CPUTOPK_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuTopKKernel
+ *
+ * The rows are distributed across threads. Rows with more chunks than there are rows are split across threads too: a
+ * first kernel selects the top-k of every chunk into a temporary tensor, then a second kernel selects the top-k of
+ * every row among them.
+ */
+class CpuTopK : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src     Source tensor info. Data types supported: F16/F32.
+     * @param[out] values  Destination tensor info of the k largest values of every row along X, sorted in
+     *                     descending order. Data types supported: same as @p src.
+     * @param[out] indices Destination tensor info of the indices along X of @p values. Data types supported: U32.
+     * @param[in]  k       Number of elements to select in every row. Must be in the range [1, width of @p src].
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuTopK::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum InternalTensorIdx
+    {
+        PARTIALS = 0,
+        COUNT
+    };
+
+    std::unique_ptr<ICPPKernel>      _partial_kernel{nullptr};
+    TensorInfo                       _partials{};
+    experimental::MemoryRequirements _aux_mem{};
+    unsigned int                     _split_dimension{Window::DimY};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUTOPK_H
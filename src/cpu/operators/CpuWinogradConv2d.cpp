@@ -136,6 +136,98 @@ bool get_winograd_kernel_implementation(const ITensorInfo
     }
     return success;
 }
+/** Number of rows of output tiles to process at a time, or 0 to process the whole tensor at once
+ *
+ * The Winograd-domain input and output of a band are sized to stay resident in the private caches of the worker
+ * threads between the input transform, the GEMM and the output transform. Bands are kept large enough for every
+ * thread to own a row of tiles and for the GEMM to amortise streaming the transformed weights.
+ *
+ * A non-zero @p forced_band_tile_rows bypasses the heuristic.
+ */
+unsigned int get_band_tile_rows(const arm_conv::winograd::WinogradImpl &winograd_impl,
+                                const arm_conv::ConvolutionArgs        &conv_args,
+                                uint32_t                                nthreads,
+                                unsigned int                            forced_band_tile_rows)
+{
+    constexpr size_t min_band_tiles = 64;
+
+    const size_t n_tile_rows =
+        DIV_CEIL(conv_args.output_shape.rows, winograd_impl.output_transform->get_output_rows());
+    if (forced_band_tile_rows != 0)
+    {
+        return std::min<size_t>(forced_band_tile_rows, n_tile_rows);
+    }
+
+    const auto  &wds          = winograd_impl.winograd_spec;
+    const size_t buffers_size = wds.input_matrix_size_bytes + wds.output_matrix_size_bytes;
+    const size_t cache_size   = static_cast<size_t>(CPUInfo::get().get_L2_cache_size()) * nthreads;
+    if (buffers_size <= cache_size)
+    {
+        return 0;
+    }
+
+    const size_t n_tile_cols =
+        DIV_CEIL(conv_args.output_shape.cols, winograd_impl.output_transform->get_output_cols());
+    const size_t tile_row_size = buffers_size / (conv_args.n_batches * n_tile_rows);
+
+    size_t band_tile_rows = std::max<size_t>(cache_size / tile_row_size, nthreads);
+    band_tile_rows        = std::max(band_tile_rows, DIV_CEIL(min_band_tiles, n_tile_cols));
+    band_tile_rows        = std::min(band_tile_rows, n_tile_rows);
+
+    // A single image already processed in one go gains nothing from banding
+    return (band_tile_rows == n_tile_rows && conv_args.n_batches == 1) ? 0 : band_tile_rows;
+}
+
+/** Get the Winograd implementation for a band of @p band_tile_rows rows of output tiles of a single batch
+ *
+ * The band uses the transforms selected for the whole tensor; only the GEMM arguments and the Winograd-domain
+ * layout change. Returns false if those transforms can not be used for the band.
+ */
+bool get_band_implementation(DataType                                    data_type,
+                             const arm_conv::winograd::WinogradImpl     &winograd_impl,
+                             const arm_conv::ConvolutionArgs            &conv_args,
+                             unsigned int                                band_tile_rows,
+                             bool                                        enable_fast_math,
+                             arm_conv::winograd::WinogradImpl           *band_impl,
+                             std::unique_ptr<arm_conv::ConvolutionArgs> &band_args)
+{
+    const unsigned int tile_rows = winograd_impl.output_transform->get_output_rows();
+    const unsigned int out_rows  = std::min(band_tile_rows * tile_rows, conv_args.output_shape.rows);
+    uint32_t           nthreads  = NEScheduler::get().num_threads();
+
+    // Padding and input rows are updated for every band when running
+    band_args = std::make_unique<arm_conv::ConvolutionArgs>(
+        1, arm_conv::Shape2D{out_rows + conv_args.kernel_shape.rows - 1, conv_args.input_shape.cols},
+        conv_args.n_input_channels, 0, conv_args.pad_left,
+        arm_conv::Shape2D{out_rows, conv_args.output_shape.cols}, conv_args.n_output_channels,
+        conv_args.kernel_shape, conv_args.activation);
+
+    arm_conv::winograd::WinogradConfig winograd_cfg;
+    winograd_cfg.output_rows             = tile_rows;
+    winograd_cfg.output_cols             = winograd_impl.output_transform->get_output_cols();
+    winograd_cfg.input_transform_filter  = winograd_impl.input_transform->get_name();
+    winograd_cfg.output_transform_filter = winograd_impl.output_transform->get_name();
+    winograd_cfg.weight_transform_filter = winograd_impl.weight_transform->get_name();
+
+    bool success = false;
+    if (data_type == DataType::F32)
+    {
+        success = arm_conv::winograd::get_implementation<float>(*band_impl, &CPUInfo::get(), *band_args, nthreads,
+                                                                enable_fast_math, &winograd_cfg, nullptr);
+    }
+#if defined(__aarch64__) && defined(ENABLE_FP16_KERNELS)
+    else if (data_type == DataType::F16)
+    {
+        success = arm_conv::winograd::get_implementation<__fp16>(*band_impl, &CPUInfo::get(), *band_args, nthreads,
+                                                                 enable_fast_math, &winograd_cfg, nullptr);
+    }
+#endif // defined(__aarch64__) && defined(ENABLE_FP16_KERNELS)
+
+    return success && band_impl->input_transform == winograd_impl.input_transform &&
+           band_impl->output_transform == winograd_impl.output_transform &&
+           band_impl->weight_transform == winograd_impl.weight_transform;
+}
+
 inline bool fuse_function_supported(const ActivationLayerInfo &act_info)
 {
     return act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU ||
@@ -154,6 +246,9 @@ CpuWinogradConv2d::CpuWinogradConv2d()
       _permute_weights(std::make_unique<CpuPermute>()),
       _aux_mem(AuxTensorIdx::Count),
       _conv_args{nullptr},
+      _band_conv_args{},
+      _band_transform_input_kernels{},
+      _band_transform_output_kernels{},
       _winograd_impl{},
       _data_layout(),
       _winograd_transformed_input{},
@@ -164,6 +259,8 @@ CpuWinogradConv2d::CpuWinogradConv2d()
       _weights_hwio(),
       _input_nhwc(),
       _output_nhwc(),
+      _band_tile_rows{0},
+      _forced_band_tile_rows{0},
       _is_prepared{false},
       _run_activation{false}
 {
@@ -205,6 +302,24 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
                            (_winograd_impl.output_transform != nullptr) && (_winograd_impl.gemm_args != nullptr));
     if (has_impl)
     {
+        // Large problems are run in bands of tile rows, so that only one band is held in the Winograd domain
+        std::unique_ptr<arm_conv::ConvolutionArgs> band_args;
+        _band_tile_rows = get_band_tile_rows(_winograd_impl, *_conv_args, nthreads, _forced_band_tile_rows);
+        if (_band_tile_rows != 0)
+        {
+            arm_conv::winograd::WinogradImpl band_impl{};
+            if (get_band_implementation(data_type, _winograd_impl, *_conv_args, _band_tile_rows, enable_fast_math,
+                                        &band_impl, band_args))
+            {
+                _winograd_impl.gemm_args     = std::move(band_impl.gemm_args);
+                _winograd_impl.winograd_spec = band_impl.winograd_spec;
+            }
+            else
+            {
+                _band_tile_rows = 0;
+            }
+        }
+
         // Determine how much working space is required, allocate it.
         const size_t input_workspace_size =
             _winograd_impl.input_transform->get_working_space_size(*_conv_args, nthreads);
@@ -277,17 +392,53 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
             _permute_output->configure(&_output_nhwc, dst, PermutationVector(1U, 2U, 0U));
         }
 
-        // Configure input transform kernel
-        _transform_input_kernel =
-            std::make_unique<CpuWinogradConv2dTransformInputKernel>(_winograd_impl, *_conv_args, nthreads);
-
         // Configure GEMM function
         _gemm_function->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
                                   &_winograd_transformed_output, 1.0f, 0.f);
 
-        // Configure output transform kernel
-        _transform_output_kernel =
-            std::make_unique<CpuWinogradConv2dTransformOutputKernel>(_winograd_impl, *_conv_args, nthreads);
+        // Configure the transform kernels, with a pair per band of each batch when the convolution is run in bands
+        _band_conv_args.clear();
+        _band_transform_input_kernels.clear();
+        _band_transform_output_kernels.clear();
+        if (_band_tile_rows == 0)
+        {
+            _transform_input_kernel =
+                std::make_unique<CpuWinogradConv2dTransformInputKernel>(_winograd_impl, *_conv_args, nthreads);
+            _transform_output_kernel =
+                std::make_unique<CpuWinogradConv2dTransformOutputKernel>(_winograd_impl, *_conv_args, nthreads);
+        }
+        else
+        {
+            const unsigned int tile_rows   = _winograd_impl.output_transform->get_output_rows();
+            const unsigned int n_tile_rows = DIV_CEIL(_conv_args->output_shape.rows, tile_rows);
+            const unsigned int band_rows   = _band_tile_rows * tile_rows;
+
+            std::vector<std::pair<unsigned int, unsigned int>> band_in_out_rows;
+            for (unsigned int tile_row = 0; tile_row < n_tile_rows; tile_row += _band_tile_rows)
+            {
+                // The last band is moved up to keep every band full height, the overlapping rows are recomputed
+                const unsigned int out_row = std::min(tile_row, n_tile_rows - _band_tile_rows) * tile_rows;
+                const unsigned int in_row  = out_row > _conv_args->pad_top ? out_row - _conv_args->pad_top : 0;
+
+                auto args               = std::make_unique<arm_conv::ConvolutionArgs>(*band_args);
+                args->pad_top           = out_row < _conv_args->pad_top ? _conv_args->pad_top - out_row : 0;
+                args->input_shape.rows  = _conv_args->input_shape.rows - in_row;
+                args->output_shape.rows = std::min(band_rows, _conv_args->output_shape.rows - out_row);
+                _band_conv_args.push_back(std::move(args));
+                band_in_out_rows.emplace_back(in_row, out_row);
+            }
+
+            for (unsigned int batch = 0; batch < _conv_args->n_batches; ++batch)
+            {
+                for (size_t band = 0; band < _band_conv_args.size(); ++band)
+                {
+                    _band_transform_input_kernels.push_back(std::make_unique<CpuWinogradConv2dTransformInputKernel>(
+                        _winograd_impl, *_band_conv_args[band], nthreads, batch, band_in_out_rows[band].first));
+                    _band_transform_output_kernels.push_back(std::make_unique<CpuWinogradConv2dTransformOutputKernel>(
+                        _winograd_impl, *_band_conv_args[band], nthreads, batch, band_in_out_rows[band].second));
+                }
+            }
+        }
 
         //Configure Activation Layer
         _run_activation = act_info.enabled() && !fuse_function_supported(act_info);
@@ -391,7 +542,6 @@ void CpuWinogradConv2d::run(ITensorPack &tensors)
     ITensorPack transform_input_pack{{ACL_SRC, is_nchw ? input_nhwc.get() : src},
                                      {ACL_DST, winograd_input_transformed.get()},
                                      {ACL_INT, input_workspace.get()}};
-    NEScheduler::get().schedule_op(_transform_input_kernel.get(), Window::DimX, win, transform_input_pack);
 
     CpuAuxTensorHandler winograd_weights_transformed(offset_int_vec(TransformedWeights), _winograd_transformed_weights,
                                                      tensors, true);
@@ -402,14 +552,29 @@ void CpuWinogradConv2d::run(ITensorPack &tensors)
     gemm_pack.add_const_tensor(ACL_SRC_1, winograd_weights_transformed.get());
     gemm_pack.add_const_tensor(ACL_BIAS, nullptr);
     gemm_pack.add_tensor(ACL_DST, winograd_output_transformed.get());
-    _gemm_function->run(gemm_pack);
 
-    // Output transform
     ITensorPack transform_output_pack{{ACL_SRC_0, winograd_output_transformed.get()},
                                       {ACL_DST, is_nchw ? output_nhwc.get() : output},
                                       {ACL_SRC_1, biases},
                                       {ACL_INT, output_workspace.get()}};
-    NEScheduler::get().schedule_op(_transform_output_kernel.get(), Window::DimX, win, transform_output_pack);
+
+    if (_band_tile_rows == 0)
+    {
+        NEScheduler::get().schedule_op(_transform_input_kernel.get(), Window::DimX, win, transform_input_pack);
+        _gemm_function->run(gemm_pack);
+        NEScheduler::get().schedule_op(_transform_output_kernel.get(), Window::DimX, win, transform_output_pack);
+    }
+    else
+    {
+        for (size_t band = 0; band < _band_transform_input_kernels.size(); ++band)
+        {
+            NEScheduler::get().schedule_op(_band_transform_input_kernels[band].get(), Window::DimX, win,
+                                           transform_input_pack);
+            _gemm_function->run(gemm_pack);
+            NEScheduler::get().schedule_op(_band_transform_output_kernels[band].get(), Window::DimX, win,
+                                           transform_output_pack);
+        }
+    }
     if (is_nchw)
     {
         // Reorder the convoluted output to ACL's ordering NCHW
@@ -478,5 +643,15 @@ experimental::MemoryRequirements CpuWinogradConv2d::workspace() const
     return _aux_mem;
 }
 
+void CpuWinogradConv2d::set_band_tile_rows(unsigned int band_tile_rows)
+{
+    _forced_band_tile_rows = band_tile_rows;
+}
+
+unsigned int CpuWinogradConv2d::num_bands() const
+{
+    return (_band_tile_rows == 0) ? 1U : static_cast<unsigned int>(_band_transform_input_kernels.size());
+}
+
 } // namespace cpu
 } // namespace arm_compute
@@ -36,6 +36,8 @@
 #include "src/cpu/operators/CpuPermute.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -95,6 +97,20 @@ public:
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                            bool                       enable_fast_math = false);
 
+    /** Force the number of rows of output tiles processed per band
+     *
+     * By default the convolution is only run in bands when its Winograd-domain buffers do not fit in the L2 caches
+     * of the threads, with a band height derived from the cache size. Must be called before configure().
+     *
+     * @param[in] band_tile_rows Rows of output tiles per band, or 0 to let the operator decide.
+     */
+    void set_band_tile_rows(unsigned int band_tile_rows);
+    /** Number of bands processed per run, over all the batches
+     *
+     * @return 1 if the whole tensor is transformed at once
+     */
+    unsigned int num_bands() const;
+
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
@@ -123,6 +139,12 @@ private:
     experimental::MemoryRequirements _aux_mem{Count};
     std::unique_ptr<arm_conv::ConvolutionArgs>
         _conv_args; // Make it unique ptr because this type does not have a default constructor
+    std::vector<std::unique_ptr<arm_conv::ConvolutionArgs>>
+        _band_conv_args; // Arguments of each band of a batch when the convolution is run in bands
+    std::vector<std::unique_ptr<ICPPKernel>>
+        _band_transform_input_kernels; // Input transform of each band of each batch, in execution order
+    std::vector<std::unique_ptr<ICPPKernel>>
+        _band_transform_output_kernels; // Output transform of each band of each batch, in execution order
     arm_conv::winograd::WinogradImpl _winograd_impl;
     DataLayout                       _data_layout;
     TensorInfo                       _winograd_transformed_input;
@@ -133,6 +155,8 @@ private:
     TensorInfo                       _weights_hwio;
     TensorInfo                       _input_nhwc;
     TensorInfo                       _output_nhwc;
+    unsigned int                     _band_tile_rows; // Rows of output tiles per band, 0 if not run in bands
+    unsigned int                     _forced_band_tile_rows; // Band height set by the caller, 0 if not forced
     bool                             _is_prepared;
     bool                             _run_activation;
 };
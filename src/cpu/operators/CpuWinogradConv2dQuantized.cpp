@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuWinogradConv2dQuantized.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+using namespace arm_compute::misc::shape_calculator;
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+constexpr size_t num_winograd_matrices = 16; // Elements of a 4x4 Winograd domain tile
+
+struct WinogradQuantizedInfos
+{
+    WinogradF2x2Tiling tiling{};
+    TensorInfo         transformed_input{};
+    TensorInfo         transformed_weights{};
+    TensorInfo         gemm_output{};
+};
+
+WinogradQuantizedInfos compute_infos(const ITensorInfo   *src,
+                                     const ITensorInfo   *weights,
+                                     const TensorShape   &dst_shape,
+                                     const PadStrideInfo &conv_info)
+{
+    WinogradQuantizedInfos infos;
+    infos.tiling.pad_left    = static_cast<int>(conv_info.pad_left());
+    infos.tiling.pad_top     = static_cast<int>(conv_info.pad_top());
+    infos.tiling.num_tiles_x = static_cast<int>(DIV_CEIL(dst_shape[1], 2U));
+    infos.tiling.num_tiles_y = static_cast<int>(DIV_CEIL(dst_shape[2], 2U));
+
+    const size_t num_tiles = src->dimension(3) * infos.tiling.num_tiles_x * infos.tiling.num_tiles_y;
+    const size_t ifm       = weights->dimension(0);
+    const size_t ofm       = weights->dimension(3);
+
+    infos.transformed_input   = TensorInfo(TensorShape(ifm, num_tiles, num_winograd_matrices), 1, DataType::S16);
+    infos.transformed_weights = TensorInfo(TensorShape(ofm, ifm, num_winograd_matrices), 1, DataType::S16);
+    infos.gemm_output         = TensorInfo(TensorShape(ofm, num_tiles, num_winograd_matrices), 1, DataType::S32);
+    return infos;
+}
+
+/** Largest magnitude of a value of @p dt once @p offset is removed */
+int64_t max_centred_magnitude(DataType dt, int32_t offset)
+{
+    const auto min_max = quantization::get_min_max_values_from_quantized_data_type(
+        (dt == DataType::QSYMM8_PER_CHANNEL) ? DataType::QASYMM8_SIGNED : dt);
+    return std::max(std::abs(min_max.first - offset), std::abs(min_max.second - offset));
+}
+
+Status make_output_stage(const ITensorInfo         *src,
+                         const ITensorInfo         *weights,
+                         const ITensorInfo         *dst,
+                         const ActivationLayerInfo &act_info,
+                         GEMMLowpOutputStageInfo   &output_stage)
+{
+    const DataType                data_type = src->data_type();
+    const UniformQuantizationInfo oq_info   = dst->quantization_info().uniform();
+
+    output_stage.type                     = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    output_stage.gemmlowp_offset          = oq_info.offset;
+    output_stage.is_quantized_per_channel = weights->quantization_info().scale().size() > 1;
+    output_stage.output_data_type         = data_type;
+
+    const auto type_min_max         = quantization::get_min_max_values_from_quantized_data_type(data_type);
+    output_stage.gemmlowp_min_bound = type_min_max.first;
+    output_stage.gemmlowp_max_bound = type_min_max.second;
+    if (act_info.enabled())
+    {
+        const auto act_min_max          = get_quantized_activation_min_max(act_info, data_type, oq_info);
+        output_stage.gemmlowp_min_bound = act_min_max.first;
+        output_stage.gemmlowp_max_bound = act_min_max.second;
+    }
+
+    return quantization::calculate_quantized_multipliers(src->quantization_info(), weights->quantization_info(),
+                                                         dst->quantization_info(), output_stage);
+}
+} // namespace
+
+CpuWinogradConv2dQuantized::CpuWinogradConv2dQuantized()
+    : _transform_weights_kernel(),
+      _transform_input_kernel(),
+      _gemm_kernel(),
+      _transform_output_kernel(),
+      _transformed_input(),
+      _transformed_weights(),
+      _gemm_output(),
+      _is_prepared(false),
+      _aux_mem(Count)
+{
+}
+
+CpuWinogradConv2dQuantized::~CpuWinogradConv2dQuantized() = default;
+
+void CpuWinogradConv2dQuantized::configure(const ITensorInfo         *src,
+                                           const ITensorInfo         *weights,
+                                           const ITensorInfo         *biases,
+                                           ITensorInfo               *dst,
+                                           const PadStrideInfo       &conv_info,
+                                           const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuWinogradConv2dQuantized::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, weights, biases, dst, conv_info, act_info));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info, act_info);
+
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_deep_convolution_shape(*src, *weights, conv_info)));
+
+    const WinogradQuantizedInfos infos = compute_infos(src, weights, dst->tensor_shape(), conv_info);
+    _transformed_input                 = infos.transformed_input;
+    _transformed_weights               = infos.transformed_weights;
+    _gemm_output                       = infos.gemm_output;
+    _is_prepared                       = false;
+
+    // Validated above
+    GEMMLowpOutputStageInfo output_stage{};
+    make_output_stage(src, weights, dst, act_info, output_stage);
+
+    _transform_weights_kernel = std::make_unique<kernels::CpuWinogradConv2dQuantizedTransformWeightsKernel>();
+    _transform_weights_kernel->configure(weights, &_transformed_weights);
+
+    _transform_input_kernel = std::make_unique<kernels::CpuWinogradConv2dQuantizedTransformInputKernel>();
+    _transform_input_kernel->configure(src, &_transformed_input, infos.tiling);
+
+    _gemm_kernel = std::make_unique<kernels::CpuWinogradConv2dQuantizedGemmKernel>();
+    _gemm_kernel->configure(&_transformed_input, &_transformed_weights, &_gemm_output);
+
+    _transform_output_kernel = std::make_unique<kernels::CpuWinogradConv2dQuantizedTransformOutputKernel>();
+    _transform_output_kernel->configure(&_gemm_output, biases, dst, infos.tiling, output_stage);
+
+    _aux_mem[TransformedInput] =
+        MemoryInfo(offset_int_vec(TransformedInput), MemoryLifetime::Temporary, _transformed_input.total_size());
+    _aux_mem[TransformedWeights] =
+        MemoryInfo(offset_int_vec(TransformedWeights), MemoryLifetime::Persistent, _transformed_weights.total_size());
+    _aux_mem[GemmOutput] = MemoryInfo(offset_int_vec(GemmOutput), MemoryLifetime::Temporary, _gemm_output.total_size());
+}
+
+Status CpuWinogradConv2dQuantized::validate(const ITensorInfo         *src,
+                                            const ITensorInfo         *weights,
+                                            const ITensorInfo         *biases,
+                                            const ITensorInfo         *dst,
+                                            const PadStrideInfo       &conv_info,
+                                            const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuWinogradConv2dQuantized::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::QSYMM8_PER_CHANNEL);
+    if (!is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != 3 || weights->dimension(2) != 3,
+                                    "Only 3x3 kernels are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1,
+                                    "Only unit strides are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(act_info.enabled() &&
+                                act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU &&
+                                act_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
+                                act_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU);
+
+    // Only the 4 * convolution sum computed by the output transform is guaranteed to fit the int32 accumulators
+    const int64_t max_src     = max_centred_magnitude(src->data_type(), src->quantization_info().uniform().offset);
+    const int64_t max_weights = max_centred_magnitude(
+        weights->data_type(),
+        is_data_type_quantized_asymmetric(weights->data_type()) ? weights->quantization_info().uniform().offset : 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(36 * static_cast<int64_t>(src->dimension(0)) * max_src * max_weights >
+                                        std::numeric_limits<int32_t>::max(),
+                                    "Too many input channels for the int32 Winograd accumulators");
+
+    const TensorShape dst_shape = compute_deep_convolution_shape(*src, *weights, conv_info);
+    const TensorInfo  dst_info =
+        (dst->total_size() != 0) ? TensorInfo(*dst) : TensorInfo(src->clone()->set_tensor_shape(dst_shape));
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    GEMMLowpOutputStageInfo output_stage{};
+    ARM_COMPUTE_RETURN_ON_ERROR(make_output_stage(src, weights, &dst_info, act_info, output_stage));
+
+    const WinogradQuantizedInfos infos = compute_infos(src, weights, dst_shape, conv_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        kernels::CpuWinogradConv2dQuantizedTransformWeightsKernel::validate(weights, &infos.transformed_weights));
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuWinogradConv2dQuantizedTransformInputKernel::validate(
+        src, &infos.transformed_input, infos.tiling));
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuWinogradConv2dQuantizedGemmKernel::validate(
+        &infos.transformed_input, &infos.transformed_weights, &infos.gemm_output));
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuWinogradConv2dQuantizedTransformOutputKernel::validate(
+        &infos.gemm_output, biases, &dst_info, infos.tiling, output_stage));
+
+    return Status{};
+}
+
+void CpuWinogradConv2dQuantized::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuWinogradConv2dQuantized::run");
+    prepare(tensors);
+
+    auto src    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto biases = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto dst    = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler transformed_input(offset_int_vec(TransformedInput), _transformed_input, tensors);
+    CpuAuxTensorHandler transformed_weights(offset_int_vec(TransformedWeights), _transformed_weights, tensors);
+    CpuAuxTensorHandler gemm_output(offset_int_vec(GemmOutput), _gemm_output, tensors);
+
+    ITensorPack input_pack = {{TensorType::ACL_SRC, src}, {TensorType::ACL_DST, transformed_input.get()}};
+    NEScheduler::get().schedule_op(_transform_input_kernel.get(), Window::DimY, _transform_input_kernel->window(),
+                                   input_pack);
+
+    // Each of the 16 products streams its own transformed weights. Splitting the rows as well lets more than 16
+    // threads share the products.
+    ITensorPack gemm_pack = {{TensorType::ACL_SRC_0, transformed_input.get()},
+                             {TensorType::ACL_SRC_1, transformed_weights.get()},
+                             {TensorType::ACL_DST, gemm_output.get()}};
+    NEScheduler::get().schedule_op(_gemm_kernel.get(), IScheduler::Hints(IScheduler::split_dimensions_all),
+                                   _gemm_kernel->window(), gemm_pack);
+
+    ITensorPack output_pack = {
+        {TensorType::ACL_SRC_0, gemm_output.get()}, {TensorType::ACL_SRC_1, biases}, {TensorType::ACL_DST, dst}};
+    NEScheduler::get().schedule_op(_transform_output_kernel.get(), Window::DimY, _transform_output_kernel->window(),
+                                   output_pack);
+}
+
+void CpuWinogradConv2dQuantized::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                                "CpuWinogradConv2dQuantized::prepare");
+        auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+        CpuAuxTensorHandler transformed_weights(offset_int_vec(TransformedWeights), _transformed_weights, tensors);
+        ITensorPack         pack = {{TensorType::ACL_SRC, weights}, {TensorType::ACL_DST, transformed_weights.get()}};
+        NEScheduler::get().schedule_op(_transform_weights_kernel.get(), Window::DimX,
+                                       _transform_weights_kernel->window(), pack);
+        weights->mark_as_unused();
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuWinogradConv2dQuantized::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
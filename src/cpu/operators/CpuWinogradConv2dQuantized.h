@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUWINOGRADCONV2DQUANTIZED_H
+#define ACL_SRC_CPU_OPERATORS_CPUWINOGRADCONV2DQUANTIZED_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuWinogradConv2dQuantizedKernel.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic operator to compute a quantized 3x3 convolution with the Winograd F(2x2, 3x3) algorithm
+ *
+ * The input and the weights are transformed with their zero points removed into int16, the 16 Winograd domain
+ * products are accumulated in int32 and the output transform yields exactly 4 times the integer convolution before
+ * the usual per-tensor or per-channel requantization. Results therefore match the GEMM based convolution, for 2.25
+ * times fewer multiplications, as long as the int32 accumulators cannot overflow: @ref validate() rejects the
+ * configurations where 36 * IFM * max|src - src_offset| * max|weights - weights_offset| exceeds INT32_MAX, e.g. more
+ * than 917 input channels for asymmetric 8-bit inputs and weights.
+ *
+ * The weights are expected to be constant: they are transformed once in @ref prepare().
+ *
+ * This operator runs the following kernels:
+ * -# @ref kernels::CpuWinogradConv2dQuantizedTransformWeightsKernel (only once)
+ * -# @ref kernels::CpuWinogradConv2dQuantizedTransformInputKernel
+ * -# @ref kernels::CpuWinogradConv2dQuantizedGemmKernel
+ * -# @ref kernels::CpuWinogradConv2dQuantizedTransformOutputKernel
+ */
+class CpuWinogradConv2dQuantized : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuWinogradConv2dQuantized();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWinogradConv2dQuantized);
+    /** Destructor */
+    ~CpuWinogradConv2dQuantized();
+
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
+     * |QASYMM8        |QSYMM8_PER_CHANNEL |S32    |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32    |QASYMM8_SIGNED |
+     *
+     * @param[in]  src       Source tensor info of shape [IFM, W, H, N]. Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  weights   Weights tensor info of shape [IFM, 3, 3, OFM]. Data types supported: Same as @p src or
+     *                       QSYMM8_PER_CHANNEL.
+     * @param[in]  biases    (Optional) Biases tensor info of shape [OFM]. Can be nullptr. Data type supported: S32.
+     * @param[out] dst       Destination tensor info of shape [OFM, out_w, out_h, N]. Data type supported: Same as
+     *                       @p src.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. Only unit strides
+     *                       are supported.
+     * @param[in]  act_info  (Optional) Activation layer information in case of a fused activation. Only RELU,
+     *                       BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *weights,
+                   const ITensorInfo         *biases,
+                   ITensorInfo               *dst,
+                   const PadStrideInfo       &conv_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuWinogradConv2dQuantized
+     *
+     * Similar to CpuWinogradConv2dQuantized::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *biases,
+                           const ITensorInfo         *dst,
+                           const PadStrideInfo       &conv_info,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        TransformedInput = 0,
+        TransformedWeights,
+        GemmOutput,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuWinogradConv2dQuantizedTransformWeightsKernel> _transform_weights_kernel;
+    std::unique_ptr<kernels::CpuWinogradConv2dQuantizedTransformInputKernel>   _transform_input_kernel;
+    std::unique_ptr<kernels::CpuWinogradConv2dQuantizedGemmKernel>             _gemm_kernel;
+    std::unique_ptr<kernels::CpuWinogradConv2dQuantizedTransformOutputKernel>  _transform_output_kernel;
+    TensorInfo                                                                  _transformed_input;
+    TensorInfo                                                                  _transformed_weights;
+    TensorInfo                                                                  _gemm_output;
+    bool                                                                        _is_prepared;
+    experimental::MemoryRequirements                                            _aux_mem;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUWINOGRADCONV2DQUANTIZED_H
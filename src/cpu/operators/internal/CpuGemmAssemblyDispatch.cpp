@@ -32,7 +32,9 @@
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/AssemblyUtils.h"
 #include "src/cpu/kernels/assembly/arm_gemm/arm_gemm.hpp"
+#include "src/cpu/kernels/activation/generic/neon/fp_impl.h"
 #include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
@@ -99,6 +101,178 @@ void run_parallel_pretranspose_B_array(arm_gemm::GemmCommon<TypeInput, TypeWeigh
     }
     NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/pretranspose_B_array");
 }
+
+constexpr ActFpImplParams EpilogueFp32Params = {static_cast<float>(1e-24), 4};
+
+/** Epilogue run by the assembly kernels on each block of final F32 results
+ *
+ * Each operation sweeps the block just written by the kernel, so the data is
+ * still in cache instead of being streamed from memory by a separate pass.
+ */
+class Fp32GemmEpilogue : public arm_gemm::IGemmEpilogue
+{
+public:
+    explicit Fp32GemmEpilogue(const std::vector<AsmGemmEpilogueOp> &ops) : _ops(ops)
+    {
+    }
+
+    /** Set the matrix added by @ref AsmGemmEpilogueOp::Type::AddMatrix */
+    void set_residual(const ITensor *residual)
+    {
+        _residual = nullptr;
+        if (residual != nullptr)
+        {
+            const ITensorInfo *info = residual->info();
+            _residual =
+                reinterpret_cast<const float *>(residual->buffer() + info->offset_first_element_in_bytes());
+            _residual_row_stride   = info->strides_in_bytes()[1] / sizeof(float);
+            _residual_batch_stride = info->dimension(2) > 1 ? info->strides_in_bytes()[2] / sizeof(float) : 0;
+            _residual_multi_stride = info->dimension(3) > 1 ? info->strides_in_bytes()[3] / sizeof(float) : 0;
+        }
+    }
+
+    void apply(void        *C,
+               size_t       ldc,
+               unsigned int m0,
+               unsigned int rows,
+               unsigned int n0,
+               unsigned int cols,
+               unsigned int batch,
+               unsigned int multi) const override
+    {
+        float *const out = reinterpret_cast<float *>(C);
+
+        for (const auto &op : _ops)
+        {
+            switch (op.type)
+            {
+                case AsmGemmEpilogueOp::Type::Scale:
+                {
+                    for (unsigned int r = 0; r < rows; ++r)
+                    {
+                        float       *out_row = out + r * ldc;
+                        unsigned int x       = 0;
+                        for (; x + 4 <= cols; x += 4)
+                        {
+                            vst1q_f32(out_row + x, vmulq_n_f32(vld1q_f32(out_row + x), op.scale));
+                        }
+                        for (; x < cols; ++x)
+                        {
+                            out_row[x] *= op.scale;
+                        }
+                    }
+                    break;
+                }
+                case AsmGemmEpilogueOp::Type::AddMatrix:
+                {
+                    ARM_COMPUTE_ERROR_ON(_residual == nullptr);
+                    const float *res = _residual + m0 * _residual_row_stride + batch * _residual_batch_stride +
+                                       multi * _residual_multi_stride + n0;
+                    for (unsigned int r = 0; r < rows; ++r)
+                    {
+                        float       *out_row = out + r * ldc;
+                        const float *res_row = res + r * _residual_row_stride;
+                        unsigned int x       = 0;
+                        for (; x + 4 <= cols; x += 4)
+                        {
+                            vst1q_f32(out_row + x, vmlaq_n_f32(vld1q_f32(out_row + x), vld1q_f32(res_row + x), op.scale));
+                        }
+                        for (; x < cols; ++x)
+                        {
+                            out_row[x] += op.scale * res_row[x];
+                        }
+                    }
+                    break;
+                }
+                case AsmGemmEpilogueOp::Type::Activation:
+                {
+                    dispatch_fp_neon_activation_function<float, EpilogueFp32Params>(
+                        op.act_info.activation(), op.act_info,
+                        [&](auto activation_op_vec, auto activation_op_tail)
+                        {
+                            for (unsigned int r = 0; r < rows; ++r)
+                            {
+                                float       *out_row = out + r * ldc;
+                                unsigned int x       = 0;
+                                for (; x + 4 <= cols; x += 4)
+                                {
+                                    vst1q_f32(out_row + x, activation_op_vec(vld1q_f32(out_row + x)));
+                                }
+                                for (; x < cols; ++x)
+                                {
+                                    out_row[x] = activation_op_tail(out_row[x]);
+                                }
+                            }
+                        });
+                    break;
+                }
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported epilogue operation");
+            }
+        }
+    }
+
+private:
+    std::vector<AsmGemmEpilogueOp> _ops;
+    const float                   *_residual{nullptr};
+    size_t                         _residual_row_stride{0};
+    size_t                         _residual_batch_stride{0};
+    size_t                         _residual_multi_stride{0};
+};
+
+/** Run an epilogue over the whole output, for kernels which cannot run it themselves
+ *
+ * @param[in]     epilogue     Epilogue to run
+ * @param[in,out] out          Output of the gemm
+ * @param[in]     ldd          Stride in y of the output
+ * @param[in]     batch_stride Stride between batches of the output
+ * @param[in]     multi_stride Stride between multis of the output
+ * @param[in]     M            Number of rows per batch
+ * @param[in]     N            Number of columns
+ * @param[in]     batches      Number of batches
+ * @param[in]     multis       Number of multis
+ * @param[in]     num_threads  Number of threads to run this method. Must be >= 1
+ */
+template <typename TypeOutput>
+void run_parallel_epilogue(const arm_gemm::IGemmEpilogue *epilogue,
+                           TypeOutput                    *out,
+                           int                            ldd,
+                           int                            batch_stride,
+                           int                            multi_stride,
+                           unsigned int                   M,
+                           unsigned int                   N,
+                           unsigned int                   batches,
+                           unsigned int                   multis,
+                           unsigned int                   num_threads)
+{
+    ARM_COMPUTE_ERROR_ON(epilogue == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_threads == 0);
+    const unsigned int total_rows    = M * batches * multis;
+    const unsigned int workload_size = std::max(1U, std::min(total_rows, num_threads));
+
+    std::vector<IScheduler::Workload> workloads(workload_size);
+    for (unsigned int t = 0; t < workload_size; ++t)
+    {
+        workloads[t] = [=](const ThreadInfo &info)
+        {
+            const unsigned int thread_id = static_cast<unsigned int>(info.thread_id);
+            const unsigned int end       = (total_rows * (thread_id + 1)) / workload_size;
+            unsigned int       row       = (total_rows * thread_id) / workload_size;
+            while (row < end)
+            {
+                // Rows of one call must belong to the same batch and multi
+                const unsigned int m     = row % M;
+                const unsigned int batch = (row / M) % batches;
+                const unsigned int multi = row / (M * batches);
+                const unsigned int rows  = std::min(M - m, end - row);
+                epilogue->apply(out + multi * multi_stride + batch * batch_stride + m * ldd, ldd, m, rows, 0, N, batch,
+                                multi);
+                row += rows;
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/epilogue");
+}
 } // namespace
 
 using namespace arm_compute::experimental;
@@ -131,6 +305,17 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     {
         p.indirect = true;
         p.sections = b->tensor_shape()[2] * b->tensor_shape()[3];
+        // Each group is a multi working on its own slice of the input and output channels
+        p.N /= info.num_groups;
+        p.K /= info.num_groups;
+        if (info.conv3d)
+        {
+            // Every output point of every output plane is a row, the kernel planes are extra sections
+            p.sections *= b->tensor_shape()[4];
+
+            p.M       = d->tensor_shape()[1] * d->tensor_shape()[2] * d->tensor_shape()[3];
+            p.batches = d->tensor_shape().total_size_upper(4);
+        }
     }
     else
     {
@@ -145,6 +330,11 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
         p.batches = d->tensor_shape().total_size_upper(3) / p.multis;
     }
 
+    if (info.num_groups > 1)
+    {
+        p.multis = info.num_groups;
+    }
+
     return p;
 }
 
@@ -201,7 +391,7 @@ public:
         }
         const arm_compute::WeightFormat wf =
             assembly_utils::map_to_arm_compute_weight_format(_gemm_kernel_asm->get_config().weight_format);
-        return wf != arm_compute::WeightFormat::UNSPECIFIED && wf != arm_compute::WeightFormat::ANY;
+        return arm_compute::is_fixed_format(wf);
     }
 
     void update_quantization_parameters(const GEMMLowpOutputStageInfo &output_info,
@@ -262,6 +452,27 @@ private:
     /** Prepare the indirect buffer */
     void prepare_indirect_buffer(ITensorPack &tensors);
 
+    /** Stride between the multis of b, d and the bias
+     *
+     * Grouped convolutions keep all groups in the same tensors: consecutive groups are consecutive slices of columns.
+     *
+     * @param[in] info          Info of the tensor
+     * @param[in] default_index Dimension holding the multis of an ungrouped GEMM
+     *
+     * @return The multi stride in elements
+     */
+    int multi_stride(const ITensorInfo *info, size_t default_index) const;
+
+    /** Depth of a 3D indirect convolution, left as a single plane for 2D */
+    struct IndirectDepth
+    {
+        int64_t input_depth{1};
+        int64_t kernel_depth{1};
+        int64_t output_depth{1};
+        int64_t stride{1};
+        int64_t padding_front{0};
+    };
+
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
     /** Assembly Gemm kernel */
@@ -289,12 +500,20 @@ private:
     std::vector<const TypeInput *>        _indirect_buf{};
     std::vector<TypeInput>                _indirect_pad{};
     arm_gemm::ConvolutionParameters       _cp{};
+    IndirectDepth                         _indirect_depth{};
+    const uint8_t                        *_indirect_src{nullptr};
     experimental::MemoryRequirements      _aux_mem{Count};
     bool                                  _B_pretranspose_required{false};
     bool                                  _is_b_constant{true};
     bool                                  _is_c_constant{true};
     bool                                  _run_pre_pretranspose_b{false};
     bool                                  _B_pre_pretranspose_required{false};
+    /** Epilogue fused into the output */
+    std::unique_ptr<Fp32GemmEpilogue> _epilogue{nullptr};
+    /** Output shape the epilogue covers */
+    Params _epilogue_params{};
+    /** True if the kernel cannot run the epilogue itself */
+    bool _run_epilogue{false};
 };
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -322,46 +541,67 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_
 {
     auto             a              = tensors.get_const_tensor(TensorType::ACL_SRC_0);
     const TypeInput *A_ptr          = reinterpret_cast<TypeInput *>(a->buffer());
-    const int        multis         = 1;
-    const int        batches        = a->info()->tensor_shape().total_size_upper(3);
+    const size_t     a_batch_idx    = _gemm_info.conv3d ? 4 : 3;
+    const int        multis         = _gemm_info.num_groups;
+    const int        batches        = a->info()->tensor_shape().total_size_upper(a_batch_idx);
     const size_t     stride_A       = a->info()->strides_in_bytes().y() / sizeof(TypeInput);
-    const size_t     batch_stride_A = a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
-    const size_t     multi_stride_A = a->info()->strides_in_bytes()[4] / sizeof(TypeInput);
+    const size_t     plane_stride_A = a->info()->strides_in_bytes().z() / sizeof(TypeInput);
+    const size_t     batch_stride_A = a->info()->strides_in_bytes()[a_batch_idx] / sizeof(TypeInput);
+    // Groups read consecutive slices of the input channels
+    const size_t multi_stride_A = _cp.input_channels;
+
+    const IndirectDepth &dp = _indirect_depth;
 
     const size_t output_hw    = _cp.output_height * _cp.output_width;
-    const int    batch_size   = _cp.kernel_height * _cp.kernel_width * output_hw * sizeof(TypeInput);
+    const size_t output_size  = output_hw * dp.output_depth;
+    const size_t kernel_size  = _cp.kernel_height * _cp.kernel_width * dp.kernel_depth;
+    const int    batch_size   = kernel_size * output_size * sizeof(TypeInput);
     const size_t batch_stride = batch_size / sizeof(TypeInput);
     const int    multi_size   = batch_size * batches;
     const size_t multi_stride = multi_size / sizeof(TypeInput);
 
+    _indirect_src = a->buffer();
     for (int64_t m = 0; m < multis; m++)
     {
         for (int64_t b = 0; b < batches; b++)
         {
-            for (int64_t output_y = 0; output_y < _cp.output_height; output_y++)
+            for (int64_t output_z = 0; output_z < dp.output_depth; output_z++)
             {
-                for (int64_t output_x = 0; output_x < _cp.output_width; output_x++)
+                for (int64_t output_y = 0; output_y < _cp.output_height; output_y++)
                 {
-                    int64_t output_xy = (output_y * _cp.output_width) + output_x;
-
-                    for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
+                    for (int64_t output_x = 0; output_x < _cp.output_width; output_x++)
                     {
-                        for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
+                        int64_t output_xyz = (output_z * output_hw) + (output_y * _cp.output_width) + output_x;
+
+                        for (int64_t kernel_z = 0; kernel_z < dp.kernel_depth; kernel_z++)
                         {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
-                            int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
-                            int64_t input_xy  = (input_y * _cp.input_width) + input_x;
+                            const int64_t input_z = (output_z * dp.stride) + kernel_z - dp.padding_front;
 
-                            if (input_x < 0 || input_x >= _cp.input_width || input_y < 0 || input_y >= _cp.input_height)
-                            {
-                                _indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    _indirect_pad.data();
-                            }
-                            else
+                            for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
                             {
-                                _indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    A_ptr + (m * multi_stride_A + b * batch_stride_A + input_xy * stride_A);
+                                for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
+                                {
+                                    int64_t input_x = (output_x * _cp.output_stride_w) +
+                                                      (kernel_x * _cp.dilation_w) - _cp.padding_left;
+                                    int64_t input_y = (output_y * _cp.output_stride_h) +
+                                                      (kernel_y * _cp.dilation_h) - _cp.padding_top;
+                                    int64_t kernel_xyz =
+                                        (((kernel_z * _cp.kernel_height) + kernel_y) * _cp.kernel_width) + kernel_x;
+                                    int64_t input_xy = (input_y * _cp.input_width) + input_x;
+
+                                    const size_t idx =
+                                        m * multi_stride + b * batch_stride + kernel_xyz * output_size + output_xyz;
+                                    if (input_x < 0 || input_x >= _cp.input_width || input_y < 0 ||
+                                        input_y >= _cp.input_height || input_z < 0 || input_z >= dp.input_depth)
+                                    {
+                                        _indirect_buf[idx] = _indirect_pad.data();
+                                    }
+                                    else
+                                    {
+                                        _indirect_buf[idx] = A_ptr + (m * multi_stride_A + b * batch_stride_A +
+                                                                      input_z * plane_stride_A + input_xy * stride_A);
+                                    }
+                                }
                             }
                         }
                     }
@@ -378,6 +618,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
                                                                                   const AsmGemmInfo &info)
 {
     ARM_COMPUTE_ERROR_ON(!(info.method == AsmConvMethod::Conv || info.method == AsmConvMethod::Indirect));
+    ARM_COMPUTE_ERROR_ON(info.conv3d && info.method != AsmConvMethod::Indirect);
 
     float zeropad = 0.f;
     if (is_data_type_quantized(a->data_type()))
@@ -387,7 +628,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
 
     const auto input_width    = static_cast<int64_t>(a->tensor_shape()[1]);
     const auto input_height   = static_cast<int64_t>(a->tensor_shape()[2]);
-    const auto input_channels = static_cast<int64_t>(a->tensor_shape()[0]);
+    const auto input_channels = static_cast<int64_t>(a->tensor_shape()[0] / info.num_groups);
     const auto kernel_width   = static_cast<int64_t>(b->tensor_shape()[2]);
     const auto kernel_height  = static_cast<int64_t>(b->tensor_shape()[3]);
     const auto output_width   = static_cast<int64_t>(d->tensor_shape()[1]);
@@ -402,12 +643,22 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
            output_height,
            info.ps_info.stride().first,
            info.ps_info.stride().second,
-           1,
-           1,
+           static_cast<int64_t>(info.dilation.x()),
+           static_cast<int64_t>(info.dilation.y()),
            info.padding_top,
            info.padding_left,
            zeropad};
 
+    _indirect_depth = IndirectDepth{};
+    if (info.conv3d)
+    {
+        _indirect_depth.input_depth   = static_cast<int64_t>(a->tensor_shape()[3]);
+        _indirect_depth.kernel_depth  = static_cast<int64_t>(b->tensor_shape()[4]);
+        _indirect_depth.output_depth  = static_cast<int64_t>(d->tensor_shape()[3]);
+        _indirect_depth.stride        = info.stride_depth;
+        _indirect_depth.padding_front = info.padding_front;
+    }
+
     if (info.method == AsmConvMethod::Conv)
     {
         _gemm_kernel_asm->set_convolution_parameters(_cp);
@@ -415,19 +666,19 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
 
     if (info.method == AsmConvMethod::Indirect)
     {
-        const unsigned int multis    = 1;
-        const unsigned int batches   = a->tensor_shape().total_size_upper(3);
-        const unsigned int kernel_hw = _cp.kernel_width * _cp.kernel_height;
-        const unsigned int output_hw = _cp.output_width * _cp.output_height;
+        const unsigned int multis      = info.num_groups;
+        const unsigned int batches     = a->tensor_shape().total_size_upper(info.conv3d ? 4 : 3);
+        const unsigned int kernel_size = _cp.kernel_width * _cp.kernel_height * _indirect_depth.kernel_depth;
+        const unsigned int output_size = _cp.output_width * _cp.output_height * _indirect_depth.output_depth;
 
         using TypeInputPtr        = TypeInput *;
-        const int    batch_size   = kernel_hw * output_hw * sizeof(TypeInputPtr);
+        const int    batch_size   = kernel_size * output_size * sizeof(TypeInputPtr);
         const size_t batch_stride = batch_size / sizeof(TypeInputPtr);
         const int    multi_size   = batch_size * batches;
         const size_t multi_stride = multi_size / sizeof(TypeInputPtr);
 
         _indirect_buf = std::vector<const TypeInput *>(multi_size * multis);
-        _indirect_arg = std::vector<const TypeInput *const *>(sizeof(TypeInput **) * kernel_hw * multis * batches);
+        _indirect_arg = std::vector<const TypeInput *const *>(sizeof(TypeInput **) * kernel_size * multis * batches);
         _indirect_pad = std::vector<TypeInput>(_cp.input_channels, TypeInput(zeropad));
 
         // Set indirect argument
@@ -436,17 +687,29 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
         {
             for (int64_t b = 0; b < batches; b++)
             {
-                for (int64_t kernel_xy = 0; kernel_xy < kernel_hw; kernel_xy++)
+                for (int64_t kernel_xyz = 0; kernel_xyz < kernel_size; kernel_xyz++)
                 {
-                    _indirect_arg[pos++] = &_indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw];
+                    _indirect_arg[pos++] =
+                        &_indirect_buf[m * multi_stride + b * batch_stride + kernel_xyz * output_size];
                 }
             }
         }
 
-        _gemm_kernel_asm->set_indirect_parameters(a->tensor_shape()[0], _indirect_arg.data());
+        _gemm_kernel_asm->set_indirect_parameters(_cp.input_channels, _indirect_arg.data());
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+int Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::multi_stride(const ITensorInfo *info,
+                                                                           size_t             default_index) const
+{
+    if (_gemm_info.num_groups > 1)
+    {
+        return info->dimension(0) / _gemm_info.num_groups;
+    }
+    return info->strides_in_bytes()[default_index] / info->element_size();
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const ITensorInfo *a,
                                                                          const ITensorInfo *b,
@@ -556,6 +819,14 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         _gemm_kernel_asm->set_dequantize_scale(a->quantization_info().uniform().scale *
                                                b->quantization_info().uniform().scale);
     }
+
+    // Let the kernel apply the epilogue to each block of output as it completes, falling back to a separate pass
+    if (!gemm_info.epilogue.empty())
+    {
+        _epilogue        = std::make_unique<Fp32GemmEpilogue>(gemm_info.epilogue);
+        _epilogue_params = extract_parameters(a, b, d, gemm_info);
+        _run_epilogue    = !_gemm_kernel_asm->set_epilogue(_epilogue.get());
+    }
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -571,7 +842,8 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         if (c && c->info()->data_type() == DataType::S32)
         {
             _gemm_kernel_asm->set_quantized_bias(
-                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
+                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()),
+                _gemm_info.num_groups > 1 ? multi_stride(c->info(), 1) : 0);
         }
         const ITensor *b_to_use = b;
 
@@ -600,7 +872,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             const int  ldb     = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto in1_ptr = reinterpret_cast<const TypeWeight *>(
                 b_to_use->buffer() + b_to_use->info()->offset_first_element_in_bytes());
-            const int multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+            const int multi_stride_b = multi_stride(b_to_use->info(), 2);
 
             CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
 
@@ -616,11 +888,6 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             // its memory will be auto-managed by the handler
         }
 
-        if (_gemm_info.method == AsmConvMethod::Indirect)
-        {
-            prepare_indirect_buffer(tensors);
-        }
-
         _is_prepared = true;
     }
 }
@@ -661,7 +928,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     const size_t a_batch_idx = _gemm_info.reinterpret_input_as_3d != 0 ? 3 : 2;
     const size_t a_multi_idx = a_batch_idx + 1;
-    const size_t d_batch_idx = _gemm_info.depth_output_gemm3d != 0 ? 3 : 2;
+    const size_t d_batch_idx = _gemm_info.conv3d ? 4 : (_gemm_info.depth_output_gemm3d != 0 ? 3 : 2);
     const size_t d_multi_idx = d_batch_idx + 1;
 
     int       batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
@@ -669,7 +936,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     int       multi_stride_a = a->info()->strides_in_bytes()[a_multi_idx] / a->info()->element_size();
     int       multi_stride_b = 0;
-    const int multi_stride_d = d->info()->strides_in_bytes()[d_multi_idx] / d->info()->element_size();
+    const int multi_stride_d = multi_stride(d->info(), d_multi_idx);
 
     auto in0_ptr = reinterpret_cast<const TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
     const TypeWeight *in1_ptr = nullptr;
@@ -694,7 +961,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     if (b_to_use && !_gemm_kernel_asm->B_is_pretransposed())
     {
         ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
-        multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+        multi_stride_b = multi_stride(b_to_use->info(), 2);
         in1_ptr        = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                        b_to_use->info()->offset_first_element_in_bytes());
     }
@@ -705,7 +972,8 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
         if (c && c->info()->data_type() == DataType::S32)
         {
             _gemm_kernel_asm->set_quantized_bias(
-                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
+                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()),
+                _gemm_info.num_groups > 1 ? multi_stride(c->info(), 1) : 0);
         }
 
         // Pretranspose B if required
@@ -717,7 +985,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
             const int  ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto b_ptr          = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                                     b_to_use->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+            const int  multi_stride_b = multi_stride(b_to_use->info(), 2);
 
             CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, true);
             ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
@@ -784,15 +1052,26 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     if (_gemm_info.method == AsmConvMethod::Indirect)
     {
+        // The indirection table points into the source, so it is rebuilt whenever the source memory changes
+        if (a->buffer() != _indirect_src)
+        {
+            prepare_indirect_buffer(tensors);
+        }
         in0_ptr        = nullptr;
         lda            = 0;
         batch_stride_a = 0;
         multi_stride_a = 0;
     }
 
+    if (_epilogue != nullptr)
+    {
+        _epilogue->set_residual(tensors.get_const_tensor(TensorType::ACL_SRC_3));
+    }
+
     // Set gemm parameters
+    const int bias_multi_stride = (bias != nullptr && _gemm_info.num_groups > 1) ? multi_stride(c->info(), 1) : 0;
     _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr,
-                                 ldd, batch_stride_d, multi_stride_d, bias, 0);
+                                 ldd, batch_stride_d, multi_stride_d, bias, bias_multi_stride);
 
     // Need to pack the input/output pointers separately to use the thread-safe,
     // stateless-execution interface for fixed-format kernels.
@@ -829,12 +1108,19 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
         // Schedule thread-safe stateless execution
         NEScheduler::get().schedule_op(_optimised_kernel.get(), scheduling_hint, _optimised_kernel->window(),
                                        gemm_pack);
-
-        return;
+    }
+    else
+    {
+        // Schedule
+        NEScheduler::get().schedule(_optimised_kernel.get(), scheduling_hint);
     }
 
-    // Schedule
-    NEScheduler::get().schedule(_optimised_kernel.get(), scheduling_hint);
+    if (_run_epilogue)
+    {
+        run_parallel_epilogue<TypeOutput>(_epilogue.get(), out_ptr, ldd, batch_stride_d, multi_stride_d,
+                                          _epilogue_params.M, _epilogue_params.N, _epilogue_params.batches,
+                                          _epilogue_params.multis, NEScheduler::get().num_threads());
+    }
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput>
@@ -1130,9 +1416,31 @@ Status CpuGemmAssemblyDispatch::validate(
         a->data_type() == DataType::QASYMM8 &&
             (d->data_type() != DataType::QASYMM8 && d->data_type() != DataType::S32 && d->data_type() != DataType::F32),
         "Only QASYMM8/S32/F32 output supported for QASYMM8 input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.dilation != Size2D(1U, 1U) && info.method != AsmConvMethod::Conv &&
+                                        info.method != AsmConvMethod::Indirect,
+                                    "Dilation is only supported by convolution GEMMs");
+    if (info.num_groups > 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.method != AsmConvMethod::Indirect || info.conv3d,
+                                        "Grouping is only supported by 2D indirect convolution GEMMs");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.fixed_format, "Grouping is not supported with fixed format kernels");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(b->data_type()),
+                                        "Grouping is not supported with per channel quantization");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info.epilogue.empty(), "Grouping is not supported with an epilogue");
+        ARM_COMPUTE_RETURN_ERROR_ON((a->dimension(0) % info.num_groups) != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON((d->dimension(0) % info.num_groups) != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(a->dimension(0) / info.num_groups != b->dimension(1));
+    }
     arm_compute::WeightFormat expected_weight_format = arm_compute::WeightFormat::UNSPECIFIED;
+    if (!info.epilogue.empty())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_epilogue(d, nullptr, info));
+    }
     const Status              ret = CpuGemmAssemblyDispatch::has_opt_impl(expected_weight_format, a, b, c, d, info);
-    if (bool(ret) && expected_weight_format != arm_compute::WeightFormat::ANY)
+    // A sparse format is only a hint: the dense kernels are used when no sparse kernel supports the problem.
+    const bool sparse_fallback = is_sparse_format(info.weight_format) &&
+                                 expected_weight_format == arm_compute::WeightFormat::UNSPECIFIED;
+    if (bool(ret) && expected_weight_format != arm_compute::WeightFormat::ANY && !sparse_fallback)
     {
         // Correctness check: if the format expected by the kernel is
         // not "any", make sure that the one found matches the format
@@ -1150,6 +1458,49 @@ bool CpuGemmAssemblyDispatch::is_activation_supported(const ActivationLayerInfo
     return act.type != arm_gemm::Activation::Type::None;
 }
 
+Status CpuGemmAssemblyDispatch::validate_epilogue(const ITensorInfo *d,
+                                                  const ITensorInfo *residual,
+                                                  const AsmGemmInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(d, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.output_stage.type != GEMMLowpOutputStageType::NONE,
+                                    "Epilogue is not supported with an output stage");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.depth_output_gemm3d || info.conv3d,
+                                    "Epilogue is not supported with a 3D output");
+
+    for (const auto &op : info.epilogue)
+    {
+        switch (op.type)
+        {
+            case AsmGemmEpilogueOp::Type::Scale:
+                break;
+            case AsmGemmEpilogueOp::Type::AddMatrix:
+                if (residual != nullptr)
+                {
+                    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(d, residual);
+                    if (d->total_size() != 0)
+                    {
+                        ARM_COMPUTE_RETURN_ERROR_ON(residual->dimension(0) != d->dimension(0));
+                        ARM_COMPUTE_RETURN_ERROR_ON(residual->dimension(1) != d->dimension(1));
+                        ARM_COMPUTE_RETURN_ERROR_ON(residual->dimension(2) != 1 &&
+                                                    residual->dimension(2) != d->dimension(2));
+                        ARM_COMPUTE_RETURN_ERROR_ON(residual->dimension(3) != 1 &&
+                                                    residual->dimension(3) != d->dimension(3));
+                    }
+                }
+                break;
+            case AsmGemmEpilogueOp::Type::Activation:
+                ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(d, nullptr, op.act_info));
+                break;
+            default:
+                ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported epilogue operation");
+        }
+    }
+
+    return Status{};
+}
+
 void CpuGemmAssemblyDispatch::configure(
     const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *d, const AsmGemmInfo &info)
 {
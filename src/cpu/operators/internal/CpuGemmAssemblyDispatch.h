@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,8 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -41,6 +43,21 @@ enum class AsmConvMethod
     Conv
 };
 
+/** Operation fused into the output of the assembly kernels */
+struct AsmGemmEpilogueOp
+{
+    enum class Type
+    {
+        Scale,      /**< Multiply the output by @ref scale */
+        AddMatrix,  /**< Add the matrix passed as ACL_SRC_3 multiplied by @ref scale */
+        Activation, /**< Apply @ref act_info */
+    };
+
+    Type                type{Type::Scale};
+    float               scale{1.f};
+    ActivationLayerInfo act_info{};
+};
+
 struct AsmGemmInfo
 {
     AsmConvMethod             method{AsmConvMethod::Im2Col};
@@ -53,6 +70,17 @@ struct AsmGemmInfo
     int64_t                   padding_top{0};
     int64_t                   padding_left{0};
     float                     padding_value{0.f};
+    /** Dilation of an @ref AsmConvMethod::Conv or @ref AsmConvMethod::Indirect convolution */
+    Size2D                    dilation{1U, 1U};
+    /** Number of groups of an @ref AsmConvMethod::Indirect convolution, each one run as a GEMM multi:
+     * b is [OFM, IFM / num_groups, Kw, Kh] and group g reads the g-th slice of the channels of a and writes the g-th
+     * slice of the channels of d
+     */
+    unsigned int              num_groups{1};
+    /** Run @ref AsmConvMethod::Indirect as a 3D convolution: a is NDHWC, b is [OFM, IFM, Kw, Kh, Kd] and d is NDHWC */
+    bool                      conv3d{false};
+    int64_t                   padding_front{0};
+    unsigned int              stride_depth{1};
     bool                      fast_mode{false};
     bool                      fixed_format{false};
     arm_compute::WeightFormat weight_format{arm_compute::WeightFormat::UNSPECIFIED};
@@ -66,6 +94,10 @@ struct AsmGemmInfo
      *       fixed format kernels do not accept weights (B) with any prior transformations
      */
     bool transpose_b{false};
+    /** Operations applied in order to each block of the output once it is final, after the bias and @ref activation_info
+     * @note Only supported for F32 outputs without an output stage
+     */
+    std::vector<AsmGemmEpilogueOp> epilogue{};
 };
 
 /** Assembly kernel glue */
@@ -178,6 +210,15 @@ public:
      * @return True if activation is supported else false
      */
     static bool is_activation_supported(const ActivationLayerInfo &activation);
+    /** Checks if an epilogue can be fused into the output of the gemm assembly dispatcher
+     *
+     * @param[in] d        Output tensor info
+     * @param[in] residual (Optional) Tensor info of the matrix added by @ref AsmGemmEpilogueOp::Type::AddMatrix
+     * @param[in] info     GEMM meta-data holding the epilogue
+     *
+     * @return a status.
+     */
+    static Status validate_epilogue(const ITensorInfo *d, const ITensorInfo *residual, const AsmGemmInfo &info);
     /** Was the function successfully configured ?
      *
      * @return True if the function is configured and ready to run
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUSPLITDIMENSION_H
+#define ACL_SRC_CPU_UTILS_CPUSPLITDIMENSION_H
+
+#include "arm_compute/core/Dimensions.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Find the dimension of a kernel window to split the work along across the threads
+ *
+ * Operators whose kernel processes independent rows should not always split along the same dimension: the rows of a
+ * [hidden, tokens, 1] tensor lie along Y and those of a [hidden, 1, batches] tensor along Z. The dimension with the
+ * most iterations spreads the work across the most threads.
+ *
+ * @param[in] win          Window of the kernel.
+ * @param[in] first_dim    First dimension the work can be split along.
+ * @param[in] fallback_dim Dimension returned when no candidate has more than one iteration.
+ * @param[in] excluded_dim (Optional) Dimension the work can not be split along, e.g. the axis of a softmax.
+ *
+ * @return The candidate dimension with the most iterations. Ties go to the innermost dimension.
+ */
+inline size_t get_split_dimension(const Window &win,
+                                  size_t        first_dim,
+                                  size_t        fallback_dim,
+                                  size_t        excluded_dim = Coordinates::num_max_dimensions)
+{
+    size_t split_dim = fallback_dim;
+    size_t max_iters = 1;
+    for (size_t d = first_dim; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if (d != excluded_dim && win.num_iterations(d) > max_iters)
+        {
+            max_iters = win.num_iterations(d);
+            split_dim = d;
+        }
+    }
+    return split_dim;
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUSPLITDIMENSION_H
@@ -58,8 +58,8 @@ Status ClScatterKernel::validate(const ITensorInfo *updates,
                                  const ITensorInfo *dst,
                                  const ScatterInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(updates, indices, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.func == ScatterFunction::Mul, "Mul scatter function is not supported.");
     ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(updates, indices, dst);
 
     const TensorShape &ind_shape = indices->tensor_shape();
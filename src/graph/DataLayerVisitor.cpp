@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -136,6 +136,13 @@ void DataLayerVisitor::visit(FusedDepthwiseConvolutionBatchNormalizationNode &n)
     add_convolution_layer_data<FusedDepthwiseConvolutionBatchNormalizationNode>(_layer_data, n);
 }
 
+void DataLayerVisitor::visit(FusedDepthwiseSeparableConvolutionNode &n)
+{
+    _layer_data.clear();
+    add_generic_layer_data<FusedDepthwiseSeparableConvolutionNode>(_layer_data, n);
+    add_convolution_layer_data<FusedDepthwiseSeparableConvolutionNode>(_layer_data, n);
+}
+
 void DataLayerVisitor::visit(OutputNode &n)
 {
     _layer_data.clear();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -90,6 +90,10 @@ void DefaultNodeVisitor::visit(FusedDepthwiseConvolutionBatchNormalizationNode &
 {
     default_visit(n);
 }
+void DefaultNodeVisitor::visit(FusedDepthwiseSeparableConvolutionNode &n)
+{
+    default_visit(n);
+}
 void DefaultNodeVisitor::visit(InputNode &n)
 {
     default_visit(n);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -95,6 +95,8 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
         }
     }
     pm.append(std::make_unique<NodeFusionMutator>());
+    pm.append(std::make_unique<DepthwiseSeparableFusionMutator>());
+    pm.append(std::make_unique<ElementwiseFusionMutator>());
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,17 +43,38 @@
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+} // namespace
+
 /** Register CPU backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
-NEDeviceBackend::NEDeviceBackend() : _allocator()
+NEDeviceBackend::NEDeviceBackend() : _allocator(), _conv_method_tuner(false), _conv_method_tuner_file()
+{
+}
+
+NEDeviceBackend::~NEDeviceBackend()
 {
+    _conv_method_tuner.save_to_file(_conv_method_tuner_file);
+}
+
+void NEDeviceBackend::set_convolution_method_tuning(bool enable_tuning)
+{
+    _conv_method_tuner.set_tune_new_configs(enable_tuning);
 }
 
 void NEDeviceBackend::initialize_backend()
@@ -75,6 +96,17 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Setup convolution method tuner
+    _conv_method_tuner_file = ctx.config().conv_method_tuner_file;
+
+    // Load the convolution methods if available
+    if (file_exists(_conv_method_tuner_file))
+    {
+        _conv_method_tuner.load_from_file(_conv_method_tuner_file);
+    }
+
+    set_convolution_method_tuning(ctx.config().use_tuner);
+
     // Create function level memory manager
     if (ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -139,7 +171,7 @@ std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &n
     ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
 
     // Configure node
-    return NEFunctionFactory::create(&node, ctx);
+    return NEFunctionFactory::create(&node, ctx, &_conv_method_tuner);
 }
 
 arm_compute::Status NEDeviceBackend::validate_node(INode &node)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/runtime/CPP/CPPFunctions.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 #include "arm_compute/runtime/NEON/NEFunctions.h"
 
 using namespace arm_compute::utils::cast;
@@ -80,9 +81,10 @@ struct NEUnaryEltwiseFunctions
 /** Function and tensor types to be used inside a fused convolution/batch normalization layer */
 struct NEFusedLayerTypes
 {
-    using ConvolutionLayer          = NEConvolutionLayer;
-    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
-    using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using ConvolutionLayer                   = NEConvolutionLayer;
+    using DepthwiseConvolutionLayer          = NEDepthwiseConvolutionLayer;
+    using DepthwiseSeparableConvolutionLayer = NEDepthwiseSeparableConvolutionLayer;
+    using FuseBatchNormalization             = NEFuseBatchNormalization;
 };
 
 namespace detail
@@ -115,7 +117,8 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 }
 } // namespace detail
 
-std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
+std::unique_ptr<IFunction>
+NEFunctionFactory::create(INode *node, GraphContext &ctx, NEConvolutionMethodTuner *conv_method_tuner)
 {
     if (node == nullptr)
     {
@@ -138,8 +141,9 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
+            // Only the convolutions left to the backend heuristics are tuned
             return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+                *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx, conv_method_tuner);
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -180,6 +184,12 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
                                                                                         NETargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return detail::create_fused_depthwise_separable_convolution_layer<NEFusedLayerTypes, NETargetInfo>(
+                *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node), ctx);
+        case NodeType::FusedElementwiseExpressionLayer:
+            return detail::create_fused_elementwise_expression_layer<NEElementwiseExpression, NETargetInfo>(
+                *polymorphic_downcast<FusedElementwiseExpressionNode *>(node));
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -92,6 +92,12 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::DetectionPostProcessLayer:
             return detail::validate_detection_post_process_layer<NEDetectionPostProcessLayer>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return detail::validate_fused_depthwise_separable_convolution_layer<NEDepthwiseSeparableConvolutionLayer>(
+                *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node));
+        case NodeType::FusedElementwiseExpressionLayer:
+            return detail::validate_fused_elementwise_expression_layer<NEElementwiseExpression>(
+                *polymorphic_downcast<FusedElementwiseExpressionNode *>(node));
         case NodeType::GenerateProposalsLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : GenerateProposalsLayer");
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DepthwiseSeparableFusionMutator.h"
+
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Convolution attributes shared by the plain and the batch normalization fused convolution nodes */
+struct ConvolutionAttributes
+{
+    PadStrideInfo       info{};
+    ActivationLayerInfo act_info{};
+    unsigned int        depth_multiplier{1};
+    unsigned int        num_groups{1};
+    bool                has_batch_norm{false};
+    float               epsilon{0.f};
+};
+
+ConvolutionAttributes extract_depthwise_attributes(const INode &node)
+{
+    ConvolutionAttributes attrs{};
+    if (node.type() == NodeType::DepthwiseConvolutionLayer)
+    {
+        auto *dwc_node = polymorphic_downcast<const DepthwiseConvolutionLayerNode *>(&node);
+
+        attrs.info             = dwc_node->convolution_info();
+        attrs.act_info         = dwc_node->fused_activation();
+        attrs.depth_multiplier = dwc_node->depth_multiplier();
+    }
+    else
+    {
+        auto *dwc_node = polymorphic_downcast<const FusedDepthwiseConvolutionBatchNormalizationNode *>(&node);
+
+        attrs.info             = dwc_node->convolution_info();
+        attrs.act_info         = dwc_node->fused_activation();
+        attrs.depth_multiplier = dwc_node->depth_multiplier();
+        attrs.has_batch_norm   = true;
+        attrs.epsilon          = dwc_node->epsilon();
+    }
+    return attrs;
+}
+
+ConvolutionAttributes extract_pointwise_attributes(const INode &node)
+{
+    ConvolutionAttributes attrs{};
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        auto *pwc_node = polymorphic_downcast<const ConvolutionLayerNode *>(&node);
+
+        attrs.info       = pwc_node->convolution_info();
+        attrs.act_info   = pwc_node->fused_activation();
+        attrs.num_groups = pwc_node->num_groups();
+    }
+    else
+    {
+        auto *pwc_node = polymorphic_downcast<const FusedConvolutionBatchNormalizationNode *>(&node);
+
+        attrs.info           = pwc_node->convolution_info();
+        attrs.act_info       = pwc_node->fused_activation();
+        attrs.num_groups     = pwc_node->num_groups();
+        attrs.has_batch_norm = true;
+        attrs.epsilon        = pwc_node->epsilon();
+    }
+    return attrs;
+}
+
+bool is_depthwise_node(const INode &node)
+{
+    return node.type() == NodeType::DepthwiseConvolutionLayer ||
+           node.type() == NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer;
+}
+
+bool is_convolution_node(const INode &node)
+{
+    return node.type() == NodeType::ConvolutionLayer ||
+           node.type() == NodeType::FusedConvolutionBatchNormalizationLayer;
+}
+
+/** Connects the inputs of an original node to the fused node
+ *
+ * @param[in, out] g           Graph
+ * @param[in]      node        Original node
+ * @param[in]      fused_id    Fused node id
+ * @param[in]      node_inputs Pairs of (original node input index, fused node input index)
+ */
+void connect_inputs(Graph                                                     &g,
+                    const INode                                               &node,
+                    NodeID                                                     fused_id,
+                    const std::vector<std::pair<unsigned int, unsigned int>> &node_inputs)
+{
+    for (const auto &input : node_inputs)
+    {
+        const Edge *edge = node.input_edge(input.first);
+        if (edge != nullptr)
+        {
+            g.add_connection(edge->producer_id(), edge->producer_idx(), fused_id, input.second);
+        }
+    }
+}
+
+/** Checks the cheap preconditions of the fusion before any node is created */
+bool is_fusable(const INode &dwc_node, const INode &pwc_node)
+{
+    Tensor       *dwc_dst     = dwc_node.output(0);
+    const Tensor *pwc_weights = pwc_node.input(1);
+    if (dwc_dst == nullptr || pwc_weights == nullptr || pwc_node.output(0) == nullptr)
+    {
+        return false;
+    }
+
+    // The intermediate tensor disappears, so it must not be read back by the user
+    if (dwc_dst->accessor() != nullptr)
+    {
+        return false;
+    }
+
+    const TensorDescriptor &desc = dwc_dst->desc();
+    if (dwc_node.assigned_target() != Target::NEON || pwc_node.assigned_target() != Target::NEON ||
+        desc.layout != DataLayout::NHWC || !is_data_type_float(desc.data_type))
+    {
+        return false;
+    }
+
+    const ConvolutionAttributes pwc = extract_pointwise_attributes(pwc_node);
+    return pwc.num_groups == 1 && pwc.info.stride() == std::make_pair(1U, 1U) && !pwc.info.has_padding() &&
+           get_dimension_size(pwc_weights->desc(), DataLayoutDimension::WIDTH) == 1 &&
+           get_dimension_size(pwc_weights->desc(), DataLayoutDimension::HEIGHT) == 1;
+}
+
+void fuse_depthwise_with_pointwise_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    INode *dwc_node = output_edge->producer();
+    INode *pwc_node = output_edge->consumer();
+    if (output_edge->consumer_idx() != 0 || !is_fusable(*dwc_node, *pwc_node))
+    {
+        return;
+    }
+
+    const ConvolutionAttributes dwc             = extract_depthwise_attributes(*dwc_node);
+    const ConvolutionAttributes pwc             = extract_pointwise_attributes(*pwc_node);
+    const Target                assigned_target = dwc_node->assigned_target();
+
+    // Create the fused node
+    const NodeID fused_id = g.add_node<FusedDepthwiseSeparableConvolutionNode>(
+        dwc.info, dwc.depth_multiplier, dwc.act_info, pwc.act_info, dwc.epsilon, pwc.epsilon);
+
+    connect_inputs(g, *dwc_node, fused_id, {{0, 0}, {1, 1}, {2, 2}});
+    connect_inputs(g, *pwc_node, fused_id, {{1, 3}, {2, 4}});
+    if (dwc.has_batch_norm)
+    {
+        connect_inputs(g, *dwc_node, fused_id, {{3, 5}, {4, 6}, {5, 7}, {6, 8}});
+    }
+    if (pwc.has_batch_norm)
+    {
+        connect_inputs(g, *pwc_node, fused_id, {{3, 9}, {4, 10}, {5, 11}, {6, 12}});
+    }
+
+    INode *fused_node = g.node(fused_id);
+    fused_node->set_assigned_target(assigned_target);
+    fused_node->set_common_node_parameters(NodeParams{dwc_node->name() + "+" + pwc_node->name(), assigned_target});
+    configure_tensor(fused_node->output(0));
+
+    // Keep the original nodes if the backend cannot run the fused node
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(assigned_target);
+    if (!bool(backend.validate_node(*fused_node)))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of depthwise convolution node with ID : "
+                                      << dwc_node->id() << " with convolution node with ID : " << pwc_node->id()
+                                      << " as the fused node is not supported" << std::endl);
+        g.remove_node(fused_id);
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing depthwise convolution node with ID : "
+                                  << dwc_node->id() << " with convolution node with ID : " << pwc_node->id()
+                                  << std::endl);
+
+    // Move the consumers and the accessor of the pointwise output to the fused node
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*pwc_node);
+    auto                     accessor      = pwc_node->output(0)->extract_accessor();
+
+    g.remove_node(pwc_node->id());
+    for (auto &driving_node : driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+    }
+    fused_node->output(0)->set_accessor(std::move(accessor));
+
+    g.remove_node(dwc_node->id());
+}
+} // namespace
+
+const char *DepthwiseSeparableFusionMutator::name()
+{
+    return "DepthwiseSeparableFusionMutator";
+}
+
+IGraphMutator::MutationType DepthwiseSeparableFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void DepthwiseSeparableFusionMutator::mutate(Graph &g)
+{
+    // Fused nodes are appended to the node list and are not candidates themselves, so only loop over the original nodes
+    const size_t num_nodes = g.nodes().size();
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+        INode *node = g.node(i);
+
+        // Check if the node is a depthwise convolution and not a branching node
+        if (node != nullptr && is_depthwise_node(*node) && node->output_edges().size() == 1)
+        {
+            const Edge *output_edge = g.edge(*node->output_edges().begin());
+            if (output_edge != nullptr && output_edge->consumer() != nullptr &&
+                is_convolution_node(*output_edge->consumer()))
+            {
+                fuse_depthwise_with_pointwise_convolution(g, output_edge);
+            }
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
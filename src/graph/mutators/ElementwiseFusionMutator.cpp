@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ElementwiseFusionMutator.h"
+
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <array>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Maximum number of graph nodes collapsed into a single expression
+ *
+ * Every collapsed node adds at most an operation, a fused activation and an input to the expression, so any tree of
+ * this many nodes fits in @ref ElementwiseExpressionInfo::max_num_nodes.
+ */
+constexpr size_t max_collapsed_nodes = (ElementwiseExpressionInfo::max_num_nodes - 1) / 3;
+
+/** Expression under construction */
+struct ExpressionBuilder
+{
+    ElementwiseExpressionInfo expression{};  /**< Expression of the collapsed nodes */
+    std::vector<NodeIdxPair>  inputs{};      /**< Producer of each input of the expression */
+    std::vector<unsigned int> input_nodes{}; /**< Expression node reading each input */
+    std::vector<NodeID>       collapsed{};   /**< Graph nodes replaced by the expression, root first */
+};
+
+ElementwiseExpressionOp to_expression_op(EltwiseOperation op)
+{
+    switch (op)
+    {
+        case EltwiseOperation::Add:
+            return ElementwiseExpressionOp::Add;
+        case EltwiseOperation::Sub:
+            return ElementwiseExpressionOp::Sub;
+        case EltwiseOperation::Mul:
+            return ElementwiseExpressionOp::Mul;
+        case EltwiseOperation::Max:
+            return ElementwiseExpressionOp::Max;
+        case EltwiseOperation::Div:
+            return ElementwiseExpressionOp::Div;
+        case EltwiseOperation::Min:
+            return ElementwiseExpressionOp::Min;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+    }
+}
+
+bool is_fusable_operation(const INode &node)
+{
+    if (node.assigned_target() != Target::NEON || node.num_outputs() != 1 || node.output(0) == nullptr ||
+        !is_data_type_float(node.output(0)->desc().data_type))
+    {
+        return false;
+    }
+    return node.type() == NodeType::EltwiseLayer || node.type() == NodeType::ActivationLayer;
+}
+
+/** Checks whether a node can be collapsed into the expression of its only consumer */
+bool is_collapsible_into_consumer(const Graph &g, const INode &node)
+{
+    if (!is_fusable_operation(node) || node.output_edges().size() != 1)
+    {
+        return false;
+    }
+
+    // The intermediate tensor disappears, so it must not be read back by the user
+    if (node.output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    return edge != nullptr && edge->consumer() != nullptr && is_fusable_operation(*edge->consumer()) &&
+           edge->consumer()->output(0)->desc().data_type == node.output(0)->desc().data_type;
+}
+
+unsigned int add_input(ExpressionBuilder &builder, const Edge &edge)
+{
+    for (size_t i = 0; i < builder.inputs.size(); ++i)
+    {
+        if (builder.inputs[i].node_id == edge.producer_id() && builder.inputs[i].index == edge.producer_idx())
+        {
+            return builder.input_nodes[i];
+        }
+    }
+
+    const auto input_idx = static_cast<unsigned int>(builder.inputs.size());
+    builder.inputs.push_back({edge.producer_id(), edge.producer_idx()});
+    builder.input_nodes.push_back(builder.expression.input(input_idx));
+    return builder.input_nodes.back();
+}
+
+/** Appends a node and all the producers collapsible into it to the expression
+ *
+ * @return the index of the expression node holding the result of @p node
+ */
+unsigned int collapse(const Graph &g, const INode &node, ExpressionBuilder &builder)
+{
+    builder.collapsed.push_back(node.id());
+
+    std::array<unsigned int, 2> operands{};
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        ARM_COMPUTE_ERROR_ON(edge == nullptr || edge->producer() == nullptr);
+
+        if (builder.collapsed.size() < max_collapsed_nodes && is_collapsible_into_consumer(g, *edge->producer()))
+        {
+            operands[i] = collapse(g, *edge->producer(), builder);
+        }
+        else
+        {
+            operands[i] = add_input(builder, *edge);
+        }
+    }
+
+    if (node.type() == NodeType::ActivationLayer)
+    {
+        auto *act_node = polymorphic_downcast<const ActivationLayerNode *>(&node);
+        return builder.expression.activation(act_node->activation_info(), operands[0]);
+    }
+
+    auto              *eltwise_node = polymorphic_downcast<const EltwiseLayerNode *>(&node);
+    const unsigned int result =
+        builder.expression.binary(to_expression_op(eltwise_node->eltwise_operation()), operands[0], operands[1]);
+    if (eltwise_node->fused_activation().enabled())
+    {
+        return builder.expression.activation(eltwise_node->fused_activation(), result);
+    }
+    return result;
+}
+
+void fuse_elementwise_expression(Graph &g, INode &root)
+{
+    ExpressionBuilder builder{};
+    collapse(g, root, builder);
+
+    // A single node already runs as a single function
+    if (builder.collapsed.size() < 2)
+    {
+        return;
+    }
+
+    const Target assigned_target = root.assigned_target();
+
+    // Create the fused node
+    const NodeID fused_id = g.add_node<FusedElementwiseExpressionNode>(builder.expression);
+    for (size_t i = 0; i < builder.inputs.size(); ++i)
+    {
+        g.add_connection(builder.inputs[i].node_id, builder.inputs[i].index, fused_id, i);
+    }
+
+    std::string fused_name = root.name();
+    for (size_t i = 1; i < builder.collapsed.size(); ++i)
+    {
+        fused_name += "+" + g.node(builder.collapsed[i])->name();
+    }
+
+    INode *fused_node = g.node(fused_id);
+    fused_node->set_assigned_target(assigned_target);
+    fused_node->set_common_node_parameters(NodeParams{fused_name, assigned_target});
+    configure_tensor(fused_node->output(0));
+
+    // Keep the original nodes if the backend cannot run the fused node
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(assigned_target);
+    if (!bool(backend.validate_node(*fused_node)))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of element-wise node with ID : "
+                                      << root.id() << " with its producers as the fused node is not supported"
+                                      << std::endl);
+        g.remove_node(fused_id);
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << builder.collapsed.size() << " element-wise nodes into node with ID : "
+                                            << fused_id << std::endl);
+
+    // Move the consumers and the accessor of the root output to the fused node
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(root);
+    auto                     accessor      = root.output(0)->extract_accessor();
+
+    for (const NodeID id : builder.collapsed)
+    {
+        g.remove_node(id);
+    }
+    for (auto &driving_node : driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+    }
+    fused_node->output(0)->set_accessor(std::move(accessor));
+}
+} // namespace
+
+const char *ElementwiseFusionMutator::name()
+{
+    return "ElementwiseFusionMutator";
+}
+
+IGraphMutator::MutationType ElementwiseFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ElementwiseFusionMutator::mutate(Graph &g)
+{
+    // Visit consumers before their producers, so that every tree is collapsed starting from its root
+    const std::vector<NodeID> sorted_nodes = dfs(g);
+    for (auto it = sorted_nodes.rbegin(); it != sorted_nodes.rend(); ++it)
+    {
+        INode *node = g.node(*it);
+
+        // Nodes collapsed into their consumer have been removed together with it
+        if (node != nullptr && is_fusable_operation(*node) && !is_collapsible_into_consumer(g, *node))
+        {
+            fuse_elementwise_expression(g, *node);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -386,9 +386,17 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::RELU,       Activation::SOFT_RELU,    Activation::SQRT,
         Activation::SQUARE,     Activation::TANH};
 
+    // Additional activations the Neon fully connected layer runs in the F32 epilogue of its GEMM
+    const std::set<Activation> neon_fc_fused_activations = {Activation::GELU, Activation::SWISH};
+
     // Preconditions
     auto empty_prec     = [](INode &) { return true; };
     auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
+    auto neon_f32_prec = [](INode &n)
+    {
+        ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
+        return n.assigned_target() == Target::NEON && n.output(0)->desc().data_type == DataType::F32;
+    };
     auto qs8_prec       = [&g](INode &n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
@@ -416,6 +424,8 @@ void NodeFusionMutator::mutate(Graph &g)
         g, qs8_prec, detail::fuse_node_with_activation<DepthwiseConvolutionLayerNode>, supported_fused_activations);
     detail::fuse_layer<FullyConnectedLayerNode, ActivationLayerNode>(
         g, empty_prec, detail::fuse_node_with_activation<FullyConnectedLayerNode>, supported_fused_activations);
+    detail::fuse_layer<FullyConnectedLayerNode, ActivationLayerNode>(
+        g, neon_f32_prec, detail::fuse_node_with_activation<FullyConnectedLayerNode>, neon_fc_fused_activations);
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(
         g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
     // The fusion of BatchNormalizationLayer must occur after the fusion of ActivationLayer. Because FusedConvolutionBatchNormalizationNode assumes the BatchNormalization is already fused with activation, if any
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,17 @@ void DotGraphVisitor::visit(FusedDepthwiseConvolutionBatchNormalizationNode &n)
     _info = ss.str();
 }
 
+void DotGraphVisitor::visit(FusedDepthwiseSeparableConvolutionNode &n)
+{
+    std::stringstream ss;
+    ss << "FusedDepthwiseSeparableConvolutionNode";
+    if (n.fused_activation().enabled())
+    {
+        ss << " " << n.fused_activation().activation();
+    }
+    _info = ss.str();
+}
+
 void DotGraphVisitor::visit(NormalizationLayerNode &n)
 {
     std::stringstream ss;
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/ActivationFunctionUtils.h"
+#include "arm_compute/core/utils/DataLayoutUtils.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/cpuinfo/CpuModel.h"
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuConv2d.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+using namespace arm_compute::experimental;
+
+namespace
+{
+const std::map<ConvolutionMethod, std::string> &convolution_method_names()
+{
+    static const std::map<ConvolutionMethod, std::string> names = {{ConvolutionMethod::GEMM, "GEMM"},
+                                                                   {ConvolutionMethod::GEMM_CONV2D, "GEMM_CONV2D"},
+                                                                   {ConvolutionMethod::WINOGRAD, "WINOGRAD"},
+                                                                   {ConvolutionMethod::DIRECT, "DIRECT"}};
+    return names;
+}
+
+void print_shape(std::ostream &os, const TensorShape &shape)
+{
+    for (size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        os << (d == 0 ? "" : "x") << shape[d];
+    }
+}
+
+/** Print the quantization of a tensor, as the first scale and offset and the number of per-channel scales */
+void print_quantization(std::ostream &os, const ITensorInfo &info)
+{
+    const QuantizationInfo &qinfo = info.quantization_info();
+    if (!is_data_type_quantized(info.data_type()) || qinfo.empty())
+    {
+        return;
+    }
+    os << "_q_" << qinfo.scale()[0] << "x" << (qinfo.offset().empty() ? 0 : qinfo.offset()[0]);
+    if (qinfo.scale().size() > 1)
+    {
+        os << "x" << qinfo.scale().size();
+    }
+}
+
+/** Allocate a tensor for the given info and fill it with zeros
+ *
+ * Zeros keep the measurements free of denormals and NaNs, which could otherwise slow down one method and not another.
+ */
+void init_dummy_tensor(Tensor &tensor, const ITensorInfo &info)
+{
+    tensor.allocator()->init(TensorInfo(info));
+    tensor.allocator()->allocate();
+    std::memset(tensor.buffer(), 0, tensor.info()->total_size());
+}
+
+/** Configure the convolution with the given method and time a few runs of it on dummy data
+ *
+ * @return The median execution time in microseconds
+ */
+double measure_convolution_method(ConvolutionMethod          method,
+                                  const ITensorInfo         *input,
+                                  const ITensorInfo         *weights,
+                                  const ITensorInfo         *biases,
+                                  const ITensorInfo         *output,
+                                  const PadStrideInfo       &conv_info,
+                                  const WeightsInfo         &weights_info,
+                                  const Size2D              &dilation,
+                                  const ActivationLayerInfo &act_info,
+                                  bool                       enable_fast_math)
+{
+    // The operator may extend the padding of its tensor infos, so it works on copies
+    auto src_info = input->clone();
+    auto wei_info = weights->clone();
+    auto dst_info = output->clone();
+    auto bia_info = (biases != nullptr) ? biases->clone() : nullptr;
+
+    cpu::CpuConv2d op;
+    op.configure(method, src_info.get(), wei_info.get(), bia_info.get(), dst_info.get(), conv_info, weights_info,
+                 dilation, act_info, enable_fast_math);
+
+    Tensor src{};
+    Tensor wei{};
+    Tensor bia{};
+    Tensor dst{};
+    init_dummy_tensor(src, *src_info);
+    init_dummy_tensor(wei, *wei_info);
+    init_dummy_tensor(dst, *dst_info);
+    if (bia_info != nullptr)
+    {
+        init_dummy_tensor(bia, *bia_info);
+    }
+
+    ITensorPack run_pack{{ACL_SRC_0, &src}, {ACL_SRC_1, &wei}, {ACL_DST, &dst}};
+    ITensorPack prep_pack{{ACL_SRC_1, &wei}};
+    if (bia_info != nullptr)
+    {
+        run_pack.add_const_tensor(ACL_SRC_2, &bia);
+        prep_pack.add_const_tensor(ACL_SRC_2, &bia);
+    }
+
+    MemoryGroup memory_group{};
+    auto        workspace = manage_workspace<Tensor>(op.workspace(), memory_group, run_pack, prep_pack);
+    ARM_COMPUTE_UNUSED(workspace);
+
+    // Weights transformations are a one-off cost: leave them, and the cold caches, out of the measurement
+    op.prepare(prep_pack);
+    op.run(run_pack);
+
+    // The median discards the runs disturbed by the rest of the system
+    constexpr size_t    num_runs = 5;
+    std::vector<double> times(num_runs);
+    for (auto &time : times)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        op.run(run_pack);
+        const auto end = std::chrono::steady_clock::now();
+        time           = std::chrono::duration<double, std::micro>(end - start).count();
+    }
+    std::nth_element(times.begin(), times.begin() + num_runs / 2, times.end());
+    return times[num_runs / 2];
+}
+} // namespace
+
+NEConvolutionMethodTuner::NEConvolutionMethodTuner(bool tune_new_configs)
+    : _methods_table(), _tune_new_configs(tune_new_configs)
+{
+}
+
+void NEConvolutionMethodTuner::set_tune_new_configs(bool tune_new_configs)
+{
+    _tune_new_configs = tune_new_configs;
+}
+
+bool NEConvolutionMethodTuner::tune_new_configs() const
+{
+    return _tune_new_configs;
+}
+
+void NEConvolutionMethodTuner::add_convolution_method(const std::string &config_id, ConvolutionMethod method)
+{
+    _methods_table[config_id] = method;
+}
+
+const std::unordered_map<std::string, ConvolutionMethod> &NEConvolutionMethodTuner::convolution_methods_table() const
+{
+    return _methods_table;
+}
+
+ConvolutionMethod NEConvolutionMethodTuner::get_convolution_method(const ITensorInfo         *input,
+                                                                   const ITensorInfo         *weights,
+                                                                   const ITensorInfo         *biases,
+                                                                   const ITensorInfo         *output,
+                                                                   const PadStrideInfo       &conv_info,
+                                                                   const WeightsInfo         &weights_info,
+                                                                   const Size2D              &dilation,
+                                                                   const ActivationLayerInfo &act_info,
+                                                                   bool                       enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    const std::string id =
+        config_id(input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+
+    // A table loaded from file may come from a different build of the library: only trust methods that still validate
+    const auto it = _methods_table.find(id);
+    if (it != _methods_table.end() &&
+        bool(cpu::CpuConv2d::validate(it->second, input, weights, biases, output, conv_info, weights_info, dilation,
+                                      act_info, enable_fast_math)))
+    {
+        return it->second;
+    }
+
+    const ConvolutionMethod default_method = cpu::CpuConv2d::get_convolution_method(
+        input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    if (!_tune_new_configs)
+    {
+        return default_method;
+    }
+
+    const auto methods = cpu::CpuConv2d::get_supported_convolution_methods(
+        input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    if (methods.empty())
+    {
+        return default_method;
+    }
+
+    ConvolutionMethod best_method = methods[0];
+    if (methods.size() > 1)
+    {
+        double best_time = std::numeric_limits<double>::max();
+        for (const auto method : methods)
+        {
+            const double time = measure_convolution_method(method, input, weights, biases, output, conv_info,
+                                                           weights_info, dilation, act_info, enable_fast_math);
+            ARM_COMPUTE_LOG_MSG_WITH_FORMAT_ACL(arm_compute::logging::LogLevel::INFO,
+                                                "[NEConvolutionMethodTuner] %s: %s took %.1f us", id.c_str(),
+                                                convolution_method_names().at(method).c_str(), time);
+            if (time < best_time)
+            {
+                best_time   = time;
+                best_method = method;
+            }
+        }
+    }
+
+    add_convolution_method(id, best_method);
+    return best_method;
+}
+
+std::string NEConvolutionMethodTuner::config_id(const ITensorInfo         *input,
+                                                const ITensorInfo         *weights,
+                                                const ITensorInfo         *biases,
+                                                const ITensorInfo         *output,
+                                                const PadStrideInfo       &conv_info,
+                                                const WeightsInfo         &weights_info,
+                                                const Size2D              &dilation,
+                                                const ActivationLayerInfo &act_info,
+                                                bool                       enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    std::stringstream ss;
+    ss << "conv2d_" << string_from_data_layout(input->data_layout());
+    ss << "_src_" << string_from_data_type(input->data_type()) << "_";
+    print_shape(ss, input->tensor_shape());
+    print_quantization(ss, *input);
+    ss << "_wei_" << string_from_data_type(weights->data_type()) << "_";
+    print_shape(ss, weights->tensor_shape());
+    print_quantization(ss, *weights);
+    ss << "_bia_" << ((biases != nullptr) ? string_from_data_type(biases->data_type()) : "NONE");
+    ss << "_dst_" << string_from_data_type(output->data_type());
+    print_quantization(ss, *output);
+    // Reshaped or fixed-format weights rule out some of the methods
+    ss << "_wi_" << weights_info.are_reshaped() << "x" << weights_info.retain_internal_weights() << "x"
+       << static_cast<int>(weights_info.weight_format());
+    ss << "_stride_" << conv_info.stride().first << "x" << conv_info.stride().second;
+    ss << "_pad_" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x"
+       << conv_info.pad_bottom();
+    ss << "_dil_" << dilation.x() << "x" << dilation.y();
+    ss << "_act_" << (act_info.enabled() ? string_from_activation_func(act_info.activation()) : "NONE");
+    if (act_info.enabled())
+    {
+        // The bounds decide whether the activation can be fused in some of the methods
+        ss << "x" << act_info.a() << "x" << act_info.b();
+    }
+    ss << "_fm_" << enable_fast_math;
+    // The fastest method depends on the micro-architecture and on how the work is split across threads
+    ss << "_cpu_" << cpuinfo::cpu_model_to_string(CPUInfo::get().get_cpu_model());
+    ss << "_thr_" << NEScheduler::get().num_threads();
+    return ss.str();
+}
+
+void NEConvolutionMethodTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        const size_t pos = line.find(";");
+        if (pos == std::string::npos)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        const std::string id          = line.substr(0, pos);
+        const std::string method_name = line.substr(pos + 1);
+
+        const auto &names = convolution_method_names();
+        const auto  it    = std::find_if(names.begin(), names.end(),
+                                         [&](const std::pair<const ConvolutionMethod, std::string> &name)
+                                         { return name.second == method_name; });
+        if (it == names.end())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        add_convolution_method(id, it->first);
+    }
+    fs.close();
+}
+
+bool NEConvolutionMethodTuner::save_to_file(const std::string &filename) const
+{
+    if (!_tune_new_configs || _methods_table.empty() || filename.empty())
+    {
+        return false;
+    }
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for (auto const &config : _methods_table)
+    {
+        fs << config.first << ";" << convolution_method_names().at(config.second) << std::endl;
+    }
+    fs.close();
+    return true;
+}
+} // namespace arm_compute
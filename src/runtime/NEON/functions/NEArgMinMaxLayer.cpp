@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,7 +35,6 @@
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
-#include "src/core/NEON/kernels/NEReductionOperationKernel.h"
 
 namespace arm_compute
 {
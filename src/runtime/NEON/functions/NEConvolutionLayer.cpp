@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/core/utils/DataTypeUtils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
@@ -42,6 +43,56 @@ namespace arm_compute
 {
 using namespace arm_compute::experimental;
 
+namespace
+{
+/** Validate the configuration against the given convolution method
+ *
+ * Similar to @ref NEConvolutionLayer::validate with an explicit convolution method
+ */
+Status validate_convolution_method(ConvolutionMethod          method,
+                                   const ITensorInfo         *input,
+                                   const ITensorInfo         *weights,
+                                   const ITensorInfo         *biases,
+                                   const ITensorInfo         *output,
+                                   const PadStrideInfo       &conv_info,
+                                   const WeightsInfo         &weights_info,
+                                   const Size2D              &dilation,
+                                   const ActivationLayerInfo &act_info,
+                                   bool                       enable_fast_math,
+                                   unsigned int               num_groups)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!weights->are_values_constant(), "Dynamic weights are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
+
+    // Biases with dynamic values are not supported with quantized inputs.
+    if (biases)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((!biases->are_values_constant() && is_data_type_quantized(input->data_type())),
+                                        "Dynamic Biases are not supported with quantized input data.");
+    }
+
+    switch (method)
+    {
+        case ConvolutionMethod::WINOGRAD:
+        case ConvolutionMethod::GEMM:
+        case ConvolutionMethod::GEMM_CONV2D:
+        case ConvolutionMethod::DIRECT:
+            ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuConv2d::validate(method, input, weights, biases, output, conv_info,
+                                                                 weights_info, dilation, act_info, enable_fast_math,
+                                                                 num_groups));
+            break;
+        case ConvolutionMethod::FFT:
+            ARM_COMPUTE_RETURN_ON_ERROR(
+                NEFFTConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info));
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported.");
+            break;
+    }
+    return Status{};
+}
+} // namespace
+
 struct NEConvolutionLayer::Impl
 {
     MemoryGroup                        memory_group{};
@@ -52,12 +103,15 @@ struct NEConvolutionLayer::Impl
     WorkspaceData<Tensor>              workspace{};
     experimental::MemoryRequirements   aux_mem_req{};
     std::unique_ptr<IFunction>         func{nullptr};
+    NEConvolutionMethodTuner          *tuner{nullptr};
     bool                               is_prepared{false};
 };
 
-NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, NEConvolutionMethodTuner *tuner)
+    : _impl(std::make_unique<Impl>())
 {
     _impl->memory_manager = std::move(memory_manager);
+    _impl->tuner          = tuner;
 }
 
 NEConvolutionLayer::~NEConvolutionLayer() = default;
@@ -74,18 +128,28 @@ void NEConvolutionLayer::configure(ITensor                   *input,
                                    unsigned int               num_groups)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEConvolutionLayer::configure");
-    // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(
-        input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info,
-        weights_info, dilation, act_info, enable_fast_math, num_groups));
+
+    const ITensorInfo *biases_info = (biases != nullptr) ? biases->info() : nullptr;
+    ConvolutionMethod  method      = ConvolutionMethod::GEMM_CONV2D;
+    if (num_groups == 1)
+    {
+        method = (_impl->tuner != nullptr)
+                     ? _impl->tuner->get_convolution_method(input->info(), weights->info(), biases_info,
+                                                            output->info(), conv_info, weights_info, dilation,
+                                                            act_info, enable_fast_math)
+                     : cpu::CpuConv2d::get_convolution_method(input->info(), weights->info(), output->info(),
+                                                              conv_info, weights_info, dilation, act_info,
+                                                              enable_fast_math);
+    }
+
+    // Perform validate step, on the method picked by the tuner when there is one
+    ARM_COMPUTE_ERROR_THROW_ON(validate_convolution_method(method, input->info(), weights->info(), biases_info,
+                                                           output->info(), conv_info, weights_info, dilation,
+                                                           act_info, enable_fast_math, num_groups));
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                            enable_fast_math, num_groups);
-
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (cpu::CpuConv2d::get_convolution_method(input->info(), weights->info(), output->info(), conv_info,
-                                                   weights_info, dilation, act_info, enable_fast_math))
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         case ConvolutionMethod::GEMM:
@@ -93,8 +157,8 @@ void NEConvolutionLayer::configure(ITensor                   *input,
         case ConvolutionMethod::DIRECT:
         {
             auto f = std::make_unique<cpu::CpuConv2d>();
-            f->configure(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr),
-                         output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups);
+            f->configure(method, input->info(), weights->info(), biases_info, output->info(), conv_info, weights_info,
+                         dilation, act_info, enable_fast_math, num_groups);
             _impl->op = std::move(f);
             break;
         }
@@ -134,38 +198,15 @@ Status NEConvolutionLayer::validate(const ITensorInfo         *input,
                                     unsigned int               num_groups)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEConvolutionLayer::validate");
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!weights->are_values_constant(), "Dynamic weights are not supported");
-    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
-
-    // Biases with dynamic values are not supported with quantized inputs.
-    if (biases)
-    {
-        ARM_COMPUTE_RETURN_ERROR_ON_MSG((!biases->are_values_constant() && is_data_type_quantized(input->data_type())),
-                                        "Dynamic Biases are not supported with quantized input data.");
-    }
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
 
-    switch (cpu::CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                                   enable_fast_math))
-    {
-        case ConvolutionMethod::WINOGRAD:
-        case ConvolutionMethod::GEMM:
-        case ConvolutionMethod::GEMM_CONV2D:
-        case ConvolutionMethod::DIRECT:
-            ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuConv2d::validate(input, weights, biases, output, conv_info,
-                                                                 weights_info, dilation, act_info, enable_fast_math,
-                                                                 num_groups));
-            break;
-        case ConvolutionMethod::FFT:
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                NEFFTConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info));
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Not supported.");
-            break;
-    }
-    return Status{};
+    // Grouped convolutions are only run natively by the direct GEMM convolution
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : cpu::CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info,
+                                                                  dilation, act_info, enable_fast_math);
+    return validate_convolution_method(method, input, weights, biases, output, conv_info, weights_info, dilation,
+                                       act_info, enable_fast_math, num_groups);
 }
 
 ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo         *input,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,13 +32,45 @@
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuGemmDeconv2d.h"
 
 using namespace arm_compute::misc::shape_calculator;
 
 namespace arm_compute
 {
+using namespace arm_compute::experimental;
+
+struct NEDeconvolutionLayer::GemmDeconv
+{
+    std::unique_ptr<cpu::CpuGemmDeconv2d> op{nullptr};
+
+    ITensorPack                      run_pack{};
+    WorkspaceData<Tensor>            workspace{};
+    experimental::MemoryRequirements aux_mem_req{};
+};
+
 namespace
 {
+/** Whether the deconvolution can run without upsampling its input
+ *
+ * Only worth it when the stride inserts zeros, and limited to NHWC with weights in their default format and, if
+ * quantized, a single scale: the other configurations keep going through @ref NEConvolutionLayer.
+ */
+bool use_gemm_deconv(const ITensorInfo   *input,
+                     const ITensorInfo   *weights,
+                     const ITensorInfo   *bias,
+                     const ITensorInfo   *output,
+                     const PadStrideInfo &info,
+                     bool                 enable_fast_math,
+                     const WeightsInfo   &weights_info)
+{
+    const bool do_upsampling = info.stride().first != 1 || info.stride().second != 1;
+    return do_upsampling && input->data_layout() == DataLayout::NHWC && !weights_info.are_reshaped() &&
+           weights_info.weight_format() == arm_compute::WeightFormat::UNSPECIFIED &&
+           bool(cpu::CpuGemmDeconv2d::validate(input, weights, bias, output, info, enable_fast_math));
+}
+
 std::pair<PadStrideInfo, bool>
 compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_pad_x, uint32_t deconv_pad_y)
 {
@@ -88,10 +120,13 @@ NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memor
       _input(nullptr),
       _info(),
       _is_prepared(false),
-      _do_upsampling(true)
+      _do_upsampling(true),
+      _gemm_deconv(nullptr)
 {
 }
 
+NEDeconvolutionLayer::~NEDeconvolutionLayer() = default;
+
 Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
                                       const ITensorInfo   *weights,
                                       const ITensorInfo   *bias,
@@ -189,6 +224,11 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(batches_idx) != scale_out_info.dimension(batches_idx));
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(channel_idx) != scale_out_info.dimension(channel_idx));
 
+    if (use_gemm_deconv(input, weights, bias, output, info, enable_fast_math, weights_info))
+    {
+        return Status{};
+    }
+
     if (do_upsampling)
     {
         const PadStrideInfo conv_info(1, 1, 0, 0, 0, 0, DimensionRoundingType::CEIL);
@@ -245,6 +285,23 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(),
                        input->info()->quantization_info());
 
+    _gemm_deconv.reset();
+    if (use_gemm_deconv(input->info(), weights->info(), (bias == nullptr) ? nullptr : bias->info(), output->info(),
+                        info, enable_fast_math, weights_info))
+    {
+        _gemm_deconv     = std::make_unique<GemmDeconv>();
+        _gemm_deconv->op = std::make_unique<cpu::CpuGemmDeconv2d>();
+        _gemm_deconv->op->configure(input->info(), weights->info(), (bias == nullptr) ? nullptr : bias->info(),
+                                    output->info(), info, enable_fast_math);
+
+        _gemm_deconv->aux_mem_req = _gemm_deconv->op->workspace();
+        _gemm_deconv->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, bias}, {ACL_DST, output}};
+        _gemm_deconv->workspace =
+            manage_workspace<Tensor>(_gemm_deconv->aux_mem_req, _memory_group, _gemm_deconv->run_pack,
+                                     _gemm_deconv->run_pack, /* allocate_now */ false);
+        return;
+    }
+
     _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
 
     _weights_flipped.allocator()->init(weights->info()->clone()->set_data_layout(data_layout));
@@ -305,6 +362,12 @@ void NEDeconvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_gemm_deconv != nullptr)
+    {
+        _gemm_deconv->op->run(_gemm_deconv->run_pack);
+        return;
+    }
+
     if (_do_upsampling)
     {
         _upsample_f.run();
@@ -318,6 +381,17 @@ void NEDeconvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
+        if (_gemm_deconv != nullptr)
+        {
+            allocate_tensors(_gemm_deconv->aux_mem_req, _gemm_deconv->workspace);
+            _gemm_deconv->op->prepare(_gemm_deconv->run_pack);
+
+            // Release temporary tensors that are only used in prepare stage
+            release_temporaries<Tensor>(_gemm_deconv->aux_mem_req, _gemm_deconv->workspace);
+            _is_prepared = true;
+            return;
+        }
+
         // Run weights flipping and mark original weights tensor as unused
         _weights_flipped.allocator()->allocate();
         _flip_weights.run();
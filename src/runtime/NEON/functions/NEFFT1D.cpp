@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/functions/NESlice.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -36,6 +37,23 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Checks whether the complex side of a transform along axis 0 only holds the N / 2 + 1 non-redundant elements of
+ *  the spectrum of a real signal of length N */
+bool is_half_spectrum(const ITensorInfo *input, const ITensorInfo *output, unsigned int axis)
+{
+    return axis == 0 && output->total_size() != 0 && input->dimension(0) != output->dimension(0);
+}
+
+/** Length of the transform, which is the one of the real side of a half spectrum */
+unsigned int transform_length(const ITensorInfo *input, const ITensorInfo *output, unsigned int axis)
+{
+    const bool is_c2r = input->num_channels() == 2 && output->num_channels() == 1;
+    return (is_c2r && is_half_spectrum(input, output, axis)) ? output->dimension(0) : input->dimension(axis);
+}
+} // namespace
+
 NEFFT1D::~NEFFT1D() = default;
 
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
@@ -43,11 +61,13 @@ NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
       _digit_reverse_kernel(),
       _fft_kernels(),
       _scale_kernel(),
+      _crop_func(),
       _digit_reversed_input(),
       _digit_reverse_indices(),
       _num_ffts(0),
       _axis(0),
-      _run_scale(false)
+      _run_scale(false),
+      _run_crop(false)
 {
 }
 
@@ -58,23 +78,31 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT1D::validate(input->info(), output->info(), config));
     ARM_COMPUTE_LOG_PARAMS(input, output, config);
 
+    const bool is_c2r  = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
+    const bool is_half = is_half_spectrum(input->info(), output->info(), config.axis);
+
     // Decompose size to radix factors
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->info()->tensor_shape()[config.axis];
+    const unsigned int N                 = transform_length(input->info(), output->info(), config.axis);
     const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
     ARM_COMPUTE_ERROR_ON(decomposed_vector.empty());
 
     // Flags
     _run_scale = config.direction == FFTDirection::Inverse;
-
-    const bool is_c2r = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
+    _run_crop  = is_half && !is_c2r;
 
     // Configure digit reverse
     FFTDigitReverseKernelInfo digit_reverse_config;
     digit_reverse_config.axis      = config.axis;
     digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
-    TensorInfo digit_reverse_indices_info(TensorShape(input->info()->tensor_shape()[config.axis]), 1, DataType::U32);
+    TensorInfo digit_reverse_indices_info(TensorShape(N), 1, DataType::U32);
     _digit_reverse_indices.allocator()->init(digit_reverse_indices_info);
+    if (is_half && is_c2r)
+    {
+        // The digit reverse rebuilds the full spectrum from its non-redundant half
+        _digit_reversed_input.allocator()->init(
+            output->info()->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+    }
     _memory_group.manage(&_digit_reversed_input);
     _digit_reverse_kernel = std::make_unique<NEFFTDigitReverseKernel>();
     _digit_reverse_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
@@ -88,6 +116,7 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     for (unsigned int i = 0; i < _num_ffts; ++i)
     {
         const unsigned int radix_for_stage = decomposed_vector.at(i);
+        const bool         is_last_stage   = (i == (_num_ffts - 1)) && !is_c2r && !_run_crop;
 
         FFTRadixStageKernelInfo fft_kernel_info;
         fft_kernel_info.axis           = config.axis;
@@ -95,8 +124,7 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         fft_kernel_info.Nx             = Nx;
         fft_kernel_info.is_first_stage = (i == 0);
         _fft_kernels[i]                = std::make_unique<NEFFTRadixStageKernel>();
-        _fft_kernels[i]->configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r) ? output : nullptr,
-                                   fft_kernel_info);
+        _fft_kernels[i]->configure(&_digit_reversed_input, is_last_stage ? output : nullptr, fft_kernel_info);
 
         Nx *= radix_for_stage;
     }
@@ -112,6 +140,18 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
                         : _scale_kernel->configure(output, nullptr, scale_config);
     }
 
+    // Keep the non-redundant half of the spectrum of a real input
+    if (_run_crop)
+    {
+        Coordinates ends;
+        for (size_t d = 0; d < _digit_reversed_input.info()->num_dimensions(); ++d)
+        {
+            ends.set(d, output->info()->dimension(d));
+        }
+        _crop_func = std::make_unique<NESlice>();
+        _crop_func->configure(&_digit_reversed_input, output, Coordinates(), ends);
+    }
+
     // Allocate tensors
     _digit_reversed_input.allocator()->allocate();
     _digit_reverse_indices.allocator()->allocate();
@@ -132,7 +172,7 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
 
     // Check if FFT is decomposable
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->tensor_shape()[config.axis];
+    const unsigned int N                 = transform_length(input, output, config.axis);
     const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
     ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty());
 
@@ -142,8 +182,21 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
         // All combinations are supported except real input with real output (i.e., both input channels set to 1)
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() == 1 && input->num_channels() == 1);
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() > 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        if (is_half_spectrum(input, output, config.axis))
+        {
+            // A half spectrum is only exchanged with a real tensor
+            ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() == output->num_channels());
+            const ITensorInfo *real_side    = input->num_channels() == 1 ? input : output;
+            const ITensorInfo *complex_side = input->num_channels() == 1 ? output : input;
+            ARM_COMPUTE_RETURN_ERROR_ON(complex_side->dimension(0) != (real_side->dimension(0) / 2) + 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(
+                detail::have_different_dimensions(input->tensor_shape(), output->tensor_shape(), 1));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        }
     }
 
     return Status{};
@@ -161,6 +214,11 @@ void NEFFT1D::run()
         NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
     }
 
+    if (_run_crop)
+    {
+        _crop_func->run();
+    }
+
     // Run output scaling
     if (_run_scale)
     {
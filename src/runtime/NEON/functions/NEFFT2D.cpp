@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,16 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Info of the intermediate tensor, which has the shape of the complex side of the transform */
+TensorInfo first_pass_tensor_info(const ITensorInfo *input, const ITensorInfo *output)
+{
+    const ITensorInfo *complex_side = (input->num_channels() == 1 && output->total_size() != 0) ? output : input;
+    return TensorInfo(complex_side->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+}
+} // namespace
+
 NEFFT2D::~NEFFT2D() = default;
 
 NEFFT2D::NEFFT2D(std::shared_ptr<IMemoryManager> memory_manager)
@@ -53,6 +63,7 @@ void NEFFT2D::configure(const ITensor *input, ITensor *output, const FFT2DInfo &
     FFT1DInfo first_pass_config;
     first_pass_config.axis      = config.axis0;
     first_pass_config.direction = config.direction;
+    _first_pass_tensor.allocator()->init(first_pass_tensor_info(input->info(), output->info()));
     _memory_group.manage(&_first_pass_tensor);
     _first_pass_func.configure(input, &_first_pass_tensor, first_pass_config);
 
@@ -71,7 +82,7 @@ Status NEFFT2D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
 
     // Create intermediate tensor info
-    TensorInfo first_pass_tensor(input->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+    TensorInfo first_pass_tensor = first_pass_tensor_info(input, output);
 
     // Validate first pass
     FFT1DInfo first_pass_config;
@@ -88,7 +99,9 @@ Status NEFFT2D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     // Checks performed when output is configured
     if ((output != nullptr) && (output->total_size() != 0))
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        // Axis 0 may be shrunk to a half spectrum, which the 1D passes validate
+        ARM_COMPUTE_RETURN_ERROR_ON(
+            detail::have_different_dimensions(input->tensor_shape(), output->tensor_shape(), 1));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
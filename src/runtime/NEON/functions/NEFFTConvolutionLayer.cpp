@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,9 +35,10 @@
 #include "src/core/NEON/kernels/NEFFTRadixStageKernel.h"
 #include "src/core/NEON/kernels/NEFFTScaleKernel.h"
 #include "src/core/NEON/kernels/NEPadLayerKernel.h"
-#include "src/core/NEON/kernels/NEReductionOperationKernel.h"
 #include "src/core/utils/helpers/fft.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace
@@ -59,6 +60,15 @@ int pad_decomposable(int N)
     }
     return pad;
 }
+
+/** Info of the non-redundant half of the spectrum of a real tensor along the width */
+TensorInfo half_spectrum_info(const ITensorInfo &info)
+{
+    TensorShape shape = info.tensor_shape();
+    shape.set(0, (shape.x() / 2) + 1);
+    return TensorInfo(
+        info.clone()->set_is_resizable(true).reset_padding().set_num_channels(2).set_tensor_shape(shape));
+}
 } // namespace
 
 NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -132,8 +142,15 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
         Size2D(input->info()->tensor_shape()[idx_width], input->info()->tensor_shape()[idx_height]);
     const Size2D kernel_size =
         Size2D(weights->info()->tensor_shape()[idx_width], weights->info()->tensor_shape()[idx_height]);
-    const Size2D pad_valid = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1),
-                                    pad_decomposable(input_dims.y() + kernel_size.y() - 1));
+
+    // The circular convolution only has to keep the wrapped around values out of the extracted region, which needs
+    // the input to be padded by the largest convolution padding rather than by the whole kernel
+    const size_t max_pad_x    = std::max(conv_info.pad_left(), conv_info.pad_right());
+    const size_t max_pad_y    = std::max(conv_info.pad_top(), conv_info.pad_bottom());
+    const Size2D min_fft_size = Size2D(std::max(input_dims.x() + max_pad_x, kernel_size.x()),
+                                       std::max(input_dims.y() + max_pad_y, kernel_size.y()));
+    const Size2D fft_size = Size2D(min_fft_size.x() + pad_decomposable(min_fft_size.x()),
+                                   min_fft_size.y() + pad_decomposable(min_fft_size.y()));
     // Tensors to use
     ITensor       *input_to_use   = input;
     const ITensor *weights_to_use = weights;
@@ -169,15 +186,16 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
     _flip_weights_func.configure(weights_to_use, &_flipped_weights, &_flip_axis);
 
     // Pad weights
-    const PaddingList padding_w = {{0, input_dims.x() + pad_valid.x() - 1}, {0, input_dims.y() + pad_valid.y() - 1}};
+    const PaddingList padding_w = {{0, fft_size.x() - kernel_size.x()}, {0, fft_size.y() - kernel_size.y()}};
     _pad_weights_func.configure(&_flipped_weights, &_padded_weights, padding_w);
 
-    // Transform weights
+    // Transform weights, keeping the non-redundant half of their spectrum only
+    _transformed_weights.allocator()->init(half_spectrum_info(*_padded_weights.info()));
     _transform_weights_func = std::make_unique<NEFFT2D>();
     _transform_weights_func->configure(&_padded_weights, &_transformed_weights, FFT2DInfo());
 
     // Pad input
-    const PaddingList padding_in = {{0, kernel_size.x() + pad_valid.x() - 1}, {0, kernel_size.y() + pad_valid.y() - 1}};
+    const PaddingList padding_in = {{0, fft_size.x() - input_dims.x()}, {0, fft_size.y() - input_dims.y()}};
     _memory_group.manage(&_padded_input);
     _pad_input_func.configure(input_to_use, &_padded_input, padding_in);
     if (_needs_permute)
@@ -185,7 +203,8 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
         _permuted_input.allocator()->allocate();
     }
 
-    // Transform input
+    // Transform input, so the products, the reduction and the inverse transform run on half spectra
+    _transformed_input.allocator()->init(half_spectrum_info(*_padded_input.info()));
     _memory_group.manage(&_transformed_input);
     _transform_input_func.configure(&_padded_input, &_transformed_input, FFT2DInfo());
     _padded_input.allocator()->allocate();
@@ -200,12 +219,20 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
     _reduce_func.configure(&_output_product, &_output_reduced, 2, ReductionOperation::SUM);
     _output_product.allocator()->allocate();
 
-    // Transform output
+    // Transform output, rebuilding the full spectrum in the last pass along the width
     _memory_group.manage(&_itransformed_output);
     FFT2DInfo itranform_info;
+    itranform_info.axis0     = 1;
+    itranform_info.axis1     = 0;
     itranform_info.direction = FFTDirection::Inverse;
-    _itransformed_output.allocator()->init(
-        _output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).reset_padding());
+    TensorShape itransformed_shape = _output_reduced.info()->tensor_shape();
+    itransformed_shape.set(0, fft_size.x());
+    _itransformed_output.allocator()->init(_output_reduced.info()
+                                               ->clone()
+                                               ->set_is_resizable(true)
+                                               .set_num_channels(1)
+                                               .reset_padding()
+                                               .set_tensor_shape(itransformed_shape));
     _itransform_output_func.configure(&_output_reduced, &_itransformed_output, itranform_info);
     _output_reduced.allocator()->allocate();
 
@@ -217,10 +244,8 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
     // Extract correct region
     const int start_left = kernel_size.x() - conv_info.pad_left() - 1;
     const int start_top  = kernel_size.y() - conv_info.pad_top() - 1;
-    const int end_right =
-        _reshaped_output.info()->tensor_shape().x() - (kernel_size.x() - conv_info.pad_right() - 1) - pad_valid.x();
-    const int end_botton =
-        _reshaped_output.info()->tensor_shape().y() - (kernel_size.y() - conv_info.pad_bottom() - 1) - pad_valid.y();
+    const int end_right  = start_left + input_dims.x();
+    const int end_botton = start_top + input_dims.y();
     if (_has_bias)
     {
         _memory_group.manage(&_bias_output);
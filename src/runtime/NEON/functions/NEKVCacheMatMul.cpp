@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEKVCacheMatMul.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuKVCacheMatMul.h"
+
+namespace arm_compute
+{
+struct NEKVCacheMatMul::Impl
+{
+    const ITensor                          *lhs{nullptr};
+    ITensor                                *dst{nullptr};
+    std::unique_ptr<cpu::CpuKVCacheMatMul> op{nullptr};
+    MemoryGroup                             memory_group{};
+    ITensorPack                             run_pack{};
+    ITensorPack                             append_pack{};
+    WorkspaceData<Tensor>                   workspace_tensors{};
+};
+
+NEKVCacheMatMul::NEKVCacheMatMul() : _impl(std::make_unique<Impl>())
+{
+}
+NEKVCacheMatMul::NEKVCacheMatMul(NEKVCacheMatMul &&)            = default;
+NEKVCacheMatMul &NEKVCacheMatMul::operator=(NEKVCacheMatMul &&) = default;
+NEKVCacheMatMul::~NEKVCacheMatMul()                             = default;
+
+void NEKVCacheMatMul::configure(const ITensor *lhs, ITensor *dst, const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEKVCacheMatMul::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, dst);
+    ARM_COMPUTE_LOG_PARAMS(lhs, dst);
+
+    _impl->lhs = lhs;
+    _impl->dst = dst;
+    _impl->op  = std::make_unique<cpu::CpuKVCacheMatMul>();
+    _impl->op->configure(lhs->info(), dst->info(), info);
+
+    // The packed cache is persistent, so both packs share the same workspace tensor
+    _impl->run_pack          = {{TensorType::ACL_SRC, _impl->lhs}, {TensorType::ACL_DST, _impl->dst}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack,
+                                                        _impl->append_pack);
+}
+
+Status NEKVCacheMatMul::validate(const ITensorInfo *lhs, const ITensorInfo *dst, const KVCacheMatMulInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEKVCacheMatMul::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(lhs, dst);
+    return cpu::CpuKVCacheMatMul::validate(lhs, dst, info);
+}
+
+void NEKVCacheMatMul::append(const ITensor *rows)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEKVCacheMatMul::append");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(rows);
+
+    _impl->append_pack.add_const_tensor(TensorType::ACL_SRC, rows);
+    _impl->op->append(_impl->append_pack);
+}
+
+void NEKVCacheMatMul::reset()
+{
+    _impl->op->reset();
+}
+
+unsigned int NEKVCacheMatMul::length() const
+{
+    return _impl->op->length();
+}
+
+void NEKVCacheMatMul::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEKVCacheMatMul::run");
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
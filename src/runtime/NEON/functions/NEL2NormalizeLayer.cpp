@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,6 @@
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/NEON/kernels/NEL2NormalizeLayerKernel.h"
-#include "src/core/NEON/kernels/NEReductionOperationKernel.h"
 
 namespace arm_compute
 {
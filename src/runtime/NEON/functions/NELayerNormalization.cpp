@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELayerNormalization.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/operators/CpuLayerNormalization.h"
+
+namespace arm_compute
+{
+namespace
+{
+template <typename T>
+auto info_or_null(T *tensor) -> decltype(tensor->info())
+{
+    return tensor != nullptr ? tensor->info() : nullptr;
+}
+} // namespace
+
+struct NELayerNormalization::Impl
+{
+    const ITensor                              *src{nullptr};
+    const ITensor                              *residual{nullptr};
+    const ITensor                              *gamma{nullptr};
+    const ITensor                              *beta{nullptr};
+    ITensor                                    *dst{nullptr};
+    ITensor                                    *sum{nullptr};
+    std::unique_ptr<cpu::CpuLayerNormalization> op{nullptr};
+};
+
+NELayerNormalization::NELayerNormalization() : _impl(std::make_unique<Impl>())
+{
+}
+NELayerNormalization::NELayerNormalization(NELayerNormalization &&)            = default;
+NELayerNormalization &NELayerNormalization::operator=(NELayerNormalization &&) = default;
+NELayerNormalization::~NELayerNormalization()                                  = default;
+
+void NELayerNormalization::configure(const ITensor                *input,
+                                     const ITensor                *gamma,
+                                     const ITensor                *beta,
+                                     ITensor                      *output,
+                                     const LayerNormalizationInfo &info,
+                                     const ITensor                *residual,
+                                     ITensor                      *residual_output)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NELayerNormalization::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    _impl->src      = input;
+    _impl->residual = residual;
+    _impl->gamma    = gamma;
+    _impl->beta     = beta;
+    _impl->dst      = output;
+    _impl->sum      = residual_output;
+
+    _impl->op = std::make_unique<cpu::CpuLayerNormalization>();
+    _impl->op->configure(input->info(), info_or_null(residual), info_or_null(gamma), info_or_null(beta),
+                         output->info(), info_or_null(residual_output), info);
+}
+
+Status NELayerNormalization::validate(const ITensorInfo            *input,
+                                      const ITensorInfo            *gamma,
+                                      const ITensorInfo            *beta,
+                                      const ITensorInfo            *output,
+                                      const LayerNormalizationInfo &info,
+                                      const ITensorInfo            *residual,
+                                      const ITensorInfo            *residual_output)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NELayerNormalization::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
+    return cpu::CpuLayerNormalization::validate(input, residual, gamma, beta, output, residual_output, info);
+}
+
+void NELayerNormalization::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NELayerNormalization::run");
+    ITensorPack pack;
+    pack.add_const_tensor(TensorType::ACL_SRC_0, _impl->src);
+    pack.add_const_tensor(TensorType::ACL_SRC_1, _impl->residual);
+    pack.add_const_tensor(TensorType::ACL_SRC_2, _impl->gamma);
+    pack.add_const_tensor(TensorType::ACL_SRC_3, _impl->beta);
+    pack.add_tensor(TensorType::ACL_DST_0, _impl->dst);
+    pack.add_tensor(TensorType::ACL_DST_1, _impl->sum);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
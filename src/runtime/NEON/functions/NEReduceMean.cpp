@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,13 +24,18 @@
 #include "arm_compute/runtime/NEON/functions/NEReduceMean.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
-#include "src/core/NEON/kernels/NEReductionOperationKernel.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuReduction.h"
 
 namespace arm_compute
 {
@@ -100,17 +105,23 @@ validate_config(const ITensorInfo *input, const Coordinates &reduction_axis, boo
 }
 } // namespace
 
-NEReduceMean::~NEReduceMean() = default;
-
-NEReduceMean::NEReduceMean(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)),
-      _reduction_kernels(),
-      _reduced_outs(),
-      _reshape(),
-      _reduction_ops(),
-      _keep_dims()
+struct NEReduceMean::Impl
+{
+    const ITensor                     *src{nullptr};
+    ITensor                           *dst{nullptr};
+    std::unique_ptr<cpu::CpuReduction> op{nullptr};
+    MemoryGroup                        memory_group{};
+    ITensorPack                        run_pack{};
+    WorkspaceData<Tensor>              workspace_tensors{};
+};
+
+NEReduceMean::NEReduceMean(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
 }
+NEReduceMean::NEReduceMean(NEReduceMean &&)            = default;
+NEReduceMean &NEReduceMean::operator=(NEReduceMean &&) = default;
+NEReduceMean::~NEReduceMean()                          = default;
 
 Status NEReduceMean::validate(const ITensorInfo *input,
                               const Coordinates &reduction_axis,
@@ -118,12 +129,17 @@ Status NEReduceMean::validate(const ITensorInfo *input,
                               const ITensorInfo *output)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEReduceMean::validate");
-    return validate_config(input, reduction_axis, keep_dims, output);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_config(input, reduction_axis, keep_dims, output));
+
+    Coordinates axis_local = reduction_axis;
+    convert_negative_axis(axis_local, input->num_dimensions());
+    return cpu::CpuReduction::validate(input, output, axis_local, ReductionOperation::MEAN_SUM, keep_dims);
 }
 
 void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis, bool keep_dims, ITensor *output)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEReduceMean::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_LOG_PARAMS(input, reduction_axis, keep_dims, output);
 
     // Perform validate step
@@ -133,80 +149,23 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
         arm_compute::misc::shape_calculator::calculate_reduce_mean_shape(input->info(), reduction_axis, keep_dims);
     auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
 
-    _reduction_ops = reduction_axis.num_dimensions();
-    _reduction_kernels.resize(_reduction_ops);
-    _reduced_outs.resize(_reduction_ops - (keep_dims ? 1 : 0));
-    _keep_dims = keep_dims;
-
-    ITensor *tmp_input  = input;
-    ITensor *tmp_output = output;
-
     Coordinates axis_local = reduction_axis;
-    const int   input_dims = tmp_input->info()->num_dimensions();
-
-    convert_negative_axis(axis_local, input_dims);
-
-    // Perform reduction for every axis
-    for (int i = 0; i < _reduction_ops; ++i)
-    {
-        TensorShape out_shape =
-            i == 0 ? tmp_input->info()->tensor_shape() : (&_reduced_outs[i - 1])->info()->tensor_shape();
-        out_shape.set(axis_local[i], 1);
-        auto in = (i == 0) ? tmp_input : (&_reduced_outs[i - 1]);
+    convert_negative_axis(axis_local, input->info()->num_dimensions());
 
-        if (i == _reduction_ops - 1 && keep_dims)
-        {
-            _reduction_kernels[i].configure(in, tmp_output, axis_local[i], ReductionOperation::MEAN_SUM);
-        }
-        else
-        {
-            _reduced_outs[i].allocator()->init(TensorInfo(out_shape, tmp_output->info()->num_channels(),
-                                                          tmp_output->info()->data_type(),
-                                                          tmp_output->info()->quantization_info()));
-            _memory_group.manage(&_reduced_outs[i]);
-            _reduction_kernels[i].configure(in, &_reduced_outs[i], axis_local[i], ReductionOperation::MEAN_SUM);
-        }
-    }
+    // The mean over all the axes is requantized once to the output quantization info
+    _impl->src = input;
+    _impl->dst = output;
+    _impl->op  = std::make_unique<cpu::CpuReduction>();
+    _impl->op->configure(input->info(), output->info(), axis_local, ReductionOperation::MEAN_SUM, keep_dims);
 
-    // Allocate intermediate tensors
-    for (int i = 0; i < _reduction_ops - (keep_dims ? 1 : 0); ++i)
-    {
-        _reduced_outs[i].allocator()->allocate();
-    }
-    // Configure reshape layer if we want to drop the dimensions
-    if (!keep_dims)
-    {
-        TensorShape out_shape = tmp_input->info()->tensor_shape();
-        // We have to sort the reduction axis vectors in order for remove_dimension
-        // to work properly
-
-// Suppress warning produced by a compiler bug in GCC
-// https://gcc.gnu.org/bugzilla/show_bug.cgi?id=104165
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-        std::sort(axis_local.begin(), axis_local.begin() + _reduction_ops);
-#pragma GCC diagnostic pop
-
-        for (int i = 0; i < _reduction_ops; ++i)
-        {
-            out_shape.remove_dimension(axis_local[i] - i, false);
-        }
-        auto_init_if_empty(*tmp_output->info(), tmp_input->info()->clone()->set_tensor_shape(out_shape));
-        _reshape.configure(&_reduced_outs[_reduction_ops - 1], tmp_output);
-    }
+    _impl->run_pack          = {{TensorType::ACL_SRC, _impl->src}, {TensorType::ACL_DST, _impl->dst}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
 }
 
 void NEReduceMean::run()
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEReduceMean::run");
-    MemoryGroupResourceScope scope_mg(_memory_group);
-    for (auto &kernel : _reduction_kernels)
-    {
-        kernel.run();
-    }
-    if (!_keep_dims)
-    {
-        _reshape.run();
-    }
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
 }
 } // namespace arm_compute
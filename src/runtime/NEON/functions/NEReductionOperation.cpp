@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,99 +23,47 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
 
-#include "arm_compute/core/Helpers.h"
-#include "arm_compute/core/utils/misc/ShapeCalculator.h"
-#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
-#include "src/core/helpers/AutoConfiguration.h"
-#include "src/core/NEON/kernels/NEReductionOperationKernel.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuReduction.h"
 
 namespace arm_compute
 {
-namespace
+struct NEReductionOperation::Impl
 {
-/** Define dimension to split the window
- *
- * @param[in] axis Reduction axis
- *
- * @return The dimension to split the window
- */
-size_t reduction_window_split_dimension(unsigned int axis)
-{
-    switch (axis)
-    {
-        case 0:
-            return Window::DimY;
-        case 1:
-        case 2:
-        case 3:
-            return Window::DimX;
-        default:
-            ARM_COMPUTE_ERROR("Unsupported reduction axis");
-    }
-}
-} // namespace
-
-NEReductionOperation::~NEReductionOperation() = default;
+    const ITensor                     *src{nullptr};
+    ITensor                           *dst{nullptr};
+    std::unique_ptr<cpu::CpuReduction> op{nullptr};
+    MemoryGroup                        memory_group{};
+    ITensorPack                        run_pack{};
+    WorkspaceData<Tensor>              workspace_tensors{};
+};
 
 NEReductionOperation::NEReductionOperation(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(memory_manager),
-      _reduction_kernel(),
-      _reshape(),
-      _output_internal(),
-      _window_split(0),
-      _reduction_axis(),
-      _is_reshape_required(false)
+    : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
 }
+NEReductionOperation::NEReductionOperation(NEReductionOperation &&)            = default;
+NEReductionOperation &NEReductionOperation::operator=(NEReductionOperation &&) = default;
+NEReductionOperation::~NEReductionOperation()                                  = default;
 
 Status NEReductionOperation::validate(
     const ITensorInfo *input, const ITensorInfo *output, unsigned int axis, ReductionOperation op, bool keep_dims)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEReductionOperation::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis >= TensorShape::num_max_dimensions,
                                     "Reduction axis greater than max number of dimensions");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis > 3, "Unsupported reduction axis");
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
-
-    const auto is_reshape_required = !keep_dims;
-
-    auto *output_internal = output;
-
-    TensorInfo info_before_reshape;
-
-    if (is_reshape_required)
-    {
-        const TensorInfo expected_output_shape = output->clone()->set_tensor_shape(
-            arm_compute::misc::shape_calculator::compute_reduced_shape(input->tensor_shape(), axis, keep_dims));
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&expected_output_shape, output);
-
-        auto shape_before_reshape = input->tensor_shape();
-        shape_before_reshape.set(axis, 1);
-
-        const auto input_num_channles = input->num_channels();
-        const auto input_qinfo        = input->quantization_info();
-        const auto is_arg_min_max = (op == ReductionOperation::ARG_IDX_MAX) || (op == ReductionOperation::ARG_IDX_MIN);
-        const auto output_data_type = is_arg_min_max ? DataType::S32 : output->data_type();
-
-        info_before_reshape.set_data_type(output_data_type)
-            .set_tensor_shape(shape_before_reshape)
-            .set_num_channels(input_num_channles)
-            .set_quantization_info(input_qinfo);
-
-        output_internal = &info_before_reshape;
-    }
-
-    ARM_COMPUTE_RETURN_ON_ERROR(NEReductionOperationKernel::validate(input, output_internal, axis, op));
-
-    if (is_reshape_required)
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEReshapeLayer::validate(output_internal, output));
-    }
-
-    return Status{};
+    return cpu::CpuReduction::validate(input, output, Coordinates(axis), op, keep_dims);
 }
 
 void NEReductionOperation::configure(
@@ -125,62 +73,19 @@ void NEReductionOperation::configure(
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_LOG_PARAMS(input, output, axis, op, keep_dims);
 
-    _is_reshape_required = !keep_dims;
-
-    auto      *output_internal = output;
-    const auto is_arg_min_max  = (op == ReductionOperation::ARG_IDX_MAX) || (op == ReductionOperation::ARG_IDX_MIN);
-
-    if (_is_reshape_required)
-    {
-        const auto output_internal_shape =
-            arm_compute::misc::shape_calculator::compute_reduced_shape(input->info()->tensor_shape(), axis);
-        const auto output_external_shape =
-            arm_compute::misc::shape_calculator::compute_reduced_shape(input->info()->tensor_shape(), axis, false);
-        const auto output_data_type = is_arg_min_max ? DataType::S32 : input->info()->data_type();
-        const auto num_channels     = input->info()->num_channels();
-        const auto qinfo            = input->info()->quantization_info();
-
-        _output_internal.allocator()->init(input->info()
-                                               ->clone()
-                                               ->set_data_type(output_data_type)
-                                               .set_tensor_shape(output_internal_shape)
-                                               .reset_padding()
-                                               .set_is_resizable(true)
-                                               .set_num_channels(num_channels)
-                                               .set_quantization_info(qinfo));
-        _memory_group.manage(&_output_internal);
-        output_internal = &_output_internal;
-        auto_init_if_empty(*output->info(), input->info()
-                                                ->clone()
-                                                ->set_data_type(output_data_type)
-                                                .set_tensor_shape(output_external_shape)
-                                                .reset_padding()
-                                                .set_is_resizable(true));
-    }
-
-    ARM_COMPUTE_ERROR_THROW_ON(NEReductionOperation::validate(input->info(), output->info(), axis, op, keep_dims));
-
-    // Configure reduction kernel
-    _reduction_kernel = std::make_unique<NEReductionOperationKernel>();
-    _reduction_kernel->configure(input, output_internal, axis, op);
-    _window_split   = reduction_window_split_dimension(axis);
-    _reduction_axis = axis;
+    _impl->src = input;
+    _impl->dst = output;
+    _impl->op  = std::make_unique<cpu::CpuReduction>();
+    _impl->op->configure(input->info(), output->info(), Coordinates(axis), op, keep_dims);
 
-    if (_is_reshape_required)
-    {
-        _reshape.configure(output_internal, output);
-        _output_internal.allocator()->allocate();
-    }
+    _impl->run_pack          = {{TensorType::ACL_SRC, _impl->src}, {TensorType::ACL_DST, _impl->dst}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
 }
 
 void NEReductionOperation::run()
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEReductionOperation::run");
-    MemoryGroupResourceScope scope_mg(_memory_group);
-    NEScheduler::get().schedule(_reduction_kernel.get(), _window_split);
-    if (_is_reshape_required)
-    {
-        _reshape.run();
-    }
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
 }
 } // namespace arm_compute
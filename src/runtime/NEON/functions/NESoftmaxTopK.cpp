@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NESoftmaxTopK.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/operators/CpuSoftmaxTopK.h"
+
+namespace arm_compute
+{
+struct NESoftmaxTopK::Impl
+{
+    const ITensor                       *src{nullptr};
+    ITensor                             *values{nullptr};
+    ITensor                             *indices{nullptr};
+    std::unique_ptr<cpu::CpuSoftmaxTopK> op{nullptr};
+};
+
+NESoftmaxTopK::NESoftmaxTopK() : _impl(std::make_unique<Impl>())
+{
+}
+NESoftmaxTopK::NESoftmaxTopK(NESoftmaxTopK &&)            = default;
+NESoftmaxTopK &NESoftmaxTopK::operator=(NESoftmaxTopK &&) = default;
+NESoftmaxTopK::~NESoftmaxTopK()                           = default;
+
+void NESoftmaxTopK::configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k, float beta)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NESoftmaxTopK::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, values, indices);
+
+    _impl->src     = input;
+    _impl->values  = values;
+    _impl->indices = indices;
+
+    _impl->op = std::make_unique<cpu::CpuSoftmaxTopK>();
+    _impl->op->configure(input->info(), values->info(), indices->info(), beta, k);
+}
+
+Status NESoftmaxTopK::validate(
+    const ITensorInfo *input, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k, float beta)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NESoftmaxTopK::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, values, indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, values, indices);
+    return cpu::CpuSoftmaxTopK::validate(input, values, indices, beta, k);
+}
+
+void NESoftmaxTopK::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NESoftmaxTopK::run");
+    ITensorPack pack;
+    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
+    pack.add_tensor(TensorType::ACL_DST_0, _impl->values);
+    pack.add_tensor(TensorType::ACL_DST_1, _impl->indices);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NESparseFullyConnectedLayer.h"
+
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuSparseFullyConnected.h"
+
+namespace arm_compute
+{
+using namespace arm_compute::experimental;
+
+struct NESparseFullyConnectedLayer::Impl
+{
+    MemoryGroup memory_group{};
+
+    std::unique_ptr<cpu::CpuSparseFullyConnected> op{nullptr};
+
+    ITensorPack                      run_pack{};
+    WorkspaceData<Tensor>            workspace{};
+    experimental::MemoryRequirements aux_mem_req{};
+
+    bool is_prepared{false};
+};
+
+NESparseFullyConnectedLayer::~NESparseFullyConnectedLayer() = default;
+
+NESparseFullyConnectedLayer::NESparseFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+void NESparseFullyConnectedLayer::configure(const ITensor                       *input,
+                                            const ITensor                       *weights,
+                                            const ITensor                       *biases,
+                                            ITensor                             *output,
+                                            const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "NESparseFullyConnectedLayer::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NESparseFullyConnectedLayer::validate(
+        input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), info));
+    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output);
+
+    _impl->op          = std::make_unique<cpu::CpuSparseFullyConnected>();
+    _impl->is_prepared = false;
+
+    _impl->op->configure(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr,
+                         output->info(), info);
+
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                _impl->run_pack, /* allocate_now */ false);
+}
+
+Status NESparseFullyConnectedLayer::validate(const ITensorInfo                   *input,
+                                             const ITensorInfo                   *weights,
+                                             const ITensorInfo                   *biases,
+                                             const ITensorInfo                   *output,
+                                             const SparseFullyConnectedLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "NESparseFullyConnectedLayer::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
+    return cpu::CpuSparseFullyConnected::validate(input, weights, biases, output, info);
+}
+
+bool NESparseFullyConnectedLayer::uses_dense_fallback() const
+{
+    return _impl->op->uses_dense_fallback();
+}
+
+void NESparseFullyConnectedLayer::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NESparseFullyConnectedLayer::run");
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NESparseFullyConnectedLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace);
+        _impl->op->prepare(_impl->run_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+
+        // Only the persistent memory of the selected path is still reported: the dense reshaped weights or the packed
+        // sparse ones. Free the other one.
+        const MemoryRequirements selected_mem_req = _impl->op->workspace();
+        for (auto &ws : _impl->workspace)
+        {
+            for (const auto &m : selected_mem_req)
+            {
+                if (m.slot == ws.slot && m.lifetime == MemoryLifetime::Persistent && m.size == 0)
+                {
+                    ws.tensor->allocator()->free();
+                    break;
+                }
+            }
+        }
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
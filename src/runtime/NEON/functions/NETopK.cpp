@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NETopK.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuTopK.h"
+
+namespace arm_compute
+{
+struct NETopK::Impl
+{
+    const ITensor                *src{nullptr};
+    ITensor                      *values{nullptr};
+    ITensor                      *indices{nullptr};
+    std::unique_ptr<cpu::CpuTopK> op{nullptr};
+    MemoryGroup                   memory_group{};
+    ITensorPack                   run_pack{};
+    WorkspaceData<Tensor>         workspace_tensors{};
+};
+
+NETopK::NETopK(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+NETopK::NETopK(NETopK &&)            = default;
+NETopK &NETopK::operator=(NETopK &&) = default;
+NETopK::~NETopK()                    = default;
+
+void NETopK::configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NETopK::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, values, indices);
+    ARM_COMPUTE_LOG_PARAMS(input, values, indices, k);
+
+    _impl->src     = input;
+    _impl->values  = values;
+    _impl->indices = indices;
+    _impl->op      = std::make_unique<cpu::CpuTopK>();
+    _impl->op->configure(input->info(), values->info(), indices->info(), k);
+
+    _impl->run_pack          = {{TensorType::ACL_SRC, _impl->src},
+                                {TensorType::ACL_DST_0, _impl->values},
+                                {TensorType::ACL_DST_1, _impl->indices}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
+}
+
+Status NETopK::validate(const ITensorInfo *input, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NETopK::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, values, indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, values, indices);
+    return cpu::CpuTopK::validate(input, values, indices, k);
+}
+
+void NETopK::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NETopK::run");
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
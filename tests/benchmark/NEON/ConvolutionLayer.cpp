@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "src/cpu/operators/CpuWinogradConv2dQuantized.h"
+#include "tests/benchmark/fixtures/ConvolutionLayerFixture.h"
+#include "tests/benchmark/fixtures/WinogradConvolutionLayerQuantizedFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+using framework::dataset::make;
+
+namespace
+{
+/** 3x3 grouped convolutions with 32 groups of the four ResNeXt-50 stages */
+const auto ResNeXt50GroupedShapes =
+    zip(make("InputShape",
+             {TensorShape(56U, 56U, 128U), TensorShape(28U, 28U, 256U), TensorShape(14U, 14U, 512U),
+              TensorShape(7U, 7U, 1024U)}),
+        make("WeightsShape",
+             {TensorShape(3U, 3U, 4U, 128U), TensorShape(3U, 3U, 8U, 256U), TensorShape(3U, 3U, 16U, 512U),
+              TensorShape(3U, 3U, 32U, 1024U)}),
+        make("BiasShape", {TensorShape(128U), TensorShape(256U), TensorShape(512U), TensorShape(1024U)}),
+        make("OutputShape",
+             {TensorShape(56U, 56U, 128U), TensorShape(28U, 28U, 256U), TensorShape(14U, 14U, 512U),
+              TensorShape(7U, 7U, 1024U)}));
+
+/** 1x1 grouped convolutions with 3 groups of the ShuffleNet units, bottleneck and expansion */
+const auto ShuffleNetGroupedShapes =
+    zip(make("InputShape", {TensorShape(28U, 28U, 240U), TensorShape(28U, 28U, 60U), TensorShape(14U, 14U, 480U)}),
+        make("WeightsShape",
+             {TensorShape(1U, 1U, 80U, 60U), TensorShape(1U, 1U, 20U, 240U), TensorShape(1U, 1U, 160U, 120U)}),
+        make("BiasShape", {TensorShape(60U), TensorShape(240U), TensorShape(120U)}),
+        make("OutputShape", {TensorShape(28U, 28U, 60U), TensorShape(28U, 28U, 240U), TensorShape(14U, 14U, 120U)}));
+
+/** 3x3 stride 1 convolutions of the four ResNet stages, within the int32 range of the quantized Winograd GEMM */
+const auto QuantizedWinogradShapes =
+    zip(make("InputShape",
+             {TensorShape(56U, 56U, 64U), TensorShape(28U, 28U, 128U), TensorShape(14U, 14U, 256U),
+              TensorShape(7U, 7U, 512U)}),
+        make("WeightsShape",
+             {TensorShape(3U, 3U, 64U, 64U), TensorShape(3U, 3U, 128U, 128U), TensorShape(3U, 3U, 256U, 256U),
+              TensorShape(3U, 3U, 512U, 512U)}),
+        make("BiasShape", {TensorShape(64U), TensorShape(128U), TensorShape(256U), TensorShape(512U)}),
+        make("OutputShape",
+             {TensorShape(56U, 56U, 64U), TensorShape(28U, 28U, 128U), TensorShape(14U, 14U, 256U),
+              TensorShape(7U, 7U, 512U)}));
+} // namespace
+
+using NEConvolutionLayerFixture     = ConvolutionLayerFixture<Tensor, NEConvolutionLayer, Accessor>;
+using NEGEMMConvolutionLayerFixture = ConvolutionLayerFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
+using CpuWinogradConv2dQuantizedFixture =
+    WinogradConvolutionLayerQuantizedFixture<Tensor, cpu::CpuWinogradConv2dQuantized, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConvolutionLayer)
+TEST_SUITE(Grouped)
+/** Grouped convolutions run natively through GEMM_CONV2D, which is NHWC only */
+REGISTER_FIXTURE_DATA_TEST_CASE(RunResNeXt50,
+                                NEConvolutionLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(ResNeXt50GroupedShapes,
+                                        make("PadStrideInfo", PadStrideInfo(1, 1, 1, 1)),
+                                        make("DataType", {DataType::F32, DataType::F16}),
+                                        make("DataLayout", DataLayout::NHWC)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunShuffleNet,
+                                NEConvolutionLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(ShuffleNetGroupedShapes,
+                                        make("PadStrideInfo", PadStrideInfo(1, 1, 0, 0)),
+                                        make("DataType", {DataType::F32, DataType::F16}),
+                                        make("DataLayout", DataLayout::NHWC)));
+TEST_SUITE_END() // Grouped
+
+TEST_SUITE(WinogradQuantized)
+/** The quantized Winograd operator is only picked on CPUs without dot product instructions, so run it directly */
+REGISTER_FIXTURE_DATA_TEST_CASE(RunWinograd,
+                                CpuWinogradConv2dQuantizedFixture,
+                                framework::DatasetMode::ALL,
+                                combine(QuantizedWinogradShapes,
+                                        make("PadStrideInfo", PadStrideInfo(1, 1, 1, 1)),
+                                        make("DataType", {DataType::QASYMM8, DataType::QASYMM8_SIGNED})));
+/** GEMM baseline on the same shapes */
+REGISTER_FIXTURE_DATA_TEST_CASE(RunGemm,
+                                NEGEMMConvolutionLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(QuantizedWinogradShapes,
+                                        make("PadStrideInfo", PadStrideInfo(1, 1, 1, 1)),
+                                        make("DataType", {DataType::QASYMM8, DataType::QASYMM8_SIGNED}),
+                                        make("DataLayout", DataLayout::NHWC)));
+TEST_SUITE_END() // WinogradQuantized
+TEST_SUITE_END() // ConvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEDeconvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/DeconvolutionLayerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Decoder upsampling stages: 4x4/2x2 kernels with stride 2 as in FCN and U-Net, and a 3x3 stride 2 kernel */
+const auto StridedDeconvolutionShapes =
+    zip(make("InputShape", {TensorShape(32U, 32U, 64U), TensorShape(16U, 16U, 256U), TensorShape(28U, 28U, 64U)}),
+        make("WeightsShape",
+             {TensorShape(4U, 4U, 64U, 32U), TensorShape(2U, 2U, 256U, 128U), TensorShape(3U, 3U, 64U, 32U)}),
+        make("BiasShape", {TensorShape(32U), TensorShape(128U), TensorShape(32U)}),
+        make("OutputShape", {TensorShape(64U, 64U, 32U), TensorShape(32U, 32U, 128U), TensorShape(57U, 57U, 32U)}),
+        make("PadStrideInfo", {PadStrideInfo(2, 2, 1, 1), PadStrideInfo(2, 2, 0, 0), PadStrideInfo(2, 2, 0, 0)}));
+
+/** The QASYMM8 2x2 stride 2 upscaling deconvolution ending graph_edsr */
+const auto EdsrDeconvolutionShapes = zip(make("InputShape", TensorShape(640U, 360U, 12U)),
+                                         make("WeightsShape", TensorShape(2U, 2U, 12U, 3U)),
+                                         make("BiasShape", TensorShape(3U)),
+                                         make("OutputShape", TensorShape(1280U, 720U, 3U)),
+                                         make("PadStrideInfo", PadStrideInfo(2, 2, 0, 0)));
+} // namespace
+
+using NEDeconvolutionLayerFixture = DeconvolutionLayerFixture<Tensor, NEDeconvolutionLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(DeconvolutionLayer)
+/** NHWC runs the GEMM + col2im path, NCHW the upsample + convolution path it replaces */
+REGISTER_FIXTURE_DATA_TEST_CASE(RunStrided,
+                                NEDeconvolutionLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(StridedDeconvolutionShapes,
+                                        make("DataType", {DataType::F32, DataType::F16}),
+                                        make("DataLayout", {DataLayout::NHWC, DataLayout::NCHW})));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunStridedQuantized,
+                                NEDeconvolutionLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(concat(StridedDeconvolutionShapes, EdsrDeconvolutionShapes),
+                                        make("DataType", {DataType::QASYMM8, DataType::QASYMM8_SIGNED}),
+                                        make("DataLayout", {DataLayout::NHWC, DataLayout::NCHW})));
+TEST_SUITE_END() // DeconvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/DepthwiseSeparableConvolutionLayerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Expanded depthwise 3x3 and projection 1x1 of MobileNetV2 bottleneck blocks, in NHWC order */
+const auto MobileNetV2Shapes =
+    zip(make("InputShape",
+             {TensorShape(96U, 112U, 112U), TensorShape(144U, 56U, 56U), TensorShape(192U, 28U, 28U),
+              TensorShape(384U, 14U, 14U), TensorShape(960U, 7U, 7U)}),
+        make("DepthwiseWeightsShape",
+             {TensorShape(96U, 3U, 3U), TensorShape(144U, 3U, 3U), TensorShape(192U, 3U, 3U),
+              TensorShape(384U, 3U, 3U), TensorShape(960U, 3U, 3U)}),
+        make("PointwiseWeightsShape",
+             {TensorShape(96U, 1U, 1U, 24U), TensorShape(144U, 1U, 1U, 24U), TensorShape(192U, 1U, 1U, 32U),
+              TensorShape(384U, 1U, 1U, 64U), TensorShape(960U, 1U, 1U, 160U)}),
+        make("OutputShape",
+             {TensorShape(24U, 56U, 56U), TensorShape(24U, 56U, 56U), TensorShape(32U, 28U, 28U),
+              TensorShape(64U, 14U, 14U), TensorShape(160U, 7U, 7U)}),
+        make("PadStrideInfo",
+             {PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::FLOOR), PadStrideInfo(1, 1, 1, 1),
+              PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 1, 1)}));
+} // namespace
+
+using NEDepthwiseSeparableConvolutionLayerFixture =
+    DepthwiseSeparableConvolutionLayerFixture<Tensor,
+                                              NEDepthwiseSeparableConvolutionLayer,
+                                              NEDepthwiseConvolutionLayer,
+                                              NEConvolutionLayer,
+                                              Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(DepthwiseSeparableConvolutionLayer)
+/** Fused runs the banded operator, unfused a depthwise layer writing the full intermediate tensor then a 1x1 layer */
+REGISTER_FIXTURE_DATA_TEST_CASE(RunMobileNetV2,
+                                NEDepthwiseSeparableConvolutionLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(MobileNetV2Shapes,
+                                        make("DataType", {DataType::F32, DataType::F16}),
+                                        make("Fused", {true, false})));
+TEST_SUITE_END() // DepthwiseSeparableConvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingBag.h"
+#include "arm_compute/runtime/NEON/functions/NEGather.h"
+#include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/EmbeddingBagFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** Tables of 128MB to 256MB in FP32, far larger than the caches, so every row is a random access to memory */
+const auto table_shapes =
+    framework::dataset::make("TableShape", {TensorShape(64U, 1000000U), TensorShape(128U, 250000U)});
+
+const auto bags = framework::dataset::combine(framework::dataset::make("BagSize", {1U, 20U, 100U}),
+                                              framework::dataset::make("NumBags", 2048U));
+} // namespace
+
+using NEEmbeddingBagFixture = EmbeddingBagFixture<Tensor, NEEmbeddingBag, Accessor>;
+using NEGatherReductionFixture = GatherReductionFixture<Tensor, NEGather, NEReductionOperation, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(EmbeddingBag)
+REGISTER_FIXTURE_DATA_TEST_CASE(RandomRows,
+                                NEEmbeddingBagFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(table_shapes,
+                                                            bags,
+                                                            framework::dataset::make("DataType",
+                                                                                     {DataType::F32, DataType::F16,
+                                                                                      DataType::S8})));
+REGISTER_FIXTURE_DATA_TEST_CASE(GatherReductionBaseline,
+                                NEGatherReductionFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(table_shapes,
+                                                            bags,
+                                                            framework::dataset::make("DataType", DataType::F32)));
+TEST_SUITE_END() // EmbeddingBag
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** Transformer projections: a single row is the decode case, 128 rows a prompt */
+const auto sparse24_fc_shapes = framework::dataset::zip(
+    framework::dataset::make("InputShape",
+                             {TensorShape(768U, 1U), TensorShape(768U, 128U), TensorShape(3072U, 128U),
+                              TensorShape(4096U, 1U), TensorShape(4096U, 32U)}),
+    framework::dataset::make("NumOutputs", {3072U, 3072U, 768U, 4096U, 4096U}));
+
+/** UNSPECIFIED runs the dense kernels on the same pruned weights */
+const auto weight_formats =
+    framework::dataset::make("WeightFormat", {WeightFormat::UNSPECIFIED, WeightFormat::SPARSE_2_4});
+} // namespace
+
+using NEFullyConnectedLayerFixture = FullyConnectedLayerFixture<Tensor, NEFullyConnectedLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(FullyConnectedLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSparse24,
+                                NEFullyConnectedLayerFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(sparse24_fc_shapes,
+                                                            weight_formats,
+                                                            framework::dataset::make("DataType", DataType::F32)));
+TEST_SUITE_END() // FullyConnectedLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
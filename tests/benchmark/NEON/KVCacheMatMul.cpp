@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEKVCacheMatMul.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/KVCacheMatMulFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+using framework::dataset::make;
+
+using NEKVCacheMatMulFixture = KVCacheMatMulFixture<Tensor, NEKVCacheMatMul, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(KVCacheMatMul)
+/** Decode steps of 32 heads of 128 channels, early and late in a 4K context */
+REGISTER_FIXTURE_DATA_TEST_CASE(Decode,
+                                NEKVCacheMatMulFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(make("HeadDim", 128U),
+                                                            make("MaxLength", 4096U),
+                                                            make("Length", {512U, 4000U}),
+                                                            make("Batches", 32U),
+                                                            make("Operand",
+                                                                 {KVCacheOperand::Key, KVCacheOperand::Value}),
+                                                            make("DataType", {DataType::F32, DataType::F16})));
+TEST_SUITE_END() // KVCacheMatMul
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
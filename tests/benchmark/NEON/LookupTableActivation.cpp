@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELookupTableActivation.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/LookupTableActivationFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** Feed-forward activations of transformer layers: hidden size by number of tokens */
+const auto ffn_shapes = framework::dataset::make(
+    "Shape", {TensorShape(3072U, 128U), TensorShape(11008U, 32U), TensorShape(14336U, 512U), TensorShape(262144U)});
+} // namespace
+
+using NELookupTableActivationFixture = LookupTableActivationFixture<Tensor, NELookupTableActivation, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(LookupTableActivation)
+#ifdef __aarch64__
+REGISTER_FIXTURE_DATA_TEST_CASE(FeedForward,
+                                NELookupTableActivationFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(ffn_shapes,
+                                                            framework::dataset::make("DataType",
+                                                                                     {DataType::F16, DataType::QASYMM8,
+                                                                                      DataType::QASYMM8_SIGNED})));
+#endif // __aarch64__
+TEST_SUITE_END() // LookupTableActivation
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/ReductionOperationFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** Reductions along X of 1M+ elements with fewer rows than cores, which are split into chunks of X across threads */
+const auto long_x_shapes = framework::dataset::make(
+    "Shape", {TensorShape(1048576U), TensorShape(4194304U), TensorShape(16777216U), TensorShape(1048576U, 4U)});
+
+const auto reduction_ops = framework::dataset::make(
+    "ReductionOperation", {ReductionOperation::SUM, ReductionOperation::MAX, ReductionOperation::ARG_IDX_MAX});
+} // namespace
+
+using NEReductionOperationFixture = ReductionOperationFixture<Tensor, NEReductionOperation, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ReductionOperation)
+REGISTER_FIXTURE_DATA_TEST_CASE(LongX,
+                                NEReductionOperationFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(long_x_shapes,
+                                                            framework::dataset::make("Axis", 0U),
+                                                            reduction_ops,
+                                                            framework::dataset::make("DataType",
+                                                                                     {DataType::F32,
+                                                                                      DataType::QASYMM8})));
+TEST_SUITE_END() // ReductionOperation
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
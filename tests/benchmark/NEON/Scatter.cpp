@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEScatter.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/ScatterFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** As many updates as destination blocks, drawn from all, 1000 or 10 of the blocks: from few collisions to
+ * thousands of updates per destination
+ */
+const auto rows = framework::dataset::combine(framework::dataset::make("DstShape", TensorShape(64U, 100000U)),
+                                              framework::dataset::make("NumUpdates", 100000U),
+                                              framework::dataset::make("NumDestinations", {100000U, 1000U, 10U}));
+
+const auto scalars = framework::dataset::combine(framework::dataset::make("DstShape", TensorShape(1000000U)),
+                                                 framework::dataset::make("NumUpdates", 1000000U),
+                                                 framework::dataset::make("NumDestinations", {1000000U, 1000U, 10U}));
+
+const auto functions = framework::dataset::make("ScatterFunction",
+                                                {ScatterFunction::Add, ScatterFunction::Max, ScatterFunction::Mul});
+
+const auto data_types = framework::dataset::make("DataType", {DataType::F32, DataType::F16, DataType::S32});
+} // namespace
+
+using NEScatterFixture = ScatterFixture<Tensor, NEScatter, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(Scatter)
+REGISTER_FIXTURE_DATA_TEST_CASE(Rows,
+                                NEScatterFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(rows, data_types, functions));
+REGISTER_FIXTURE_DATA_TEST_CASE(Scalars,
+                                NEScatterFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(scalars, data_types, functions));
+TEST_SUITE_END() // Scatter
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NESoftmaxLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/SoftmaxLayerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Attention scores [keys, queries, heads, batches], normalised over the keys */
+const auto AttentionScoreShapes = make("Shape",
+                                       {TensorShape(128U, 128U, 12U), TensorShape(512U, 512U, 12U),
+                                        TensorShape(1024U, 64U, 8U, 2U), TensorShape(4096U, 1U, 32U)});
+
+/** Attention scores [queries, keys, heads, batches], normalised over the keys along Y with few queries along X */
+const auto TransposedAttentionScoreShapes = make("Shape",
+                                                 {TensorShape(1U, 4096U, 32U), TensorShape(8U, 2048U, 32U),
+                                                  TensorShape(64U, 512U, 12U, 2U)});
+} // namespace
+
+using NESoftmaxLayerFixture = SoftmaxLayerFixture<Tensor, NESoftmaxLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(SoftmaxLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunAttentionScores,
+                                NESoftmaxLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(AttentionScoreShapes,
+                                        make("Axis", 0),
+                                        make("DataType", {DataType::F32, DataType::F16})));
+/** The non-X softmax splits the work along the dimension with the most iterations rather than along X */
+REGISTER_FIXTURE_DATA_TEST_CASE(RunTransposedAttentionScores,
+                                NESoftmaxLayerFixture,
+                                framework::DatasetMode::ALL,
+                                combine(TransposedAttentionScoreShapes,
+                                        make("Axis", 1),
+                                        make("DataType", {DataType::F32, DataType::F16})));
+TEST_SUITE_END() // SoftmaxLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
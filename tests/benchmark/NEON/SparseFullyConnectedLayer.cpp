@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NESparseFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/SparseFullyConnectedLayerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** A single row is the latency bound decode case, 16 rows a small batch */
+const auto sparse_fc_shapes = framework::dataset::zip(
+    framework::dataset::make("InputShape", {TensorShape(1024U, 1U), TensorShape(1024U, 16U), TensorShape(4096U, 1U)}),
+    framework::dataset::make("NumOutputs", {1024U, 1024U, 4096U}));
+
+const auto block_shapes = framework::dataset::make(
+    "BlockShape", {SparseBlockShape::Block1x4, SparseBlockShape::Block4x4, SparseBlockShape::Block8x1});
+
+const auto sparsities = framework::dataset::make("Sparsity", {0.5f, 0.7f, 0.8f, 0.9f, 0.95f});
+
+/** 0 forces the dense path and 1 the sparse path */
+const auto max_densities = framework::dataset::make("MaxDensity", {0.f, 1.f});
+} // namespace
+
+using NESparseFullyConnectedLayerFixture =
+    SparseFullyConnectedLayerFixture<Tensor, NESparseFullyConnectedLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(SparseFullyConnectedLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall,
+                                NESparseFullyConnectedLayerFixture,
+                                framework::DatasetMode::ALL,
+                                framework::dataset::combine(sparse_fc_shapes,
+                                                            block_shapes,
+                                                            sparsities,
+                                                            max_densities,
+                                                            framework::dataset::make("DataType", DataType::F32)));
+TEST_SUITE_END() // SparseFullyConnectedLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_DECONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_DECONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Shapes are given in NCHW order and permuted for NHWC */
+template <typename TensorType, typename Function, typename Accessor>
+class DeconvolutionLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape   src_shape,
+               TensorShape   weights_shape,
+               TensorShape   bias_shape,
+               TensorShape   dst_shape,
+               PadStrideInfo info,
+               DataType      data_type,
+               DataLayout    data_layout)
+    {
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Quantized deconvolutions take S32 biases
+        const bool             is_quantized = is_data_type_quantized_asymmetric(data_type);
+        const QuantizationInfo qinfo        = is_quantized ? QuantizationInfo(1.f / 255.f, 10) : QuantizationInfo();
+        const DataType         bias_type    = is_quantized ? DataType::S32 : data_type;
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo, data_layout);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1, qinfo, data_layout);
+        bias    = create_tensor<TensorType>(bias_shape, bias_type, 1, QuantizationInfo(), data_layout);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo, data_layout);
+
+        // Create and configure function
+        deconv.configure(&src, &weights, &bias, &dst, info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(bias), 2);
+
+        // Reshape the weights outside of the timed runs
+        deconv.prepare();
+    }
+
+    void run()
+    {
+        deconv.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        bias.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType bias{};
+    TensorType dst{};
+    Function   deconv{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_DECONVOLUTIONLAYERFIXTURE_H
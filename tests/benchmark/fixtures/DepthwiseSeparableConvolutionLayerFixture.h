@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Depthwise convolution followed by a 1x1 convolution, either fused or as two separate functions
+ *
+ * Shapes are given in NHWC order.
+ */
+template <typename TensorType,
+          typename FusedFunction,
+          typename DepthwiseFunction,
+          typename ConvolutionFunction,
+          typename Accessor>
+class DepthwiseSeparableConvolutionLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape   src_shape,
+               TensorShape   dwc_weights_shape,
+               TensorShape   pwc_weights_shape,
+               TensorShape   dst_shape,
+               PadStrideInfo info,
+               DataType      data_type,
+               bool          fused)
+    {
+        TensorShape dwc_dst_shape = dst_shape;
+        dwc_dst_shape.set(0, src_shape[0]);
+
+        const ActivationLayerInfo relu6(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+
+        // Create tensors
+        src         = create_tensor<TensorType>(src_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        dwc_weights = create_tensor<TensorType>(dwc_weights_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        dwc_bias    = create_tensor<TensorType>(TensorShape(src_shape[0]), data_type, 1);
+        pwc_weights = create_tensor<TensorType>(pwc_weights_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        pwc_bias    = create_tensor<TensorType>(TensorShape(dst_shape[0]), data_type, 1);
+        dst         = create_tensor<TensorType>(dst_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        // Create and configure the functions
+        _fused = fused;
+        if (_fused)
+        {
+            fused_conv.configure(&src, &dwc_weights, &dwc_bias, &pwc_weights, &pwc_bias, &dst, info, 1, relu6);
+        }
+        else
+        {
+            dwc_dst = create_tensor<TensorType>(dwc_dst_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+            dwc_conv.configure(&src, &dwc_weights, &dwc_bias, &dwc_dst, info, 1, relu6);
+            pwc_conv.configure(&dwc_dst, &pwc_weights, &pwc_bias, &dst, PadStrideInfo(1, 1, 0, 0));
+            dwc_dst.allocator()->allocate();
+        }
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dwc_weights.allocator()->allocate();
+        dwc_bias.allocator()->allocate();
+        pwc_weights.allocator()->allocate();
+        pwc_bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(dwc_weights), 1);
+        library->fill_tensor_uniform(Accessor(dwc_bias), 2);
+        library->fill_tensor_uniform(Accessor(pwc_weights), 3);
+        library->fill_tensor_uniform(Accessor(pwc_bias), 4);
+
+        // Reshape the weights outside of the timed runs
+        if (_fused)
+        {
+            fused_conv.prepare();
+        }
+        else
+        {
+            dwc_conv.prepare();
+            pwc_conv.prepare();
+        }
+    }
+
+    void run()
+    {
+        if (_fused)
+        {
+            fused_conv.run();
+        }
+        else
+        {
+            dwc_conv.run();
+            pwc_conv.run();
+        }
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        dwc_weights.allocator()->free();
+        dwc_bias.allocator()->free();
+        pwc_weights.allocator()->free();
+        pwc_bias.allocator()->free();
+        dwc_dst.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType          src{};
+    TensorType          dwc_weights{};
+    TensorType          dwc_bias{};
+    TensorType          pwc_weights{};
+    TensorType          pwc_bias{};
+    TensorType          dwc_dst{};
+    TensorType          dst{};
+    FusedFunction       fused_conv{};
+    DepthwiseFunction   dwc_conv{};
+    ConvolutionFunction pwc_conv{};
+    bool                _fused{false};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
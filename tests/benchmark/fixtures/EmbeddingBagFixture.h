@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_EMBEDDINGBAGFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_EMBEDDINGBAGFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Sum pooling of @p num_bags bags of @p bag_size random rows with an embedding bag */
+template <typename TensorType, typename Function, typename Accessor>
+class EmbeddingBagFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape table_shape, unsigned int bag_size, unsigned int num_bags, DataType data_type)
+    {
+        // Create tensors
+        table   = create_tensor<TensorType>(table_shape, data_type);
+        indices = create_tensor<TensorType>(TensorShape(bag_size * num_bags), DataType::S32);
+        offsets = create_tensor<TensorType>(TensorShape(num_bags), DataType::S32);
+        scales  = create_tensor<TensorType>(TensorShape(table_shape[1]), DataType::F32);
+
+        // Create and configure function
+        embedding_bag.configure(&table, &indices, &offsets, &dst, EmbeddingBagInfo(),
+                                data_type == DataType::S8 ? &scales : nullptr);
+
+        // Allocate tensors
+        table.allocator()->allocate();
+        indices.allocator()->allocate();
+        offsets.allocator()->allocate();
+        scales.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        std::vector<int32_t> bag_offsets(num_bags);
+        for (unsigned int b = 0; b < num_bags; ++b)
+        {
+            bag_offsets[b] = b * bag_size;
+        }
+        std::uniform_int_distribution<int32_t> row_distribution(0, table_shape[1] - 1);
+        std::uniform_real_distribution<float>  scale_distribution(0.5f, 1.5f);
+
+        library->fill_tensor_uniform(Accessor(table), 0);
+        library->fill(Accessor(indices), row_distribution, 1);
+        library->fill_static_values(Accessor(offsets), bag_offsets);
+        library->fill(Accessor(scales), scale_distribution, 2);
+    }
+
+    void run()
+    {
+        embedding_bag.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        table.allocator()->free();
+        indices.allocator()->free();
+        offsets.allocator()->free();
+        scales.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType table{};
+    TensorType indices{};
+    TensorType offsets{};
+    TensorType scales{};
+    TensorType dst{};
+    Function   embedding_bag{};
+};
+
+/** Same pooling as @ref EmbeddingBagFixture, as a gather of all the rows followed by a sum over every bag
+ *
+ * This is the baseline for the embedding bag: the gathered rows are written to memory and read back.
+ */
+template <typename TensorType, typename Gather, typename Reduction, typename Accessor>
+class GatherReductionFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape table_shape, unsigned int bag_size, unsigned int num_bags, DataType data_type)
+    {
+        // Create tensors
+        table   = create_tensor<TensorType>(table_shape, data_type);
+        indices = create_tensor<TensorType>(TensorShape(bag_size, num_bags), DataType::S32);
+
+        // Create and configure functions: gather to [dim, bag_size, num_bags], then sum along the bags
+        gather.configure(&table, &indices, &rows, 1);
+        reduction.configure(&rows, &dst, 1, ReductionOperation::SUM);
+
+        // Allocate tensors
+        table.allocator()->allocate();
+        indices.allocator()->allocate();
+        rows.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        std::uniform_int_distribution<int32_t> row_distribution(0, table_shape[1] - 1);
+
+        library->fill_tensor_uniform(Accessor(table), 0);
+        library->fill(Accessor(indices), row_distribution, 1);
+    }
+
+    void run()
+    {
+        gather.run();
+        reduction.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        table.allocator()->free();
+        indices.allocator()->free();
+        rows.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType table{};
+    TensorType indices{};
+    TensorType rows{};
+    TensorType dst{};
+    Gather     gather{};
+    Reduction  reduction{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_EMBEDDINGBAGFIXTURE_H
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_FULLYCONNECTEDLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_FULLYCONNECTEDLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running a fully connected layer on weights pruned to a 2:4 structured sparsity pattern
+ *
+ * The weights always keep two values in every group of four inputs, so running the same shape with
+ * WeightFormat::UNSPECIFIED and WeightFormat::SPARSE_2_4 compares the dense and the sparse kernels on identical data.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class FullyConnectedLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape input_shape, unsigned int num_outputs, WeightFormat weight_format, DataType data_type)
+    {
+        const unsigned int num_inputs = input_shape.x();
+
+        // Create tensors
+        src     = create_tensor<TensorType>(input_shape, data_type);
+        weights = create_tensor<TensorType>(TensorShape(num_inputs, num_outputs), data_type);
+        bias    = create_tensor<TensorType>(TensorShape(num_outputs), data_type);
+        dst     = create_tensor<TensorType>(TensorShape(num_outputs, input_shape.y()), data_type);
+
+        WeightsInfo weights_info;
+        weights_info.set_weight_format(weight_format);
+
+        // Create and configure function
+        fc_layer.configure(&src, &weights, &bias, &dst, FullyConnectedLayerInfo(), weights_info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        library->fill(Accessor(src), distribution, 0);
+        library->fill(Accessor(weights), distribution, 1);
+        library->fill(Accessor(bias), distribution, 2);
+
+        // Zero two values in every group of four along the input dimension
+        std::mt19937                       generator(library->seed());
+        std::uniform_int_distribution<int> first_kept(0, 3);
+        Accessor                           weights_accessor(weights);
+        for (unsigned int n = 0; n < num_outputs; ++n)
+        {
+            for (unsigned int k = 0; k < num_inputs; k += 4)
+            {
+                const unsigned int first = first_kept(generator);
+                for (unsigned int c = 0; c < 4 && k + c < num_inputs; ++c)
+                {
+                    if (c != first && c != (first + 2) % 4)
+                    {
+                        *reinterpret_cast<float *>(weights_accessor(Coordinates(k + c, n))) = 0.f;
+                    }
+                }
+            }
+        }
+
+        // Compress or reshape the weights outside of the measured runs
+        fc_layer.prepare();
+    }
+
+    void run()
+    {
+        fc_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        bias.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType bias{};
+    TensorType dst{};
+    Function   fc_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_FULLYCONNECTEDLAYERFIXTURE_H
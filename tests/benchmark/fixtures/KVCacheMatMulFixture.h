@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_KVCACHEMATMULFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_KVCACHEMATMULFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Decode step of attention against a cache holding @p length rows
+ *
+ * The cache is filled once in setup(): every run multiplies a single row per batch against the active length, which
+ * is the cost of a decode step once appending the new row is left aside.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class KVCacheMatMulFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int   head_dim,
+               unsigned int   max_length,
+               unsigned int   length,
+               unsigned int   batches,
+               KVCacheOperand operand,
+               DataType       data_type)
+    {
+        const KVCacheMatMulInfo info(operand, head_dim, max_length);
+        const unsigned int      width = (operand == KVCacheOperand::Key) ? head_dim : max_length;
+
+        // Create tensors
+        lhs  = create_tensor<TensorType>(TensorShape(width, 1U, batches), data_type);
+        rows = create_tensor<TensorType>(TensorShape(head_dim, length, batches), data_type);
+
+        // Create and configure function
+        kv_matmul.configure(&lhs, &dst, info);
+
+        // Allocate tensors
+        lhs.allocator()->allocate();
+        rows.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(lhs), 0);
+        library->fill_tensor_uniform(Accessor(rows), 1);
+
+        // Fill the cache up to the context length
+        kv_matmul.append(&rows);
+    }
+
+    void run()
+    {
+        kv_matmul.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        lhs.allocator()->free();
+        rows.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType lhs{};
+    TensorType rows{};
+    TensorType dst{};
+    Function   kv_matmul{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_KVCACHEMATMULFIXTURE_H
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_LOOKUPTABLEACTIVATIONFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_LOOKUPTABLEACTIVATIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/LookupTableActivationInfo.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Mish applied through a lookup table to every element of @p shape
+ *
+ * The run time does not depend on the function: every element costs a table lookup.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class LookupTableActivationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        const QuantizationInfo qinfo = is_data_type_quantized(data_type) ? QuantizationInfo(0.05f, 10)
+                                                                         : QuantizationInfo();
+
+        // Create tensors
+        src = create_tensor<TensorType>(shape, data_type, 1, qinfo);
+        dst = create_tensor<TensorType>(shape, data_type, 1, qinfo);
+
+        // Create and configure function
+        act.configure(&src, &dst,
+                      LookupTableActivationInfo([](float x) { return x * std::tanh(std::log1p(std::exp(x))); }));
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+    }
+
+    void run()
+    {
+        act.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType dst{};
+    Function   act{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_LOOKUPTABLEACTIVATIONFIXTURE_H
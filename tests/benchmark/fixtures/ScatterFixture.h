@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_SCATTERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_SCATTERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ScatterInfo.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** In-place scatter of @p num_updates updates into @p num_destinations destinations along the highest dimension */
+template <typename TensorType, typename Function, typename Accessor>
+class ScatterFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape     dst_shape,
+               unsigned int    num_updates,
+               unsigned int    num_destinations,
+               DataType        data_type,
+               ScatterFunction func)
+    {
+        TensorShape updates_shape = dst_shape;
+        updates_shape.set(dst_shape.num_dimensions() - 1, num_updates);
+
+        // Create tensors
+        dst     = create_tensor<TensorType>(dst_shape, data_type);
+        updates = create_tensor<TensorType>(updates_shape, data_type);
+        indices = create_tensor<TensorType>(TensorShape(1U, num_updates), DataType::S32);
+
+        // Create and configure function
+        scatter.configure(&dst, &updates, &indices, &dst, ScatterInfo(func, false));
+
+        // Allocate tensors
+        dst.allocator()->allocate();
+        updates.allocator()->allocate();
+        indices.allocator()->allocate();
+
+        // Factors close to one keep the products of repeated runs away from overflow and denormals
+        std::uniform_int_distribution<int32_t> index_distribution(0, num_destinations - 1);
+        std::uniform_real_distribution<float>  factor_distribution(0.999f, 1.001f);
+
+        library->fill_tensor_uniform(Accessor(dst), 0);
+        if (func == ScatterFunction::Mul && is_data_type_float(data_type))
+        {
+            library->fill(Accessor(updates), factor_distribution, 1);
+        }
+        else
+        {
+            library->fill_tensor_uniform(Accessor(updates), 1);
+        }
+        library->fill(Accessor(indices), index_distribution, 2);
+    }
+
+    void run()
+    {
+        scatter.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        dst.allocator()->free();
+        updates.allocator()->free();
+        indices.allocator()->free();
+    }
+
+private:
+    TensorType dst{};
+    TensorType updates{};
+    TensorType indices{};
+    Function   scatter{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_SCATTERFIXTURE_H
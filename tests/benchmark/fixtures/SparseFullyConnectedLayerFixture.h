@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_SPARSEFULLYCONNECTEDLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_SPARSEFULLYCONNECTEDLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running a sparse fully connected layer with whole blocks of the weights zeroed
+ *
+ * @p max_density selects the path independently of @p sparsity: 0 always runs dense and 1 always runs sparse, which
+ * gives the crossover point to tune @ref SparseFullyConnectedLayerInfo::max_density.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class SparseFullyConnectedLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape      input_shape,
+               unsigned int     num_outputs,
+               SparseBlockShape block_shape,
+               float            sparsity,
+               float            max_density,
+               DataType         data_type)
+    {
+        SparseFullyConnectedLayerInfo info{};
+        info.block_shape = block_shape;
+        info.max_density = max_density;
+
+        const unsigned int num_inputs = input_shape.x();
+
+        // Create tensors
+        src     = create_tensor<TensorType>(input_shape, data_type);
+        weights = create_tensor<TensorType>(TensorShape(num_inputs, num_outputs), data_type);
+        bias    = create_tensor<TensorType>(TensorShape(num_outputs), data_type);
+        dst     = create_tensor<TensorType>(TensorShape(num_outputs, input_shape.y()), data_type);
+
+        // Create and configure function
+        fc_layer.configure(&src, &weights, &bias, &dst, info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        library->fill(Accessor(src), distribution, 0);
+        library->fill(Accessor(weights), distribution, 1);
+        library->fill(Accessor(bias), distribution, 2);
+
+        const unsigned int bh = (block_shape == SparseBlockShape::Block1x4) ? 1U
+                                : (block_shape == SparseBlockShape::Block4x4) ? 4U
+                                                                              : 8U;
+        const unsigned int bw = (block_shape == SparseBlockShape::Block8x1) ? 1U : 4U;
+
+        std::mt19937                generator(library->seed());
+        std::bernoulli_distribution drop(sparsity);
+        Accessor                    weights_accessor(weights);
+        for (unsigned int n = 0; n < num_outputs; n += bh)
+        {
+            for (unsigned int k = 0; k < num_inputs; k += bw)
+            {
+                if (!drop(generator))
+                {
+                    continue;
+                }
+                for (unsigned int r = 0; r < bh; ++r)
+                {
+                    for (unsigned int c = 0; c < bw; ++c)
+                    {
+                        *reinterpret_cast<float *>(weights_accessor(Coordinates(k + c, n + r))) = 0.f;
+                    }
+                }
+            }
+        }
+
+        // Compress the weights outside of the measured runs
+        fc_layer.prepare();
+    }
+
+    void run()
+    {
+        fc_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        bias.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType bias{};
+    TensorType dst{};
+    Function   fc_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_SPARSEFULLYCONNECTEDLAYERFIXTURE_H
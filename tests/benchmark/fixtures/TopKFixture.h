@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_TOPKFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_TOPKFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Selection of the top-k values and indices of every row of @p shape along X */
+template <typename TensorType, typename Function, typename Accessor>
+class TopKFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, unsigned int k, DataType data_type)
+    {
+        // Create tensors
+        src = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        topk.configure(&src, &values, &indices, k);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        values.allocator()->allocate();
+        indices.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+    }
+
+    void run()
+    {
+        topk.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(values);
+        sync_tensor_if_necessary<TensorType>(indices);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        values.allocator()->free();
+        indices.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType values{};
+    TensorType indices{};
+    Function   topk{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_TOPKFIXTURE_H
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_WINOGRADCONVOLUTIONLAYERQUANTIZEDFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_WINOGRADCONVOLUTIONLAYERQUANTIZEDFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture for the quantized Winograd convolution operator
+ *
+ * Shapes are given in NCHW order and permuted for NHWC, the only layout of the operator.
+ */
+template <typename TensorType, typename Operator, typename Accessor>
+class WinogradConvolutionLayerQuantizedFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape   src_shape,
+               TensorShape   weights_shape,
+               TensorShape   bias_shape,
+               TensorShape   dst_shape,
+               PadStrideInfo info,
+               DataType      data_type)
+    {
+        permute(src_shape, PermutationVector(2U, 0U, 1U));
+        permute(weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(dst_shape, PermutationVector(2U, 0U, 1U));
+
+        const QuantizationInfo qinfo(1.f / 255.f, 10);
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo, DataLayout::NHWC);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1, qinfo, DataLayout::NHWC);
+        bias    = create_tensor<TensorType>(bias_shape, DataType::S32, 1, QuantizationInfo(), DataLayout::NHWC);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo, DataLayout::NHWC);
+
+        // Create and configure the operator
+        conv = std::make_unique<Operator>();
+        conv->configure(src.info(), weights.info(), bias.info(), dst.info(), info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(bias), 2);
+
+        run_pack  = {{arm_compute::TensorType::ACL_SRC_0, &src},
+                     {arm_compute::TensorType::ACL_SRC_1, &weights},
+                     {arm_compute::TensorType::ACL_SRC_2, &bias},
+                     {arm_compute::TensorType::ACL_DST, &dst}};
+        prep_pack = {{arm_compute::TensorType::ACL_SRC_1, &weights}, {arm_compute::TensorType::ACL_SRC_2, &bias}};
+        workspace = manage_workspace<TensorType>(conv->workspace(), memory_group, run_pack, prep_pack);
+
+        // Transform the weights outside of the timed runs
+        conv->prepare(prep_pack);
+    }
+
+    void run()
+    {
+        conv->run(run_pack);
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        workspace.clear();
+        src.allocator()->free();
+        weights.allocator()->free();
+        bias.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType                src{};
+    TensorType                weights{};
+    TensorType                bias{};
+    TensorType                dst{};
+    std::unique_ptr<Operator> conv{};
+    MemoryGroup               memory_group{};
+    ITensorPack               run_pack{};
+    ITensorPack               prep_pack{};
+    WorkspaceData<TensorType> workspace{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_WINOGRADCONVOLUTIONLAYERQUANTIZEDFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -138,6 +138,21 @@ public:
     }
 };
 
+// Few output blocks with a long K: when run with at least four threads these
+// shapes are split along K by the hybrid and GEMV kernels.
+class SmallGEMMSplitKDataset final : public GEMMDataset
+{
+public:
+    SmallGEMMSplitKDataset()
+    {
+        add_config(TensorShape(2048U), TensorShape(23U, 2048U), TensorShape(23U), TensorShape(23U), 1.0f, 1.0f);
+        add_config(TensorShape(3001U, 4U), TensorShape(17U, 3001U), TensorShape(17U), TensorShape(17U, 4U), 1.0f,
+                   1.0f);
+        add_config(TensorShape(4097U, 7U), TensorShape(33U, 4097U), TensorShape(33U), TensorShape(33U, 7U), 1.0f,
+                   1.0f);
+    }
+};
+
 // These shapes have been experimentally determined to hit a combination of
 // fixed-format interleaved and fixed-format hybrid kernels when run with <=16
 // threads. May need to be update if the heuristics change.
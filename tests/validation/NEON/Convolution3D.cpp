@@ -73,6 +73,23 @@ const auto data_precommit = combine(zip(datasets::SmallDirectConv3DShapes(),
                                         make("NumKernels", {2, 3, 8})),
                                     make("HasBias", {true, false}),
                                     ActivationFunctionsDataset);
+
+/** Shapes with enough input and output channels to run as an indirect GEMM */
+const auto data_gemm_precommit = combine(zip(make("InputShape",
+                                                  {TensorShape(16U, 9U, 7U, 5U, 2U), TensorShape(24U, 11U, 6U, 8U),
+                                                   TensorShape(8U, 5U, 5U, 5U)}),
+                                             make("StrideX", {1, 2, 1}),
+                                             make("StrideY", {1, 1, 2}),
+                                             make("StrideZ", {1, 2, 1}),
+                                             make("PadX", {1, 0, 2}),
+                                             make("PadY", {1, 2, 0}),
+                                             make("PadZ", {1, 1, 0}),
+                                             make("KernelWidth", {3, 3, 5}),
+                                             make("KernelHeight", {3, 1, 3}),
+                                             make("KernelDepth", {3, 2, 1}),
+                                             make("NumKernels", {16, 9, 33})),
+                                         make("HasBias", {true, false}),
+                                         ActivationFunctionsDataset);
 } // namespace
 
 TEST_SUITE(NEON)
@@ -143,6 +160,16 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGemm,
+                       NEDirectConvolution3DFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data_gemm_precommit,
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NDHWC})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -165,6 +192,24 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
         framework::ARM_COMPUTE_PRINT_WARNING();
     }
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGemm,
+                       NEDirectConvolution3DFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data_gemm_precommit,
+                               make("DataType", DataType::F16),
+                               make("DataLayout", {DataLayout::NDHWC})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 
@@ -202,6 +247,31 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
 {
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGemm,
+                       NEDirectConvolution3DQuantizedFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(zip(make("InputShape",
+                                        {TensorShape(16U, 9U, 7U, 5U, 2U), TensorShape(24U, 11U, 6U, 8U)}),
+                                   make("StrideX", {1, 2}),
+                                   make("StrideY", {1, 1}),
+                                   make("StrideZ", {1, 2}),
+                                   make("PadX", {1, 0}),
+                                   make("PadY", {1, 2}),
+                                   make("PadZ", {1, 1}),
+                                   make("KernelWidth", {3, 3}),
+                                   make("KernelHeight", {3, 1}),
+                                   make("KernelDepth", {3, 2}),
+                                   make("NumKernels", {16, 9}),
+                                   make("HasBias", {true, false})),
+                               make("Activation", ActivationLayerInfo()),
+                               make("DataType", DataType::QASYMM8),
+                               make("DataLayout", DataLayout::NDHWC),
+                               make("SrcQuantizationInfo", QuantizationInfo(0.1f, 10)),
+                               make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20)),
+                               make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 
 TEST_SUITE_END() // QASYMM8
 
@@ -232,6 +302,31 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
 {
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGemm,
+                       NEDirectConvolution3DQuantizedFixture<int8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(zip(make("InputShape",
+                                        {TensorShape(16U, 9U, 7U, 5U, 2U), TensorShape(24U, 11U, 6U, 8U)}),
+                                   make("StrideX", {1, 2}),
+                                   make("StrideY", {1, 1}),
+                                   make("StrideZ", {1, 2}),
+                                   make("PadX", {1, 0}),
+                                   make("PadY", {1, 2}),
+                                   make("PadZ", {1, 1}),
+                                   make("KernelWidth", {3, 3}),
+                                   make("KernelHeight", {3, 1}),
+                                   make("KernelDepth", {3, 2}),
+                                   make("NumKernels", {16, 9}),
+                                   make("HasBias", {true, false})),
+                               make("Activation", ActivationLayerInfo()),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("DataLayout", DataLayout::NDHWC),
+                               make("SrcQuantizationInfo", QuantizationInfo(0.1f, 10)),
+                               make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20)),
+                               make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 
 TEST_SUITE_END() // QASYMM8_SIGNED
 TEST_SUITE_END() // Quantized
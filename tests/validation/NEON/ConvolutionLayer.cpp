@@ -26,14 +26,19 @@
 #include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/MemoryHelpers.h"
+#include "src/core/NEON/kernels/assembly/winograd.hpp"
+#include "src/cpu/operators/CpuConv2d.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
+#include "src/cpu/operators/CpuWinogradConv2dQuantized.h"
+#include "tests/datasets/DilatedConvolutionLayerDataset.h"
 #include "tests/datasets/LargeConvolutionLayerDataset.h"
 #include "tests/datasets/SmallConvolutionLayerDataset.h"
 #include "tests/framework/Asserts.h"
@@ -220,6 +225,43 @@ DATA_TEST_CASE(SupportedTypes,
     ARM_COMPUTE_EXPECT(bool(status) == expected_const, framework::LogLevel::ERRORS);
 }
 
+/** Grouped convolutions are run natively by @ref NEConvolutionLayer for NHWC tensors only
+ *
+ * Checks performed in order:
+ * - Grouped NHWC convolutions validate
+ * - Grouped NCHW convolutions and mismatching group sizes are rejected
+ */
+DATA_TEST_CASE(ValidateGrouped,
+               framework::DatasetMode::ALL,
+               zip(make("DataLayout", {DataLayout::NHWC, DataLayout::NCHW, DataLayout::NHWC}),
+                   make("NumGroups", {2U, 2U, 3U}),
+                   make("Expected", {true, false, false})),
+               data_layout,
+               num_groups,
+               expected)
+{
+    const bool  is_nhwc = data_layout == DataLayout::NHWC;
+    TensorShape input_shape(8U, 8U, 4U);
+    TensorShape weights_shape(3U, 3U, 2U, 6U);
+    TensorShape output_shape(6U, 6U, 6U);
+    if (is_nhwc)
+    {
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+        permute(weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(output_shape, PermutationVector(2U, 0U, 1U));
+    }
+
+    const TensorInfo input_info(input_shape, 1, DataType::F32, data_layout);
+    const TensorInfo weights_info(weights_shape, 1, DataType::F32, data_layout);
+    const TensorInfo output_info(output_shape, 1, DataType::F32, data_layout);
+
+    const Status status =
+        NEConvolutionLayer::validate(&input_info, &weights_info, nullptr, &output_info, PadStrideInfo(1, 1, 0, 0),
+                                     WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), false, num_groups);
+
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(
@@ -264,6 +306,138 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(
     ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
 }
 
+/** Test case for the selection of the method of dilated convolutions
+ *
+ * Checks performed in order:
+ * - NHWC dilated convolutions use GEMM_CONV2D when the indirect GEMM supports them
+ * - NCHW dilated convolutions use GEMM
+ */
+TEST_CASE(DilatedConvolutionMethod, framework::DatasetMode::ALL)
+{
+    const Size2D        dilation(2U, 2U);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+    for (const auto data_layout : {DataLayout::NHWC, DataLayout::NCHW})
+    {
+        TensorShape src_shape(18U, 18U, 32U);
+        TensorShape wei_shape(3U, 3U, 32U, 16U);
+        TensorShape dst_shape(14U, 14U, 16U);
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(wei_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+        const TensorInfo src_info(src_shape, 1, DataType::F32, data_layout);
+        const TensorInfo wei_info(wei_shape, 1, DataType::F32, data_layout);
+        const TensorInfo dst_info(dst_shape, 1, DataType::F32, data_layout);
+
+        const bool indirect_validates = bool(cpu::CpuGemmDirectConv2d::validate(
+            &src_info, &wei_info, nullptr, &dst_info, Conv2dInfo(conv_info, dilation, ActivationLayerInfo(), false, 1)));
+        const ConvolutionMethod expected = (data_layout == DataLayout::NHWC && indirect_validates)
+                                               ? ConvolutionMethod::GEMM_CONV2D
+                                               : ConvolutionMethod::GEMM;
+        const ConvolutionMethod method = NEConvolutionLayer::get_convolution_method(
+            &src_info, &wei_info, &dst_info, conv_info, WeightsInfo(), dilation, ActivationLayerInfo(), false);
+        ARM_COMPUTE_EXPECT(method == expected, framework::LogLevel::ERRORS);
+    }
+}
+
+/** Test case for @ref NEConvolutionMethodTuner
+ *
+ * Checks performed in order:
+ * - The tuned method is one of the methods supporting the configuration and it is recorded in the table
+ * - Known configurations are served from the table, even when tuning is disabled
+ * - @ref NEConvolutionLayer runs with the method picked by the tuner
+ */
+TEST_CASE(TunedConvolutionMethod, framework::DatasetMode::ALL)
+{
+    TensorInfo src_info(TensorShape(32U, 12U, 12U), 1, DataType::F32, DataLayout::NHWC);
+    TensorInfo wei_info(TensorShape(32U, 3U, 3U, 16U), 1, DataType::F32, DataLayout::NHWC);
+    TensorInfo bia_info(TensorShape(16U), 1, DataType::F32, DataLayout::NHWC);
+    TensorInfo dst_info(TensorShape(16U, 12U, 12U), 1, DataType::F32, DataLayout::NHWC);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    NEConvolutionMethodTuner tuner;
+    const ConvolutionMethod  tuned_method = tuner.get_convolution_method(&src_info, &wei_info, &bia_info, &dst_info, conv_info, WeightsInfo(),
+                                                                          Size2D(1U, 1U), ActivationLayerInfo(), false);
+    const auto supported_methods = cpu::CpuConv2d::get_supported_convolution_methods(&src_info, &wei_info, &bia_info, &dst_info, conv_info);
+    ARM_COMPUTE_EXPECT(std::find(supported_methods.begin(), supported_methods.end(), tuned_method) != supported_methods.end(), framework::LogLevel::ERRORS);
+
+    const std::string config_id = NEConvolutionMethodTuner::config_id(&src_info, &wei_info, &bia_info, &dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), false);
+    ARM_COMPUTE_ASSERT(tuner.convolution_methods_table().count(config_id) == 1);
+    ARM_COMPUTE_EXPECT(tuner.convolution_methods_table().at(config_id) == tuned_method, framework::LogLevel::ERRORS);
+
+    tuner.set_tune_new_configs(false);
+    tuner.add_convolution_method(config_id, ConvolutionMethod::GEMM);
+    ARM_COMPUTE_EXPECT(tuner.get_convolution_method(&src_info, &wei_info, &bia_info, &dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), false)
+                       == ConvolutionMethod::GEMM,
+                       framework::LogLevel::ERRORS);
+
+    auto src = create_tensor<Tensor>(src_info);
+    auto wei = create_tensor<Tensor>(wei_info);
+    auto bia = create_tensor<Tensor>(bia_info);
+    auto dst = create_tensor<Tensor>(dst_info);
+
+    NEConvolutionLayer conv(nullptr, &tuner);
+    conv.configure(&src, &wei, &bia, &dst, conv_info);
+
+    src.allocator()->allocate();
+    wei.allocator()->allocate();
+    bia.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_value(Accessor(src), 1.f);
+    library->fill_tensor_value(Accessor(wei), 1.f);
+    library->fill_tensor_value(Accessor(bia), 0.f);
+
+    conv.run();
+
+    // Centre points see the full 3x3x32 window of ones
+    const Coordinates centre(0, 6, 6);
+    ARM_COMPUTE_EXPECT(*reinterpret_cast<float *>(dst.ptr_to_element(centre)) == 288.f, framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref NEConvolutionMethodTuner::config_id
+ *
+ * Checks performed in order:
+ * - Configurations differing only in their weights info get different identifiers
+ * - Configurations differing only in their quantization get different identifiers
+ * - Configurations differing only in their activation bounds get different identifiers
+ */
+TEST_CASE(TunerConfigId, framework::DatasetMode::ALL)
+{
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+    const TensorInfo    src_info(TensorShape(32U, 12U, 12U), 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo    wei_info(TensorShape(32U, 3U, 3U, 16U), 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo    dst_info(TensorShape(16U, 12U, 12U), 1, DataType::F32, DataLayout::NHWC);
+    const WeightsInfo   fixed_format(false, 3U, 3U, 16U, false, arm_compute::WeightFormat::OHWIo4);
+
+    const auto config_id = [&](const TensorInfo &src, const TensorInfo &wei, const TensorInfo &dst,
+                               const WeightsInfo &weights_info)
+    {
+        return NEConvolutionMethodTuner::config_id(&src, &wei, nullptr, &dst, conv_info, weights_info, Size2D(1U, 1U),
+                                                   ActivationLayerInfo(), false);
+    };
+
+    ARM_COMPUTE_EXPECT(config_id(src_info, wei_info, dst_info, WeightsInfo()) !=
+                           config_id(src_info, wei_info, dst_info, fixed_format),
+                       framework::LogLevel::ERRORS);
+
+    const TensorInfo src_q0(TensorShape(32U, 12U, 12U), 1, DataType::QASYMM8, QuantizationInfo(0.5f, 10));
+    const TensorInfo src_q1(TensorShape(32U, 12U, 12U), 1, DataType::QASYMM8, QuantizationInfo(0.25f, 10));
+    const TensorInfo wei_q(TensorShape(32U, 3U, 3U, 16U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 3));
+    const TensorInfo dst_q(TensorShape(16U, 12U, 12U), 1, DataType::QASYMM8, QuantizationInfo(1.f, 0));
+    ARM_COMPUTE_EXPECT(config_id(src_q0, wei_q, dst_q, WeightsInfo()) != config_id(src_q1, wei_q, dst_q, WeightsInfo()),
+                       framework::LogLevel::ERRORS);
+
+    const ActivationLayerInfo relu6(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f, 0.f);
+    const ActivationLayerInfo relu1(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 1.f, -1.f);
+    ARM_COMPUTE_EXPECT(NEConvolutionMethodTuner::config_id(&src_info, &wei_info, nullptr, &dst_info, conv_info,
+                                                           WeightsInfo(), Size2D(1U, 1U), relu6, false) !=
+                           NEConvolutionMethodTuner::config_id(&src_info, &wei_info, nullptr, &dst_info, conv_info,
+                                                               WeightsInfo(), Size2D(1U, 1U), relu1, false),
+                       framework::LogLevel::ERRORS);
+}
+
 #ifdef __aarch64__
 template <typename T>
 using NEConvolutionLayerQuantizedF32OutputFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEConvolutionLayer, T,false,float>;
@@ -439,6 +613,93 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for @ref cpu::CpuWinogradConv2dQuantized.
+ *
+ * Checks performed in order:
+ * - The quantized Winograd convolution matches @ref NEGEMMConvolutionLayer to within one quantization step
+ */
+DATA_TEST_CASE(Quantized,
+               framework::DatasetMode::ALL,
+               combine(make("DataType", {DataType::QASYMM8, DataType::QASYMM8_SIGNED}),
+                       make("PerChannelWeights", {false, true}),
+                       make("ActivationInfo",
+                            {ActivationLayerInfo(),
+                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)})),
+               data_type,
+               per_channel,
+               act_info)
+{
+    constexpr unsigned int ifm = 19U;
+    constexpr unsigned int ofm = 21U;
+    const PadStrideInfo    conv_info(1U, 1U, 1U, 1U);
+    const bool             is_signed = data_type == DataType::QASYMM8_SIGNED;
+
+    std::vector<float> weights_scales(ofm);
+    for (unsigned int i = 0; i < ofm; ++i)
+    {
+        weights_scales[i] = 0.01f + 0.005f * i;
+    }
+    const QuantizationInfo weights_qinfo =
+        per_channel ? QuantizationInfo(weights_scales) : QuantizationInfo(0.02f, is_signed ? -7 : 120);
+
+    auto src_info =
+        TensorInfo(TensorShape(ifm, 9U, 7U, 2U), 1, data_type, QuantizationInfo(0.5f, is_signed ? 5 : 130));
+    auto w_info = TensorInfo(TensorShape(ifm, 3U, 3U, ofm), 1,
+                             per_channel ? DataType::QSYMM8_PER_CHANNEL : data_type, weights_qinfo);
+    auto b_info = TensorInfo(TensorShape(ofm), 1, DataType::S32);
+    auto dst_info =
+        TensorInfo(TensorShape(ofm, 9U, 7U, 2U), 1, data_type, QuantizationInfo(0.8f, is_signed ? -3 : 110));
+    src_info.set_data_layout(DataLayout::NHWC);
+    w_info.set_data_layout(DataLayout::NHWC);
+    dst_info.set_data_layout(DataLayout::NHWC);
+
+    ARM_COMPUTE_EXPECT(bool(cpu::CpuWinogradConv2dQuantized::validate(&src_info, &w_info, &b_info, &dst_info,
+                                                                       conv_info, act_info)),
+                       framework::LogLevel::ERRORS);
+
+    auto src     = create_tensor<Tensor>(src_info);
+    auto w       = create_tensor<Tensor>(w_info);
+    auto b       = create_tensor<Tensor>(b_info);
+    auto dst     = create_tensor<Tensor>(dst_info);
+    auto ref_dst = create_tensor<Tensor>(dst_info);
+
+    NEGEMMConvolutionLayer gemm_conv;
+    gemm_conv.configure(&src, &w, &b, &ref_dst, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info);
+
+    auto winograd = std::make_unique<cpu::CpuWinogradConv2dQuantized>();
+    winograd->configure(&src_info, &w_info, &b_info, &dst_info, conv_info, act_info);
+
+    for (auto *t : {&src, &w, &b, &dst, &ref_dst})
+    {
+        t->allocator()->allocate();
+    }
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(w), 1);
+    library->fill_tensor_uniform(Accessor(b), 2, -2000, 2000);
+
+    ITensorPack run_pack{{TensorType::ACL_SRC_0, &src},
+                         {TensorType::ACL_SRC_1, &w},
+                         {TensorType::ACL_SRC_2, &b},
+                         {TensorType::ACL_DST, &dst}};
+    ITensorPack prep_pack{{TensorType::ACL_SRC_1, &w}, {TensorType::ACL_SRC_2, &b}};
+
+    auto mg = MemoryGroup{};
+    auto ws = manage_workspace<Tensor>(winograd->workspace(), mg, run_pack, prep_pack);
+    winograd->prepare(prep_pack);
+    winograd->run(run_pack);
+    gemm_conv.run();
+
+    const auto value_at = [&](const Tensor &t, size_t i)
+    {
+        return is_signed ? static_cast<int>(reinterpret_cast<const int8_t *>(t.buffer())[i])
+                         : static_cast<int>(reinterpret_cast<const uint8_t *>(t.buffer())[i]);
+    };
+    for (size_t i = 0; i < dst_info.tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(value_at(dst, i) - value_at(ref_dst, i)) <= 1, framework::LogLevel::ERRORS);
+    }
+}
+
 DATA_TEST_CASE(SupportedKernels,
                framework::DatasetMode::ALL,
                zip(make("WeightsInfo",
@@ -547,6 +808,32 @@ DATA_TEST_CASE(SupportedKernels,
 
 TEST_SUITE(FP32)
 
+/** Test case for the Winograd tile selection without fast math
+ *
+ * Checks that the F(6x6, 3x3) and F(1x8, 1x3) tiles are only picked in fast mode: without it the convolutions
+ * keep the F(4x4, 3x3) and F(1x6, 1x3) tiles.
+ */
+TEST_CASE(TileSelectionWithoutFastMath, framework::DatasetMode::ALL)
+{
+    arm_conv::winograd::WinogradConfig winograd_cfg;
+
+    const arm_conv::ConvolutionArgs args_3x3(1, arm_conv::Shape2D{24U, 24U}, 64U, 1U, 1U, arm_conv::Shape2D{24U, 24U},
+                                             64U, arm_conv::Shape2D{3U, 3U});
+    arm_conv::winograd::WinogradImpl impl_3x3{};
+    ARM_COMPUTE_ASSERT(arm_conv::winograd::get_implementation<float>(impl_3x3, &CPUInfo::get(), args_3x3, 1, false,
+                                                                     &winograd_cfg, nullptr));
+    ARM_COMPUTE_EXPECT(impl_3x3.output_transform->get_output_rows() == 4U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(impl_3x3.output_transform->get_output_cols() == 4U, framework::LogLevel::ERRORS);
+
+    const arm_conv::ConvolutionArgs args_1x3(1, arm_conv::Shape2D{32U, 34U}, 64U, 0U, 0U, arm_conv::Shape2D{32U, 32U},
+                                             64U, arm_conv::Shape2D{1U, 3U});
+    arm_conv::winograd::WinogradImpl impl_1x3{};
+    ARM_COMPUTE_ASSERT(arm_conv::winograd::get_implementation<float>(impl_1x3, &CPUInfo::get(), args_1x3, 1, false,
+                                                                     &winograd_cfg, nullptr));
+    ARM_COMPUTE_EXPECT(impl_1x3.output_transform->get_output_rows() == 1U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(impl_1x3.output_transform->get_output_cols() == 6U, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE(Conv1x3)
 FIXTURE_DATA_TEST_CASE(RunSmall,
                        NEWinogradConvolutionLayerFixture<float>,
@@ -559,6 +846,23 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, abs_tolerance_f32);
 }
+/// Large enough plane and channel count to select the 8x1 output tile in fast mode
+FIXTURE_DATA_TEST_CASE(RunLargeTile,
+                       NEWinogradConvolutionLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("Input", TensorShape(32U, 34U, 64U)),
+                               make("Weight", TensorShape(1U, 3U, 64U, 64U)),
+                               make("Bias", TensorShape(64U)),
+                               make("Output", TensorShape(32U, 32U, 64U)),
+                               make("PadStrideInfo", PadStrideInfo(1, 1, 0, 0)),
+                               make("Dilation", Size2D(1U, 1U)),
+                               make("DataType", {DataType::F32}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, abs_tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunMixedDataLayout,
                        NEWinogradConvolutionLayerMixedDataLayoutFixture<float>,
                        framework::DatasetMode::PRECOMMIT,
@@ -733,6 +1037,24 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     validate(Accessor(_target), _reference, abs_tolerance_f32);
 }
 
+/// Large enough plane and channel count to select the 6x6 output tile in fast mode
+FIXTURE_DATA_TEST_CASE(RunLargeTile,
+                       NEWinogradConvolutionLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("Input", TensorShape(24U, 24U, 64U)),
+                               make("Weight", TensorShape(3U, 3U, 64U, 64U)),
+                               make("Bias", TensorShape(64U)),
+                               make("Output", TensorShape(24U, 24U, 64U)),
+                               make("PadStrideInfo", PadStrideInfo(1, 1, 1, 1)),
+                               make("Dilation", Size2D(1U, 1U)),
+                               make("DataType", {DataType::F32}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, abs_tolerance_f32);
+}
+
 /// It's enough to run the activations for a single weight/input combination and data type because
 /// activation function is called on top of the winograd output as a separate operator
 /// TODO(COMPMID-6573): Enable after COMPMID-6573 is resolved
@@ -766,6 +1088,88 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
     // floating point arithmetic the Winograd results will not be exactly the same as direct convolution, especially for big shapes
     validate(Accessor(_target), _reference, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_f32));
 }
+
+/// Shapes whose Winograd-domain buffers exceed the cache, so the convolution is run in bands of tile rows
+FIXTURE_DATA_TEST_CASE(RunBands,
+                       NEWinogradConvolutionLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(zip(make("Input", {TensorShape(40U, 40U, 64U, 2U), TensorShape(39U, 41U, 48U, 2U)}),
+                                   make("Weight", {TensorShape(3U, 3U, 64U, 64U), TensorShape(3U, 3U, 48U, 40U)}),
+                                   make("Bias", {TensorShape(64U), TensorShape(40U)}),
+                                   make("Output", {TensorShape(40U, 40U, 64U, 2U), TensorShape(37U, 39U, 40U, 2U)}),
+                                   make("PadStrideInfo", {PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 0, 0)})),
+                               make("Dilation", Size2D(1U, 1U)),
+                               make("DataType", {DataType::F32}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_f32));
+}
+
+/** Test case for the banded execution of @ref cpu::CpuWinogradConv2d.
+ *
+ * The band height is forced, as the cache-size heuristic only bands convolutions too large for a unit test.
+ *
+ * Checks performed in order:
+ * - The operator runs more than one band
+ * - The banded output matches the output of the operator using its own band height
+ */
+TEST_CASE(ForcedBands, framework::DatasetMode::ALL)
+{
+    const auto          src_info = TensorInfo(TensorShape(64U, 40U, 40U, 2U), 1, DataType::F32, DataLayout::NHWC);
+    const auto          w_info   = TensorInfo(TensorShape(64U, 3U, 3U, 64U), 1, DataType::F32, DataLayout::NHWC);
+    const auto          b_info   = TensorInfo(TensorShape(64U), 1, DataType::F32, DataLayout::NHWC);
+    auto                dst_info = TensorInfo(TensorShape(64U, 40U, 40U, 2U), 1, DataType::F32, DataLayout::NHWC);
+    const PadStrideInfo pad_info(1, 1, 1, 1);
+
+    auto src = create_tensor<Tensor>(src_info);
+    auto w   = create_tensor<Tensor>(w_info);
+    auto b   = create_tensor<Tensor>(b_info);
+    src.allocator()->allocate();
+    w.allocator()->allocate();
+    b.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(w), 1, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(b), 2, -1.f, 1.f);
+
+    auto run_conv = [&](unsigned int band_tile_rows, unsigned int &num_bands) -> Tensor
+    {
+        auto winograd = std::make_unique<cpu::CpuWinogradConv2d>();
+        winograd->set_band_tile_rows(band_tile_rows);
+        winograd->configure(&src_info, &w_info, &b_info, &dst_info, pad_info);
+        num_bands = winograd->num_bands();
+
+        auto dst = create_tensor<Tensor>(dst_info);
+        dst.allocator()->allocate();
+
+        ITensorPack run_pack{{TensorType::ACL_SRC_0, &src},
+                             {TensorType::ACL_SRC_1, &w},
+                             {TensorType::ACL_SRC_2, &b},
+                             {TensorType::ACL_DST, &dst}};
+        ITensorPack prep_pack{{TensorType::ACL_SRC_1, &w}, {TensorType::ACL_SRC_2, &b}};
+
+        auto mg = MemoryGroup{};
+        auto ws = manage_workspace<Tensor>(winograd->workspace(), mg, run_pack, prep_pack);
+        winograd->prepare(prep_pack);
+        winograd->run(run_pack);
+        return dst;
+    };
+
+    unsigned int banded_bands  = 0;
+    unsigned int default_bands = 0;
+    auto         banded        = run_conv(3U, banded_bands);
+    auto         reference     = run_conv(0U, default_bands);
+
+    ARM_COMPUTE_EXPECT(banded_bands > 1, framework::LogLevel::ERRORS);
+    for (size_t i = 0; i < dst_info.tensor_shape().total_size(); ++i)
+    {
+        const float ref = reinterpret_cast<const float *>(reference.buffer())[i];
+        const float out = reinterpret_cast<const float *>(banded.buffer())[i];
+        ARM_COMPUTE_EXPECT(std::abs(out - ref) <= float(abs_tolerance_f32) * std::max(1.f, std::abs(ref)),
+                           framework::LogLevel::ERRORS);
+    }
+}
 TEST_SUITE_END() // Conv3x3
 
 TEST_SUITE(Conv5x5)
@@ -1382,6 +1786,9 @@ using NEGEMMConvolutionLayerPaddedWeightsFixture =
 template <typename T>
 using NEGEMMConvolutionLayerMixedDataLayoutFixture =
     ConvolutionValidationFixture<Tensor, Accessor, NEConvolutionLayer, T, true>;
+template <typename T>
+using NEGEMMConvolutionLayerSparseFixture =
+    ConvolutionValidationSparseFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T>;
 
 /** Test case for memory injection in @ref cpu::CpuGemmConv2d.
  *
@@ -1524,6 +1931,29 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
         framework::ARM_COMPUTE_PRINT_WARNING();
     }
 }
+/** The 2:4 sparse kernels are F32 only: a sparse weight format is a hint and F16 falls back to the dense kernels */
+FIXTURE_DATA_TEST_CASE(RunSparse,
+                       NEGEMMConvolutionLayerSparseFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F16),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               NoActivation,
+                               make("WeightFormat", WeightFormat::SPARSE_2_4),
+                               make("SparseWeights", {true})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 
@@ -1540,6 +1970,64 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+/** Weights declared 2:4 sparse, with and without the pattern actually holding */
+FIXTURE_DATA_TEST_CASE(RunSparse,
+                       NEGEMMConvolutionLayerSparseFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC}),
+                               ActivationFunctionsDataset,
+                               make("WeightFormat", WeightFormat::SPARSE_2_4),
+                               make("SparseWeights", {true, false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+/** NHWC dilated convolutions run as an indirect GEMM, NCHW ones through im2col */
+FIXTURE_DATA_TEST_CASE(RunDilated,
+                       NEGEMMConvolutionLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallDilatedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+/** Grouped convolutions run natively as an indirect GEMM, which is NHWC only */
+FIXTURE_DATA_TEST_CASE(RunGrouped,
+                       NEGEMMConvolutionLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+FIXTURE_DATA_TEST_CASE(RunGroupedDilated,
+                       NEGEMMConvolutionLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(zip(make("Input", {TensorShape(20U, 18U, 8U), TensorShape(17U, 23U, 12U, 2U)}),
+                                   make("Weights", {TensorShape(3U, 3U, 4U, 16U), TensorShape(3U, 3U, 3U, 8U)}),
+                                   make("Bias", {TensorShape(16U), TensorShape(8U)}),
+                                   make("Output", {TensorShape(20U, 18U, 16U), TensorShape(15U, 19U, 8U, 2U)}),
+                                   make("PadStrideInfo", {PadStrideInfo(1, 1, 2, 2), PadStrideInfo(1, 1, 1, 1)}),
+                                   make("Dilation", {Size2D(2U, 2U), Size2D(2U, 3U)})),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 FIXTURE_DATA_TEST_CASE(RunMixedDataLayout,
                        NEGEMMConvolutionLayerMixedDataLayoutFixture<float>,
                        framework::DatasetMode::ALL,
@@ -1675,6 +2163,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunDilated,
+                       NEGEMMConvolutionLayerQuantizedFixture<uint8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallDilatedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::QASYMM8),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC}),
+                               make("QuantizationInfoIfActivationEnabled", {QuantizationInfo(2.f / 255.f, 10)}),
+                               QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 
 FIXTURE_DATA_TEST_CASE(RunMixedDataLayout,
                        NEGEMMConvolutionLayerQuantizedFixture<uint8_t>,
@@ -1973,6 +2474,30 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+FIXTURE_DATA_TEST_CASE(RunDilated,
+                       NEDirectGEMMConv2dLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallDilatedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               make("ActivationInfo", ActivationLayerInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+FIXTURE_DATA_TEST_CASE(RunGrouped,
+                       NEDirectGEMMConv2dLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -2037,6 +2562,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunGrouped,
+                       NEDirectGEMMConv2dLayerQuantizedFixture<uint8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::QASYMM8),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               make("QuantizationInfo", {QuantizationInfo(2.f / 255.f, 10)}),
+                               QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -78,6 +78,11 @@ const auto data9x9_large_asymm = make("InputShape", TensorShape{640U, 360U, 56U,
 const auto data3x3_precommit = datasets::SmallDeconvolutionShapes() * make("StrideX", 1, 2) * make("StrideY", 1, 2) *
                                make("PadX", 0, 2) * make("PadY", 0, 2) * make("NumKernels", {3});
 
+/** Strided NHWC configurations run without upsampling; enough kernels to cover the vector loop and its tail */
+const auto data3x3_strided_many_kernels = datasets::SmallDeconvolutionShapes() * make("StrideX", {2}) *
+                                          make("StrideY", {2, 3}) * make("PadX", {1}) * make("PadY", 0, 2) *
+                                          make("NumKernels", {13});
+
 const auto data1x1 = datasets::SmallDeconvolutionShapes() * make("StrideX", 1, 4) * make("StrideY", 1, 4) *
                      make("PadX", 0, 1) * make("PadY", 0, 1) * make("NumKernels", {3});
 
@@ -209,6 +214,17 @@ FIXTURE_DATA_TEST_CASE(
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunStridedManyKernels,
+                       NEDeconvolutionLayerFixture3x3<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data3x3_strided_many_kernels,
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 FIXTURE_DATA_TEST_CASE(RunAsymm,
                        NEDeconvolutionLayerAsymmFixture3x3<float>,
                        framework::DatasetMode::NIGHTLY,
@@ -433,6 +449,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
 }
+FIXTURE_DATA_TEST_CASE(RunStridedManyKernels,
+                       NEDeconvolutionLayerQuantizedFixture3x3<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data3x3_strided_many_kernels,
+                               make("DataType", DataType::QASYMM8),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               input_qinfo_dataset,
+                               output_qinfo_dataset,
+                               add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NEDeconvolutionLayerQuantizedFixture3x3<uint8_t>,
                        framework::DatasetMode::NIGHTLY,
@@ -514,6 +543,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
 }
+FIXTURE_DATA_TEST_CASE(RunStridedManyKernels,
+                       NEDeconvolutionLayerQuantizedFixture3x3<int8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data3x3_strided_many_kernels,
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               input_qinfo_dataset,
+                               output_qinfo_dataset,
+                               add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NEDeconvolutionLayerQuantizedFixture3x3<int8_t>,
                        framework::DatasetMode::NIGHTLY,
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/DepthwiseSeparableConvolutionLayerFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+#ifdef ARM_COMPUTE_ENABLE_FP16
+const RelativeTolerance<half_float::half>
+    rel_tolerance_f16(half_float::half(0.2f));                /**< Relative tolerance value for FP16 types */
+const AbsoluteTolerance<float> abs_tolerance_f16(0.2f);       /**< Absolute tolerance for FP16 types */
+constexpr float                tolerance_num = 0.07f;         /**< Tolerance number for the FP16 implementation */
+#endif                                                        /* ARM_COMPUTE_ENABLE_FP16 */
+const RelativeTolerance<float> rel_tolerance_f32(0.01f);      /**< Relative tolerance for FP32 types */
+const AbsoluteTolerance<float> abs_tolerance_f32(0.002f);     /**< Absolute tolerance for FP32 types */
+
+/** Shapes covering strides, asymmetric padding, depth multipliers and batches */
+const auto data_precommit = combine(zip(make("InputShape",
+                                             {TensorShape(7U, 5U, 16U), TensorShape(17U, 23U, 8U, 2U),
+                                              TensorShape(56U, 56U, 24U), TensorShape(9U, 33U, 32U)}),
+                                        make("KernelSize", {Size2D(3U, 3U), Size2D(3U, 3U), Size2D(3U, 3U),
+                                                            Size2D(5U, 5U)}),
+                                        make("ConvInfo",
+                                             {PadStrideInfo(1, 1, 1, 1), PadStrideInfo(2, 2, 0, 1, 0, 1,
+                                                                                        DimensionRoundingType::FLOOR),
+                                              PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 2, 2, 2)}),
+                                        make("DepthMultiplier", {1U, 2U, 1U, 1U}),
+                                        make("NumKernels", {8U, 24U, 32U, 5U})),
+                                    make("HasBias", {true, false}),
+                                    make("DepthwiseActivation",
+                                         {ActivationLayerInfo(),
+                                          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+                                                              6.f)}),
+                                    make("PointwiseActivation",
+                                         {ActivationLayerInfo(),
+                                          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)}));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(DepthwiseSeparableConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(16U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(16U, 9U, 9U), 1, DataType::F32, DataLayout::NCHW), // Wrong data layout
+                                   TensorInfo(TensorShape(16U, 9U, 9U), 1, DataType::QASYMM8, DataLayout::NHWC), // Unsupported data type
+                                   TensorInfo(TensorShape(16U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC), // Pointwise kernel is not 1x1
+                                   TensorInfo(TensorShape(16U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC), // Mismatching pointwise input channels
+                                   TensorInfo(TensorShape(16U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC), // Wrong output shape
+                                 }),
+               make("PointwiseWeightsInfo", { TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NCHW),
+                                              TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(16U, 3U, 3U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(12U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                            }),
+               make("OutputInfo", { TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NCHW),
+                                    TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(8U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),
+                                  }),
+               make("Expected", { true, false, false, false, false, false })),
+               input_info, pwc_weights_info, output_info, expected)
+{
+    const TensorInfo dwc_weights_info(TensorShape(16U, 3U, 3U), 1, input_info.data_type(), input_info.data_layout());
+
+    const bool is_valid = bool(NEDepthwiseSeparableConvolutionLayer::validate(&input_info.clone()->set_is_resizable(false),
+                                                                               &dwc_weights_info, nullptr,
+                                                                               &pwc_weights_info.clone()->set_is_resizable(false), nullptr,
+                                                                               &output_info.clone()->set_is_resizable(false),
+                                                                               PadStrideInfo(1, 1, 1, 1)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEDepthwiseSeparableConvolutionLayerFixture =
+    DepthwiseSeparableConvolutionLayerValidationFixture<Tensor, Accessor, NEDepthwiseSeparableConvolutionLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDepthwiseSeparableConvolutionLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data_precommit, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDepthwiseSeparableConvolutionLayerFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data_precommit, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // DepthwiseSeparableConvolutionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEElementwiseExpression.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/ElementwiseExpressionFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+RelativeTolerance<float> tolerance_fp32(0.00001f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+RelativeTolerance<float> tolerance_fp16(0.01f);
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+const auto ActivationFunctionsDataset =
+    make("ActivationInfo",
+         {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 4.f, -1.f),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)});
+
+ElementwiseExpressionInfo add_expression()
+{
+    ElementwiseExpressionInfo info;
+    info.binary(ElementwiseExpressionOp::Add, info.input(0), info.input(1));
+    return info;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ElementwiseExpression)
+
+TEST_CASE(Validate, framework::DatasetMode::ALL)
+{
+    const TensorInfo src_f32(TensorShape(27U, 13U, 2U), 1, DataType::F32);
+    const TensorInfo src_f16(TensorShape(27U, 13U, 2U), 1, DataType::F16);
+    const TensorInfo src_s32(TensorShape(27U, 13U, 2U), 1, DataType::S32);
+    const TensorInfo src_bcast(TensorShape(27U, 1U, 2U), 1, DataType::F32);
+    const TensorInfo src_mismatch(TensorShape(26U, 13U, 2U), 1, DataType::F32);
+    const TensorInfo dst_f32(TensorShape(27U, 13U, 2U), 1, DataType::F32);
+    const TensorInfo dst_wrong(TensorShape(27U, 1U, 2U), 1, DataType::F32);
+
+    const ElementwiseExpressionInfo add = add_expression();
+
+    // Valid, with and without broadcast
+    ARM_COMPUTE_EXPECT(bool(NEElementwiseExpression::validate({&src_f32, &src_f32}, &dst_f32, add)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEElementwiseExpression::validate({&src_f32, &src_bcast}, &dst_f32, add)),
+                       framework::LogLevel::ERRORS);
+
+    // Unsupported data type
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({&src_s32, &src_s32}, &dst_f32, add)),
+                       framework::LogLevel::ERRORS);
+    // Mismatching data types
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({&src_f32, &src_f16}, &dst_f32, add)),
+                       framework::LogLevel::ERRORS);
+    // Shapes not broadcast compatible
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({&src_f32, &src_mismatch}, &dst_f32, add)),
+                       framework::LogLevel::ERRORS);
+    // Wrong output shape
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({&src_f32, &src_f32}, &dst_wrong, add)),
+                       framework::LogLevel::ERRORS);
+    // Number of inputs not matching the expression
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({&src_f32}, &dst_f32, add)),
+                       framework::LogLevel::ERRORS);
+    // Empty expression
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({&src_f32}, &dst_f32, ElementwiseExpressionInfo())),
+                       framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEElementwiseExpressionFixture =
+    ElementwiseExpressionValidationFixture<Tensor, Accessor, NEElementwiseExpression, T>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmallBroadcast,
+                       NEElementwiseExpressionFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallShapesBroadcast(),
+                               make("DataType", DataType::F16),
+                               ActivationFunctionsDataset))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16, 0.01);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEElementwiseExpressionFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(zip(datasets::SmallShapes(), datasets::SmallShapes()),
+                               make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunSmallBroadcast,
+                       NEElementwiseExpressionFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallShapesBroadcast(),
+                               make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NEElementwiseExpressionFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(zip(datasets::LargeShapes(), datasets::LargeShapes()),
+                               make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // F32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // ElementwiseExpression
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
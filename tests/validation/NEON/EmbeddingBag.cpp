@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingBag.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/EmbeddingBagFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float> tolerance_f16(0.05f);
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-4f);
+/** Rows of an int8 table are pooled into magnitudes of a few thousands */
+constexpr AbsoluteTolerance<float> tolerance_s8(1e-2f);
+
+const auto EmbeddingBagModes = make("Mode", {EmbeddingBagMode::Sum, EmbeddingBagMode::Mean});
+
+/** Rows with and without a vector tail, more bags than indices and rows wider than the accumulation block */
+const auto SmallEmbeddingBagDataset = zip(make("TableShape",
+                                               {TensorShape(16U, 100U), TensorShape(37U, 50U), TensorShape(1U, 10U),
+                                                TensorShape(600U, 40U), TensorShape(128U, 1000U)}),
+                                          make("NumIndices", {64, 200, 5, 30, 1000}),
+                                          make("NumBags", {8, 17, 9, 4, 64}));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(EmbeddingBag)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("TableInfo",   { TensorInfo(TensorShape(16U, 100U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // Wrong output shape
+                                     TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // 2D indices
+                                     TensorInfo(TensorShape(16U, 100U), 1, DataType::U8),  // Wrong table type
+                                     TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // Wrong indices type
+                                     TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // Wrong output type
+                                   }),
+               make("IndicesInfo", { TensorInfo(TensorShape(40U), 1, DataType::S32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::S32),
+                                     TensorInfo(TensorShape(40U, 2U), 1, DataType::S32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::S32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::U32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::S32),
+                                   }),
+               make("OutputInfo",  { TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(16U, 9U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(16U, 8U), 1, DataType::U8),
+                                     TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(16U, 8U), 1, DataType::F16),
+                                   }),
+               make("Expected", { true, false, false, false, false, false })
+               ),
+               table_info, indices_info, output_info, expected)
+{
+    const TensorInfo offsets_info(TensorShape(8U), 1, DataType::S32);
+    const Status     status = NEEmbeddingBag::validate(&table_info.clone()->set_is_resizable(false),
+                                                       &indices_info.clone()->set_is_resizable(false),
+                                                       &offsets_info,
+                                                       &output_info.clone()->set_is_resizable(false));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(ValidateScales, framework::DatasetMode::ALL)
+{
+    const TensorInfo       table(TensorShape(16U, 100U), 1, DataType::S8);
+    const TensorInfo       indices(TensorShape(40U), 1, DataType::S32);
+    const TensorInfo       offsets(TensorShape(8U), 1, DataType::S32);
+    const TensorInfo       dst(TensorShape(16U, 8U), 1, DataType::F32);
+    const TensorInfo       scales(TensorShape(100U), 1, DataType::F32);
+    const TensorInfo       wrong_scales(TensorShape(16U), 1, DataType::F32);
+    const EmbeddingBagInfo info{};
+
+    // Int8 tables require one scale per row
+    ARM_COMPUTE_EXPECT(!bool(NEEmbeddingBag::validate(&table, &indices, &offsets, &dst, info)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(NEEmbeddingBag::validate(&table, &indices, &offsets, &dst, info, &wrong_scales)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEEmbeddingBag::validate(&table, &indices, &offsets, &dst, info, &scales)),
+                       framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEEmbeddingBagFixture = EmbeddingBagValidationFixture<Tensor, Accessor, NEEmbeddingBag, T>;
+
+/** Int8 table pooled into a FP32 output */
+using NEEmbeddingBagInt8Fixture = EmbeddingBagValidationFixture<Tensor, Accessor, NEEmbeddingBag, int8_t, float>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEEmbeddingBagFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallEmbeddingBagDataset,
+                               make("DataType", DataType::F16),
+                               EmbeddingBagModes,
+                               make("Scales", {false, true})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEEmbeddingBagFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallEmbeddingBagDataset,
+                               make("DataType", DataType::F32),
+                               EmbeddingBagModes,
+                               make("Scales", {false, true})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Integer)
+TEST_SUITE(S8)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEEmbeddingBagInt8Fixture,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallEmbeddingBagDataset,
+                               make("DataType", DataType::S8),
+                               EmbeddingBagModes,
+                               make("Scales", true)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_s8);
+}
+TEST_SUITE_END() // S8
+TEST_SUITE_END() // Integer
+
+TEST_SUITE_END() // EmbeddingBag
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
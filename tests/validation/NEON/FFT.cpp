@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,10 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Unsupported axis
                                                 TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Half spectrum
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32), // Half spectrum to real
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Wrong half spectrum size
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Half spectrum on axis 1
         }),
         make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F16),
                                                 TensorInfo(TensorShape(16U, 13U, 2U), 2, DataType::F32),
@@ -85,9 +89,13 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 7U, 2U), 2, DataType::F32),
         }),
-        make("Axis", { 0, 0, 0, 2, 0, 0 }),
-        make("Expected", { false, false, false, false, false, true })
+        make("Axis", { 0, 0, 0, 2, 0, 0, 0, 0, 0, 1 }),
+        make("Expected", { false, false, false, false, false, true, true, true, false, false })
         ),
         input_info, output_info, axis, expected)
 {
@@ -102,6 +110,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 template <typename T>
 using NEFFT1DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
 
+template <typename T>
+using NEFFT1DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall,
@@ -112,6 +123,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallReal,
+                       NEFFT1DRealFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_1d, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT1D
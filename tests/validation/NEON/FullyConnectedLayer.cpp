@@ -100,6 +100,14 @@ const auto ActivationFunctionsDataset =
              ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH),
          });
 
+/** Activations the assembly GEMM runs in its output epilogue */
+const auto EpilogueActivationFunctionsDataset =
+    make("ActivationInfo",
+         {
+             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU),
+             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::SWISH, 1.f),
+         });
+
 const auto ActivationFunctionsQuantizedDataset =
     make("ActivationInfo",
          {
@@ -320,6 +328,9 @@ using NEFullyConnectedLayerDynamicWeightsFixture =
 template <typename T>
 using NEFullyConnectedLayerDynamicBiasFixture =
     FullyConnectedWithDynamicBiasFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+template <typename T>
+using NEFullyConnectedLayerSparseFixture =
+    FullyConnectedLayerSparseValidationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
 
 TEST_SUITE(Float)
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -432,6 +443,17 @@ FIXTURE_DATA_TEST_CASE(RunWithActivation,
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunWithEpilogueActivation,
+                       NEFullyConnectedLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                               FullyConnectedParameters,
+                               make("DataType", DataType::F32),
+                               EpilogueActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NEFullyConnectedLayerFixture<float>,
                        framework::DatasetMode::NIGHTLY,
@@ -453,6 +475,19 @@ FIXTURE_DATA_TEST_CASE(RunDynamicWeights,
                                make("WeightsReshaped", {false, true})))
 {
 }
+FIXTURE_DATA_TEST_CASE(RunSparse,
+                       NEFullyConnectedLayerSparseFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallFullyConnectedLayerDataset(),
+                               FullyConnectedParameters,
+                               make("DataType", DataType::F32),
+                               ActivationFunctionsDataset,
+                               make("WeightFormat", WeightFormat::SPARSE_2_4),
+                               make("SparseWeights", {true, false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
 TEST_SUITE_END()
 TEST_SUITE_END()
 
@@ -24,6 +24,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/StringUtils.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
@@ -392,6 +393,34 @@ using NEBatchedMatMulFixture =
 template <typename T>
 using NEGEMMAccumulateFixture = GEMMAccumulateValidationFixture<Tensor, Accessor, NEGEMM, T>;
 
+/** Configures and runs the GEMM with at least four threads, so that shapes with fewer output blocks than threads
+ *  take the split-K path whatever thread count the suite was started with.
+ */
+template <typename T>
+class NEGEMMSplitKFixture : public NEGEMMFixture<T>
+{
+public:
+    void setup(TensorShape shape_a,
+               TensorShape shape_b,
+               TensorShape shape_c,
+               TensorShape output_shape,
+               float       alpha,
+               float       beta,
+               bool        pretranspose,
+               DataType    data_type)
+    {
+        IScheduler        &scheduler   = Scheduler::get();
+        const unsigned int num_threads = scheduler.num_threads();
+
+        scheduler.set_num_threads(std::max(num_threads, min_threads));
+        NEGEMMFixture<T>::setup(shape_a, shape_b, shape_c, output_shape, alpha, beta, pretranspose, data_type);
+        scheduler.set_num_threads(num_threads);
+    }
+
+private:
+    static constexpr unsigned int min_threads = 4;
+};
+
 TEST_SUITE(Float)
 DATA_TEST_CASE(ValidateZeroPadding,
                framework::DatasetMode::ALL,
@@ -525,6 +554,16 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallSplitK,
+                       NEGEMMSplitKFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallGEMMSplitKDataset(),
+                               make("ReshapeWeights", {true, false}),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
 
 #if defined(__aarch64__)
 TEST_SUITE(DynamicShape)
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEKVCacheMatMul.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/KVCacheMatMulFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.0001f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+const AbsoluteTolerance<half> tolerance_fp16(half(0.05f));
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+/** Head dimensions and cache lengths that are not multiples of the kernel blocks exercise the tails */
+const auto KVCacheShapes = combine(make("HeadDim", {16U, 23U}),
+                                   make("MaxLength", {32U, 45U}),
+                                   make("Batches", {1U, 3U}),
+                                   make("PrefillLength", {1U, 9U}),
+                                   make("DecodeSteps", {0U, 2U}));
+
+const auto KeyDataset   = combine(KVCacheShapes, make("Operand", KVCacheOperand::Key), make("Scale", {1.f, 0.125f}));
+const auto ValueDataset = combine(KVCacheShapes, make("Operand", KVCacheOperand::Value), make("Scale", 1.f));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(KVCacheMatMul)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("LhsInfo", { TensorInfo(TensorShape(16U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(16U, 1U, 2U), 1, DataType::QASYMM8),   // Unsupported data type
+                      TensorInfo(TensorShape(17U, 1U, 2U), 1, DataType::F32),       // Lhs width doesn't match head_dim
+                      TensorInfo(TensorShape(16U, 2U, 2U), 1, DataType::F32),       // More than one query row
+                      TensorInfo(TensorShape(16U, 1U, 2U), 1, DataType::F32),       // Wrong dst shape
+                      TensorInfo(TensorShape(16U, 1U, 2U), 1, DataType::F32),       // Mismatching data types
+                    }),
+    make("DstInfo", { TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(16U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::QASYMM8),
+                      TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(16U, 1U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F16),
+                    }),
+    make("Operand", { KVCacheOperand::Key, KVCacheOperand::Value, KVCacheOperand::Key, KVCacheOperand::Key,
+                      KVCacheOperand::Key, KVCacheOperand::Key, KVCacheOperand::Key }),
+    make("Expected", { true, true, false, false, false, false, false })),
+    lhs_info, dst_info, operand, expected)
+{
+    const KVCacheMatMulInfo info(operand, 16U, 32U);
+    const Status status = NEKVCacheMatMul::validate(&lhs_info.clone()->set_is_resizable(true), &dst_info.clone()->set_is_resizable(true), info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEKVCacheMatMulFixture = KVCacheMatMulValidationFixture<Tensor, Accessor, NEKVCacheMatMul, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunKey,
+                       NEKVCacheMatMulFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(KeyDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+FIXTURE_DATA_TEST_CASE(RunValue,
+                       NEKVCacheMatMulFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(ValueDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunKey,
+                       NEKVCacheMatMulFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(KeyDataset, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunValue,
+                       NEKVCacheMatMulFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(ValueDataset, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // KVCacheMatMul
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
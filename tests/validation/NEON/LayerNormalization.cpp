@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELayerNormalization.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/LayerNormalizationFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float> tolerance_f16(0.02f);
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+#ifdef ARM_COMPUTE_ENABLE_BF16
+constexpr AbsoluteTolerance<float> tolerance_bf16(0.05f);
+#endif /* ARM_COMPUTE_ENABLE_BF16 */
+constexpr AbsoluteTolerance<float>   tolerance_f32(1e-4f);
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
+constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
+
+const auto NormalizationTypes = make("Type", {LayerNormalizationType::LayerNorm, LayerNormalizationType::RMSNorm});
+
+/** Rows with and without a vector tail, a row shorter than a vector and several batch dimensions */
+const auto SmallLayerNormalizationShapes = make("Shape",
+                                                {TensorShape(1U, 7U), TensorShape(5U, 13U), TensorShape(32U, 64U),
+                                                 TensorShape(77U, 3U, 2U), TensorShape(768U, 5U, 1U, 2U)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LayerNormalization)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Mismatching shapes
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Wrong gamma size
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Unsupported output data type
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::U8),  // Unsupported input data type
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Quantized output
+                                 }),
+               make("GammaInfo", { TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(13U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U), 1, DataType::U8),
+                                   TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                 }),
+               make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 11U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::U8),
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::U8),
+                                   TensorInfo(TensorShape(32U, 13U), 1, DataType::QASYMM8_SIGNED),
+                                 }),
+               make("Expected", { true, false, false, false, false, true })
+               ),
+               input_info, gamma_info, output_info, expected)
+{
+    const Status status = NELayerNormalization::validate(&input_info.clone()->set_is_resizable(false),
+                                                         &gamma_info.clone()->set_is_resizable(false),
+                                                         nullptr,
+                                                         &output_info.clone()->set_is_resizable(false));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(ValidateResidual, framework::DatasetMode::ALL)
+{
+    const TensorInfo             src(TensorShape(32U, 13U), 1, DataType::F32);
+    const TensorInfo             wrong_residual(TensorShape(32U, 12U), 1, DataType::F32);
+    const TensorInfo             sum(TensorShape(32U, 13U), 1, DataType::F32);
+    const LayerNormalizationInfo info{};
+
+    // The sum output requires a residual input
+    ARM_COMPUTE_EXPECT(!bool(NELayerNormalization::validate(&src, nullptr, nullptr, &src, info, nullptr, &sum)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(NELayerNormalization::validate(&src, nullptr, nullptr, &src, info, &wrong_residual)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NELayerNormalization::validate(&src, nullptr, nullptr, &src, info, &src, &sum)),
+                       framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NELayerNormalizationFixture = LayerNormalizationValidationFixture<Tensor, Accessor, NELayerNormalization, T>;
+
+/** Float input normalized into a quantized output of type TOut */
+template <typename TOut>
+using NELayerNormalizationQuantizedFixture =
+    LayerNormalizationValidationFixture<Tensor, Accessor, NELayerNormalization, float, TOut>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELayerNormalizationFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormalizationShapes,
+                               make("DataType", DataType::F16),
+                               NormalizationTypes,
+                               make("Affine", {false, true}),
+                               make("Residual", {false, true}),
+                               make("OutputDataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+        if (_target_sum.info()->total_size() != 0)
+        {
+            validate(Accessor(_target_sum), _reference_sum, tolerance_f16);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+#ifdef ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE(BF16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELayerNormalizationFixture<bfloat16>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormalizationShapes,
+                               make("DataType", DataType::BFLOAT16),
+                               NormalizationTypes,
+                               make("Affine", {false, true}),
+                               make("Residual", {false, true}),
+                               make("OutputDataType", DataType::BFLOAT16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_bf16);
+    if (_target_sum.info()->total_size() != 0)
+    {
+        validate(Accessor(_target_sum), _reference_sum, tolerance_bf16);
+    }
+}
+TEST_SUITE_END() // BF16
+#endif           /* ARM_COMPUTE_ENABLE_BF16 */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELayerNormalizationFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormalizationShapes,
+                               make("DataType", DataType::F32),
+                               NormalizationTypes,
+                               make("Affine", {false, true}),
+                               make("Residual", {false, true}),
+                               make("OutputDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    if (_target_sum.info()->total_size() != 0)
+    {
+        validate(Accessor(_target_sum), _reference_sum, tolerance_f32);
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NELayerNormalizationFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::Large2DMeanStdDevNormalizationShapes(),
+                               make("DataType", DataType::F32),
+                               NormalizationTypes,
+                               make("Affine", true),
+                               make("Residual", {false, true}),
+                               make("OutputDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    if (_target_sum.info()->total_size() != 0)
+    {
+        validate(Accessor(_target_sum), _reference_sum, tolerance_f32);
+    }
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE(QuantizedOutput)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELayerNormalizationQuantizedFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormalizationShapes,
+                               make("DataType", DataType::F32),
+                               NormalizationTypes,
+                               make("Affine", true),
+                               make("Residual", {false, true}),
+                               make("OutputDataType", DataType::QASYMM8)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELayerNormalizationQuantizedFixture<int8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormalizationShapes,
+                               make("DataType", DataType::F32),
+                               NormalizationTypes,
+                               make("Affine", true),
+                               make("Residual", {false, true}),
+                               make("OutputDataType", DataType::QASYMM8_SIGNED)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // QuantizedOutput
+
+TEST_SUITE_END() // LayerNormalization
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
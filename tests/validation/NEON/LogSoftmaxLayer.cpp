@@ -111,6 +111,26 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D,
         framework::ARM_COMPUTE_PRINT_WARNING();
     }
 }
+/** Rows above the 32 KiB threshold of the online kernel */
+FIXTURE_DATA_TEST_CASE(RunOnlineRows,
+                       NELogSoftmaxLayerFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("Shape", {TensorShape(20011U, 2U)}),
+                               make("DataType", DataType::F16),
+                               make("Beta", {1.0f, 2.0f}),
+                               make("Axis", {0})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NELogSoftmaxLayerFixture<half>,
                        framework::DatasetMode::NIGHTLY,
@@ -156,6 +176,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+/** Rows above the 32 KiB threshold of the online kernel */
+FIXTURE_DATA_TEST_CASE(RunOnlineRows,
+                       NELogSoftmaxLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("Shape", {TensorShape(12003U, 2U)}),
+                               make("DataType", DataType::F32),
+                               make("Beta", {1.0f, 2.0f}),
+                               make("Axis", {0})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NELogSoftmaxLayerFixture<float>,
                        framework::DatasetMode::NIGHTLY,
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELookupTableActivation.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/LookupTableActivationFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** The table and the reference evaluate the function identically: only the last bit of a result may differ */
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
+constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+const RelativeTolerance<half> tolerance_f16(half(0.001f));
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+const auto LookupTableFunctions =
+    make("Function", {std::string("GeluTanh"), std::string("Silu"), std::string("Mish"), std::string("Custom")});
+
+/** A single row is split across threads along X */
+const auto LookupTableSmallShapes = concat(datasets::SmallShapes(), make("Shape", {TensorShape(10000U)}));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LookupTableActivation)
+
+#ifdef __aarch64__
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("InputInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 128)),
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.1f, 0)),
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8),         // No function
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8),         // Mismatching data types
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8),         // Mismatching shapes
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),             // Unsupported data type
+                      }),
+    make("OutputInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8, QuantizationInfo(0.05f, 10)),
+                         TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.1f, 0)),
+                         TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 128)),
+                         TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.1f, 0)),
+                         TensorInfo(TensorShape(27U, 12U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 128)),
+                         TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                       }),
+    make("WithFunction", { true, true, false, true, true, true }),
+    make("Expected", { true, true, false, false, false, false })),
+    input_info, output_info, with_function, expected)
+{
+    const LookupTableActivationInfo info = with_function ? LookupTableActivationInfo(lookup_table_test_function("Silu"))
+                                                         : LookupTableActivationInfo();
+    ARM_COMPUTE_EXPECT(bool(NELookupTableActivation::validate(&input_info.clone()->set_is_resizable(false),
+                                                              &output_info.clone()->set_is_resizable(false),
+                                                              info)) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NELookupTableActivationFixture =
+    LookupTableActivationValidationFixture<Tensor, Accessor, NELookupTableActivation, T>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELookupTableActivationFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LookupTableSmallShapes,
+                               LookupTableFunctions,
+                               make("DataType", DataType::F16),
+                               make("SrcQuantizationInfo", {QuantizationInfo()}),
+                               make("DstQuantizationInfo", {QuantizationInfo()}),
+                               make("InPlace", {false, true})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NELookupTableActivationFixture<half>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeShapes(),
+                               LookupTableFunctions,
+                               make("DataType", DataType::F16),
+                               make("SrcQuantizationInfo", {QuantizationInfo()}),
+                               make("DstQuantizationInfo", {QuantizationInfo()}),
+                               make("InPlace", {false})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() //FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() //Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELookupTableActivationFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LookupTableSmallShapes,
+                               LookupTableFunctions,
+                               make("DataType", DataType::QASYMM8),
+                               make("SrcQuantizationInfo", {QuantizationInfo(0.05f, 128)}),
+                               make("DstQuantizationInfo", {QuantizationInfo(0.04f, 20)}),
+                               make("InPlace", {false, true})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NELookupTableActivationFixture<uint8_t>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeShapes(),
+                               LookupTableFunctions,
+                               make("DataType", DataType::QASYMM8),
+                               make("SrcQuantizationInfo", {QuantizationInfo(0.05f, 128)}),
+                               make("DstQuantizationInfo", {QuantizationInfo(0.04f, 20)}),
+                               make("InPlace", {false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELookupTableActivationFixture<int8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LookupTableSmallShapes,
+                               LookupTableFunctions,
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("SrcQuantizationInfo", {QuantizationInfo(0.05f, 0)}),
+                               make("DstQuantizationInfo", {QuantizationInfo(0.03f, -100)}),
+                               make("InPlace", {false, true})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NELookupTableActivationFixture<int8_t>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeShapes(),
+                               LookupTableFunctions,
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("SrcQuantizationInfo", {QuantizationInfo(0.05f, 0)}),
+                               make("DstQuantizationInfo", {QuantizationInfo(0.03f, -100)}),
+                               make("InPlace", {false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+#endif           // __aarch64__
+
+TEST_SUITE_END() // LookupTableActivation
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -74,7 +74,8 @@ const auto axis_keep = combine(make("Axis",
                                      Coordinates(1, 3), Coordinates(2, 3), Coordinates(0, 1, 2, 3)}),
                                make("KeepDims", {true}));
 const auto axis_drop =
-    combine(make("Axis", {Coordinates(0), Coordinates(1), Coordinates(3)}), make("KeepDims", {false}));
+    combine(make("Axis", {Coordinates(0), Coordinates(1), Coordinates(3), Coordinates(2, 0), Coordinates(1, 3)}),
+            make("KeepDims", {false}));
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(ReduceMean)
@@ -48,6 +48,8 @@ namespace
 /** Tolerance for float operations */
 AbsoluteTolerance<float> tolerance_f32(0.0001f);
 RelativeTolerance<float> rel_tolerance_f32(0.0001f);
+/** Tolerance for long reductions along X, which are summed in a different order than the reference */
+AbsoluteTolerance<float> tolerance_long_x_f32(0.01f);
 #ifdef ARM_COMPUTE_ENABLE_FP16
 AbsoluteTolerance<float> tolerance_f16(0.2f);
 RelativeTolerance<float> rel_tolerance_f16(0.1f);
@@ -73,6 +75,16 @@ const auto Axises = make("Axis", {0, 1, 2, 3});
 
 const auto KeepDims = make("KeepDims", {true, false});
 
+/** Reductions along X long enough to be split across threads */
+const auto LongXShapes = make("Shape", {TensorShape(50000U), TensorShape(40000U, 2U)});
+
+const auto LongXReductionOperations = make("ReductionOperation",
+                                           {
+                                               ReductionOperation::SUM,
+                                               ReductionOperation::MIN,
+                                               ReductionOperation::MAX,
+                                           });
+
 } // namespace
 
 TEST_SUITE(NEON)
@@ -155,6 +167,59 @@ FIXTURE_DATA_TEST_CASE(
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(
+    RunLongX,
+    NEReductionOperationFixture<float>,
+    framework::DatasetMode::PRECOMMIT,
+    combine(LongXShapes, make("DataType", DataType::F32), make("Axis", 0), LongXReductionOperations, KeepDims))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_long_x_f32);
+}
+
+/** Test case for arg min/max reductions along a long X split in chunks
+ *
+ * Every row holds its extremum several times, in different chunks of X. Row 0 first holds it past the first chunk,
+ * row 1 on both sides of the boundary between the first two chunks.
+ *
+ * Checks performed in order:
+ * - The index of the first occurrence of the extremum is returned, whichever chunk it is in
+ */
+TEST_CASE(LongXArgIdxTies, framework::DatasetMode::PRECOMMIT)
+{
+    const TensorShape                            shape(40000U, 2U);
+    const std::vector<std::vector<unsigned int>> extrema_pos = {{20000U, 35000U, 39999U}, {16383U, 16384U, 32768U}};
+
+    for (const auto op : {ReductionOperation::ARG_IDX_MIN, ReductionOperation::ARG_IDX_MAX})
+    {
+        const float extremum = (op == ReductionOperation::ARG_IDX_MIN) ? -5.f : 5.f;
+
+        Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+        Tensor dst;
+
+        NEReductionOperation reduction;
+        reduction.configure(&src, &dst, 0, op, true);
+
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_value(Accessor(src), 0.f);
+        for (unsigned int row = 0; row < extrema_pos.size(); ++row)
+        {
+            for (const auto x : extrema_pos[row])
+            {
+                *reinterpret_cast<float *>(src.ptr_to_element(Coordinates(x, row))) = extremum;
+            }
+        }
+
+        reduction.run();
+
+        for (unsigned int row = 0; row < extrema_pos.size(); ++row)
+        {
+            const int32_t index = *reinterpret_cast<int32_t *>(dst.ptr_to_element(Coordinates(0, row)));
+            ARM_COMPUTE_EXPECT(index == static_cast<int32_t>(extrema_pos[row][0]), framework::LogLevel::ERRORS);
+        }
+    }
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -214,6 +279,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quantized);
 }
+FIXTURE_DATA_TEST_CASE(RunLongX,
+                       NEReductionOperationQuantizedFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LongXShapes,
+                               make("DataType", DataType::QASYMM8),
+                               make("Axis", 0),
+                               make("ReductionOperation", ReductionOperation::MEAN_SUM),
+                               QuantizationInfos,
+                               KeepDims))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized);
+}
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
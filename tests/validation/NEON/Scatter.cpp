@@ -40,6 +40,8 @@ namespace validation
 {
 template <typename T>
 using NEScatterLayerFixture = ScatterValidationFixture<Tensor, Accessor, NEScatter, T>;
+template <typename T>
+using NEScatterReduceFixture = ScatterReduceValidationFixture<Tensor, Accessor, NEScatter, T>;
 namespace
 {
 RelativeTolerance<float> tolerance_f32(
@@ -193,9 +195,18 @@ DATA_TEST_CASE(ValidateCommonDataTypes,
     validate_data_types(input_dtype, updates_dtype, indices_dtype, output_dtype);
 }
 
-const auto allScatterFunctions = make(
-    "ScatterFunction",
-    {ScatterFunction::Update, ScatterFunction::Add, ScatterFunction::Sub, ScatterFunction::Min, ScatterFunction::Max});
+const auto allScatterFunctions = make("ScatterFunction",
+                                      {ScatterFunction::Update, ScatterFunction::Add, ScatterFunction::Sub,
+                                       ScatterFunction::Min, ScatterFunction::Max, ScatterFunction::Mul});
+
+const auto reduceScatterFunctions = make(
+    "ScatterFunction", {ScatterFunction::Update, ScatterFunction::Add, ScatterFunction::Max, ScatterFunction::Mul});
+
+// 500 updates into 2, 50 or up to 1000 destinations: from hundreds of duplicates per destination to almost none
+const auto ScatterCollisionsDataset =
+    combine(make("OutputShape", {TensorShape(16U, 300U), TensorShape(7U, 3U, 200U), TensorShape(1000U)}),
+            make("NumUpdates", {500U}),
+            make("NumDestinations", {2U, 50U, 1000U}));
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -282,6 +293,18 @@ FIXTURE_DATA_TEST_CASE(RunSmallScatterScalar,
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+// Updates with duplicate indices, reduced in parallel over the destination
+FIXTURE_DATA_TEST_CASE(RunSmallCollisions,
+                       NEScatterReduceFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(ScatterCollisionsDataset,
+                               make("DataType", {DataType::F32}),
+                               reduceScatterFunctions,
+                               make("Padding", {false, true})))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
 TEST_SUITE_END() // FP32
 
 // NOTE: Padding is disabled for the SmallScatterMixedDataset due certain shapes not supporting padding.
@@ -308,6 +331,25 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed,
         framework::ARM_COMPUTE_PRINT_WARNING();
     }
 }
+
+FIXTURE_DATA_TEST_CASE(RunSmallCollisions,
+                       NEScatterReduceFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(ScatterCollisionsDataset,
+                               make("DataType", {DataType::F16}),
+                               reduceScatterFunctions,
+                               make("Padding", {false})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           // ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE_END() // Float
@@ -326,6 +368,17 @@ FIXTURE_DATA_TEST_CASE(RunSmallMixed,
 {
     validate(Accessor(_target), _reference, tolerance_int);
 }
+
+FIXTURE_DATA_TEST_CASE(RunSmallCollisions,
+                       NEScatterReduceFixture<int32_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(ScatterCollisionsDataset,
+                               make("DataType", {DataType::S32}),
+                               reduceScatterFunctions,
+                               make("Padding", {false})))
+{
+    validate(Accessor(_target), _reference, tolerance_int);
+}
 TEST_SUITE_END() // S32
 
 TEST_SUITE(S16)
@@ -60,6 +60,10 @@ const auto CNNDataTypes = make("DataType",
 #endif /* ARM_COMPUTE_ENABLE_FP16 */
                                    DataType::F32,
                                });
+
+/** Attention score shapes reduced along a non-X axis, with widths covering full, partial and sub-vector column blocks */
+const auto AttentionScoreShapes =
+    make("Shape", {TensorShape(37U, 24U, 4U), TensorShape(64U, 17U, 2U, 2U), TensorShape(3U, 33U, 8U)});
 } // namespace
 
 TEST_SUITE(NEON)
@@ -229,6 +233,26 @@ FIXTURE_DATA_TEST_CASE(
         framework::ARM_COMPUTE_PRINT_WARNING();
     }
 }
+/** Rows above the 32 KiB threshold of the online kernel */
+FIXTURE_DATA_TEST_CASE(RunOnlineRows,
+                       NESoftmaxLayerFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("Shape", {TensorShape(20011U, 2U)}),
+                               make("DataType", DataType::F16),
+                               make("Beta", {1.0f, 2.0f}),
+                               make("Axis", {0})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NESoftmaxLayerFixture<half>,
                        framework::DatasetMode::NIGHTLY,
@@ -311,6 +335,29 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+/** Rows above the 32 KiB threshold of the online kernel */
+FIXTURE_DATA_TEST_CASE(RunOnlineRows,
+                       NESoftmaxLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("Shape", {TensorShape(12003U, 2U)}),
+                               make("DataType", DataType::F32),
+                               make("Beta", {1.0f, 2.0f}),
+                               make("Axis", {0})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallNonXAxis,
+                       NESoftmaxLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(AttentionScoreShapes,
+                               make("DataType", DataType::F32),
+                               make("Beta", {1.0f}),
+                               make("Axis", {1, 2})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NESoftmaxLayerFixture<float>,
                        framework::DatasetMode::NIGHTLY,
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NESparseFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/SparseFullyConnectedLayerFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.0001f);
+
+const auto SparseFCShapes = zip(make("InputShape", {TensorShape(64U, 1U), TensorShape(128U, 7U), TensorShape(256U, 3U)}),
+                                make("NumOutputs", {32U, 48U, 64U}));
+
+const auto BlockShapes =
+    make("BlockShape", {SparseBlockShape::Block1x4, SparseBlockShape::Block4x4, SparseBlockShape::Block8x1});
+
+/** 0.5 is above the default maximum density, so it runs the dense fallback */
+const auto Sparsities = make("Sparsity", {0.9f, 0.5f});
+
+const auto ActivationFunctions =
+    make("ActivationInfo",
+         {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.5f, -0.5f)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(SparseFullyConnectedLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("InputInfo", { TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),
+                        TensorInfo(TensorShape(64U, 2U), 1, DataType::F16),     // Unsupported data type
+                        TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),     // Outputs not a multiple of the block height
+                        TensorInfo(TensorShape(62U, 2U), 1, DataType::F32),     // Inputs not a multiple of the block width
+                        TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),     // Unsupported activation
+                        TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),     // Wrong dst shape
+                      }),
+    make("WeightsInfo", { TensorInfo(TensorShape(64U, 32U), 1, DataType::F32),
+                          TensorInfo(TensorShape(64U, 32U), 1, DataType::F16),
+                          TensorInfo(TensorShape(64U, 30U), 1, DataType::F32),
+                          TensorInfo(TensorShape(62U, 32U), 1, DataType::F32),
+                          TensorInfo(TensorShape(64U, 32U), 1, DataType::F32),
+                          TensorInfo(TensorShape(64U, 32U), 1, DataType::F32),
+                        }),
+    make("OutputInfo", { TensorInfo(TensorShape(32U, 2U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 2U), 1, DataType::F16),
+                         TensorInfo(TensorShape(30U, 2U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 2U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 2U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 3U), 1, DataType::F32),
+                       }),
+    make("ActivationInfo", { ActivationLayerInfo(),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH),
+                             ActivationLayerInfo(),
+                           }),
+    make("Expected", { true, false, false, false, false, false })),
+    input_info, weights_info, output_info, act_info, expected)
+{
+    SparseFullyConnectedLayerInfo info{};
+    info.activation_info = act_info;
+    info.block_shape     = SparseBlockShape::Block4x4;
+
+    const Status status = NESparseFullyConnectedLayer::validate(&input_info.clone()->set_is_resizable(true),
+                                                                &weights_info.clone()->set_is_resizable(true),
+                                                                nullptr,
+                                                                &output_info.clone()->set_is_resizable(true),
+                                                                info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** The weights are compressed once when preparing, so they must be constant */
+TEST_CASE(ValidateNonConstantWeights, framework::DatasetMode::ALL)
+{
+    const TensorInfo input_info(TensorShape(64U, 2U), 1, DataType::F32);
+    TensorInfo       weights_info(TensorShape(64U, 32U), 1, DataType::F32);
+    const TensorInfo output_info(TensorShape(32U, 2U), 1, DataType::F32);
+
+    SparseFullyConnectedLayerInfo info{};
+    info.block_shape = SparseBlockShape::Block4x4;
+
+    Status status = NESparseFullyConnectedLayer::validate(&input_info, &weights_info, nullptr, &output_info, info);
+    ARM_COMPUTE_EXPECT(bool(status), framework::LogLevel::ERRORS);
+
+    weights_info.set_are_values_constant(false);
+    status = NESparseFullyConnectedLayer::validate(&input_info, &weights_info, nullptr, &output_info, info);
+    ARM_COMPUTE_EXPECT(!bool(status), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NESparseFullyConnectedLayerFixture =
+    SparseFullyConnectedLayerValidationFixture<Tensor, Accessor, NESparseFullyConnectedLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NESparseFullyConnectedLayerFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(SparseFCShapes,
+                               BlockShapes,
+                               Sparsities,
+                               make("TransposeWeights", {true, false}),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // SparseFullyConnectedLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NETopK.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/TopKFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Row widths covering the vector blocks, the leftover elements and a single row split across threads */
+const auto TopKSmallShapes = make("Shape", {TensorShape(37U, 3U), TensorShape(1000U, 2U, 2U), TensorShape(40000U)});
+
+/** Vocabulary sized rows: the rows with more chunks than rows are split across threads */
+const auto TopKLargeShapes =
+    make("Shape", {TensorShape(32003U, 4U), TensorShape(70001U, 2U), TensorShape(150000U)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(TopK)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("InputInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                        TensorInfo(TensorShape(100000U), 1, DataType::F32),     // Split along X
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // k larger than the rows
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // Mismatching data types
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // Wrong values shape
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // Wrong indices data type
+                        TensorInfo(TensorShape(27U, 13U), 1, DataType::S32),    // Unsupported data type
+                      }),
+    make("ValuesInfo", { TensorInfo(TensorShape(5U, 13U), 1, DataType::F32),
+                         TensorInfo(TensorShape(5U), 1, DataType::F32),
+                         TensorInfo(TensorShape(28U, 13U), 1, DataType::F32),
+                         TensorInfo(TensorShape(5U, 13U), 1, DataType::F16),
+                         TensorInfo(TensorShape(5U, 12U), 1, DataType::F32),
+                         TensorInfo(TensorShape(5U, 13U), 1, DataType::F32),
+                         TensorInfo(TensorShape(5U, 13U), 1, DataType::S32),
+                       }),
+    make("IndicesInfo", { TensorInfo(TensorShape(5U, 13U), 1, DataType::U32),
+                          TensorInfo(TensorShape(5U), 1, DataType::U32),
+                          TensorInfo(TensorShape(28U, 13U), 1, DataType::U32),
+                          TensorInfo(TensorShape(5U, 13U), 1, DataType::U32),
+                          TensorInfo(TensorShape(5U, 12U), 1, DataType::U32),
+                          TensorInfo(TensorShape(5U, 13U), 1, DataType::S32),
+                          TensorInfo(TensorShape(5U, 13U), 1, DataType::U32),
+                        }),
+    make("K", { 5U, 5U, 28U, 5U, 5U, 5U, 5U }),
+    make("Expected", { true, true, false, false, false, false, false })),
+    input_info, values_info, indices_info, k, expected)
+{
+    ARM_COMPUTE_EXPECT(bool(NETopK::validate(&input_info.clone()->set_is_resizable(false),
+                                             &values_info.clone()->set_is_resizable(false),
+                                             &indices_info.clone()->set_is_resizable(false),
+                                             k)) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NETopKFixture = TopKValidationFixture<Tensor, Accessor, NETopK, T>;
+
+TEST_SUITE(Float)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NETopKFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(TopKSmallShapes,
+                               make("DataType", DataType::F16),
+                               make("K", {1U, 5U, 37U}),
+                               make("WithTies", {false, true})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target_values), _reference_values);
+        validate(Accessor(_target_indices), _reference_indices);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NETopKFixture<half>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(TopKLargeShapes,
+                               make("DataType", DataType::F16),
+                               make("K", {1U, 40U, 100U}),
+                               make("WithTies", {false, true})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target_values), _reference_values);
+        validate(Accessor(_target_indices), _reference_indices);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() //FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NETopKFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(TopKSmallShapes,
+                               make("DataType", DataType::F32),
+                               make("K", {1U, 5U, 37U}),
+                               make("WithTies", {false, true})))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NETopKFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(TopKLargeShapes,
+                               make("DataType", DataType::F32),
+                               make("K", {1U, 40U, 100U}),
+                               make("WithTies", {false, true})))
+{
+    // Validate output
+    validate(Accessor(_target_values), _reference_values);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() //FP32
+TEST_SUITE_END() //Float
+
+TEST_SUITE_END() //TopK
+TEST_SUITE_END() //NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
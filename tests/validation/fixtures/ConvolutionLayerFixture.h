@@ -380,6 +380,28 @@ protected:
         }
     }
 
+    template <typename U>
+    void fill_weights(U &&tensor, int i)
+    {
+        fill(tensor, i);
+
+        if (_sparse_weights)
+        {
+            // Keep two values in every group of four input channels (2:4 structured sparsity)
+            const size_t idx_c = get_data_layout_dimension_index(tensor.data_layout(), DataLayoutDimension::CHANNEL);
+            for (int idx = 0; idx < tensor.num_elements(); ++idx)
+            {
+                const Coordinates coord = index2coord(tensor.shape(), idx);
+                const int         pos   = coord[idx_c] % 4;
+                const int         first = (coord[idx_c] / 4 + coord[3]) % 4;
+                if (pos != first && pos != (first + 2) % 4)
+                {
+                    *reinterpret_cast<TW *>(tensor(coord)) = TW(0);
+                }
+            }
+        }
+    }
+
     // given input is IN nchw format
     TensorType compute_target(TensorShape               input_shape,
                               TensorShape               weights_shape,
@@ -420,7 +442,7 @@ protected:
         const int idx_height = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
 
         WeightsInfo weights_info(!reshape_weights, weights_shape[idx_width], weights_shape[idx_height],
-                                 weights_shape[3]);
+                                 weights_shape[3], false, _weight_format);
         TensorShape reshaped_weights_shape(weights_shape);
 
         TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1, _quantization_info, _data_layout);
@@ -482,7 +504,7 @@ protected:
 
         // Fill tensors
         fill(AccessorType(src), 0 + _hash);
-        fill(AccessorType(weights), 1 + _hash);
+        fill_weights(AccessorType(weights), 1 + _hash);
         fill(AccessorType(bias), 2 + _hash);
 
         if (_mixed_layout)
@@ -655,7 +677,7 @@ protected:
         SimpleTensor<TBias> bias{bias_shape, bias_dt, 1, _quantization_info};
 
         fill(src, 0 + _hash);
-        fill(weights, 1 + _hash);
+        fill_weights(weights, 1 + _hash);
         fill(bias, 2 + _hash);
 
         // Fill with bfloat16 to perform the conversion and reduce the mismatches in the output
@@ -689,6 +711,8 @@ protected:
     bool             _is_bfloat16  = false;
     bool             _mixed_layout = false;
     bool             _use_dynamic_output_quant{false};
+    WeightFormat     _weight_format{WeightFormat::UNSPECIFIED};
+    bool             _sparse_weights{false};
     int32_t          _hash{0};
     int32_t          _min_bias{-100};
     int32_t          _max_bias{100};
@@ -717,6 +741,32 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ConvolutionValidationSparseFixture
+    : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
+{
+public:
+    void setup(TensorShape         input_shape,
+               TensorShape         weights_shape,
+               TensorShape         bias_shape,
+               TensorShape         output_shape,
+               PadStrideInfo       info,
+               Size2D              dilation,
+               bool                reshape_weights,
+               DataType            data_type,
+               DataLayout          data_layout,
+               ActivationLayerInfo act_info,
+               WeightFormat        weight_format,
+               bool                sparse_weights)
+    {
+        this->_weight_format  = weight_format;
+        this->_sparse_weights = sparse_weights;
+        ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>::setup(
+            input_shape, weights_shape, bias_shape, output_shape, info, dilation, reshape_weights, data_type, data_type,
+            data_layout, QuantizationInfo(), QuantizationInfo(), act_info);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool mixed_layout = false>
 class NEDirectGEMMConv2dLayerFP16WithAccModeFixture
     : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
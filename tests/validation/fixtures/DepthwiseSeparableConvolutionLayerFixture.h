@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/function_info/ConvolutionInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Runs a depthwise convolution followed by a 1x1 convolution in NHWC and compares it against the two reference
+ * convolutions run one after the other.
+ *
+ * Shapes are given in NCHW order: input [W, H, C, N], depthwise weights [Kx, Ky, C * depth_multiplier].
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         input_shape,
+               Size2D              kernel_size,
+               PadStrideInfo       conv_info,
+               unsigned int        depth_multiplier,
+               unsigned int        num_kernels,
+               bool                has_bias,
+               ActivationLayerInfo dwc_act_info,
+               ActivationLayerInfo pwc_act_info,
+               DataType            data_type)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const unsigned int dwc_channels = input_shape[2] * depth_multiplier;
+
+        _input_shape       = input_shape;
+        _dwc_weights_shape = TensorShape(kernel_size.width, kernel_size.height, dwc_channels);
+        _pwc_weights_shape = TensorShape(1U, 1U, dwc_channels, num_kernels);
+        _dwc_biases_shape  = TensorShape(dwc_channels);
+        _pwc_biases_shape  = TensorShape(num_kernels);
+
+        const TensorInfo  input_info(_input_shape, 1, data_type);
+        const TensorInfo  dwc_weights_info(_dwc_weights_shape, 1, data_type);
+        const TensorShape dwc_output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(
+            input_info, dwc_weights_info, ConvolutionInfo{conv_info, depth_multiplier, dwc_act_info, Size2D(1U, 1U)});
+        _dwc_output_shape = dwc_output_shape;
+        _output_shape     = TensorShape(dwc_output_shape[0], dwc_output_shape[1], num_kernels, input_shape[3]);
+
+        _target    = compute_target(conv_info, depth_multiplier, has_bias, dwc_act_info, pwc_act_info, data_type);
+        _reference = compute_reference(conv_info, depth_multiplier, has_bias, dwc_act_info, pwc_act_info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -1.0f, 1.0f);
+    }
+
+    TensorType compute_target(const PadStrideInfo       &conv_info,
+                              unsigned int               depth_multiplier,
+                              bool                       has_bias,
+                              const ActivationLayerInfo &dwc_act_info,
+                              const ActivationLayerInfo &pwc_act_info,
+                              DataType                   data_type)
+    {
+        TensorShape input_shape       = _input_shape;
+        TensorShape dwc_weights_shape = _dwc_weights_shape;
+        TensorShape pwc_weights_shape = _pwc_weights_shape;
+        TensorShape output_shape      = _output_shape;
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+        permute(dwc_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(pwc_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(output_shape, PermutationVector(2U, 0U, 1U));
+
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(input_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dwc_weights =
+            create_tensor<TensorType>(dwc_weights_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dwc_biases = create_tensor<TensorType>(_dwc_biases_shape, data_type);
+        TensorType pwc_weights =
+            create_tensor<TensorType>(pwc_weights_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType pwc_biases = create_tensor<TensorType>(_pwc_biases_shape, data_type);
+        TensorType dst = create_tensor<TensorType>(output_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType conv;
+        conv.configure(&src, &dwc_weights, has_bias ? &dwc_biases : nullptr, &pwc_weights,
+                       has_bias ? &pwc_biases : nullptr, &dst, conv_info, depth_multiplier, dwc_act_info,
+                       pwc_act_info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dwc_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(pwc_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dwc_weights.allocator()->allocate();
+        dwc_biases.allocator()->allocate();
+        pwc_weights.allocator()->allocate();
+        pwc_biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dwc_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!pwc_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(dwc_weights), 1);
+        fill(AccessorType(dwc_biases), 2);
+        fill(AccessorType(pwc_weights), 3);
+        fill(AccessorType(pwc_biases), 4);
+
+        // Compute function
+        conv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const PadStrideInfo       &conv_info,
+                                      unsigned int               depth_multiplier,
+                                      bool                       has_bias,
+                                      const ActivationLayerInfo &dwc_act_info,
+                                      const ActivationLayerInfo &pwc_act_info,
+                                      DataType                   data_type)
+    {
+        SimpleTensor<T> src{_input_shape, data_type};
+        SimpleTensor<T> dwc_weights{_dwc_weights_shape, data_type};
+        SimpleTensor<T> dwc_biases{_dwc_biases_shape, data_type};
+        SimpleTensor<T> pwc_weights{_pwc_weights_shape, data_type};
+        SimpleTensor<T> pwc_biases{_pwc_biases_shape, data_type};
+
+        fill(src, 0);
+        fill(dwc_weights, 1);
+        fill(pwc_weights, 3);
+        if (has_bias)
+        {
+            fill(dwc_biases, 2);
+            fill(pwc_biases, 4);
+        }
+        else
+        {
+            library->fill_tensor_value(dwc_biases, 0.f);
+            library->fill_tensor_value(pwc_biases, 0.f);
+        }
+
+        SimpleTensor<T> dwc_dst = reference::depthwise_convolution<T>(src, dwc_weights, dwc_biases, _dwc_output_shape,
+                                                                      conv_info, depth_multiplier);
+        if (dwc_act_info.enabled())
+        {
+            dwc_dst = reference::activation_layer<T>(dwc_dst, dwc_act_info);
+        }
+
+        SimpleTensor<T> dst = reference::convolution_layer<T>(dwc_dst, pwc_weights, pwc_biases, _output_shape,
+                                                              PadStrideInfo(1, 1, 0, 0));
+        return pwc_act_info.enabled() ? reference::activation_layer<T>(dst, pwc_act_info) : dst;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    TensorShape     _input_shape{};
+    TensorShape     _dwc_weights_shape{};
+    TensorShape     _pwc_weights_shape{};
+    TensorShape     _dwc_biases_shape{};
+    TensorShape     _pwc_biases_shape{};
+    TensorShape     _dwc_output_shape{};
+    TensorShape     _output_shape{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEEXPRESSIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEEXPRESSIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ElementwiseOperations.h"
+#include "tests/validation/reference/ElementwiseUnary.h"
+#include "tests/validation/reference/PixelWiseMultiplication.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Validates the expression act(max((a + b) * b, a) - neg(b)) where @p a and @p b may be broadcast */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ElementwiseExpressionValidationFixture : public framework::Fixture
+{
+public:
+    void setup(const TensorShape &shape0, const TensorShape &shape1, DataType data_type, ActivationLayerInfo act_info)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const ElementwiseExpressionInfo info = build_expression(act_info);
+
+        _target    = compute_target(shape0, shape1, data_type, info);
+        _reference = compute_reference(shape0, shape1, data_type, act_info);
+    }
+
+protected:
+    static ElementwiseExpressionInfo build_expression(const ActivationLayerInfo &act_info)
+    {
+        ElementwiseExpressionInfo info;
+        const unsigned int        a    = info.input(0);
+        const unsigned int        b    = info.input(1);
+        const unsigned int        sum  = info.binary(ElementwiseExpressionOp::Add, a, b);
+        const unsigned int        prod = info.binary(ElementwiseExpressionOp::Mul, sum, b);
+        const unsigned int        max  = info.binary(ElementwiseExpressionOp::Max, prod, a);
+        const unsigned int        neg  = info.unary(ElementWiseUnary::NEG, b);
+        const unsigned int        res  = info.binary(ElementwiseExpressionOp::Sub, max, neg);
+        if (act_info.enabled())
+        {
+            info.activation(act_info, res);
+        }
+        return info;
+    }
+
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -2.f, 2.f);
+    }
+
+    TensorType compute_target(const TensorShape               &shape0,
+                              const TensorShape               &shape1,
+                              DataType                         data_type,
+                              const ElementwiseExpressionInfo &info)
+    {
+        // Create tensors
+        TensorType src0 = create_tensor<TensorType>(shape0, data_type);
+        TensorType src1 = create_tensor<TensorType>(shape1, data_type);
+        TensorType dst;
+
+        // Create and configure function
+        FunctionType expression;
+        expression.configure({&src0, &src1}, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src0.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(src1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src0.allocator()->allocate();
+        src1.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src0.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!src1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src0), 0);
+        fill(AccessorType(src1), 1);
+
+        // Compute function
+        expression.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape         &shape0,
+                                      const TensorShape         &shape1,
+                                      DataType                   data_type,
+                                      const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<T> src0{shape0, data_type};
+        SimpleTensor<T> src1{shape1, data_type};
+        SimpleTensor<T> neg{shape1, data_type};
+
+        // Fill reference
+        fill(src0, 0);
+        fill(src1, 1);
+
+        const SimpleTensor<T> sum =
+            reference::arithmetic_operation<T>(ArithmeticOperation::ADD, src0, src1, data_type);
+        const SimpleTensor<T> prod = reference::pixel_wise_multiplication<T, T, T>(
+            sum, src1, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_UP, data_type);
+        const SimpleTensor<T> max = reference::arithmetic_operation<T>(ArithmeticOperation::MAX, prod, src0, data_type);
+        reference::elementwise_unary<T>(src1, neg, ElementWiseUnary::NEG);
+        const SimpleTensor<T> res = reference::arithmetic_operation<T>(ArithmeticOperation::SUB, max, neg, data_type);
+
+        return act_info.enabled() ? reference::activation_layer<T>(res, act_info) : res;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEEXPRESSIONFIXTURE_H
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGBAGFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGBAGFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/EmbeddingBag.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture for an embedding bag over random indices and bags of random sizes
+ *
+ * Some indices fall outside the table and some bags are empty.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TOut = T>
+class EmbeddingBagValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape      table_shape,
+               int              num_indices,
+               int              num_bags,
+               DataType         data_type,
+               EmbeddingBagMode mode,
+               bool             has_scales)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        // Sorted offsets starting at 0: equal offsets give empty bags
+        std::mt19937                           gen(library->seed());
+        std::uniform_int_distribution<int32_t> offset_dist(0, num_indices);
+        _offsets.resize(num_bags);
+        std::generate(_offsets.begin(), _offsets.end(), [&]() { return offset_dist(gen); });
+        std::sort(_offsets.begin(), _offsets.end());
+        _offsets[0] = 0;
+
+        const EmbeddingBagInfo info(mode);
+        compute_target(table_shape, num_indices, data_type, info, has_scales);
+        compute_reference(table_shape, num_indices, data_type, info, has_scales);
+    }
+
+protected:
+    template <typename U>
+    void fill_table(U &&tensor)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-1.f, 1.f};
+                library->fill(tensor, distribution, 0);
+                break;
+            }
+            case DataType::S8:
+            {
+                library->fill_tensor_uniform(tensor, 0);
+                break;
+            }
+            default:
+            {
+                std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+                library->fill(tensor, distribution, 0);
+                break;
+            }
+        }
+    }
+
+    template <typename U>
+    void fill_indices(U &&tensor, int num_rows)
+    {
+        // One index below and one above the table
+        std::uniform_int_distribution<int32_t> distribution(-1, num_rows);
+        library->fill(tensor, distribution, 1);
+    }
+
+    template <typename U>
+    void fill_scales(U &&tensor)
+    {
+        std::uniform_real_distribution<float> distribution(0.5f, 1.5f);
+        library->fill(tensor, distribution, 2);
+    }
+
+    void compute_target(const TensorShape      &table_shape,
+                        int                     num_indices,
+                        DataType                data_type,
+                        const EmbeddingBagInfo &info,
+                        bool                    has_scales)
+    {
+        // Create tensors
+        TensorType table   = create_tensor<TensorType>(table_shape, data_type);
+        TensorType indices = create_tensor<TensorType>(TensorShape(num_indices), DataType::S32);
+        TensorType offsets = create_tensor<TensorType>(TensorShape(_offsets.size()), DataType::S32);
+        TensorType scales  = create_tensor<TensorType>(TensorShape(table_shape[1]), DataType::F32);
+        TensorType dst;
+
+        // Create and configure function
+        FunctionType embedding_bag;
+        embedding_bag.configure(&table, &indices, &offsets, &dst, info, has_scales ? &scales : nullptr);
+
+        // Allocate tensors
+        for (TensorType *tensor : {&table, &indices, &offsets, &scales, &dst})
+        {
+            tensor->allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!tensor->info()->is_resizable());
+        }
+
+        // Fill tensors
+        fill_table(AccessorType(table));
+        fill_indices(AccessorType(indices), table_shape[1]);
+        library->fill_static_values(AccessorType(offsets), _offsets);
+        fill_scales(AccessorType(scales));
+
+        // Compute function
+        embedding_bag.run();
+
+        _target = std::move(dst);
+    }
+
+    void compute_reference(const TensorShape      &table_shape,
+                           int                     num_indices,
+                           DataType                data_type,
+                           const EmbeddingBagInfo &info,
+                           bool                    has_scales)
+    {
+        // Create reference
+        SimpleTensor<T>       table{table_shape, data_type};
+        SimpleTensor<int32_t> indices{TensorShape(num_indices), DataType::S32};
+        SimpleTensor<int32_t> offsets{TensorShape(_offsets.size()), DataType::S32};
+        SimpleTensor<float>   scales{TensorShape(table_shape[1]), DataType::F32};
+
+        // Fill reference
+        fill_table(table);
+        fill_indices(indices, table_shape[1]);
+        library->fill_static_values(offsets, _offsets);
+        if (has_scales)
+        {
+            fill_scales(scales);
+        }
+        else
+        {
+            library->fill_static_values(scales, std::vector<float>{1.f});
+        }
+
+        _reference = reference::embedding_bag<T, TOut>(table, indices, offsets, scales, info);
+    }
+
+    std::vector<int32_t> _offsets{};
+    TensorType           _target{};
+    SimpleTensor<TOut>   _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGBAGFIXTURE_H
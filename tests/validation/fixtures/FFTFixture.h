@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, 2025 Arm Limited.
+ * Copyright (c) 2019-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -130,6 +130,81 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+/** Forward transform of a real input keeping the non-redundant half of its spectrum along axis 0 */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTRealValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        _target    = compute_target(shape, data_type);
+        _reference = compute_reference(shape, data_type);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(_target.info()->tensor_shape(), _reference.shape());
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        std::uniform_real_distribution<float> distribution(-5.0f, 5.0f);
+        library->fill(tensor, distribution, 0);
+    }
+
+    TensorType compute_target(const TensorShape &shape, DataType data_type)
+    {
+        TensorShape half_shape = shape;
+        half_shape.set(0, (shape.x() / 2) + 1);
+
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(shape, data_type, 1);
+        TensorType dst = create_tensor<TensorType>(half_shape, data_type, 2);
+
+        // Create and configure function
+        FunctionType fft;
+        fft.configure(&src, &dst, InfoType());
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({&src, &dst});
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        fft.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{shape, data_type, 1};
+
+        // Fill reference
+        fill(src);
+        if (std::is_same<InfoType, FFT1DInfo>::value)
+        {
+            return reference::rdft_1d(src);
+        }
+        else
+        {
+            return reference::rdft_2d(src);
+        }
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FFTConvolutionValidationGenericFixture : public framework::Fixture
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -190,6 +190,27 @@ protected:
         }
     }
 
+    template <typename U>
+    void fill_weights(U &&tensor, int i)
+    {
+        fill(tensor, i);
+
+        if (_sparse_weights)
+        {
+            // Keep two values in every group of four along the input dimension (2:4 structured sparsity)
+            for (int idx = 0; idx < tensor.num_elements(); ++idx)
+            {
+                const Coordinates coord = index2coord(tensor.shape(), idx);
+                const int         pos   = coord[0] % 4;
+                const int         first = (coord[0] / 4 + coord[1]) % 4;
+                if (pos != first && pos != (first + 2) % 4)
+                {
+                    *reinterpret_cast<T *>(tensor(coord)) = T(0);
+                }
+            }
+        }
+    }
+
     TensorType compute_target(const TensorShape &input_shape,
                               const TensorShape &weights_shape,
                               const TensorShape &bias_shape,
@@ -228,9 +249,12 @@ protected:
         fc_info.are_weights_reshaped = !reshape_weights;
         fc_info.activation_info      = _activation_info;
 
+        WeightsInfo weights_info;
+        weights_info.set_weight_format(_weight_format);
+
         // Create and configure function.
         FunctionType fc;
-        fc.configure(&src, &weights, &bias, &dst, fc_info);
+        fc.configure(&src, &weights, &bias, &dst, fc_info, weights_info);
 
         ARM_COMPUTE_ASSERT(src.info()->is_resizable());
         ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
@@ -260,7 +284,7 @@ protected:
             RawTensor   tmp(tmp_shape, _data_type, 1);
 
             // Fill with original shape
-            fill(tmp, 1 + _hash);
+            fill_weights(tmp, 1 + _hash);
 
             // Transpose elementwise
             tmp = transpose(tmp);
@@ -276,7 +300,7 @@ protected:
         }
         else
         {
-            fill(AccessorType(weights), 1 + _hash);
+            fill_weights(AccessorType(weights), 1 + _hash);
         }
 
         if (_mixed_layout)
@@ -304,7 +328,7 @@ protected:
 
         // Fill reference
         fill(src, 0 + _hash);
-        fill(weights, 1 + _hash);
+        fill_weights(weights, 1 + _hash);
         fill(bias, 2 + _hash);
 
         return reference::activation_layer(
@@ -321,6 +345,8 @@ protected:
     QuantizationInfo    _weight_q_info{};
     QuantizationInfo    _dst_q_info{};
     ActivationLayerInfo _activation_info{};
+    WeightFormat        _weight_format{WeightFormat::UNSPECIFIED};
+    bool                _sparse_weights{false};
 
     // Random initialization limits
     // Default values are previously handcrafted limits
@@ -355,6 +381,30 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedLayerSparseValidationFixture
+    : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape         input_shape,
+               TensorShape         weights_shape,
+               TensorShape         bias_shape,
+               TensorShape         output_shape,
+               bool                transpose_weights,
+               bool                reshape_weights,
+               DataType            data_type,
+               ActivationLayerInfo activation_info,
+               WeightFormat        weight_format,
+               bool                sparse_weights)
+    {
+        this->_weight_format  = weight_format;
+        this->_sparse_weights = sparse_weights;
+        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            input_shape, weights_shape, bias_shape, output_shape, transpose_weights, reshape_weights, data_type,
+            QuantizationInfo(), activation_info, false);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool mixed_layout = false>
 class FullyConnectedLayerValidationQuantizedFixture
     : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_KVCACHEMATMULFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_KVCACHEMATMULFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/KVCacheMatMul.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture that prefills the cache with a prompt, then appends one row per decode step and runs after each append */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class KVCacheMatMulValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int   head_dim,
+               unsigned int   max_length,
+               unsigned int   batches,
+               unsigned int   prefill_length,
+               unsigned int   decode_steps,
+               KVCacheOperand operand,
+               float          scale,
+               DataType       data_type)
+    {
+        if (data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const KVCacheMatMulInfo info(operand, head_dim, max_length, scale);
+
+        _target    = compute_target(info, batches, prefill_length, decode_steps, data_type);
+        _reference = compute_reference(info, batches, prefill_length, decode_steps, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-1.0f, 1.0f};
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorShape lhs_shape(const KVCacheMatMulInfo &info, unsigned int batches) const
+    {
+        const unsigned int width = (info.operand() == KVCacheOperand::Key) ? info.head_dim() : info.max_length();
+        return TensorShape(width, 1U, batches);
+    }
+
+    TensorType compute_target(const KVCacheMatMulInfo &info,
+                              unsigned int             batches,
+                              unsigned int             prefill_length,
+                              unsigned int             decode_steps,
+                              DataType                 data_type)
+    {
+        // Create tensors
+        TensorType lhs = create_tensor<TensorType>(lhs_shape(info, batches), data_type);
+        TensorType dst{};
+
+        FunctionType kv_matmul;
+        kv_matmul.configure(&lhs, &dst, info);
+
+        ARM_COMPUTE_ASSERT(lhs.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        lhs.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!lhs.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        fill(AccessorType(lhs), 0);
+
+        // Prefill the cache with the whole prompt, then append one row at a time
+        for (unsigned int step = 0; step <= decode_steps; ++step)
+        {
+            const unsigned int num_rows = (step == 0) ? prefill_length : 1U;
+            TensorType rows = create_tensor<TensorType>(TensorShape(info.head_dim(), num_rows, batches), data_type);
+            rows.allocator()->allocate();
+            fill(AccessorType(rows), 1 + step);
+
+            kv_matmul.append(&rows);
+            kv_matmul.run();
+        }
+
+        ARM_COMPUTE_EXPECT(kv_matmul.length() == prefill_length + decode_steps, framework::LogLevel::ERRORS);
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const KVCacheMatMulInfo &info,
+                                      unsigned int             batches,
+                                      unsigned int             prefill_length,
+                                      unsigned int             decode_steps,
+                                      DataType                 data_type)
+    {
+        SimpleTensor<T> lhs{lhs_shape(info, batches), data_type};
+        fill(lhs, 0);
+
+        std::vector<SimpleTensor<T>> rows;
+        for (unsigned int step = 0; step <= decode_steps; ++step)
+        {
+            const unsigned int num_rows = (step == 0) ? prefill_length : 1U;
+            rows.emplace_back(TensorShape(info.head_dim(), num_rows, batches), data_type);
+            fill(rows.back(), 1 + step);
+        }
+
+        return reference::kvcache_matmul<T>(lhs, rows, info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_KVCACHEMATMULFIXTURE_H
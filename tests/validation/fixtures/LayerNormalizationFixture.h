@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMALIZATIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMALIZATIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/LayerNormalization.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture for a layer normalization, optionally fused with a residual addition and an output quantization
+ *
+ * When the residual is enabled, both the normalized tensor and the sum of the source and the residual are checked.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TOut = T>
+class LayerNormalizationValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape            shape,
+               DataType               data_type,
+               LayerNormalizationType type,
+               bool                   has_affine,
+               bool                   has_residual,
+               DataType               output_data_type)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const LayerNormalizationInfo info(type);
+        const QuantizationInfo       oq_info =
+            is_data_type_quantized(output_data_type) ? QuantizationInfo(1.f / 16, 10) : QuantizationInfo();
+
+        compute_target(shape, data_type, info, has_affine, has_residual, output_data_type, oq_info);
+        compute_reference(shape, data_type, info, has_affine, has_residual, oq_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed, float min, float max)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{min, max};
+                library->fill(tensor, distribution, seed);
+                break;
+            }
+            case DataType::BFLOAT16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<bfloat16> distribution{min, max};
+                library->fill(tensor, distribution, seed);
+                break;
+            }
+            default:
+            {
+                std::uniform_real_distribution<float> distribution(min, max);
+                library->fill(tensor, distribution, seed);
+                break;
+            }
+        }
+    }
+
+    void compute_target(const TensorShape            &shape,
+                        DataType                      data_type,
+                        const LayerNormalizationInfo &info,
+                        bool                          has_affine,
+                        bool                          has_residual,
+                        DataType                      output_data_type,
+                        const QuantizationInfo       &oq_info)
+    {
+        const TensorShape param_shape(shape[0]);
+
+        // Create tensors
+        TensorType src      = create_tensor<TensorType>(shape, data_type);
+        TensorType residual = create_tensor<TensorType>(shape, data_type);
+        TensorType gamma    = create_tensor<TensorType>(param_shape, data_type);
+        TensorType beta     = create_tensor<TensorType>(param_shape, data_type);
+        TensorType dst      = create_tensor<TensorType>(shape, output_data_type, 1, oq_info);
+        TensorType sum;
+
+        // Create and configure function
+        FunctionType norm;
+        norm.configure(&src, has_affine ? &gamma : nullptr, has_affine ? &beta : nullptr, &dst, info,
+                       has_residual ? &residual : nullptr, has_residual ? &sum : nullptr);
+
+        // Allocate tensors
+        for (TensorType *tensor : {&src, &residual, &gamma, &beta, &dst, &sum})
+        {
+            if (tensor->info()->total_size() != 0)
+            {
+                tensor->allocator()->allocate();
+                ARM_COMPUTE_ASSERT(!tensor->info()->is_resizable());
+            }
+        }
+
+        // Fill tensors
+        fill(AccessorType(src), 0, -2.f, 2.f);
+        if (has_residual)
+        {
+            fill(AccessorType(residual), 1, -1.f, 1.f);
+        }
+        if (has_affine)
+        {
+            fill(AccessorType(gamma), 2, 0.5f, 1.5f);
+            fill(AccessorType(beta), 3, -0.5f, 0.5f);
+        }
+
+        // Compute function
+        norm.run();
+
+        _target = std::move(dst);
+        if (has_residual)
+        {
+            _target_sum = std::move(sum);
+        }
+    }
+
+    void compute_reference(const TensorShape            &shape,
+                           DataType                      data_type,
+                           const LayerNormalizationInfo &info,
+                           bool                          has_affine,
+                           bool                          has_residual,
+                           const QuantizationInfo       &oq_info)
+    {
+        const TensorShape param_shape(shape[0]);
+
+        // Create reference
+        SimpleTensor<T> src{shape, data_type};
+        SimpleTensor<T> gamma{param_shape, data_type};
+        SimpleTensor<T> beta{param_shape, data_type};
+
+        // Fill reference
+        fill(src, 0, -2.f, 2.f);
+        if (has_residual)
+        {
+            SimpleTensor<T> residual{shape, data_type};
+            fill(residual, 1, -1.f, 1.f);
+            for (int i = 0; i < src.num_elements(); ++i)
+            {
+                src[i] = static_cast<T>(static_cast<float>(src[i]) + static_cast<float>(residual[i]));
+            }
+            _reference_sum = src;
+        }
+        if (has_affine)
+        {
+            fill(gamma, 2, 0.5f, 1.5f);
+            fill(beta, 3, -0.5f, 0.5f);
+        }
+        else
+        {
+            for (int i = 0; i < gamma.num_elements(); ++i)
+            {
+                gamma[i] = static_cast<T>(1.f);
+                beta[i]  = static_cast<T>(0.f);
+            }
+        }
+
+        _reference = reference::layer_normalization<T, TOut>(src, gamma, beta, info, oq_info);
+    }
+
+    TensorType         _target{};
+    TensorType         _target_sum{};
+    SimpleTensor<TOut> _reference{};
+    SimpleTensor<T>    _reference_sum{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMALIZATIONFIXTURE_H
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_LOOKUPTABLEACTIVATIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_LOOKUPTABLEACTIVATIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/LookupTableActivationInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+
+#include <cmath>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Scalar functions applied through a lookup table by the tests
+ *
+ * @param[in] name One of "GeluTanh", "Silu", "Mish" or "Custom".
+ *
+ * @return the scalar function
+ */
+inline LookupTableActivationInfo::Function lookup_table_test_function(const std::string &name)
+{
+    if (name == "GeluTanh")
+    {
+        return [](float x) { return 0.5f * x * (1.f + std::tanh(0.7978845608f * (x + 0.044715f * x * x * x))); };
+    }
+    if (name == "Silu")
+    {
+        return [](float x) { return x / (1.f + std::exp(-x)); };
+    }
+    if (name == "Mish")
+    {
+        return [](float x) { return x * std::tanh(std::log1p(std::exp(x))); };
+    }
+    // A function with no built-in activation counterpart
+    return [](float x) { return std::sin(x) * std::exp(-0.1f * x * x); };
+}
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LookupTableActivationValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape      shape,
+               std::string      function_name,
+               DataType         data_type,
+               QuantizationInfo src_qinfo,
+               QuantizationInfo dst_qinfo,
+               bool             in_place)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        // The destination of an in-place computation is the source
+        const QuantizationInfo out_qinfo = in_place ? src_qinfo : dst_qinfo;
+        const auto             function  = lookup_table_test_function(function_name);
+
+        compute_target(shape, function, data_type, src_qinfo, out_qinfo, in_place);
+        compute_reference(shape, function, data_type, src_qinfo, out_qinfo);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        if (tensor.data_type() == DataType::F16)
+        {
+            arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-8.0f, 8.0f};
+            library->fill(tensor, distribution, 0);
+        }
+        else
+        {
+            // Every quantized value
+            library->fill_tensor_uniform(tensor, 0);
+        }
+    }
+
+    void compute_target(const TensorShape                         &shape,
+                        const LookupTableActivationInfo::Function &function,
+                        DataType                                   data_type,
+                        QuantizationInfo                           src_qinfo,
+                        QuantizationInfo                           dst_qinfo,
+                        bool                                       in_place)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(shape, data_type, 1, src_qinfo);
+        TensorType dst = create_tensor<TensorType>(shape, data_type, 1, dst_qinfo);
+
+        // Create and configure function
+        FunctionType act;
+        act.configure(&src, in_place ? nullptr : &dst, LookupTableActivationInfo(function));
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        if (!in_place)
+        {
+            dst.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+        }
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        act.run();
+
+        _target = in_place ? std::move(src) : std::move(dst);
+    }
+
+    void compute_reference(const TensorShape                         &shape,
+                           const LookupTableActivationInfo::Function &function,
+                           DataType                                   data_type,
+                           QuantizationInfo                           src_qinfo,
+                           QuantizationInfo                           dst_qinfo)
+    {
+        // Create reference
+        SimpleTensor<T> src{shape, data_type, 1, src_qinfo};
+
+        // Fill reference
+        fill(src);
+
+        _reference = SimpleTensor<T>{shape, data_type, 1, dst_qinfo};
+
+        const UniformQuantizationInfo qi_in  = src_qinfo.uniform();
+        const UniformQuantizationInfo qi_out = dst_qinfo.uniform();
+        for (int i = 0; i < src.num_elements(); ++i)
+        {
+            switch (data_type)
+            {
+                case DataType::QASYMM8:
+                    _reference[i] = quantize_qasymm8(function(dequantize_qasymm8(src[i], qi_in)), qi_out);
+                    break;
+                case DataType::QASYMM8_SIGNED:
+                    _reference[i] =
+                        quantize_qasymm8_signed(function(dequantize_qasymm8_signed(src[i], qi_in)), qi_out);
+                    break;
+                default:
+                    _reference[i] = static_cast<T>(function(static_cast<float>(src[i])));
+                    break;
+            }
+        }
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_LOOKUPTABLEACTIVATIONFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "tests/validation/reference/ScatterLayer.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <random>
 
@@ -76,15 +77,16 @@ public:
     }
 
 protected:
+    // Factors of a multiplication are kept close to one so that products of many duplicates stay in range.
     template <typename U>
-    void fill(U &&tensor, int i)
+    void fill(U &&tensor, int i, bool factors = false)
     {
         switch (tensor.data_type())
         {
             case DataType::F32:
             case DataType::F16:
             {
-                std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+                std::uniform_real_distribution<float> distribution(factors ? 0.9f : -10.f, factors ? 1.1f : 10.f);
                 library->fill(tensor, distribution, i);
                 break;
             }
@@ -92,7 +94,7 @@ protected:
             case DataType::S16:
             case DataType::S8:
             {
-                std::uniform_int_distribution<int32_t> distribution(-100, 100);
+                std::uniform_int_distribution<int32_t> distribution(factors ? -1 : -100, factors ? 1 : 100);
                 library->fill(tensor, distribution, i);
                 break;
             }
@@ -100,7 +102,7 @@ protected:
             case DataType::U16:
             case DataType::U8:
             {
-                std::uniform_int_distribution<uint32_t> distribution(0, 200);
+                std::uniform_int_distribution<uint32_t> distribution(factors ? 1 : 0, factors ? 2 : 200);
                 library->fill(tensor, distribution, i);
                 break;
             }
@@ -117,7 +119,7 @@ protected:
     void fill_indices(U &&tensor, int i, const TensorShape &shape)
     {
         // Calculate max indices the shape should contain. Add an arbitrary value to allow testing for some out of bounds values (In this case min dimension)
-        const int32_t max = std::min({shape[0], shape[1], shape[2]}) + 1;
+        const int32_t max = (_max_index >= 0) ? _max_index : std::min({shape[0], shape[1], shape[2]}) + 1;
         library->fill_tensor_uniform(tensor, i, static_cast<int32_t>(0), static_cast<int32_t>(max));
     }
 
@@ -198,7 +200,7 @@ protected:
 
         // Fill update (a) and indices (b) tensors.
         fill(AccessorType(src), 0 + _hash);
-        fill(AccessorType(updates), 1 + _hash);
+        fill(AccessorType(updates), 1 + _hash, info.func == ScatterFunction::Mul);
         fill_indices(AccessorType(indices), 2 + _hash, out_shape);
 
         scatter.run();
@@ -251,7 +253,7 @@ protected:
 
         // Fill reference
         fill(src, 0 + _hash);
-        fill(updates, 1 + _hash);
+        fill(updates, 1 + _hash, info.func == ScatterFunction::Mul);
         fill_indices(indices, 2 + _hash, out_shape);
 
         // Calculate individual reference using collapsed shapes
@@ -261,6 +263,7 @@ protected:
     TensorType      _target{};
     SimpleTensor<T> _reference{};
     int32_t         _hash{};
+    int32_t         _max_index{-1}; // Largest index to draw, derived from the output shape when negative
 };
 
 // This fixture will use the same shape for updates as indices.
@@ -284,6 +287,30 @@ public:
     }
 };
 
+// This fixture scatters updates into a fixed number of destinations along the highest dimension of the output, so the
+// collision rate is controlled by the number of updates per destination.
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ScatterReduceValidationFixture : public ScatterGenericValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape     out_shape,
+               unsigned int    num_updates,
+               unsigned int    num_destinations,
+               DataType        data_type,
+               ScatterFunction func,
+               bool            padding)
+    {
+        const size_t index_dim     = out_shape.num_dimensions() - 1;
+        TensorShape  updates_shape = out_shape;
+        updates_shape.set(index_dim, num_updates);
+
+        this->_max_index = static_cast<int32_t>(std::min<size_t>(num_destinations, out_shape[index_dim])) - 1;
+        ScatterGenericValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            out_shape, updates_shape, TensorShape(1U, num_updates), out_shape, data_type, ScatterInfo(func, false),
+            false, padding, QuantizationInfo(), QuantizationInfo());
+    }
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
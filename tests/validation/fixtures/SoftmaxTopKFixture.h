@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_SOFTMAXTOPKFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_SOFTMAXTOPKFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/SoftmaxLayer.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class SoftmaxTopKValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type, unsigned int k, float beta)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        compute_target(shape, data_type, k, beta);
+        compute_reference(shape, data_type, k, beta);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        if (tensor.data_type() == DataType::F32)
+        {
+            std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+            library->fill(tensor, distribution, 0);
+        }
+        else
+        {
+            arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-10.0f, 10.0f};
+            library->fill(tensor, distribution, 0);
+        }
+    }
+
+    void compute_target(const TensorShape &shape, DataType data_type, unsigned int k, float beta)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(shape, data_type);
+        TensorType values;
+        TensorType indices;
+
+        // Create and configure function
+        FunctionType softmax_topk;
+        softmax_topk.configure(&src, &values, &indices, k, beta);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(values.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(indices.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        values.allocator()->allocate();
+        indices.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!values.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!indices.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        softmax_topk.run();
+
+        _target_values  = std::move(values);
+        _target_indices = std::move(indices);
+    }
+
+    void compute_reference(const TensorShape &shape, DataType data_type, unsigned int k, float beta)
+    {
+        // Create reference
+        SimpleTensor<T> src{shape, data_type};
+
+        // Fill reference
+        fill(src);
+
+        const SimpleTensor<T> probabilities = reference::softmax_layer<T>(src, beta, 0);
+
+        TensorShape out_shape = shape;
+        out_shape.set(0, k);
+        _reference_values  = SimpleTensor<T>{out_shape, data_type};
+        _reference_indices = SimpleTensor<uint32_t>{out_shape, DataType::U32};
+
+        // Rank every row by logit, lowest index first on ties
+        const int        width    = shape[0];
+        const int        num_rows = shape.total_size() / width;
+        std::vector<int> order(width);
+        for (int row = 0; row < num_rows; ++row)
+        {
+            const T *logits = src.data() + row * width;
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return logits[a] > logits[b]; });
+
+            for (unsigned int i = 0; i < k; ++i)
+            {
+                _reference_values[row * k + i]  = probabilities[row * width + order[i]];
+                _reference_indices[row * k + i] = static_cast<uint32_t>(order[i]);
+            }
+        }
+    }
+
+    TensorType             _target_values{};
+    TensorType             _target_indices{};
+    SimpleTensor<T>        _reference_values{};
+    SimpleTensor<uint32_t> _reference_indices{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_SOFTMAXTOPKFIXTURE_H
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_SPARSEFULLYCONNECTEDLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_SPARSEFULLYCONNECTEDLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture zeroing whole blocks of the weights so that about @p sparsity of them are empty */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class SparseFullyConnectedLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         input_shape,
+               unsigned int        num_outputs,
+               SparseBlockShape    block_shape,
+               float               sparsity,
+               bool                transpose_weights,
+               ActivationLayerInfo act_info,
+               DataType            data_type)
+    {
+        _info.activation_info   = act_info;
+        _info.transpose_weights = transpose_weights;
+        _info.block_shape       = block_shape;
+
+        const TensorShape weights_shape(input_shape.x(), num_outputs);
+        const TensorShape output_shape(num_outputs, input_shape.y());
+
+        // Reference weights are [K, N], i.e. one row of K values per output channel
+        SimpleTensor<T> weights{weights_shape, data_type};
+        fill(weights, 1);
+        const bool expect_dense = sparsify(weights, sparsity);
+
+        _target    = compute_target(input_shape, weights, output_shape, data_type, expect_dense);
+        _reference = compute_reference(input_shape, weights, output_shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    unsigned int block_height() const
+    {
+        return (_info.block_shape == SparseBlockShape::Block1x4) ? 1U
+               : (_info.block_shape == SparseBlockShape::Block4x4) ? 4U
+                                                                   : 8U;
+    }
+
+    unsigned int block_width() const
+    {
+        return (_info.block_shape == SparseBlockShape::Block8x1) ? 1U : 4U;
+    }
+
+    /** Zero random blocks and return whether the function is expected to use its dense path */
+    bool sparsify(SimpleTensor<T> &weights, float sparsity)
+    {
+        const unsigned int num_inputs  = weights.shape().x();
+        const unsigned int num_outputs = weights.shape().y();
+
+        std::mt19937                mt(library->seed());
+        std::bernoulli_distribution drop(sparsity);
+
+        unsigned int nonzero_blocks = 0;
+        unsigned int total_blocks   = 0;
+        for (unsigned int n = 0; n < num_outputs; n += block_height())
+        {
+            for (unsigned int k = 0; k < num_inputs; k += block_width())
+            {
+                ++total_blocks;
+                if (!drop(mt))
+                {
+                    ++nonzero_blocks;
+                    continue;
+                }
+                for (unsigned int r = 0; r < block_height(); ++r)
+                {
+                    for (unsigned int c = 0; c < block_width(); ++c)
+                    {
+                        weights[(n + r) * num_inputs + k + c] = T(0);
+                    }
+                }
+            }
+        }
+        return nonzero_blocks > _info.max_density * total_blocks;
+    }
+
+    TensorType compute_target(const TensorShape     &input_shape,
+                              const SimpleTensor<T> &ref_weights,
+                              const TensorShape     &output_shape,
+                              DataType               data_type,
+                              bool                   expect_dense)
+    {
+        const unsigned int num_inputs  = input_shape.x();
+        const unsigned int num_outputs = output_shape.x();
+
+        const TensorShape weights_shape =
+            _info.transpose_weights ? TensorShape(num_inputs, num_outputs) : TensorShape(num_outputs, num_inputs);
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights = create_tensor<TensorType>(weights_shape, data_type);
+        TensorType bias    = create_tensor<TensorType>(TensorShape(num_outputs), data_type);
+        TensorType dst     = create_tensor<TensorType>(output_shape, data_type);
+
+        FunctionType fc;
+        fc.configure(&src, &weights, &bias, &dst, _info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        fill(AccessorType(src), 0);
+        fill(AccessorType(bias), 2);
+
+        AccessorType weights_accessor(weights);
+        for (unsigned int n = 0; n < num_outputs; ++n)
+        {
+            for (unsigned int k = 0; k < num_inputs; ++k)
+            {
+                const Coordinates coord = _info.transpose_weights ? Coordinates(k, n) : Coordinates(n, k);
+                *reinterpret_cast<T *>(weights_accessor(coord)) = ref_weights[n * num_inputs + k];
+            }
+        }
+
+        fc.run();
+
+        ARM_COMPUTE_EXPECT(fc.uses_dense_fallback() == expect_dense, framework::LogLevel::ERRORS);
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape     &input_shape,
+                                      const SimpleTensor<T> &weights,
+                                      const TensorShape     &output_shape,
+                                      DataType               data_type)
+    {
+        SimpleTensor<T> src{input_shape, data_type};
+        SimpleTensor<T> bias{TensorShape(output_shape.x()), data_type};
+
+        fill(src, 0);
+        fill(bias, 2);
+
+        return reference::activation_layer(reference::fully_connected_layer<T>(src, weights, bias, output_shape),
+                                           _info.activation_info);
+    }
+
+    TensorType                    _target{};
+    SimpleTensor<T>               _reference{};
+    SparseFullyConnectedLayerInfo _info{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_SPARSEFULLYCONNECTEDLAYERFIXTURE_H
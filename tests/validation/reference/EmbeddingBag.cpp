@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "EmbeddingBag.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T, typename TOut>
+SimpleTensor<TOut> embedding_bag(const SimpleTensor<T>       &table,
+                                 const SimpleTensor<int32_t> &indices,
+                                 const SimpleTensor<int32_t> &offsets,
+                                 const SimpleTensor<float>   &scales,
+                                 const EmbeddingBagInfo      &info)
+{
+    const int      dim         = table.shape()[0];
+    const int      num_rows    = table.shape()[1];
+    const int      num_indices = indices.num_elements();
+    const int      num_bags    = offsets.num_elements();
+    const DataType dst_type    = table.data_type() == DataType::S8 ? DataType::F32 : table.data_type();
+
+    SimpleTensor<TOut> dst{TensorShape(dim, num_bags), dst_type, 1};
+    for (int bag = 0; bag < num_bags; ++bag)
+    {
+        const int begin = std::min(std::max(offsets[bag], 0), num_indices);
+        const int end   = bag + 1 < num_bags ? std::min(std::max(offsets[bag + 1], begin), num_indices) : num_indices;
+        for (int x = 0; x < dim; ++x)
+        {
+            double acc = 0.0;
+            for (int pos = begin; pos < end; ++pos)
+            {
+                const int row = indices[pos];
+                if (row >= 0 && row < num_rows)
+                {
+                    acc += static_cast<double>(scales[row]) * static_cast<float>(table[row * dim + x]);
+                }
+            }
+            if (info.mode == EmbeddingBagMode::Mean && end > begin)
+            {
+                acc /= end - begin;
+            }
+            dst[bag * dim + x] = static_cast<TOut>(acc);
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> embedding_bag(const SimpleTensor<float>   &table,
+                                           const SimpleTensor<int32_t> &indices,
+                                           const SimpleTensor<int32_t> &offsets,
+                                           const SimpleTensor<float>   &scales,
+                                           const EmbeddingBagInfo      &info);
+template SimpleTensor<half>  embedding_bag(const SimpleTensor<half>    &table,
+                                           const SimpleTensor<int32_t> &indices,
+                                           const SimpleTensor<int32_t> &offsets,
+                                           const SimpleTensor<float>   &scales,
+                                           const EmbeddingBagInfo      &info);
+template SimpleTensor<float> embedding_bag(const SimpleTensor<int8_t>  &table,
+                                           const SimpleTensor<int32_t> &indices,
+                                           const SimpleTensor<int32_t> &offsets,
+                                           const SimpleTensor<float>   &scales,
+                                           const EmbeddingBagInfo      &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_EMBEDDINGBAG_H
+#define ACL_TESTS_VALIDATION_REFERENCE_EMBEDDINGBAG_H
+
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Gather the rows of @p table selected by every bag and pool them
+ *
+ * @param[in] table   2D embedding table, one row along X per embedding.
+ * @param[in] indices 1D tensor of the rows to gather. Indices outside the table contribute zeros.
+ * @param[in] offsets 1D tensor of the first index of every bag.
+ * @param[in] scales  1D tensor of per-row scales, one per row of @p table.
+ * @param[in] info    Pooling applied to every bag.
+ *
+ * @return the pooled tensor, one row per bag
+ */
+template <typename T, typename TOut = T>
+SimpleTensor<TOut> embedding_bag(const SimpleTensor<T>       &table,
+                                 const SimpleTensor<int32_t> &indices,
+                                 const SimpleTensor<int32_t> &offsets,
+                                 const SimpleTensor<float>   &scales,
+                                 const EmbeddingBagInfo      &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_EMBEDDINGBAG_H
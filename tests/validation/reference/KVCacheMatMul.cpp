@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "KVCacheMatMul.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T>
+kvcache_matmul(const SimpleTensor<T> &lhs, const std::vector<SimpleTensor<T>> &rows, const KVCacheMatMulInfo &info)
+{
+    const unsigned int head_dim = info.head_dim();
+    const unsigned int batches  = lhs.shape()[2];
+
+    // Gather the appended chunks into a single [head_dim, length, batches] cache
+    unsigned int length = 0;
+    for (const auto &r : rows)
+    {
+        length += r.shape()[1];
+    }
+
+    std::vector<float> cache(head_dim * length * batches);
+    unsigned int       offset = 0;
+    for (const auto &r : rows)
+    {
+        const unsigned int num_rows = r.shape()[1];
+        for (unsigned int b = 0; b < batches; ++b)
+        {
+            for (unsigned int t = 0; t < num_rows; ++t)
+            {
+                for (unsigned int d = 0; d < head_dim; ++d)
+                {
+                    cache[(b * length + offset + t) * head_dim + d] =
+                        static_cast<float>(r[(b * num_rows + t) * head_dim + d]);
+                }
+            }
+        }
+        offset += num_rows;
+    }
+
+    if (info.operand() == KVCacheOperand::Key)
+    {
+        SimpleTensor<T> dst{TensorShape(info.max_length(), 1U, batches), lhs.data_type()};
+
+        for (unsigned int b = 0; b < batches; ++b)
+        {
+            for (unsigned int t = 0; t < info.max_length(); ++t)
+            {
+                float acc = -std::numeric_limits<float>::infinity();
+                if (t < length)
+                {
+                    acc = 0.f;
+                    for (unsigned int d = 0; d < head_dim; ++d)
+                    {
+                        acc += static_cast<float>(lhs[b * head_dim + d]) * cache[(b * length + t) * head_dim + d];
+                    }
+                    acc *= info.scale();
+                }
+                dst[b * info.max_length() + t] = static_cast<T>(acc);
+            }
+        }
+        return dst;
+    }
+
+    SimpleTensor<T> dst{TensorShape(head_dim, 1U, batches), lhs.data_type()};
+
+    for (unsigned int b = 0; b < batches; ++b)
+    {
+        for (unsigned int d = 0; d < head_dim; ++d)
+        {
+            float acc = 0.f;
+            for (unsigned int t = 0; t < length; ++t)
+            {
+                acc += static_cast<float>(lhs[b * info.max_length() + t]) * cache[(b * length + t) * head_dim + d];
+            }
+            dst[b * head_dim + d] = static_cast<T>(acc);
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float>
+kvcache_matmul(const SimpleTensor<float> &lhs, const std::vector<SimpleTensor<float>> &rows, const KVCacheMatMulInfo &info);
+template SimpleTensor<half>
+kvcache_matmul(const SimpleTensor<half> &lhs, const std::vector<SimpleTensor<half>> &rows, const KVCacheMatMulInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
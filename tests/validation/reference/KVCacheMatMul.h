@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_KVCACHEMATMUL_H
+#define ACL_TESTS_VALIDATION_REFERENCE_KVCACHEMATMUL_H
+
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+
+#include "tests/SimpleTensor.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Reference for a decode step matrix multiplication against a key/value cache
+ *
+ * @param[in] lhs  Query of shape [head_dim, 1, batches] or weights of shape [max_length, 1, batches].
+ * @param[in] rows Chunks of cache rows of shape [head_dim, num_rows, batches], in the order they were appended.
+ * @param[in] info Cache information.
+ *
+ * @return the scores of shape [max_length, 1, batches] or the output of shape [head_dim, 1, batches]
+ */
+template <typename T>
+SimpleTensor<T>
+kvcache_matmul(const SimpleTensor<T> &lhs, const std::vector<SimpleTensor<T>> &rows, const KVCacheMatMulInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_KVCACHEMATMUL_H
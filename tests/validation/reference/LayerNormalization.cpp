@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "LayerNormalization.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T, typename TOut>
+SimpleTensor<TOut> layer_normalization(const SimpleTensor<T>        &src,
+                                       const SimpleTensor<T>        &gamma,
+                                       const SimpleTensor<T>        &beta,
+                                       const LayerNormalizationInfo &info,
+                                       const QuantizationInfo       &oq_info)
+{
+    ARM_COMPUTE_UNUSED(oq_info);
+
+    SimpleTensor<TOut> dst{src.shape(), src.data_type(), 1};
+    const int          width    = src.shape()[0];
+    const int          num_rows = src.num_elements() / width;
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const int offset = row * width;
+
+        double sum    = 0.0;
+        double sum_sq = 0.0;
+        for (int x = 0; x < width; ++x)
+        {
+            const double value = static_cast<float>(src[offset + x]);
+            sum += value;
+            sum_sq += value * value;
+        }
+
+        double mean = 0.0;
+        double var  = sum_sq / width;
+        if (info.type == LayerNormalizationType::LayerNorm)
+        {
+            mean = sum / width;
+            var  = std::max(var - mean * mean, 0.0);
+        }
+        const double rstd = 1.0 / std::sqrt(var + info.epsilon);
+
+        for (int x = 0; x < width; ++x)
+        {
+            const double value = static_cast<float>(src[offset + x]);
+            const double res   = (value - mean) * rstd * static_cast<float>(gamma[x]) + static_cast<float>(beta[x]);
+            dst[offset + x]    = static_cast<TOut>(static_cast<float>(res));
+        }
+    }
+    return dst;
+}
+
+template <>
+SimpleTensor<uint8_t> layer_normalization(const SimpleTensor<float>    &src,
+                                          const SimpleTensor<float>    &gamma,
+                                          const SimpleTensor<float>    &beta,
+                                          const LayerNormalizationInfo &info,
+                                          const QuantizationInfo       &oq_info)
+{
+    const SimpleTensor<float> dst_tmp = layer_normalization<float, float>(src, gamma, beta, info);
+    return convert_to_asymmetric<uint8_t>(dst_tmp, oq_info);
+}
+
+template <>
+SimpleTensor<int8_t> layer_normalization(const SimpleTensor<float>    &src,
+                                         const SimpleTensor<float>    &gamma,
+                                         const SimpleTensor<float>    &beta,
+                                         const LayerNormalizationInfo &info,
+                                         const QuantizationInfo       &oq_info)
+{
+    const SimpleTensor<float> dst_tmp = layer_normalization<float, float>(src, gamma, beta, info);
+    return convert_to_asymmetric<int8_t>(dst_tmp, oq_info);
+}
+
+template SimpleTensor<float> layer_normalization(const SimpleTensor<float>    &src,
+                                                 const SimpleTensor<float>    &gamma,
+                                                 const SimpleTensor<float>    &beta,
+                                                 const LayerNormalizationInfo &info,
+                                                 const QuantizationInfo       &oq_info);
+template SimpleTensor<half>  layer_normalization(const SimpleTensor<half>     &src,
+                                                 const SimpleTensor<half>     &gamma,
+                                                 const SimpleTensor<half>     &beta,
+                                                 const LayerNormalizationInfo &info,
+                                                 const QuantizationInfo       &oq_info);
+template SimpleTensor<bfloat16> layer_normalization(const SimpleTensor<bfloat16> &src,
+                                                    const SimpleTensor<bfloat16> &gamma,
+                                                    const SimpleTensor<bfloat16> &beta,
+                                                    const LayerNormalizationInfo &info,
+                                                    const QuantizationInfo       &oq_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
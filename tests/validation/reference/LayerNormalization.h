@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMALIZATION_H
+#define ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMALIZATION_H
+
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Normalize every row along X of @p src, then scale it by @p gamma and shift it by @p beta
+ *
+ * @param[in] src     Source tensor.
+ * @param[in] gamma   1D tensor of scales with the size of src's X dimension.
+ * @param[in] beta    1D tensor of offsets with the size of src's X dimension.
+ * @param[in] info    Normalization type and epsilon.
+ * @param[in] oq_info (Optional) Quantization info of the destination when TOut is quantized.
+ *
+ * @return the normalized tensor
+ */
+template <typename T, typename TOut = T>
+SimpleTensor<TOut> layer_normalization(const SimpleTensor<T>        &src,
+                                       const SimpleTensor<T>        &gamma,
+                                       const SimpleTensor<T>        &beta,
+                                       const LayerNormalizationInfo &info,
+                                       const QuantizationInfo       &oq_info = QuantizationInfo());
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMALIZATION_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,6 +58,9 @@ T reduce_op(const T &current, const T &update, const ScatterFunction func)
         case ScatterFunction::Min:
             return std::min(current, update);
             break;
+        case ScatterFunction::Mul:
+            return current * update;
+            break;
         default:
             ARM_COMPUTE_ERROR("Unsupported Scatter function");
             break;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,10 +38,14 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ConvolutionInfo.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
 #include "arm_compute/function_info/FullyConnectedLayerInfo.h"
 #include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/function_info/KVCacheMatMulInfo.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
 #include "arm_compute/function_info/MatMulInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
+#include "arm_compute/function_info/SparseFullyConnectedLayerInfo.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
 #include "arm_compute/runtime/CL/CLTypes.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
@@ -3191,6 +3195,7 @@ inline std::string to_string(const WeightFormat wf)
     {
         __CASE_WEIGHT_FORMAT(UNSPECIFIED)
         __CASE_WEIGHT_FORMAT(ANY)
+        __CASE_WEIGHT_FORMAT(SPARSE_2_4)
         __CASE_WEIGHT_FORMAT(OHWI)
         __CASE_WEIGHT_FORMAT(OHWIo2)
         __CASE_WEIGHT_FORMAT(OHWIo4)
@@ -3403,6 +3408,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const ScatterFunction &fun
         case ScatterFunction::Min:
             os << "MIN";
             break;
+        case ScatterFunction::Mul:
+            os << "MUL";
+            break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }
@@ -3448,6 +3456,153 @@ inline std::string to_string(const arm_compute::ScatterInfo &info)
     return str.str();
 }
 
+/** Formatted output of the arm_compute::KVCacheOperand type.
+ *
+ * @param[out] os      Output stream.
+ * @param[in]  operand arm_compute::KVCacheOperand type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const KVCacheOperand &operand)
+{
+    switch (operand)
+    {
+        case KVCacheOperand::Key:
+            os << "Key";
+            break;
+        case KVCacheOperand::Value:
+            os << "Value";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+
+/** Formatted output of the arm_compute::KVCacheOperand type.
+ *
+ * @param[in] operand arm_compute::KVCacheOperand type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const KVCacheOperand &operand)
+{
+    std::stringstream str;
+    str << operand;
+    return str.str();
+}
+
+/** Formatted output of the arm_compute::SparseBlockShape type.
+ *
+ * @param[out] os    Output stream.
+ * @param[in]  shape arm_compute::SparseBlockShape type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const SparseBlockShape &shape)
+{
+    switch (shape)
+    {
+        case SparseBlockShape::Block1x4:
+            os << "1x4";
+            break;
+        case SparseBlockShape::Block4x4:
+            os << "4x4";
+            break;
+        case SparseBlockShape::Block8x1:
+            os << "8x1";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+
+/** Formatted output of the arm_compute::SparseBlockShape type.
+ *
+ * @param[in] shape arm_compute::SparseBlockShape type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const SparseBlockShape &shape)
+{
+    std::stringstream str;
+    str << shape;
+    return str.str();
+}
+
+/** Formatted output of the arm_compute::LayerNormalizationType type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  type arm_compute::LayerNormalizationType type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const LayerNormalizationType &type)
+{
+    switch (type)
+    {
+        case LayerNormalizationType::LayerNorm:
+            os << "LayerNorm";
+            break;
+        case LayerNormalizationType::RMSNorm:
+            os << "RMSNorm";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+
+/** Formatted output of the arm_compute::LayerNormalizationType type.
+ *
+ * @param[in] type arm_compute::LayerNormalizationType type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const LayerNormalizationType &type)
+{
+    std::stringstream str;
+    str << type;
+    return str.str();
+}
+
+/** Formatted output of the arm_compute::EmbeddingBagMode type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  mode arm_compute::EmbeddingBagMode type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const EmbeddingBagMode &mode)
+{
+    switch (mode)
+    {
+        case EmbeddingBagMode::Sum:
+            os << "Sum";
+            break;
+        case EmbeddingBagMode::Mean:
+            os << "Mean";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+
+/** Formatted output of the arm_compute::EmbeddingBagMode type.
+ *
+ * @param[in] mode arm_compute::EmbeddingBagMode type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const EmbeddingBagMode &mode)
+{
+    std::stringstream str;
+    str << mode;
+    return str.str();
+}
+
 /** Formatted output of the bool data type.
  *
  * @param[in] info bool type to output.